@@ -5,6 +5,8 @@
 #include <sys/stat.h>
 extern "C" {
 #include "can_api.h"
+#include "pcan_db.h"
+#include "bcan_db.h"
 }
 
 #include <sys/types.h>
@@ -25,42 +27,42 @@ static const QString kSock = "/tmp/dcu.demo.sock";
 // 모든 IPC 클라이언트 관리 (브로드캐스트용)
 static QSet<IpcConnection*> g_clients;
 static constexpr int kPowerApplyAckDelayMs = 10000; // 10초
-// ── 메시지 ID (표 기준) ──────────────────────────────────────────────────────
+// ── 메시지 ID (pcan.dbc / bcan.dbc에서 생성된 헤더 기준) ─────────────────────
 // Body CAN (DCU -> Power*)
-static constexpr uint32_t ID_DCU_SEAT_ORDER   = 0x101; // DLC 4 (→ can1 TX)
-static constexpr uint32_t ID_DCU_MIRROR_ORDER = 0x102; // DLC 6 (→ can1 TX)
-static constexpr uint32_t ID_DCU_WHEEL_ORDER  = 0x103; // DLC 2 (→ can1 TX)
+static constexpr uint32_t ID_DCU_SEAT_ORDER   = BCAN_DCU_SEAT_ORDER_ID;   // (→ can1 TX)
+static constexpr uint32_t ID_DCU_MIRROR_ORDER = BCAN_DCU_MIRROR_ORDER_ID; // (→ can1 TX)
+static constexpr uint32_t ID_DCU_WHEEL_ORDER  = BCAN_DCU_WHEEL_ORDER_ID;  // (→ can1 TX)
 // Power* -> DCU (20ms) (← can1 RX)
-static constexpr uint32_t ID_POW_SEAT_STATE   = 0x201; // DLC 5(+flags)
-static constexpr uint32_t ID_POW_MIRROR_STATE = 0x202; // DLC 7
-static constexpr uint32_t ID_POW_WHEEL_STATE  = 0x203; // DLC 3
+static constexpr uint32_t ID_POW_SEAT_STATE   = BCAN_POW_SEAT_STATE_ID;
+static constexpr uint32_t ID_POW_MIRROR_STATE = BCAN_POW_MIRROR_STATE_ID;
+static constexpr uint32_t ID_POW_WHEEL_STATE  = BCAN_POW_WHEEL_STATE_ID;
 
 // SCA/TCU 영역 (인증/프로필) (can0 TX/RX)
-static constexpr uint32_t ID_DCU_RESET                          = 0x001; // DLC 1
-static constexpr uint32_t ID_DCU_RESET_ACK                      = 0x002; // DLC 2
-static constexpr uint32_t ID_DCU_TCU_DRIVE_CMD                  = 0x005; // DLC 1  (drive:1, stop:0)
-static constexpr uint32_t ID_DCU_SCA_USER_FACE_REQ              = 0x101; // DLC 1
-static constexpr uint32_t ID_SCA_DCU_AUTH_STATE                 = 0x103; // DLC 2
-static constexpr uint32_t ID_SCA_DCU_AUTH_RESULT                = 0x112; // DLC 8
-static constexpr uint32_t ID_SCA_DCU_AUTH_RESULT_ADD            = 0x113; // DLC 8
-static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_REQ           = 0x201; // DLC 1
-static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_SEAT          = 0x202; // DLC 4
-static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_MIRROR        = 0x203; // DLC 6
-static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_WHEEL         = 0x204; // DLC 2
-static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_ACK           = 0x205; // DLC 2
-static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_SEAT_UPDATE   = 0x206; // DLC4
-static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_MIRROR_UPDATE = 0x207; // DLC6
-static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_WHEEL_UPDATE  = 0x208; // DLC2
-static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_UPDATE_ACK    = 0x209; // DLC2
+static constexpr uint32_t ID_DCU_RESET                          = PCAN_DCU_RESET_ID;
+static constexpr uint32_t ID_DCU_RESET_ACK                      = PCAN_DCU_RESET_ACK_ID;
+static constexpr uint32_t ID_DCU_TCU_DRIVE_CMD                  = PCAN_DCU_SCA_DRIVE_STATUS_ID; // (drive:1, stop:0)
+static constexpr uint32_t ID_DCU_SCA_USER_FACE_REQ              = PCAN_DCU_SCA_USER_FACE_REQ_ID;
+static constexpr uint32_t ID_SCA_DCU_AUTH_STATE                 = PCAN_SCA_DCU_AUTH_STATE_ID;
+static constexpr uint32_t ID_SCA_DCU_AUTH_RESULT                = PCAN_SCA_DCU_AUTH_RESULT_ID;
+static constexpr uint32_t ID_SCA_DCU_AUTH_RESULT_ADD            = PCAN_SCA_DCU_AUTH_RESULT_ADD_ID;
+static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_REQ           = PCAN_DCU_TCU_USER_PROFILE_REQ_ID;
+static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_SEAT          = PCAN_TCU_DCU_USER_PROFILE_SEAT_ID;
+static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_MIRROR        = PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID;
+static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_WHEEL         = PCAN_TCU_DCU_USER_PROFILE_WHEEL_ID;
+static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_ACK           = PCAN_DCU_TCU_USER_PROFILE_ACK_ID;
+static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_SEAT_UPDATE   = PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_ID;
+static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_MIRROR_UPDATE = PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_ID;
+static constexpr uint32_t ID_DCU_TCU_USER_PROFILE_WHEEL_UPDATE  = PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_ID;
+static constexpr uint32_t ID_TCU_DCU_USER_PROFILE_UPDATE_ACK    = PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_ID;
 
 static constexpr uint32_t ID_CAN_SYSTEM_WARNING = 0x003;
 static constexpr uint32_t ID_CAN_SYSTEM_START   = 0x600;
 
 // ── 버튼 메시지 상수 (주기 송신) ─────────────────────────────────────────────
 static constexpr int kBtnTxPeriodMs = 50; // 20Hz 기본
-static constexpr uint32_t ID_DCU_SEAT_BUTTON   = 0x301; // DLC 4
-static constexpr uint32_t ID_DCU_MIRROR_BUTTON = 0x302; // DLC 6
-static constexpr uint32_t ID_DCU_WHEEL_BUTTON  = 0x303; // DLC 2
+static constexpr uint32_t ID_DCU_SEAT_BUTTON   = BCAN_DCU_SEAT_BUTTON_ID;
+static constexpr uint32_t ID_DCU_MIRROR_BUTTON = BCAN_DCU_MIRROR_BUTTON_ID;
+static constexpr uint32_t ID_DCU_WHEEL_BUTTON  = BCAN_DCU_WHEEL_BUTTON_ID;
 
 // ── 내부 상태(IPC <-> CAN 공유 변수) ─────────────────────────────────────────
 static int m_seatPosition     = 20;   // 0~100 (%)
@@ -84,8 +86,12 @@ static bool g_profMirrorOK = false;
 static bool g_profWheelOK = false;
 
 // 구독 ID (종료 시 해제용)
-static int g_canSubPowId = 0; // can1 (Power*)
+static int g_canSubPowId = 0; // can1 (Power*) — 변화 구독을 못 쓸 때만
+static int g_canSubPowWatch[3] = {0, 0, 0}; // can1 (Power*) 변화 구독: seat, mirror, wheel
+static int g_canPowPeriod[3]   = {0, 0, 0}; // can1 (Power*) 주기 감시 (전체 구독일 때만): seat, mirror, wheel
 static int g_canSubScaId = 0; // can0 (SCA/TCU)
+static CanChannel* g_can0 = nullptr; // SCA/TCU
+static CanChannel* g_can1 = nullptr; // Power*
 
 // ── 전역에 추가(인증/프로필/유저) ───────────────────────────────────────────
 static QString g_lastAuthReqId;
@@ -226,7 +232,7 @@ static void CAN_Tx_SEAT_ORDER() {
     f.data[3] = encPercent100(m_seatRearHeight);
     qInfo() << "[CAN1 TX] SEAT_ORDER id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 static void CAN_Tx_MIRROR_ORDER() {
     CanFrame f = mkFrame(ID_DCU_MIRROR_ORDER, 6);
@@ -238,7 +244,7 @@ static void CAN_Tx_MIRROR_ORDER() {
     f.data[5] = encAngle180_fromSigned(m_roomMirrorPitch,     90);
     qInfo() << "[CAN1 TX] MIRROR_ORDER id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 static void CAN_Tx_WHEEL_ORDER() {
     CanFrame f = mkFrame(ID_DCU_WHEEL_ORDER, 2);
@@ -246,7 +252,7 @@ static void CAN_Tx_WHEEL_ORDER() {
     f.data[1] = encAngle180_fromSigned(m_handleAngle, 90);
     qInfo() << "[CAN1 TX] WHEEL_ORDER id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 
 // → 버튼 상태 주기 송신 (can1)
@@ -255,21 +261,21 @@ static void CAN_Tx_SEAT_BUTTONS() {
     for (int i=0;i<4;++i) f.data[i] = g_btnSeat[i];
     qInfo() << "[CAN1 TX] SEAT_BUTTON id=0x" << QString::number(f.id,16).toUpper()
             << " dlc=" << f.dlc << " data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 static void CAN_Tx_MIRROR_BUTTONS() {
     CanFrame f = mkFrame(ID_DCU_MIRROR_BUTTON, 6);
     for (int i=0;i<6;++i) f.data[i] = g_btnMirror[i];
     qInfo() << "[CAN1 TX] MIRROR_BUTTON id=0x" << QString::number(f.id,16).toUpper()
             << " dlc=" << f.dlc << " data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 static void CAN_Tx_WHEEL_BUTTONS() {
     CanFrame f = mkFrame(ID_DCU_WHEEL_BUTTON, 2);
     for (int i=0;i<2;++i) f.data[i] = g_btnWheel[i];
     qInfo() << "[CAN1 TX] WHEEL_BUTTON id=0x" << QString::number(f.id,16).toUpper()
             << " dlc=" << f.dlc << " data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can1", f, 0);
+    can_send_h(g_can1, &f, 0);
 }
 
 // → SCA/TCU 로 가는 신호는 can0
@@ -278,7 +284,7 @@ static void CAN_Tx_USER_FACE_REQ() {
     f.data[0] = 1; // 트리거
     qInfo() << "[CAN0 TX] USER_FACE_REQ id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 static void CAN_Tx_USER_PROFILE_REQ() {
     CanFrame f = mkFrame(ID_DCU_TCU_USER_PROFILE_REQ, 1);
@@ -286,7 +292,7 @@ static void CAN_Tx_USER_PROFILE_REQ() {
     g_profSeatOK = g_profMirrorOK = g_profWheelOK = false;
     qInfo() << "[CAN0 TX] USER_PROFILE_REQ id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 static void CAN_Tx_USER_PROFILE_ACK(uint8_t index /*1:Seat,2:Mirror,3:Wheel*/, uint8_t state /*0:OK,1:Partial*/) {
     CanFrame f = mkFrame(ID_DCU_TCU_USER_PROFILE_ACK, 2);
@@ -294,7 +300,7 @@ static void CAN_Tx_USER_PROFILE_ACK(uint8_t index /*1:Seat,2:Mirror,3:Wheel*/, u
     f.data[1] = state;
     qInfo() << "[CAN0 TX] USER_PROFILE_ACK id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 static void CAN_Tx_USER_PROFILE_SEAT_UPDATE() {
     CanFrame f = mkFrame(ID_DCU_TCU_USER_PROFILE_SEAT_UPDATE, 4);
@@ -304,7 +310,7 @@ static void CAN_Tx_USER_PROFILE_SEAT_UPDATE() {
     f.data[3] = encPercent100(m_seatRearHeight);
     qInfo() << "[CAN0 TX] PROFILE_SEAT_UPDATE id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 static void CAN_Tx_USER_PROFILE_MIRROR_UPDATE() {
     CanFrame f = mkFrame(ID_DCU_TCU_USER_PROFILE_MIRROR_UPDATE, 6);
@@ -316,7 +322,7 @@ static void CAN_Tx_USER_PROFILE_MIRROR_UPDATE() {
     f.data[5] = encAngle180_fromSigned(m_roomMirrorPitch,     90);
     qInfo() << "[CAN0 TX] PROFILE_MIRROR_UPDATE id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 static void CAN_Tx_USER_PROFILE_WHEEL_UPDATE() {
     CanFrame f = mkFrame(ID_DCU_TCU_USER_PROFILE_WHEEL_UPDATE, 2);
@@ -324,21 +330,21 @@ static void CAN_Tx_USER_PROFILE_WHEEL_UPDATE() {
     f.data[1] = encAngle180_fromSigned(m_handleAngle, 90);
     qInfo() << "[CAN0 TX] PROFILE_WHEEL_UPDATE id=0x" << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 
 // ── CAN TX: RESET ───────────────────────────────────────────────────────────
-static void CAN_Tx_RESET_on(const char* bus) {
+static void CAN_Tx_RESET_on(CanChannel* ch, const char* bus) {
     CanFrame f = mkFrame(ID_DCU_RESET, 1);
     f.data[0] = 1; // 트리거
     qInfo() << "[" << bus << " TX] SYSTEM_RESET id=0x"
             << QString::number(f.id,16).toUpper()
             << "dlc=" << f.dlc << "data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send(bus, f, 0);
+    can_send_h(ch, &f, 0);
 }
 static void CAN_Tx_RESET_BOTH() {
-    CAN_Tx_RESET_on("can0");
-    CAN_Tx_RESET_on("can1");
+    CAN_Tx_RESET_on(g_can0, "can0");
+    CAN_Tx_RESET_on(g_can1, "can1");
 }
 
 // → SCA/TCU 로 가는 주행 상태 명령 (can0)
@@ -347,7 +353,7 @@ static void CAN_Tx_DRIVE_CMD(uint8_t v /* 1:drive, 0:stop */) {
     f.data[0] = v;
     qInfo() << "[CAN0 TX] DRIVE_CMD id=0x" << QString::number(f.id,16).toUpper()
             << " dlc=" << f.dlc << " data=[" << bytesToHex(f.data, f.dlc) << "]";
-    can_send("can0", f, 0);
+    can_send_h(g_can0, &f, 0);
 }
 
 // ── CAN RX (버스 구분은 ID로 충분하여 공용 콜백 사용) ───────────────────────
@@ -572,6 +578,96 @@ if (fr->id == ID_SCA_DCU_AUTH_STATE && fr->dlc >= 2) {
             << "dlc=" << fr->dlc << "data=[" << bytesToHex(fr->data, fr->dlc) << "]";
 }
 
+// Power* 상태 프레임은 20ms 주기 → 10주기 동안 안 오면 경고
+static constexpr uint32_t kPowStatePeriodMs  = 20;
+static constexpr uint32_t kPowStateTimeoutMs = 200;
+
+static void reportPowTimeout(uint32_t id) {
+    qWarning() << "[CAN1 RX] state timeout id=0x" << QString::number(id, 16).toUpper();
+    if (hasClients()) {
+        sendToAll([id](IpcConnection* c){
+            sendSystemWarning(c, "CAN_TIMEOUT", QString("no state frame 0x%1").arg(id, 3, 16, QLatin1Char('0')).toUpper());
+        });
+    }
+}
+
+static void reportPowRecovered(uint32_t id) {
+    qInfo() << "[CAN1 RX] state recovered id=0x" << QString::number(id, 16).toUpper();
+}
+
+// 주기 감시 스레드에서 불린다 (끊기면 한 번, 다시 들어오면 한 번) — 변화 구독을 못 쓸 때만
+static void onPowPeriod(uint32_t id, can_period_event_t ev, void* user) {
+    (void)user;
+    if (ev == CAN_PERIOD_RECOVERED) reportPowRecovered(id);
+    else                            reportPowTimeout(id);
+}
+
+// 전체 구독일 때 끊김 감시
+static bool watchPowPeriod() {
+    static const uint32_t pow[] = { ID_POW_SEAT_STATE, ID_POW_MIRROR_STATE, ID_POW_WHEEL_STATE };
+    const float tolerance = (float)kPowStateTimeoutMs / kPowStatePeriodMs - 1.0f;
+    for (size_t i = 0; i < sizeof(pow)/sizeof(pow[0]); ++i) {
+        if (can_watch_period("can1", &g_canPowPeriod[i], pow[i], kPowStatePeriodMs, tolerance, onPowPeriod, nullptr) != CAN_OK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 변화 구독의 끊김은 커널(BCM RX_SETUP 타임아웃)이 감시한다.
+// 타임아웃 뒤 첫 프레임은 값이 같아도 올라오므로 그걸로 복구를 알린다.
+// 두 콜백 모두 reactor 스레드에서 불리므로 g_powLost는 락 없이 쓴다.
+static bool g_powLost[3] = {false, false, false};
+
+static int powIndex(uint32_t id) {
+    switch (id) {
+    case ID_POW_SEAT_STATE:   return 0;
+    case ID_POW_MIRROR_STATE: return 1;
+    case ID_POW_WHEEL_STATE:  return 2;
+    default:                  return -1;
+    }
+}
+
+static void onPowChanged(const CanFrame* fr, void* user) {
+    const int i = powIndex(fr->id);
+    if (i >= 0 && g_powLost[i]) {
+        g_powLost[i] = false;
+        reportPowRecovered(fr->id);
+    }
+    onCanRx(fr, user);
+}
+
+static void onPowTimeout(uint32_t id, void* user) {
+    (void)user;
+    const int i = powIndex(id);
+    if (i >= 0) {
+        if (g_powLost[i]) return;
+        g_powLost[i] = true;
+    }
+    reportPowTimeout(id);
+}
+
+// 값이 바뀐 프레임만 onCanRx로 (onCanRx가 읽는 바이트만 커널이 비교)
+static bool subscribePowOnChange() {
+    static const struct { uint32_t id; uint8_t len; } pow[] = {
+        { ID_POW_SEAT_STATE,   5 },
+        { ID_POW_MIRROR_STATE, 6 },
+        { ID_POW_WHEEL_STATE,  2 },
+    };
+    for (size_t i = 0; i < sizeof(pow)/sizeof(pow[0]); ++i) {
+        CanChangeFilter cf{};
+        cf.id = pow[i].id;
+        cf.len = pow[i].len;
+        memset(cf.mask, 0xFF, pow[i].len);
+        cf.timeout_ms = kPowStateTimeoutMs;
+        if (can_subscribe_on_change("can1", &g_canSubPowWatch[i], &cf, onPowChanged, onPowTimeout, (void*)kBusCan1) != CAN_OK) {
+            for (size_t k = 0; k < i; ++k) { can_unsubscribe("can1", g_canSubPowWatch[k]); g_canSubPowWatch[k] = 0; }
+            return false;
+        }
+    }
+    return true;
+}
+
 // ── CAN BEGIN (can0 + can1) ─────────────────────────────────────────────────
 static bool startCAN(QString* errOut=nullptr) {
     // 예: 500k, 샘플포인트는 환경에 맞게
@@ -579,8 +675,8 @@ static bool startCAN(QString* errOut=nullptr) {
     CanConfig cfg1{1, 500000, 0.75f, 1, CAN_MODE_NORMAL};
 
     if (can_init(CAN_DEVICE_LINUX) != CAN_OK) { if (errOut) *errOut = "can_init failed"; return false; }
-    if (can_open("can0", cfg0) != CAN_OK)      { if (errOut) *errOut = "can_open(can0) failed"; return false; }
-    if (can_open("can1", cfg1) != CAN_OK)      { if (errOut) *errOut = "can_open(can1) failed"; return false; }
+    if (can_open_h("can0", cfg0, &g_can0) != CAN_OK) { if (errOut) *errOut = "can_open(can0) failed"; return false; }
+    if (can_open_h("can1", cfg1, &g_can1) != CAN_OK) { if (errOut) *errOut = "can_open(can1) failed"; return false; }
 
     // can1: Power* 상태 수신
     static uint32_t ids_pow[] = {
@@ -591,9 +687,15 @@ static bool startCAN(QString* errOut=nullptr) {
     flt_pow.data.list.list  = ids_pow;
     flt_pow.data.list.count = (uint32_t)(sizeof(ids_pow)/sizeof(ids_pow[0]));
     g_canSubPowId = 0;
-    if (can_subscribe("can1", &g_canSubPowId, flt_pow, onCanRx, (void*)kBusCan1) != CAN_OK) {
-        if (errOut) *errOut = "can_subscribe(can1) failed";
-        return false;
+    if (!subscribePowOnChange()) {
+        if (can_subscribe("can1", &g_canSubPowId, flt_pow, onCanRx, (void*)kBusCan1) != CAN_OK) {
+            if (errOut) *errOut = "can_subscribe(can1) failed";
+            return false;
+        }
+        if (!watchPowPeriod()) {
+            if (errOut) *errOut = "can_watch_period(can1) failed";
+            return false;
+        }
     }
 
     // can0: SCA/TCU 인증/프로필/디버그/경고 수신
@@ -852,9 +954,12 @@ int main(int argc, char** argv) {
 
     // 정리
     if (g_canSubPowId) can_unsubscribe("can1", g_canSubPowId);
+    for (int& w : g_canSubPowWatch) if (w) can_unsubscribe("can1", w);
+    for (int& w : g_canPowPeriod) if (w) can_unwatch_period("can1", w);
     if (g_canSubScaId) can_unsubscribe("can0", g_canSubScaId);
-    can_close("can1");
-    can_close("can0");
+    can_close_h(g_can1);
+    can_close_h(g_can0);
+    g_can1 = g_can0 = nullptr;
     can_dispose();
 
     QLocalServer::removeServer(kSock);
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <stdatomic.h>
 #include "driver/twai.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -28,10 +29,17 @@ typedef struct Job {
     uint64_t    next_due_ms; // ms
     can_tx_prepare_cb_t prep;
     void*       prep_user;
+
+    // 통계 (mtx 보호)
+    CanJobStats st;
+    uint64_t    late_sum_us;
+    uint64_t    last_sent_us;
+
     struct Job* next;
 } Job;
 
 typedef struct {
+    int      job_id;              // 송신 결과 집계용
     CanFrame fr;                  // 프레임 스냅샷
     can_tx_prepare_cb_t prep;     // 콜백 스냅샷
     void* prep_user;
@@ -46,14 +54,46 @@ typedef struct {
     TaskHandle_t     rx_task;
     volatile int     running;
 
+    // 수신 허용 필터 (TWAI 단일 필터 방식과 같은 code/mask 한 쌍, mask 0 → 전체 허용)
+    // TWAI 하드웨어 필터는 드라이버 install 시점에만 바꿀 수 있어서 RX 태스크에서 거른다
+    volatile uint32_t acc_code;
+    volatile uint32_t acc_mask;
+
     TaskHandle_t      tx_task;
     volatile int      tx_running;
     int               next_job_id;
     Job*              jobs;
     SemaphoreHandle_t mtx;         // jobs 보호
+
+    // 통계. 버스 에러/중재 손실/수신 누락은 드라이버 카운터(twai_get_status_info)를 그대로 쓰고,
+    // 상태 변화와 bus-off 횟수는 RX 태스크가 TWAI alert로 센다.
+    int                  bitrate;
+    atomic_int           state;          // can_bus_state_t
+    atomic_uint_fast64_t tx_frames, tx_bytes, tx_failed, tx_bus_ns;
+    atomic_uint_fast64_t err_events, bus_off_count;
 } Esp32Ch;
 
-typedef struct { int dummy; } Esp32Priv;
+// RX 태스크가 처리하는 TWAI alert
+#define ESP32_ALERTS    (TWAI_ALERT_ERR_ACTIVE | TWAI_ALERT_ERR_PASS | TWAI_ALERT_BUS_OFF | \
+                         TWAI_ALERT_BUS_RECOVERED | TWAI_ALERT_BUS_ERROR | TWAI_ALERT_RX_QUEUE_FULL)
+
+typedef struct {
+    Esp32Ch* ch;        // 열린 채널 (TWAI는 하나). can_set_thread_policy가 태스크 우선순위를 바꿀 때
+} Esp32Priv;
+
+// 태스크 기본값 (can_set_thread_policy로 바꿀 수 있음)
+#define ESP32_RX_PRIO   10          // TX는 하나 아래
+#define ESP32_STACK     4096
+
+static void task_params(const CanThreadPolicy* p, UBaseType_t* rx_prio, UBaseType_t* tx_prio,
+                        BaseType_t* core, uint32_t* stack){
+    UBaseType_t rp = p->priority > 0 ? (UBaseType_t)p->priority : ESP32_RX_PRIO;
+    if (rp >= configMAX_PRIORITIES) rp = configMAX_PRIORITIES - 1;
+    *rx_prio = rp;
+    *tx_prio = rp > 1 ? rp - 1 : rp;
+    *core    = p->cpu_mask == 1u ? 0 : p->cpu_mask == 2u ? 1 : tskNO_AFFINITY;
+    *stack   = p->stack_size ? p->stack_size : ESP32_STACK;
+}
 
 static inline uint64_t now_ms(void){
     return (uint64_t)(esp_timer_get_time() / 1000ULL);
@@ -76,10 +116,11 @@ static void canframe_from_twai(const twai_message_t* in, CanFrame* out){
     out->id   = (in->extd) ? in->identifier & 0x1FFFFFFF : in->identifier & 0x7FF;
     out->dlc  = in->data_length_code;
     out->flags= 0;
+    out->timestamp_ns = (uint64_t)esp_timer_get_time() * 1000ULL;   // 드라이버 큐에서 꺼낸 시각
     if (in->extd) out->flags |= CAN_FRAME_EXTID;
     if (in->rtr)  out->flags |= CAN_FRAME_RTR;
     // (에러 프레임 개념은 TWAI 메시지로 직접 안 들어옴)
-    memset(out->data, 0, 8);
+    memset(out->data, 0, sizeof(out->data));
     if (!in->rtr) memcpy(out->data, in->data, out->dlc);
 }
 
@@ -92,6 +133,41 @@ static void twai_from_canframe(const CanFrame* in, twai_message_t* out){
     if (!out->rtr) memcpy(out->data, in->data, out->data_length_code);
 }
 
+static void tx_account(Esp32Ch* ch, const CanFrame* f, bool ok){
+    if (!ok){ atomic_fetch_add_explicit(&ch->tx_failed, 1, memory_order_relaxed); return; }
+    atomic_fetch_add_explicit(&ch->tx_frames, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&ch->tx_bytes, f->dlc, memory_order_relaxed);
+    atomic_fetch_add_explicit(&ch->tx_bus_ns, can_frame_bus_time_ns(f, ch->bitrate, 0), memory_order_relaxed);
+}
+
+static void set_bus_state(Esp32Ch* ch, can_bus_state_t st){
+    if ((can_bus_state_t)atomic_exchange(&ch->state, (int)st) != st && ch->on_bus)
+        ch->on_bus(st, ch->on_bus_user);
+}
+
+/* TWAI alert → 버스 상태/에러 콜백 (RX 태스크) */
+static void handle_alerts(Esp32Ch* ch, uint32_t alerts){
+    if (alerts & (TWAI_ALERT_BUS_ERROR | TWAI_ALERT_BUS_OFF | TWAI_ALERT_RX_QUEUE_FULL))
+        atomic_fetch_add_explicit(&ch->err_events, 1, memory_order_relaxed);
+    if (alerts & TWAI_ALERT_BUS_OFF){
+        atomic_fetch_add_explicit(&ch->bus_off_count, 1, memory_order_relaxed);
+        set_bus_state(ch, CAN_BUS_STATE_BUS_OFF);
+    } else if (alerts & TWAI_ALERT_ERR_PASS){
+        set_bus_state(ch, CAN_BUS_STATE_ERROR_PASSIVE);
+    } else if (alerts & TWAI_ALERT_ERR_ACTIVE){
+        set_bus_state(ch, CAN_BUS_STATE_ERROR_ACTIVE);
+    }
+    if (alerts & TWAI_ALERT_BUS_RECOVERED){
+        // 복구 후 드라이버는 STOPPED 상태 → 다시 시작해야 송수신 가능
+        twai_start();
+        set_bus_state(ch, CAN_BUS_STATE_ERROR_ACTIVE);
+    }
+    if (ch->on_err){
+        if      (alerts & TWAI_ALERT_BUS_OFF)   ch->on_err(CAN_ERR_BUSOFF, ch->on_err_user);
+        else if (alerts & TWAI_ALERT_BUS_ERROR) ch->on_err(CAN_ERR_IO, ch->on_err_user);
+    }
+}
+
 static void rx_task_fn(void* arg){
     Esp32Ch* ch = (Esp32Ch*)arg;
     for(;;){
@@ -102,18 +178,41 @@ static void rx_task_fn(void* arg){
         twai_message_t msg;
         if (twai_receive(&msg, pdMS_TO_TICKS(100)) == ESP_OK){
             CanFrame f; canframe_from_twai(&msg, &f);
+            if ((f.id ^ ch->acc_code) & ch->acc_mask) continue;
 
             // 콜백/유저 포인터 스냅샷 후 호출
             adapter_rx_cb_t cb = ch->on_rx;
             void* u = ch->on_rx_user;
             if (cb) cb(&f, u);
         }
-        // (선택) TWAI Alerts로 on_bus/on_err도 처리 가능
+        uint32_t alerts = 0;
+        if (twai_read_alerts(&alerts, 0) == ESP_OK && alerts) handle_alerts(ch, alerts);
     }
     ch->rx_task = NULL;           // 핸들 무효화
     vTaskDelete(NULL);
 }
 
+static void job_account(Job* j, uint64_t sent_us, bool ok){
+    CanJobStats* st = &j->st;
+    if (!ok){ st->failed++; return; }
+
+    // 이번에 처리한 주기의 만기 시각 = 다음 만기 - 주기
+    uint64_t due_us = (j->next_due_ms - j->period_ms) * 1000ULL;
+    uint64_t late = sent_us > due_us ? sent_us - due_us : 0;
+    st->sent++;
+    j->late_sum_us += late;
+    if (late > st->late_max_us) st->late_max_us = (uint32_t)late;
+    st->late_avg_us = (uint32_t)(j->late_sum_us / st->sent);
+
+    if (j->last_sent_us){
+        uint64_t iv  = sent_us - j->last_sent_us;
+        uint64_t per = (uint64_t)j->period_ms * 1000ULL;
+        uint64_t dev = iv > per ? iv - per : per - iv;
+        if (dev > st->jitter_max_us) st->jitter_max_us = (uint32_t)dev;
+    }
+    j->last_sent_us = sent_us;
+}
+
 static void tx_task_fn(void* arg){
     Esp32Ch* ch = (Esp32Ch*)arg;
     for(;;){
@@ -133,6 +232,7 @@ static void tx_task_fn(void* arg){
             if (j->next_due_ms == 0) j->next_due_ms = t + j->period_ms; // or t;
             if (t >= j->next_due_ms) {
                 if (np < (int)(sizeof(pend)/sizeof(pend[0]))) {
+                    pend[np].job_id    = j->id;
                     pend[np].fr        = j->fr;
                     pend[np].prep      = j->prep;
                     pend[np].prep_user = j->prep_user;
@@ -142,6 +242,7 @@ static void tx_task_fn(void* arg){
                 }
                 uint64_t late = t - j->next_due_ms;
                 uint64_t k = late / j->period_ms + 1;
+                j->st.skipped += k - 1;
                 j->next_due_ms += k * j->period_ms;
             }
             uint32_t remain = (j->next_due_ms > t) ? (uint32_t)(j->next_due_ms - t) : 0;
@@ -152,10 +253,24 @@ static void tx_task_fn(void* arg){
         if (overflow) sleep_ms = 0;     // 용량 초과 시 곧바로 다음 루프
 
         // 2) 락 밖에서 prep + 전송
+        bool sent[16];
         for (int i=0; i<np; ++i) {
             if (pend[i].prep) pend[i].prep(&pend[i].fr, pend[i].prep_user);
             twai_message_t m; twai_from_canframe(&pend[i].fr, &m);
-            (void)twai_transmit(&m, 0); // 필요하면 결과 체크하여 통계/에러콜백
+            sent[i] = (twai_transmit(&m, 0) == ESP_OK);
+            tx_account(ch, &pend[i].fr, sent[i]);
+        }
+
+        // 3) 통계 반영 (그 사이 취소된 Job은 건너뜀)
+        if (np > 0) {
+            uint64_t now_us = (uint64_t)esp_timer_get_time();
+            xSemaphoreTake(ch->mtx, portMAX_DELAY);
+            for (int i=0; i<np; ++i) {
+                for (Job* j = ch->jobs; j; j = j->next) {
+                    if (j->id == pend[i].job_id) { job_account(j, now_us, sent[i]); break; }
+                }
+            }
+            xSemaphoreGive(ch->mtx);
         }
 
         vTaskDelay(pdMS_TO_TICKS(sleep_ms ? sleep_ms : 1));
@@ -174,6 +289,7 @@ static can_err_t v_probe(Adapter* self){
 static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg, AdapterHandle* out){
     (void)name;
     if (!cfg || !out) return CAN_ERR_INVALID;
+    if (cfg->fd) return CAN_ERR_INVALID;        // TWAI 컨트롤러는 CAN FD를 지원하지 않음
 
     twai_general_config_t g = TWAI_GENERAL_CONFIG_DEFAULT(TWAI_TX_PIN, TWAI_RX_PIN, TWAI_MODE_NORMAL);
     // Listen-only/Loopback 등 모드 설정
@@ -198,9 +314,17 @@ static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg
         free(ch); twai_stop(); twai_driver_uninstall();
         return CAN_ERR_MEMORY;
     }
+    ch->bitrate = cfg->bitrate;
+    atomic_init(&ch->state, CAN_BUS_STATE_ERROR_ACTIVE);
+    twai_reconfigure_alerts(ESP32_ALERTS, NULL);
+
+    UBaseType_t rx_prio, tx_prio;
+    BaseType_t  core;
+    uint32_t    stack;
+    task_params(can_thread_policy_get(), &rx_prio, &tx_prio, &core, &stack);
 
     ch->running = 1;
-    if (xTaskCreate(rx_task_fn, "twai_rx", 4096, ch, 10, &ch->rx_task) != pdPASS){
+    if (xTaskCreatePinnedToCore(rx_task_fn, "twai_rx", stack, ch, rx_prio, &ch->rx_task, core) != pdPASS){
         vSemaphoreDelete(ch->mtx);
         free(ch); twai_stop(); twai_driver_uninstall();
         return CAN_ERR_MEMORY;
@@ -208,7 +332,7 @@ static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg
 
 
     ch->tx_running = 1;
-    if (xTaskCreate(tx_task_fn, "twai_tx", 4096, ch, 9, &ch->tx_task) != pdPASS){
+    if (xTaskCreatePinnedToCore(tx_task_fn, "twai_tx", stack, ch, tx_prio, &ch->tx_task, core) != pdPASS){
         // RX 태스크 종료 후 정리
         ch->running = 0; if (ch->rx_task) xTaskNotifyGive(ch->rx_task);
         for (int i=0; i<100; ++i){
@@ -224,14 +348,16 @@ static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg
     ch->next_job_id= 0;
     ch->jobs       = NULL;
 
+    ((Esp32Priv*)self->priv)->ch = ch;
     *out = (AdapterHandle)ch;
     return CAN_OK;
 }
 
 static void v_ch_close(Adapter* self, AdapterHandle h){
-    (void)self;
     if (!h) return;
     Esp32Ch* ch = (Esp32Ch*)h;
+    Esp32Priv* priv = (Esp32Priv*)self->priv;
+    if (priv->ch == ch) priv->ch = NULL;
 
     ch->running    = 0;
     ch->tx_running = 0;
@@ -281,28 +407,43 @@ static can_err_t v_ch_set_callbacks(
     return CAN_OK;
 }
 
+/* 채널이 넘겨준 (id, mask) 목록을 하나의 code/mask로 덮는다.
+ * 모든 필터가 공통으로 보는 비트 중 값이 같은 비트만 남기므로 합집합의 상위집합이 된다.
+ */
+static can_err_t v_ch_set_filters(Adapter* self, AdapterHandle h, const CanFilter* filters, size_t count){
+    (void)self;
+    if (!h) return CAN_ERR_INVALID;
+    Esp32Ch* ch = (Esp32Ch*)h;
+
+    uint32_t code = 0, mask = 0;
+    if (filters && count > 0){
+        code = filters[0].data.mask.id;
+        mask = 0x1FFFFFFF;
+        for (size_t i = 0; i < count; ++i){
+            if (filters[i].type != CAN_FILTER_MASK) return CAN_ERR_INVALID;
+            mask &= filters[i].data.mask.mask;
+            mask &= ~(filters[i].data.mask.id ^ code);
+        }
+        code &= mask;
+    }
+    ch->acc_mask = 0;           // 갱신 중에는 전체 허용
+    ch->acc_code = code;
+    ch->acc_mask = mask;
+    return CAN_OK;
+}
+
 static can_err_t v_write(Adapter* self, AdapterHandle h, const CanFrame* fr, uint32_t timeout_ms){
     (void)self;
     if (!h || !fr) return CAN_ERR_INVALID;
     twai_message_t msg; twai_from_canframe(fr, &msg);
     TickType_t to = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
     esp_err_t e = twai_transmit(&msg, to);
+    tx_account((Esp32Ch*)h, fr, e == ESP_OK);
     if (e == ESP_OK) return CAN_OK;
     if (e == ESP_ERR_TIMEOUT) return CAN_ERR_TIMEOUT;
     return CAN_ERR_IO;
 }
 
-static can_err_t v_read(Adapter* self, AdapterHandle h, CanFrame* out, uint32_t timeout_ms){
-    (void)self;
-    if (!h || !out) return CAN_ERR_INVALID;
-    twai_message_t msg;
-    TickType_t to = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    esp_err_t e = twai_receive(&msg, to);
-    if (e == ESP_OK){ canframe_from_twai(&msg, out); return CAN_OK; }
-    if (e == ESP_ERR_TIMEOUT) return CAN_ERR_TIMEOUT;
-    return CAN_ERR_IO;
-}
-
 static can_bus_state_t v_status(Adapter* self, AdapterHandle h){
     (void)self; (void)h;
     twai_status_info_t st;
@@ -320,6 +461,42 @@ static can_err_t v_recover(Adapter* self, AdapterHandle h){
     return CAN_ERR_STATE;
 }
 
+static can_err_t v_ch_update_job(Adapter* self, AdapterHandle h, int jobId, const CanFrame* fr){
+    (void)self;
+    if (!h || jobId<=0 || !fr) return CAN_ERR_INVALID;
+    Esp32Ch* ch = (Esp32Ch*)h;
+
+    // TX 태스크는 락 안에서 프레임을 스냅샷하므로 다음 송신부터 새 프레임이 나간다
+    can_err_t ret = CAN_ERR_INVALID;
+    xSemaphoreTake(ch->mtx, portMAX_DELAY);
+    for (Job* j = ch->jobs; j; j = j->next){
+        if (j->id == jobId){ j->fr = *fr; ret = CAN_OK; break; }
+    }
+    xSemaphoreGive(ch->mtx);
+    return ret;
+}
+
+static can_err_t v_ch_get_bus_stats(Adapter* self, AdapterHandle h, CanStats* io){
+    if (!h || !io) return CAN_ERR_INVALID;
+    Esp32Ch* ch = (Esp32Ch*)h;
+    io->state         = v_status(self, h);
+    io->tx_frames     = atomic_load_explicit(&ch->tx_frames, memory_order_relaxed);
+    io->tx_bytes      = atomic_load_explicit(&ch->tx_bytes, memory_order_relaxed);
+    io->tx_failed     = atomic_load_explicit(&ch->tx_failed, memory_order_relaxed);
+    io->bus_time_ns  += atomic_load_explicit(&ch->tx_bus_ns, memory_order_relaxed);
+    io->err_frames    = atomic_load_explicit(&ch->err_events, memory_order_relaxed);
+    io->bus_off_count = atomic_load_explicit(&ch->bus_off_count, memory_order_relaxed);
+    twai_status_info_t st;
+    if (twai_get_status_info(&st) == ESP_OK){
+        io->tx_err_counter = st.tx_error_counter > 255 ? 255 : (uint8_t)st.tx_error_counter;
+        io->rx_err_counter = st.rx_error_counter > 255 ? 255 : (uint8_t)st.rx_error_counter;
+        io->bus_errors     = st.bus_error_count;
+        io->arb_lost       = st.arb_lost_count;
+        io->rx_overflows   = st.rx_missed_count;
+    }
+    return CAN_OK;
+}
+
 static void v_destroy(Adapter* self){
     if (!self) return;
     free(self->priv);
@@ -337,6 +514,7 @@ static can_err_t v_ch_register_job_dynamic(Adapter* self, int* id, AdapterHandle
 
     memset(&j->fr, 0, sizeof(j->fr));
     j->period_ms = period_ms;
+    j->st.period_ms = period_ms;
     j->next_due_ms = now_ms() + period_ms;
     j->prep = prep;
     j->prep_user = prep_user;
@@ -362,6 +540,7 @@ static can_err_t v_ch_register_job(Adapter* self, int* id, AdapterHandle h, cons
 
     j->fr = *fr;
     j->period_ms = period_ms;
+    j->st.period_ms = period_ms;
     j->next_due_ms = now_ms() + period_ms;
     j->prep = NULL;
     j->prep_user = NULL;
@@ -396,6 +575,34 @@ static can_err_t v_ch_cancel_job(Adapter* self, AdapterHandle h, int jobId){
     return ret;
 }
 
+static can_err_t v_ch_get_job_stats(Adapter* self, AdapterHandle h, int jobId, CanJobStats* out){
+    (void)self;
+    if (!h || jobId<=0 || !out) return CAN_ERR_INVALID;
+    Esp32Ch* ch = (Esp32Ch*)h;
+
+    can_err_t ret = CAN_ERR_INVALID;
+    xSemaphoreTake(ch->mtx, portMAX_DELAY);
+    for (Job* j = ch->jobs; j; j = j->next){
+        if (j->id == jobId){ *out = j->st; ret = CAN_OK; break; }
+    }
+    xSemaphoreGive(ch->mtx);
+    return ret;
+}
+
+// 돌고 있는 태스크는 우선순위만 바꾼다 (코어 고정/스택은 다음 can_open부터)
+static can_err_t v_set_thread_policy(Adapter* self, const CanThreadPolicy* p){
+    Esp32Ch* ch = ((Esp32Priv*)self->priv)->ch;
+    if (!p) return CAN_ERR_INVALID;
+    if (!ch) return CAN_OK;
+    UBaseType_t rx_prio, tx_prio;
+    BaseType_t  core;
+    uint32_t    stack;
+    task_params(p, &rx_prio, &tx_prio, &core, &stack);
+    if (ch->rx_task) vTaskPrioritySet(ch->rx_task, rx_prio);
+    if (ch->tx_task) vTaskPrioritySet(ch->tx_task, tx_prio);
+    return CAN_OK;
+}
+
 Adapter* adapter_esp32_new(void){
     Adapter* ad = (Adapter*)calloc(1, sizeof(Adapter));
     if (!ad) return NULL;
@@ -408,16 +615,22 @@ Adapter* adapter_esp32_new(void){
         .ch_close                   = v_ch_close,
         .ch_set_callbacks           = v_ch_set_callbacks,
         .write                      = v_write,
-        .read                       = v_read,
         .status                     = v_status,
         .recover                    = v_recover,
         .ch_register_job            = v_ch_register_job,
         .ch_register_job_dynamic    = v_ch_register_job_dynamic,
         .ch_cancel_job              = v_ch_cancel_job,   
+        .ch_set_filters             = v_ch_set_filters,
+        .ch_get_job_stats           = v_ch_get_job_stats,
+        .ch_get_bus_stats           = v_ch_get_bus_stats,
+        .ch_update_job              = v_ch_update_job,
+        .set_thread_policy          = v_set_thread_policy,
         .destroy                    = v_destroy
     };
     ad->v = &V; ad->priv = priv;
     return ad;
 }
 
-Adapter* adapter_linux_new(void) { return NULL; }
\ No newline at end of file
+Adapter* adapter_linux_new(void) { return NULL; }
+Adapter* adapter_record_new(void) { return NULL; }  // 트레이스 기록/재생은 Linux 전용 (adapter_trace.c)
+Adapter* adapter_replay_new(void) { return NULL; }
\ No newline at end of file
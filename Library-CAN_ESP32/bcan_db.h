@@ -0,0 +1,961 @@
+// bcan.dbc에서 dbcgen.py로 생성됨. 직접 고치지 말고 DBC를 고친 뒤 다시 생성할 것.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "candb.h"
+
+// ---- 0x001 DCU_RESET (1 byte, DCU)
+#define BCAN_DCU_RESET_ID   0x001u
+#define BCAN_DCU_RESET_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_RESET_LEN) && BCAN_DCU_RESET_LEN <= CAN_FRAME_DATA_MAX, "DCU_RESET: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_RESET_LEN * 8, "DCU_RESET.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;  // 1: 리셋 요청
+} bcan_dcu_reset_t;
+
+static inline void bcan_dcu_reset_unpack(bcan_dcu_reset_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void bcan_dcu_reset_pack(uint8_t* d, const bcan_dcu_reset_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_reset_decode(const CanFrame* fr, bcan_dcu_reset_t* m){
+    bcan_dcu_reset_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_RESET_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_reset_encode(const bcan_dcu_reset_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_RESET_ID;
+    fr.dlc          = BCAN_DCU_RESET_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_reset_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_reset_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_reset_decode(fr, (bcan_dcu_reset_t*)m);
+}
+
+// ---- 0x002 DCU_RESET_ACK (2 bytes, Vector__XXX)
+#define BCAN_DCU_RESET_ACK_ID   0x002u
+#define BCAN_DCU_RESET_ACK_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_RESET_ACK_LEN) && BCAN_DCU_RESET_ACK_LEN <= CAN_FRAME_DATA_MAX, "DCU_RESET_ACK: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_RESET_ACK_LEN * 8, "DCU_RESET_ACK.sig_index: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_RESET_ACK_LEN * 8, "DCU_RESET_ACK.sig_status: out of frame");
+
+typedef struct {
+    uint8_t   sig_index;
+    uint8_t   sig_status;
+} bcan_dcu_reset_ack_t;
+
+static inline void bcan_dcu_reset_ack_unpack(bcan_dcu_reset_ack_t* m, const uint8_t* d){
+    const uint32_t r_sig_index = (uint32_t)d[0];
+    m->sig_index = (uint8_t)(r_sig_index);
+    const uint32_t r_sig_status = (uint32_t)d[1];
+    m->sig_status = (uint8_t)(r_sig_status);
+}
+
+static inline void bcan_dcu_reset_ack_pack(uint8_t* d, const bcan_dcu_reset_ack_t* m){
+    const uint32_t r_sig_index = (uint32_t)m->sig_index;
+    const uint32_t r_sig_status = (uint32_t)m->sig_status;
+    d[0] = (uint8_t)(r_sig_index);
+    d[1] = (uint8_t)(r_sig_status);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_reset_ack_decode(const CanFrame* fr, bcan_dcu_reset_ack_t* m){
+    bcan_dcu_reset_ack_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_RESET_ACK_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_reset_ack_encode(const bcan_dcu_reset_ack_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_RESET_ACK_ID;
+    fr.dlc          = BCAN_DCU_RESET_ACK_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_reset_ack_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_reset_ack_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_reset_ack_decode(fr, (bcan_dcu_reset_ack_t*)m);
+}
+
+// ---- 0x101 DCU_SEAT_ORDER (4 bytes, DCU)
+#define BCAN_DCU_SEAT_ORDER_ID   0x101u
+#define BCAN_DCU_SEAT_ORDER_LEN  4
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_SEAT_ORDER_LEN) && BCAN_DCU_SEAT_ORDER_LEN <= CAN_FRAME_DATA_MAX, "DCU_SEAT_ORDER: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_SEAT_ORDER_LEN * 8, "DCU_SEAT_ORDER.sig_seat_position: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_SEAT_ORDER_LEN * 8, "DCU_SEAT_ORDER.sig_seat_angle: out of frame");
+CANDB_STATIC_ASSERT(23 < BCAN_DCU_SEAT_ORDER_LEN * 8, "DCU_SEAT_ORDER.sig_seat_front_height: out of frame");
+CANDB_STATIC_ASSERT(31 < BCAN_DCU_SEAT_ORDER_LEN * 8, "DCU_SEAT_ORDER.sig_seat_rear_height: out of frame");
+
+typedef struct {
+    uint8_t   sig_seat_position;  // [0..100] %
+    uint8_t   sig_seat_angle;  // [0..180] deg
+    uint8_t   sig_seat_front_height;  // [0..100] %
+    uint8_t   sig_seat_rear_height;  // [0..100] %
+} bcan_dcu_seat_order_t;
+
+static inline void bcan_dcu_seat_order_unpack(bcan_dcu_seat_order_t* m, const uint8_t* d){
+    const uint32_t r_sig_seat_position = (uint32_t)d[0];
+    m->sig_seat_position = (uint8_t)(r_sig_seat_position);
+    const uint32_t r_sig_seat_angle = (uint32_t)d[1];
+    m->sig_seat_angle = (uint8_t)(r_sig_seat_angle);
+    const uint32_t r_sig_seat_front_height = (uint32_t)d[2];
+    m->sig_seat_front_height = (uint8_t)(r_sig_seat_front_height);
+    const uint32_t r_sig_seat_rear_height = (uint32_t)d[3];
+    m->sig_seat_rear_height = (uint8_t)(r_sig_seat_rear_height);
+}
+
+static inline void bcan_dcu_seat_order_pack(uint8_t* d, const bcan_dcu_seat_order_t* m){
+    uint8_t v_sig_seat_position = m->sig_seat_position;
+    v_sig_seat_position = v_sig_seat_position > 100 ? 100 : v_sig_seat_position;
+    const uint32_t r_sig_seat_position = (uint32_t)v_sig_seat_position;
+    uint8_t v_sig_seat_angle = m->sig_seat_angle;
+    v_sig_seat_angle = v_sig_seat_angle > 180 ? 180 : v_sig_seat_angle;
+    const uint32_t r_sig_seat_angle = (uint32_t)v_sig_seat_angle;
+    uint8_t v_sig_seat_front_height = m->sig_seat_front_height;
+    v_sig_seat_front_height = v_sig_seat_front_height > 100 ? 100 : v_sig_seat_front_height;
+    const uint32_t r_sig_seat_front_height = (uint32_t)v_sig_seat_front_height;
+    uint8_t v_sig_seat_rear_height = m->sig_seat_rear_height;
+    v_sig_seat_rear_height = v_sig_seat_rear_height > 100 ? 100 : v_sig_seat_rear_height;
+    const uint32_t r_sig_seat_rear_height = (uint32_t)v_sig_seat_rear_height;
+    d[0] = (uint8_t)(r_sig_seat_position);
+    d[1] = (uint8_t)(r_sig_seat_angle);
+    d[2] = (uint8_t)(r_sig_seat_front_height);
+    d[3] = (uint8_t)(r_sig_seat_rear_height);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_seat_order_decode(const CanFrame* fr, bcan_dcu_seat_order_t* m){
+    bcan_dcu_seat_order_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_SEAT_ORDER_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_seat_order_encode(const bcan_dcu_seat_order_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_SEAT_ORDER_ID;
+    fr.dlc          = BCAN_DCU_SEAT_ORDER_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_seat_order_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_seat_order_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_seat_order_decode(fr, (bcan_dcu_seat_order_t*)m);
+}
+
+// ---- 0x102 DCU_MIRROR_ORDER (6 bytes, DCU)
+#define BCAN_DCU_MIRROR_ORDER_ID   0x102u
+#define BCAN_DCU_MIRROR_ORDER_LEN  6
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_MIRROR_ORDER_LEN) && BCAN_DCU_MIRROR_ORDER_LEN <= CAN_FRAME_DATA_MAX, "DCU_MIRROR_ORDER: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_left_yaw: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_left_pitch: out of frame");
+CANDB_STATIC_ASSERT(23 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_right_yaw: out of frame");
+CANDB_STATIC_ASSERT(31 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_right_pitch: out of frame");
+CANDB_STATIC_ASSERT(39 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_room_yaw: out of frame");
+CANDB_STATIC_ASSERT(47 < BCAN_DCU_MIRROR_ORDER_LEN * 8, "DCU_MIRROR_ORDER.sig_mirror_room_pitch: out of frame");
+
+typedef struct {
+    uint8_t   sig_mirror_left_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_left_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_right_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_right_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_room_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_room_pitch;  // [0..180] deg
+} bcan_dcu_mirror_order_t;
+
+static inline void bcan_dcu_mirror_order_unpack(bcan_dcu_mirror_order_t* m, const uint8_t* d){
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)d[0];
+    m->sig_mirror_left_yaw = (uint8_t)(r_sig_mirror_left_yaw);
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)d[1];
+    m->sig_mirror_left_pitch = (uint8_t)(r_sig_mirror_left_pitch);
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)d[2];
+    m->sig_mirror_right_yaw = (uint8_t)(r_sig_mirror_right_yaw);
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)d[3];
+    m->sig_mirror_right_pitch = (uint8_t)(r_sig_mirror_right_pitch);
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)d[4];
+    m->sig_mirror_room_yaw = (uint8_t)(r_sig_mirror_room_yaw);
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)d[5];
+    m->sig_mirror_room_pitch = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+static inline void bcan_dcu_mirror_order_pack(uint8_t* d, const bcan_dcu_mirror_order_t* m){
+    uint8_t v_sig_mirror_left_yaw = m->sig_mirror_left_yaw;
+    v_sig_mirror_left_yaw = v_sig_mirror_left_yaw > 180 ? 180 : v_sig_mirror_left_yaw;
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)v_sig_mirror_left_yaw;
+    uint8_t v_sig_mirror_left_pitch = m->sig_mirror_left_pitch;
+    v_sig_mirror_left_pitch = v_sig_mirror_left_pitch > 180 ? 180 : v_sig_mirror_left_pitch;
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)v_sig_mirror_left_pitch;
+    uint8_t v_sig_mirror_right_yaw = m->sig_mirror_right_yaw;
+    v_sig_mirror_right_yaw = v_sig_mirror_right_yaw > 180 ? 180 : v_sig_mirror_right_yaw;
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)v_sig_mirror_right_yaw;
+    uint8_t v_sig_mirror_right_pitch = m->sig_mirror_right_pitch;
+    v_sig_mirror_right_pitch = v_sig_mirror_right_pitch > 180 ? 180 : v_sig_mirror_right_pitch;
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)v_sig_mirror_right_pitch;
+    uint8_t v_sig_mirror_room_yaw = m->sig_mirror_room_yaw;
+    v_sig_mirror_room_yaw = v_sig_mirror_room_yaw > 180 ? 180 : v_sig_mirror_room_yaw;
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)v_sig_mirror_room_yaw;
+    uint8_t v_sig_mirror_room_pitch = m->sig_mirror_room_pitch;
+    v_sig_mirror_room_pitch = v_sig_mirror_room_pitch > 180 ? 180 : v_sig_mirror_room_pitch;
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)v_sig_mirror_room_pitch;
+    d[0] = (uint8_t)(r_sig_mirror_left_yaw);
+    d[1] = (uint8_t)(r_sig_mirror_left_pitch);
+    d[2] = (uint8_t)(r_sig_mirror_right_yaw);
+    d[3] = (uint8_t)(r_sig_mirror_right_pitch);
+    d[4] = (uint8_t)(r_sig_mirror_room_yaw);
+    d[5] = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_mirror_order_decode(const CanFrame* fr, bcan_dcu_mirror_order_t* m){
+    bcan_dcu_mirror_order_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_MIRROR_ORDER_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_mirror_order_encode(const bcan_dcu_mirror_order_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_MIRROR_ORDER_ID;
+    fr.dlc          = BCAN_DCU_MIRROR_ORDER_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_mirror_order_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_mirror_order_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_mirror_order_decode(fr, (bcan_dcu_mirror_order_t*)m);
+}
+
+// ---- 0x103 DCU_WHEEL_ORDER (2 bytes, DCU)
+#define BCAN_DCU_WHEEL_ORDER_ID   0x103u
+#define BCAN_DCU_WHEEL_ORDER_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_WHEEL_ORDER_LEN) && BCAN_DCU_WHEEL_ORDER_LEN <= CAN_FRAME_DATA_MAX, "DCU_WHEEL_ORDER: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_WHEEL_ORDER_LEN * 8, "DCU_WHEEL_ORDER.sig_wheel_position: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_WHEEL_ORDER_LEN * 8, "DCU_WHEEL_ORDER.sig_wheel_angle: out of frame");
+
+typedef struct {
+    uint8_t   sig_wheel_position;  // [0..100] %
+    uint8_t   sig_wheel_angle;  // [0..180] deg
+} bcan_dcu_wheel_order_t;
+
+static inline void bcan_dcu_wheel_order_unpack(bcan_dcu_wheel_order_t* m, const uint8_t* d){
+    const uint32_t r_sig_wheel_position = (uint32_t)d[0];
+    m->sig_wheel_position = (uint8_t)(r_sig_wheel_position);
+    const uint32_t r_sig_wheel_angle = (uint32_t)d[1];
+    m->sig_wheel_angle = (uint8_t)(r_sig_wheel_angle);
+}
+
+static inline void bcan_dcu_wheel_order_pack(uint8_t* d, const bcan_dcu_wheel_order_t* m){
+    uint8_t v_sig_wheel_position = m->sig_wheel_position;
+    v_sig_wheel_position = v_sig_wheel_position > 100 ? 100 : v_sig_wheel_position;
+    const uint32_t r_sig_wheel_position = (uint32_t)v_sig_wheel_position;
+    uint8_t v_sig_wheel_angle = m->sig_wheel_angle;
+    v_sig_wheel_angle = v_sig_wheel_angle > 180 ? 180 : v_sig_wheel_angle;
+    const uint32_t r_sig_wheel_angle = (uint32_t)v_sig_wheel_angle;
+    d[0] = (uint8_t)(r_sig_wheel_position);
+    d[1] = (uint8_t)(r_sig_wheel_angle);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_wheel_order_decode(const CanFrame* fr, bcan_dcu_wheel_order_t* m){
+    bcan_dcu_wheel_order_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_WHEEL_ORDER_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_wheel_order_encode(const bcan_dcu_wheel_order_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_WHEEL_ORDER_ID;
+    fr.dlc          = BCAN_DCU_WHEEL_ORDER_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_wheel_order_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_wheel_order_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_wheel_order_decode(fr, (bcan_dcu_wheel_order_t*)m);
+}
+
+// ---- 0x201 POW_SEAT_STATE (6 bytes, POW_SEAT): 5번째 바이트(sig_seat_is_seated)가 1이면 DCU가 system/start를 보낸다
+#define BCAN_POW_SEAT_STATE_ID   0x201u
+#define BCAN_POW_SEAT_STATE_LEN  6
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_POW_SEAT_STATE_LEN) && BCAN_POW_SEAT_STATE_LEN <= CAN_FRAME_DATA_MAX, "POW_SEAT_STATE: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_position: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_angle: out of frame");
+CANDB_STATIC_ASSERT(23 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_front_height: out of frame");
+CANDB_STATIC_ASSERT(31 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_rear_height: out of frame");
+CANDB_STATIC_ASSERT(39 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_is_seated: out of frame");
+CANDB_STATIC_ASSERT(47 < BCAN_POW_SEAT_STATE_LEN * 8, "POW_SEAT_STATE.sig_seat_status: out of frame");
+
+typedef struct {
+    uint8_t   sig_seat_position;  // [0..100] %
+    uint8_t   sig_seat_angle;  // [0..180] deg
+    uint8_t   sig_seat_front_height;  // [0..100] %
+    uint8_t   sig_seat_rear_height;  // [0..100] %
+    uint8_t   sig_seat_is_seated;  // [0..1]
+    uint8_t   sig_seat_status;
+} bcan_pow_seat_state_t;
+
+static inline void bcan_pow_seat_state_unpack(bcan_pow_seat_state_t* m, const uint8_t* d){
+    const uint32_t r_sig_seat_position = (uint32_t)d[0];
+    m->sig_seat_position = (uint8_t)(r_sig_seat_position);
+    const uint32_t r_sig_seat_angle = (uint32_t)d[1];
+    m->sig_seat_angle = (uint8_t)(r_sig_seat_angle);
+    const uint32_t r_sig_seat_front_height = (uint32_t)d[2];
+    m->sig_seat_front_height = (uint8_t)(r_sig_seat_front_height);
+    const uint32_t r_sig_seat_rear_height = (uint32_t)d[3];
+    m->sig_seat_rear_height = (uint8_t)(r_sig_seat_rear_height);
+    const uint32_t r_sig_seat_is_seated = (uint32_t)d[4];
+    m->sig_seat_is_seated = (uint8_t)(r_sig_seat_is_seated);
+    const uint32_t r_sig_seat_status = (uint32_t)d[5];
+    m->sig_seat_status = (uint8_t)(r_sig_seat_status);
+}
+
+static inline void bcan_pow_seat_state_pack(uint8_t* d, const bcan_pow_seat_state_t* m){
+    uint8_t v_sig_seat_position = m->sig_seat_position;
+    v_sig_seat_position = v_sig_seat_position > 100 ? 100 : v_sig_seat_position;
+    const uint32_t r_sig_seat_position = (uint32_t)v_sig_seat_position;
+    uint8_t v_sig_seat_angle = m->sig_seat_angle;
+    v_sig_seat_angle = v_sig_seat_angle > 180 ? 180 : v_sig_seat_angle;
+    const uint32_t r_sig_seat_angle = (uint32_t)v_sig_seat_angle;
+    uint8_t v_sig_seat_front_height = m->sig_seat_front_height;
+    v_sig_seat_front_height = v_sig_seat_front_height > 100 ? 100 : v_sig_seat_front_height;
+    const uint32_t r_sig_seat_front_height = (uint32_t)v_sig_seat_front_height;
+    uint8_t v_sig_seat_rear_height = m->sig_seat_rear_height;
+    v_sig_seat_rear_height = v_sig_seat_rear_height > 100 ? 100 : v_sig_seat_rear_height;
+    const uint32_t r_sig_seat_rear_height = (uint32_t)v_sig_seat_rear_height;
+    uint8_t v_sig_seat_is_seated = m->sig_seat_is_seated;
+    v_sig_seat_is_seated = v_sig_seat_is_seated > 1 ? 1 : v_sig_seat_is_seated;
+    const uint32_t r_sig_seat_is_seated = (uint32_t)v_sig_seat_is_seated;
+    const uint32_t r_sig_seat_status = (uint32_t)m->sig_seat_status;
+    d[0] = (uint8_t)(r_sig_seat_position);
+    d[1] = (uint8_t)(r_sig_seat_angle);
+    d[2] = (uint8_t)(r_sig_seat_front_height);
+    d[3] = (uint8_t)(r_sig_seat_rear_height);
+    d[4] = (uint8_t)(r_sig_seat_is_seated);
+    d[5] = (uint8_t)(r_sig_seat_status);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_pow_seat_state_decode(const CanFrame* fr, bcan_pow_seat_state_t* m){
+    bcan_pow_seat_state_unpack(m, fr->data);
+    return fr->dlc >= BCAN_POW_SEAT_STATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_pow_seat_state_encode(const bcan_pow_seat_state_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_POW_SEAT_STATE_ID;
+    fr.dlc          = BCAN_POW_SEAT_STATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_pow_seat_state_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_pow_seat_state_decode_any(const CanFrame* fr, void* m){
+    return bcan_pow_seat_state_decode(fr, (bcan_pow_seat_state_t*)m);
+}
+
+// ---- 0x202 POW_MIRROR_STATE (7 bytes, POW_MIRROR)
+#define BCAN_POW_MIRROR_STATE_ID   0x202u
+#define BCAN_POW_MIRROR_STATE_LEN  7
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_POW_MIRROR_STATE_LEN) && BCAN_POW_MIRROR_STATE_LEN <= CAN_FRAME_DATA_MAX, "POW_MIRROR_STATE: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_left_yaw: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_left_pitch: out of frame");
+CANDB_STATIC_ASSERT(23 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_right_yaw: out of frame");
+CANDB_STATIC_ASSERT(31 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_right_pitch: out of frame");
+CANDB_STATIC_ASSERT(39 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_room_yaw: out of frame");
+CANDB_STATIC_ASSERT(47 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_room_pitch: out of frame");
+CANDB_STATIC_ASSERT(55 < BCAN_POW_MIRROR_STATE_LEN * 8, "POW_MIRROR_STATE.sig_mirror_status: out of frame");
+
+typedef struct {
+    uint8_t   sig_mirror_left_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_left_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_right_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_right_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_room_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_room_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_status;
+} bcan_pow_mirror_state_t;
+
+static inline void bcan_pow_mirror_state_unpack(bcan_pow_mirror_state_t* m, const uint8_t* d){
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)d[0];
+    m->sig_mirror_left_yaw = (uint8_t)(r_sig_mirror_left_yaw);
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)d[1];
+    m->sig_mirror_left_pitch = (uint8_t)(r_sig_mirror_left_pitch);
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)d[2];
+    m->sig_mirror_right_yaw = (uint8_t)(r_sig_mirror_right_yaw);
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)d[3];
+    m->sig_mirror_right_pitch = (uint8_t)(r_sig_mirror_right_pitch);
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)d[4];
+    m->sig_mirror_room_yaw = (uint8_t)(r_sig_mirror_room_yaw);
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)d[5];
+    m->sig_mirror_room_pitch = (uint8_t)(r_sig_mirror_room_pitch);
+    const uint32_t r_sig_mirror_status = (uint32_t)d[6];
+    m->sig_mirror_status = (uint8_t)(r_sig_mirror_status);
+}
+
+static inline void bcan_pow_mirror_state_pack(uint8_t* d, const bcan_pow_mirror_state_t* m){
+    uint8_t v_sig_mirror_left_yaw = m->sig_mirror_left_yaw;
+    v_sig_mirror_left_yaw = v_sig_mirror_left_yaw > 180 ? 180 : v_sig_mirror_left_yaw;
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)v_sig_mirror_left_yaw;
+    uint8_t v_sig_mirror_left_pitch = m->sig_mirror_left_pitch;
+    v_sig_mirror_left_pitch = v_sig_mirror_left_pitch > 180 ? 180 : v_sig_mirror_left_pitch;
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)v_sig_mirror_left_pitch;
+    uint8_t v_sig_mirror_right_yaw = m->sig_mirror_right_yaw;
+    v_sig_mirror_right_yaw = v_sig_mirror_right_yaw > 180 ? 180 : v_sig_mirror_right_yaw;
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)v_sig_mirror_right_yaw;
+    uint8_t v_sig_mirror_right_pitch = m->sig_mirror_right_pitch;
+    v_sig_mirror_right_pitch = v_sig_mirror_right_pitch > 180 ? 180 : v_sig_mirror_right_pitch;
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)v_sig_mirror_right_pitch;
+    uint8_t v_sig_mirror_room_yaw = m->sig_mirror_room_yaw;
+    v_sig_mirror_room_yaw = v_sig_mirror_room_yaw > 180 ? 180 : v_sig_mirror_room_yaw;
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)v_sig_mirror_room_yaw;
+    uint8_t v_sig_mirror_room_pitch = m->sig_mirror_room_pitch;
+    v_sig_mirror_room_pitch = v_sig_mirror_room_pitch > 180 ? 180 : v_sig_mirror_room_pitch;
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)v_sig_mirror_room_pitch;
+    const uint32_t r_sig_mirror_status = (uint32_t)m->sig_mirror_status;
+    d[0] = (uint8_t)(r_sig_mirror_left_yaw);
+    d[1] = (uint8_t)(r_sig_mirror_left_pitch);
+    d[2] = (uint8_t)(r_sig_mirror_right_yaw);
+    d[3] = (uint8_t)(r_sig_mirror_right_pitch);
+    d[4] = (uint8_t)(r_sig_mirror_room_yaw);
+    d[5] = (uint8_t)(r_sig_mirror_room_pitch);
+    d[6] = (uint8_t)(r_sig_mirror_status);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_pow_mirror_state_decode(const CanFrame* fr, bcan_pow_mirror_state_t* m){
+    bcan_pow_mirror_state_unpack(m, fr->data);
+    return fr->dlc >= BCAN_POW_MIRROR_STATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_pow_mirror_state_encode(const bcan_pow_mirror_state_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_POW_MIRROR_STATE_ID;
+    fr.dlc          = BCAN_POW_MIRROR_STATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_pow_mirror_state_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_pow_mirror_state_decode_any(const CanFrame* fr, void* m){
+    return bcan_pow_mirror_state_decode(fr, (bcan_pow_mirror_state_t*)m);
+}
+
+// ---- 0x203 POW_WHEEL_STATE (3 bytes, POW_WHEEL)
+#define BCAN_POW_WHEEL_STATE_ID   0x203u
+#define BCAN_POW_WHEEL_STATE_LEN  3
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_POW_WHEEL_STATE_LEN) && BCAN_POW_WHEEL_STATE_LEN <= CAN_FRAME_DATA_MAX, "POW_WHEEL_STATE: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_POW_WHEEL_STATE_LEN * 8, "POW_WHEEL_STATE.sig_wheel_position: out of frame");
+CANDB_STATIC_ASSERT(15 < BCAN_POW_WHEEL_STATE_LEN * 8, "POW_WHEEL_STATE.sig_wheel_angle: out of frame");
+CANDB_STATIC_ASSERT(23 < BCAN_POW_WHEEL_STATE_LEN * 8, "POW_WHEEL_STATE.sig_wheel_status: out of frame");
+
+typedef struct {
+    uint8_t   sig_wheel_position;  // [0..100] %
+    uint8_t   sig_wheel_angle;  // [0..180] deg
+    uint8_t   sig_wheel_status;
+} bcan_pow_wheel_state_t;
+
+static inline void bcan_pow_wheel_state_unpack(bcan_pow_wheel_state_t* m, const uint8_t* d){
+    const uint32_t r_sig_wheel_position = (uint32_t)d[0];
+    m->sig_wheel_position = (uint8_t)(r_sig_wheel_position);
+    const uint32_t r_sig_wheel_angle = (uint32_t)d[1];
+    m->sig_wheel_angle = (uint8_t)(r_sig_wheel_angle);
+    const uint32_t r_sig_wheel_status = (uint32_t)d[2];
+    m->sig_wheel_status = (uint8_t)(r_sig_wheel_status);
+}
+
+static inline void bcan_pow_wheel_state_pack(uint8_t* d, const bcan_pow_wheel_state_t* m){
+    uint8_t v_sig_wheel_position = m->sig_wheel_position;
+    v_sig_wheel_position = v_sig_wheel_position > 100 ? 100 : v_sig_wheel_position;
+    const uint32_t r_sig_wheel_position = (uint32_t)v_sig_wheel_position;
+    uint8_t v_sig_wheel_angle = m->sig_wheel_angle;
+    v_sig_wheel_angle = v_sig_wheel_angle > 180 ? 180 : v_sig_wheel_angle;
+    const uint32_t r_sig_wheel_angle = (uint32_t)v_sig_wheel_angle;
+    const uint32_t r_sig_wheel_status = (uint32_t)m->sig_wheel_status;
+    d[0] = (uint8_t)(r_sig_wheel_position);
+    d[1] = (uint8_t)(r_sig_wheel_angle);
+    d[2] = (uint8_t)(r_sig_wheel_status);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_pow_wheel_state_decode(const CanFrame* fr, bcan_pow_wheel_state_t* m){
+    bcan_pow_wheel_state_unpack(m, fr->data);
+    return fr->dlc >= BCAN_POW_WHEEL_STATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_pow_wheel_state_encode(const bcan_pow_wheel_state_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_POW_WHEEL_STATE_ID;
+    fr.dlc          = BCAN_POW_WHEEL_STATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_pow_wheel_state_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_pow_wheel_state_decode_any(const CanFrame* fr, void* m){
+    return bcan_pow_wheel_state_decode(fr, (bcan_pow_wheel_state_t*)m);
+}
+
+// ---- 0x301 DCU_SEAT_BUTTON (4 bytes, DCU)
+#define BCAN_DCU_SEAT_BUTTON_ID   0x301u
+#define BCAN_DCU_SEAT_BUTTON_LEN  4
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_SEAT_BUTTON_LEN) && BCAN_DCU_SEAT_BUTTON_LEN <= CAN_FRAME_DATA_MAX, "DCU_SEAT_BUTTON: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_SEAT_BUTTON_LEN * 8, "DCU_SEAT_BUTTON.sig_seat_position_button: out of frame");
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_POSITION_BUTTON_NEUTRAL 0
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_POSITION_BUTTON_PLUS 1
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_POSITION_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_SEAT_BUTTON_LEN * 8, "DCU_SEAT_BUTTON.sig_seat_angle_button: out of frame");
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_ANGLE_BUTTON_NEUTRAL 0
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_ANGLE_BUTTON_PLUS 1
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_ANGLE_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(23 < BCAN_DCU_SEAT_BUTTON_LEN * 8, "DCU_SEAT_BUTTON.sig_seat_front_height_button: out of frame");
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_FRONT_HEIGHT_BUTTON_NEUTRAL 0
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_FRONT_HEIGHT_BUTTON_PLUS 1
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_FRONT_HEIGHT_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(31 < BCAN_DCU_SEAT_BUTTON_LEN * 8, "DCU_SEAT_BUTTON.sig_seat_rear_height_button: out of frame");
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_REAR_HEIGHT_BUTTON_NEUTRAL 0
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_REAR_HEIGHT_BUTTON_PLUS 1
+#define BCAN_DCU_SEAT_BUTTON_SIG_SEAT_REAR_HEIGHT_BUTTON_MINUS 2
+
+typedef struct {
+    uint8_t   sig_seat_position_button;  // [0..2]
+    uint8_t   sig_seat_angle_button;  // [0..2]
+    uint8_t   sig_seat_front_height_button;  // [0..2]
+    uint8_t   sig_seat_rear_height_button;  // [0..2]
+} bcan_dcu_seat_button_t;
+
+static inline void bcan_dcu_seat_button_unpack(bcan_dcu_seat_button_t* m, const uint8_t* d){
+    const uint32_t r_sig_seat_position_button = (uint32_t)d[0];
+    m->sig_seat_position_button = (uint8_t)(r_sig_seat_position_button);
+    const uint32_t r_sig_seat_angle_button = (uint32_t)d[1];
+    m->sig_seat_angle_button = (uint8_t)(r_sig_seat_angle_button);
+    const uint32_t r_sig_seat_front_height_button = (uint32_t)d[2];
+    m->sig_seat_front_height_button = (uint8_t)(r_sig_seat_front_height_button);
+    const uint32_t r_sig_seat_rear_height_button = (uint32_t)d[3];
+    m->sig_seat_rear_height_button = (uint8_t)(r_sig_seat_rear_height_button);
+}
+
+static inline void bcan_dcu_seat_button_pack(uint8_t* d, const bcan_dcu_seat_button_t* m){
+    uint8_t v_sig_seat_position_button = m->sig_seat_position_button;
+    v_sig_seat_position_button = v_sig_seat_position_button > 2 ? 2 : v_sig_seat_position_button;
+    const uint32_t r_sig_seat_position_button = (uint32_t)v_sig_seat_position_button;
+    uint8_t v_sig_seat_angle_button = m->sig_seat_angle_button;
+    v_sig_seat_angle_button = v_sig_seat_angle_button > 2 ? 2 : v_sig_seat_angle_button;
+    const uint32_t r_sig_seat_angle_button = (uint32_t)v_sig_seat_angle_button;
+    uint8_t v_sig_seat_front_height_button = m->sig_seat_front_height_button;
+    v_sig_seat_front_height_button = v_sig_seat_front_height_button > 2 ? 2 : v_sig_seat_front_height_button;
+    const uint32_t r_sig_seat_front_height_button = (uint32_t)v_sig_seat_front_height_button;
+    uint8_t v_sig_seat_rear_height_button = m->sig_seat_rear_height_button;
+    v_sig_seat_rear_height_button = v_sig_seat_rear_height_button > 2 ? 2 : v_sig_seat_rear_height_button;
+    const uint32_t r_sig_seat_rear_height_button = (uint32_t)v_sig_seat_rear_height_button;
+    d[0] = (uint8_t)(r_sig_seat_position_button);
+    d[1] = (uint8_t)(r_sig_seat_angle_button);
+    d[2] = (uint8_t)(r_sig_seat_front_height_button);
+    d[3] = (uint8_t)(r_sig_seat_rear_height_button);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_seat_button_decode(const CanFrame* fr, bcan_dcu_seat_button_t* m){
+    bcan_dcu_seat_button_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_SEAT_BUTTON_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_seat_button_encode(const bcan_dcu_seat_button_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_SEAT_BUTTON_ID;
+    fr.dlc          = BCAN_DCU_SEAT_BUTTON_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_seat_button_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_seat_button_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_seat_button_decode(fr, (bcan_dcu_seat_button_t*)m);
+}
+
+// ---- 0x302 DCU_MIRROR_BUTTON (6 bytes, DCU)
+#define BCAN_DCU_MIRROR_BUTTON_ID   0x302u
+#define BCAN_DCU_MIRROR_BUTTON_LEN  6
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_MIRROR_BUTTON_LEN) && BCAN_DCU_MIRROR_BUTTON_LEN <= CAN_FRAME_DATA_MAX, "DCU_MIRROR_BUTTON: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_left_yaw_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_YAW_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_YAW_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_YAW_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_left_pitch_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_PITCH_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_PITCH_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_PITCH_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(23 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_right_yaw_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_YAW_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_YAW_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_YAW_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(31 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_right_pitch_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_PITCH_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_PITCH_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_PITCH_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(39 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_room_yaw_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_YAW_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_YAW_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_YAW_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(47 < BCAN_DCU_MIRROR_BUTTON_LEN * 8, "DCU_MIRROR_BUTTON.sig_mirror_room_pitch_button: out of frame");
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_PITCH_BUTTON_NEUTRAL 0
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_PITCH_BUTTON_PLUS 1
+#define BCAN_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_PITCH_BUTTON_MINUS 2
+
+typedef struct {
+    uint8_t   sig_mirror_left_yaw_button;  // [0..2]
+    uint8_t   sig_mirror_left_pitch_button;  // [0..2]
+    uint8_t   sig_mirror_right_yaw_button;  // [0..2]
+    uint8_t   sig_mirror_right_pitch_button;  // [0..2]
+    uint8_t   sig_mirror_room_yaw_button;  // [0..2]
+    uint8_t   sig_mirror_room_pitch_button;  // [0..2]
+} bcan_dcu_mirror_button_t;
+
+static inline void bcan_dcu_mirror_button_unpack(bcan_dcu_mirror_button_t* m, const uint8_t* d){
+    const uint32_t r_sig_mirror_left_yaw_button = (uint32_t)d[0];
+    m->sig_mirror_left_yaw_button = (uint8_t)(r_sig_mirror_left_yaw_button);
+    const uint32_t r_sig_mirror_left_pitch_button = (uint32_t)d[1];
+    m->sig_mirror_left_pitch_button = (uint8_t)(r_sig_mirror_left_pitch_button);
+    const uint32_t r_sig_mirror_right_yaw_button = (uint32_t)d[2];
+    m->sig_mirror_right_yaw_button = (uint8_t)(r_sig_mirror_right_yaw_button);
+    const uint32_t r_sig_mirror_right_pitch_button = (uint32_t)d[3];
+    m->sig_mirror_right_pitch_button = (uint8_t)(r_sig_mirror_right_pitch_button);
+    const uint32_t r_sig_mirror_room_yaw_button = (uint32_t)d[4];
+    m->sig_mirror_room_yaw_button = (uint8_t)(r_sig_mirror_room_yaw_button);
+    const uint32_t r_sig_mirror_room_pitch_button = (uint32_t)d[5];
+    m->sig_mirror_room_pitch_button = (uint8_t)(r_sig_mirror_room_pitch_button);
+}
+
+static inline void bcan_dcu_mirror_button_pack(uint8_t* d, const bcan_dcu_mirror_button_t* m){
+    uint8_t v_sig_mirror_left_yaw_button = m->sig_mirror_left_yaw_button;
+    v_sig_mirror_left_yaw_button = v_sig_mirror_left_yaw_button > 2 ? 2 : v_sig_mirror_left_yaw_button;
+    const uint32_t r_sig_mirror_left_yaw_button = (uint32_t)v_sig_mirror_left_yaw_button;
+    uint8_t v_sig_mirror_left_pitch_button = m->sig_mirror_left_pitch_button;
+    v_sig_mirror_left_pitch_button = v_sig_mirror_left_pitch_button > 2 ? 2 : v_sig_mirror_left_pitch_button;
+    const uint32_t r_sig_mirror_left_pitch_button = (uint32_t)v_sig_mirror_left_pitch_button;
+    uint8_t v_sig_mirror_right_yaw_button = m->sig_mirror_right_yaw_button;
+    v_sig_mirror_right_yaw_button = v_sig_mirror_right_yaw_button > 2 ? 2 : v_sig_mirror_right_yaw_button;
+    const uint32_t r_sig_mirror_right_yaw_button = (uint32_t)v_sig_mirror_right_yaw_button;
+    uint8_t v_sig_mirror_right_pitch_button = m->sig_mirror_right_pitch_button;
+    v_sig_mirror_right_pitch_button = v_sig_mirror_right_pitch_button > 2 ? 2 : v_sig_mirror_right_pitch_button;
+    const uint32_t r_sig_mirror_right_pitch_button = (uint32_t)v_sig_mirror_right_pitch_button;
+    uint8_t v_sig_mirror_room_yaw_button = m->sig_mirror_room_yaw_button;
+    v_sig_mirror_room_yaw_button = v_sig_mirror_room_yaw_button > 2 ? 2 : v_sig_mirror_room_yaw_button;
+    const uint32_t r_sig_mirror_room_yaw_button = (uint32_t)v_sig_mirror_room_yaw_button;
+    uint8_t v_sig_mirror_room_pitch_button = m->sig_mirror_room_pitch_button;
+    v_sig_mirror_room_pitch_button = v_sig_mirror_room_pitch_button > 2 ? 2 : v_sig_mirror_room_pitch_button;
+    const uint32_t r_sig_mirror_room_pitch_button = (uint32_t)v_sig_mirror_room_pitch_button;
+    d[0] = (uint8_t)(r_sig_mirror_left_yaw_button);
+    d[1] = (uint8_t)(r_sig_mirror_left_pitch_button);
+    d[2] = (uint8_t)(r_sig_mirror_right_yaw_button);
+    d[3] = (uint8_t)(r_sig_mirror_right_pitch_button);
+    d[4] = (uint8_t)(r_sig_mirror_room_yaw_button);
+    d[5] = (uint8_t)(r_sig_mirror_room_pitch_button);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_mirror_button_decode(const CanFrame* fr, bcan_dcu_mirror_button_t* m){
+    bcan_dcu_mirror_button_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_MIRROR_BUTTON_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_mirror_button_encode(const bcan_dcu_mirror_button_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_MIRROR_BUTTON_ID;
+    fr.dlc          = BCAN_DCU_MIRROR_BUTTON_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_mirror_button_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_mirror_button_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_mirror_button_decode(fr, (bcan_dcu_mirror_button_t*)m);
+}
+
+// ---- 0x303 DCU_WHEEL_BUTTON (2 bytes, DCU)
+#define BCAN_DCU_WHEEL_BUTTON_ID   0x303u
+#define BCAN_DCU_WHEEL_BUTTON_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(BCAN_DCU_WHEEL_BUTTON_LEN) && BCAN_DCU_WHEEL_BUTTON_LEN <= CAN_FRAME_DATA_MAX, "DCU_WHEEL_BUTTON: invalid length");
+CANDB_STATIC_ASSERT(7 < BCAN_DCU_WHEEL_BUTTON_LEN * 8, "DCU_WHEEL_BUTTON.sig_wheel_position_button: out of frame");
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_POSITION_BUTTON_NEUTRAL 0
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_POSITION_BUTTON_PLUS 1
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_POSITION_BUTTON_MINUS 2
+CANDB_STATIC_ASSERT(15 < BCAN_DCU_WHEEL_BUTTON_LEN * 8, "DCU_WHEEL_BUTTON.sig_wheel_angle_button: out of frame");
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_ANGLE_BUTTON_NEUTRAL 0
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_ANGLE_BUTTON_PLUS 1
+#define BCAN_DCU_WHEEL_BUTTON_SIG_WHEEL_ANGLE_BUTTON_MINUS 2
+
+typedef struct {
+    uint8_t   sig_wheel_position_button;  // [0..2]
+    uint8_t   sig_wheel_angle_button;  // [0..2]
+} bcan_dcu_wheel_button_t;
+
+static inline void bcan_dcu_wheel_button_unpack(bcan_dcu_wheel_button_t* m, const uint8_t* d){
+    const uint32_t r_sig_wheel_position_button = (uint32_t)d[0];
+    m->sig_wheel_position_button = (uint8_t)(r_sig_wheel_position_button);
+    const uint32_t r_sig_wheel_angle_button = (uint32_t)d[1];
+    m->sig_wheel_angle_button = (uint8_t)(r_sig_wheel_angle_button);
+}
+
+static inline void bcan_dcu_wheel_button_pack(uint8_t* d, const bcan_dcu_wheel_button_t* m){
+    uint8_t v_sig_wheel_position_button = m->sig_wheel_position_button;
+    v_sig_wheel_position_button = v_sig_wheel_position_button > 2 ? 2 : v_sig_wheel_position_button;
+    const uint32_t r_sig_wheel_position_button = (uint32_t)v_sig_wheel_position_button;
+    uint8_t v_sig_wheel_angle_button = m->sig_wheel_angle_button;
+    v_sig_wheel_angle_button = v_sig_wheel_angle_button > 2 ? 2 : v_sig_wheel_angle_button;
+    const uint32_t r_sig_wheel_angle_button = (uint32_t)v_sig_wheel_angle_button;
+    d[0] = (uint8_t)(r_sig_wheel_position_button);
+    d[1] = (uint8_t)(r_sig_wheel_angle_button);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t bcan_dcu_wheel_button_decode(const CanFrame* fr, bcan_dcu_wheel_button_t* m){
+    bcan_dcu_wheel_button_unpack(m, fr->data);
+    return fr->dlc >= BCAN_DCU_WHEEL_BUTTON_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame bcan_dcu_wheel_button_encode(const bcan_dcu_wheel_button_t* m){
+    CanFrame fr;
+    fr.id           = BCAN_DCU_WHEEL_BUTTON_ID;
+    fr.dlc          = BCAN_DCU_WHEEL_BUTTON_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    bcan_dcu_wheel_button_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t bcan_dcu_wheel_button_decode_any(const CanFrame* fr, void* m){
+    return bcan_dcu_wheel_button_decode(fr, (bcan_dcu_wheel_button_t*)m);
+}
+
+// ---- BCAN 버스 전체
+typedef union {
+    bcan_dcu_reset_t dcu_reset;
+    bcan_dcu_reset_ack_t dcu_reset_ack;
+    bcan_dcu_seat_order_t dcu_seat_order;
+    bcan_dcu_mirror_order_t dcu_mirror_order;
+    bcan_dcu_wheel_order_t dcu_wheel_order;
+    bcan_pow_seat_state_t pow_seat_state;
+    bcan_pow_mirror_state_t pow_mirror_state;
+    bcan_pow_wheel_state_t pow_wheel_state;
+    bcan_dcu_seat_button_t dcu_seat_button;
+    bcan_dcu_mirror_button_t dcu_mirror_button;
+    bcan_dcu_wheel_button_t dcu_wheel_button;
+} bcan_db_t;
+
+enum {
+    BCAN_MSG_DCU_RESET = 0,
+    BCAN_MSG_DCU_RESET_ACK = 1,
+    BCAN_MSG_DCU_SEAT_ORDER = 2,
+    BCAN_MSG_DCU_MIRROR_ORDER = 3,
+    BCAN_MSG_DCU_WHEEL_ORDER = 4,
+    BCAN_MSG_POW_SEAT_STATE = 5,
+    BCAN_MSG_POW_MIRROR_STATE = 6,
+    BCAN_MSG_POW_WHEEL_STATE = 7,
+    BCAN_MSG_DCU_SEAT_BUTTON = 8,
+    BCAN_MSG_DCU_MIRROR_BUTTON = 9,
+    BCAN_MSG_DCU_WHEEL_BUTTON = 10,
+    BCAN_MSG_COUNT = 11
+};
+
+enum {
+    BCAN_SIG_DCU_RESET_SIG_FLAG = 0,
+    BCAN_SIG_DCU_RESET_ACK_SIG_INDEX = 1,
+    BCAN_SIG_DCU_RESET_ACK_SIG_STATUS = 2,
+    BCAN_SIG_DCU_SEAT_ORDER_SIG_SEAT_POSITION = 3,
+    BCAN_SIG_DCU_SEAT_ORDER_SIG_SEAT_ANGLE = 4,
+    BCAN_SIG_DCU_SEAT_ORDER_SIG_SEAT_FRONT_HEIGHT = 5,
+    BCAN_SIG_DCU_SEAT_ORDER_SIG_SEAT_REAR_HEIGHT = 6,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_LEFT_YAW = 7,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_LEFT_PITCH = 8,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_RIGHT_YAW = 9,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_RIGHT_PITCH = 10,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_ROOM_YAW = 11,
+    BCAN_SIG_DCU_MIRROR_ORDER_SIG_MIRROR_ROOM_PITCH = 12,
+    BCAN_SIG_DCU_WHEEL_ORDER_SIG_WHEEL_POSITION = 13,
+    BCAN_SIG_DCU_WHEEL_ORDER_SIG_WHEEL_ANGLE = 14,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_POSITION = 15,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_ANGLE = 16,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_FRONT_HEIGHT = 17,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_REAR_HEIGHT = 18,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_IS_SEATED = 19,
+    BCAN_SIG_POW_SEAT_STATE_SIG_SEAT_STATUS = 20,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_LEFT_YAW = 21,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_LEFT_PITCH = 22,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_RIGHT_YAW = 23,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_RIGHT_PITCH = 24,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_ROOM_YAW = 25,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_ROOM_PITCH = 26,
+    BCAN_SIG_POW_MIRROR_STATE_SIG_MIRROR_STATUS = 27,
+    BCAN_SIG_POW_WHEEL_STATE_SIG_WHEEL_POSITION = 28,
+    BCAN_SIG_POW_WHEEL_STATE_SIG_WHEEL_ANGLE = 29,
+    BCAN_SIG_POW_WHEEL_STATE_SIG_WHEEL_STATUS = 30,
+    BCAN_SIG_DCU_SEAT_BUTTON_SIG_SEAT_POSITION_BUTTON = 31,
+    BCAN_SIG_DCU_SEAT_BUTTON_SIG_SEAT_ANGLE_BUTTON = 32,
+    BCAN_SIG_DCU_SEAT_BUTTON_SIG_SEAT_FRONT_HEIGHT_BUTTON = 33,
+    BCAN_SIG_DCU_SEAT_BUTTON_SIG_SEAT_REAR_HEIGHT_BUTTON = 34,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_YAW_BUTTON = 35,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_LEFT_PITCH_BUTTON = 36,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_YAW_BUTTON = 37,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_RIGHT_PITCH_BUTTON = 38,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_YAW_BUTTON = 39,
+    BCAN_SIG_DCU_MIRROR_BUTTON_SIG_MIRROR_ROOM_PITCH_BUTTON = 40,
+    BCAN_SIG_DCU_WHEEL_BUTTON_SIG_WHEEL_POSITION_BUTTON = 41,
+    BCAN_SIG_DCU_WHEEL_BUTTON_SIG_WHEEL_ANGLE_BUTTON = 42,
+    BCAN_SIG_COUNT = 43
+};
+
+static const CanDbSignal bcan_db_signals[BCAN_SIG_COUNT] = {
+    { "sig_flag", 0, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_index", 1, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_status", 1, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_seat_position", 2, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_angle", 2, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_seat_front_height", 2, 16, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_rear_height", 2, 24, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_mirror_left_yaw", 3, 0, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_left_pitch", 3, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_yaw", 3, 16, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_pitch", 3, 24, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_yaw", 3, 32, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_pitch", 3, 40, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_wheel_position", 4, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_wheel_angle", 4, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_seat_position", 5, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_angle", 5, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_seat_front_height", 5, 16, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_rear_height", 5, 24, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_is_seated", 5, 32, 8, 0, 1.0, 0.0, 0.0, 1.0 },
+    { "sig_seat_status", 5, 40, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_mirror_left_yaw", 6, 0, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_left_pitch", 6, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_yaw", 6, 16, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_pitch", 6, 24, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_yaw", 6, 32, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_pitch", 6, 40, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_status", 6, 48, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_wheel_position", 7, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_wheel_angle", 7, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_wheel_status", 7, 16, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_seat_position_button", 8, 0, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_seat_angle_button", 8, 8, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_seat_front_height_button", 8, 16, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_seat_rear_height_button", 8, 24, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_left_yaw_button", 9, 0, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_left_pitch_button", 9, 8, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_right_yaw_button", 9, 16, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_right_pitch_button", 9, 24, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_room_yaw_button", 9, 32, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_mirror_room_pitch_button", 9, 40, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_wheel_position_button", 10, 0, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+    { "sig_wheel_angle_button", 10, 8, 8, 0, 1.0, 0.0, 0.0, 2.0 },
+};
+
+static const CanDbMessage bcan_db_messages[BCAN_MSG_COUNT] = {
+    { "DCU_RESET", 0x001u, 0, 1, 0, 1, bcan_dcu_reset_decode_any },
+    { "DCU_RESET_ACK", 0x002u, 0, 2, 1, 2, bcan_dcu_reset_ack_decode_any },
+    { "DCU_SEAT_ORDER", 0x101u, 0, 4, 3, 4, bcan_dcu_seat_order_decode_any },
+    { "DCU_MIRROR_ORDER", 0x102u, 0, 6, 7, 6, bcan_dcu_mirror_order_decode_any },
+    { "DCU_WHEEL_ORDER", 0x103u, 0, 2, 13, 2, bcan_dcu_wheel_order_decode_any },
+    { "POW_SEAT_STATE", 0x201u, 0, 6, 15, 6, bcan_pow_seat_state_decode_any },
+    { "POW_MIRROR_STATE", 0x202u, 0, 7, 21, 7, bcan_pow_mirror_state_decode_any },
+    { "POW_WHEEL_STATE", 0x203u, 0, 3, 28, 3, bcan_pow_wheel_state_decode_any },
+    { "DCU_SEAT_BUTTON", 0x301u, 0, 4, 31, 4, bcan_dcu_seat_button_decode_any },
+    { "DCU_MIRROR_BUTTON", 0x302u, 0, 6, 35, 6, bcan_dcu_mirror_button_decode_any },
+    { "DCU_WHEEL_BUTTON", 0x303u, 0, 2, 41, 2, bcan_dcu_wheel_button_decode_any },
+};
+
+static const CanDb bcan_db = { bcan_db_messages, bcan_db_signals, BCAN_MSG_COUNT, BCAN_SIG_COUNT };
+
+// 표준 ID → (메시지 인덱스 + 1), 0은 미등록
+static const uint8_t bcan_db_slot[0x304] = {
+     0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x000
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x010
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x020
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x030
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x040
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x050
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x060
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x070
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x080
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x090
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0A0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0B0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0C0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0D0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0E0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0F0
+     0, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x100
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x110
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x120
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x130
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x140
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x150
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x160
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x170
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x180
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x190
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1A0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1B0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1C0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1D0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1E0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1F0
+     0, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x200
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x210
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x220
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x230
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x240
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x250
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x260
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x270
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x280
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x290
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2A0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2B0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2C0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2D0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2E0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x2F0
+     0, 9,10,11,  // 0x300
+};
+
+static inline const CanDbMessage* bcan_db_find(uint32_t id, uint32_t flags){
+    if (flags & CAN_FRAME_EXTID) return NULL;
+    if (id >= sizeof(bcan_db_slot) / sizeof(bcan_db_slot[0]) || !bcan_db_slot[id]) return NULL;
+    return &bcan_db_messages[bcan_db_slot[id] - 1];
+}
+
+// ID로 디코더를 찾아 out의 해당 멤버에 unpack. msg에는 찾은 메시지 디스크립터 (NULL 가능)
+static inline can_err_t bcan_db_decode(const CanFrame* fr, bcan_db_t* out, const CanDbMessage** msg){
+    const CanDbMessage* m = bcan_db_find(fr->id, fr->flags);
+    if (msg) *msg = m;
+    if (!m) return CAN_ERR_INVALID;
+    return m->decode(fr, out);
+}
+
+static inline const CanDbSignal* bcan_db_signal(const char* msg, const char* sig){
+    for (size_t i = 0; i < BCAN_SIG_COUNT; ++i) {
+        const CanDbSignal* s = &bcan_db_signals[i];
+        if (!strcmp(s->name, sig) && !strcmp(bcan_db_messages[s->msg].name, msg)) return s;
+    }
+    return NULL;
+}
@@ -6,6 +6,8 @@ typedef enum {
     CAN_DEVICE_NONE = 0,
     CAN_DEVICE_LINUX,
     CAN_DEVICE_ESP32,
+    CAN_DEVICE_RECORD,      // Linux 어댑터 + 채널별 송수신 프레임을 트레이스 파일로 기록 (can_trace_config)
+    CAN_DEVICE_REPLAY,      // 기록한 트레이스를 수신 프레임으로 재생 (버스 없음, 송신은 버림)
 } can_device_t;
 
 typedef enum {
@@ -37,9 +39,14 @@ typedef enum {
 typedef enum {
     CAN_FRAME_EXTID = 1 << 0,
     CAN_FRAME_RTR = 1 << 1,
-    CAN_FRAME_ERR = 1 << 2
+    CAN_FRAME_ERR = 1 << 2,
+    CAN_FRAME_FD  = 1 << 3,     // CAN FD 프레임 (데이터 최대 64바이트)
+    CAN_FRAME_BRS = 1 << 4,     // FD: 데이터 구간 비트레이트 전환 (CanConfig.dataBitrate)
+    CAN_FRAME_ESI = 1 << 5      // FD: 송신 노드가 error passive (수신 시에만 의미)
 } can_frame_flag_t;
 
+#define CAN_FRAME_DATA_MAX      64  // CanFrame.data 크기 (FD 최대 길이)
+
 typedef enum {
     CAN_FILTER_RANGE = 0,
     CAN_FILTER_MASK,
@@ -57,9 +64,10 @@ typedef struct {
 
 typedef struct {
     uint32_t id;      // 11-bit ID 사용 가정
-    uint8_t  dlc;
-    uint8_t  data[8];
+    uint8_t  dlc;     // 데이터 길이(바이트). 클래식 0~8, FD는 0~8,12,16,20,24,32,48,64
+    uint8_t  data[CAN_FRAME_DATA_MAX];
     uint32_t flags;
+    uint64_t timestamp_ns;  // 수신 시각 (CLOCK_MONOTONIC 기준 ns, 송신 프레임은 무시)
 } CanFrame;
 
 typedef struct {
@@ -68,21 +76,314 @@ typedef struct {
     float       samplePoint;
     int         sjw;
     can_mode_t  mode;
+    int         batchSize;      // 한 번의 시스템 콜로 송수신할 최대 프레임 수 (0이면 어댑터 기본값)
+    int         fd;             // 1이면 CAN FD 채널 (FD 프레임 송수신 허용)
+    int         dataBitrate;    // FD 데이터 구간 비트레이트 (0이면 bitrate와 같음)
+    float       dataSamplePoint;// FD 데이터 구간 샘플 포인트 (0이면 드라이버 기본값)
+    int         rxQueueDepth;   // can_recv 수신 링 크기. 0이면 첫 can_recv 때 기본값(256)으로 만들고,
+                                // 양수면 can_open 때부터 받아 둔다 (구독 필터와 무관하게 전체 수신)
+    int         txQueueDepth;   // 소켓 txqueue가 찼을 때 프레임을 ID 우선순위 순으로 잡아 두는 소프트웨어 큐 크기
+                                // (0이면 64, 음수면 끔. Linux)
+    int         ifTxQueueLen;   // 인터페이스 txqueuelen (ip link ... txqueuelen). 0이면 그대로 (Linux)
+    int         restartMs;      // bus-off 자동 재시작 (ip link ... restart-ms). 0이면 그대로, 음수면 끔 (Linux)
+    int         bcmJobs;        // 1이면 고정 프레임 Job을 커널 BCM 타이머에 맡김 (Linux, can_register_job 주석 참고)
 } CanConfig;
 
+// 주기 송신 Job 통계 (can_get_job_stats)
+typedef struct {
+    uint32_t    period_ms;
+    uint64_t    sent;           // 송신 성공 횟수 (TX 큐를 거친 프레임은 실제로 나갔을 때 센다)
+    uint64_t    failed;         // 송신 실패 (txqueue와 TX 큐가 모두 가득 참, 큐에서 밀려남, 다음 주기까지 못 나감 등)
+    uint64_t    skipped;        // 스케줄이 밀려 건너뛴 주기 수
+    uint32_t    late_avg_us;    // 만기 시각 대비 실제 송신 지연 평균
+    uint32_t    late_max_us;    // 〃 최대
+    uint32_t    jitter_max_us;  // |실제 송신 간격 - 주기| 최대
+} CanJobStats;
+
+// 구독 전달 방식 (can_subscribe_ex)
+typedef enum {
+    CAN_SUB_INLINE = 0,             // 기본: 어댑터 RX 스레드에서 바로 콜백
+    CAN_SUB_ASYNC_WORKER,           // 구독별 링 버퍼 + 전용 워커 스레드가 콜백
+    CAN_SUB_ASYNC_POLL              // 구독별 링 버퍼, 호출자가 can_sub_fd/can_sub_drain으로 꺼냄
+} can_sub_mode_t;
+
+// 링이 가득 찼을 때의 처리
+typedef enum {
+    CAN_SUB_DROP_OLDEST = 0,        // 가장 오래된 프레임을 덮어쓴다 (RX 스레드는 멈추지 않음)
+    CAN_SUB_BLOCK                   // 빈 자리가 날 때까지 RX 스레드가 기다린다 (최대 block_timeout_ms, 그 뒤엔 DROP_OLDEST처럼)
+                                    // 주의: RX 스레드는 어댑터에 하나 (Linux reactor, ESP32 RX 태스크) → 기다리는 동안
+                                    //       모든 채널의 수신, 주기 송신, TX 큐, BCM 처리가 같이 멈춘다
+} can_sub_overflow_t;
+
+typedef struct {
+    can_sub_mode_t      mode;
+    uint32_t            depth;      // 링 크기 (2의 거듭제곱으로 올림, 0이면 64)
+    can_sub_overflow_t  overflow;
+    uint32_t            block_timeout_ms;   // CAN_SUB_BLOCK에서 프레임 하나당 기다리는 최대 시간 (0이면 10 ms)
+} CanSubOptions;
+
+// 비동기 구독 통계 (can_sub_get_stats)
+typedef struct {
+    uint64_t    delivered;      // 콜백으로 전달된 프레임 수
+    uint64_t    dropped;        // 링이 가득 차 덮어쓴 프레임 수 (CAN_SUB_BLOCK은 block_timeout_ms를 넘긴 경우)
+    uint64_t    blocked;        // CAN_SUB_BLOCK에서 RX 스레드가 기다린 횟수
+    uint32_t    depth;
+    uint32_t    high_water;     // 링에 쌓였던 최대 프레임 수
+} CanSubStats;
+
+// 수신 지연 히스토그램 (can_get_latency)
+// 커널(ESP32는 드라이버)이 프레임을 받은 시각부터 채널이 콜백을 부르기 직전까지의 시간.
+// bucket[i]는 [2^i, 2^(i+1)) us 구간, bucket[0]은 2us 미만, 마지막 칸은 그 이상 전부.
+#define CAN_LATENCY_BUCKETS 20
+typedef struct {
+    uint64_t    count;
+    uint64_t    sum_us;
+    uint32_t    max_us;
+    uint64_t    bucket[CAN_LATENCY_BUCKETS];
+} CanLatencyHist;
+
+// 채널/버스 통계 (can_get_stats)
+// *_fps, *_Bps, bus_load는 같은 채널에 대한 직전 can_get_stats 호출 이후 구간의 평균.
+typedef struct {
+    can_bus_state_t state;
+    uint8_t     tx_err_counter;     // 컨트롤러 TEC/REC (드라이버가 알려준 마지막 값)
+    uint8_t     rx_err_counter;
+
+    uint64_t    rx_frames;
+    uint64_t    rx_bytes;
+    uint64_t    tx_frames;          // Job 포함, 실제로 소켓/드라이버에 넘긴 것
+    uint64_t    tx_bytes;
+    uint64_t    tx_failed;
+    uint64_t    tx_queued;          // 소켓이 가득 차 TX 큐를 거친 프레임 (Linux)
+    uint64_t    tx_late;            // 큐에서 기한(can_send timeout, Job은 다음 주기) 안에 못 나가 버린 프레임
+    uint64_t    tx_dropped;         // 큐가 가득 차 더 높은 우선순위 프레임에 밀려나거나 거절된 프레임
+    uint32_t    tx_queue_high_water;
+    uint64_t    bus_time_ns;        // 송수신 프레임의 버스 점유 시간 추정 누적 (스터핑 비트 제외)
+
+    uint64_t    err_frames;         // 수신한 에러 프레임/이벤트 수
+    uint64_t    bus_errors;         // 프로토콜/ACK/트랜시버 에러
+    uint64_t    arb_lost;
+    uint64_t    rx_overflows;       // 컨트롤러/드라이버 수신 오버플로
+    uint64_t    bus_off_count;
+    uint64_t    recv_dropped;       // can_recv 링이 가득 차 덮어쓴 프레임 (가장 오래된 것부터)
+    uint32_t    recv_high_water;    // can_recv 링 최대 사용량
+    uint32_t    link_setup_us;      // can_open 때 인터페이스 bring-up에 걸린 시간 (Linux. 이미 같은 설정이면 조회 시간만)
+
+    float       rx_fps;
+    float       rx_Bps;
+    float       tx_fps;
+    float       tx_Bps;
+    float       bus_load;           // % (bus_time_ns 증가분 / 경과 시간)
+} CanStats;
+
+// ID별 수신 통계 (can_stats_enable 후 can_get_id_stats)
+typedef struct {
+    uint32_t    id;
+    uint32_t    flags;              // CAN_FRAME_EXTID
+    uint64_t    count;
+    float       rate_hz;            // 평균 도착 간격 기준
+    uint32_t    period_avg_us;      // 도착 간격 평균 (EWMA 1/16)
+    uint32_t    jitter_avg_us;      // |간격 - 평균| 의 EWMA
+    uint32_t    jitter_max_us;      // |간격 - 평균| 최대
+    uint32_t    age_ms;             // 마지막 수신 후 경과
+} CanIdStats;
+
+// 내용 변화 구독 (can_subscribe_on_change, Linux CAN_BCM RX_SETUP)
+// id 프레임의 (data & mask)나 길이가 바뀔 때만 콜백한다. 첫 프레임은 항상 전달.
+typedef struct {
+    uint32_t    id;
+    uint32_t    flags;                      // CAN_FRAME_EXTID, CAN_FRAME_FD (FD 프레임만 감시)
+    uint8_t     mask[CAN_FRAME_DATA_MAX];   // 비교할 비트
+    uint8_t     len;                        // mask 길이 (0이면 전체 바이트 비교)
+    uint32_t    timeout_ms;                 // 이 시간 동안 수신이 없으면 on_timeout (0: 감시 안 함)
+} CanChangeFilter;
+
+// ISO-TP (ISO 15765-2) 연결 (can_isotp_open). 한 쌍의 ID로 최대 4095바이트 메시지를 분할/재조립한다.
+// Linux는 커널 CAN_ISOTP 소켓을 쓰고, 없으면(ESP32 포함) 라이브러리 안의 사용자 공간 구현을 쓴다.
+#define CAN_ISOTP_MAX_LEN       4095
+#define CAN_ISOTP_PAD(b)        (0x100u | (uint8_t)(b))     // CanIsoTpConfig.padding
+
+typedef struct {
+    uint32_t    tx_id;          // 이 노드가 보내는 ID (SF/FF/CF, 상대 메시지에 대한 FC)
+    uint32_t    rx_id;          // 상대가 보내는 ID
+    uint32_t    flags;          // CAN_FRAME_EXTID (두 ID 모두), CAN_FRAME_FD (64바이트 프레임으로 분할), CAN_FRAME_BRS
+    uint8_t     block_size;     // 받을 때 FC에 실을 BS: CF를 이만큼 받을 때마다 FC (0: FF에 한 번만)
+    uint8_t     stmin;          // 받을 때 FC에 실을 STmin (0x00~0x7F: ms, 0xF1~0xF9: 100~900us)
+    uint16_t    padding;        // 0: 패딩 안 함, CAN_ISOTP_PAD(x): 짧은 프레임을 x로 채움 (FD는 항상 채움)
+    uint32_t    timeout_ms;     // FC/CF 대기 (N_Bs, N_Cr). 0이면 1000 (커널 구현은 고정 1초)
+    uint16_t    rx_queue;       // 다 받았지만 아직 can_isotp_recv로 꺼내지 않은 메시지 수 (0이면 4, 사용자 공간 구현)
+} CanIsoTpConfig;
+
+typedef void (*can_timeout_callback_t)(uint32_t id, void* user);
+
+// 주기 프레임 감시 (can_watch_period). 채널마다 감시 스레드 하나가 모든 감시의 만기를 처리한다.
+// 마지막 도착(처음엔 감시 시작) 후 expected_ms * (1 + tolerance) 안에 안 오면 TIMEOUT 한 번,
+// 그 뒤 다시 들어오면 RECOVERED 한 번. 콜백은 감시 스레드에서 불린다.
+typedef enum {
+    CAN_PERIOD_TIMEOUT = 0,
+    CAN_PERIOD_RECOVERED,
+} can_period_event_t;
+
+typedef void (*can_period_callback_t)(uint32_t id, can_period_event_t ev, void* user);
+
+typedef struct {
+    uint32_t    id;
+    uint32_t    expected_ms;
+    uint64_t    count;              // 받은 프레임 수
+    uint64_t    timeouts;           // TIMEOUT 횟수
+    uint32_t    min_us;             // 도착 간격 (프레임 2개 이상부터)
+    uint32_t    avg_us;
+    uint32_t    max_us;
+    uint32_t    age_ms;             // 마지막 수신 후 경과 (받기 전엔 감시 시작 후 경과)
+    int         timed_out;          // 지금 타임아웃 상태
+} CanPeriodStats;
+
+// 신호 단위 변화 구독 (can_subscribe_signal). dbcgen.py가 만든 버스 테이블(candb.h의 CanDb, 예: &bcan_db)에서
+// sig번 신호를 프레임마다 한 번 디코드하고, 마지막으로 알린 값에서 deadband보다 많이 움직였을 때만 콜백한다.
+// 처음 받은 값은 old_value = NAN으로 알린다. 콜백은 RX 스레드에서 불린다.
+struct CanDb;
+typedef void (*can_signal_callback_t)(uint16_t sig, double old_value, double new_value, void* user);
+
+// 채널 간 게이트웨이 경로 (can_route_add). src로 받은 프레임 중 필터에 맞는 것을 고쳐서 dst로 내보낸다.
+// Linux는 커널 CAN_GW 규칙(can-gw 모듈)으로 걸어 프레임이 사용자 공간을 거치지 않고, 규칙을 못 걸면
+// (모듈 없음, CAP_NET_ADMIN 없음, 기록/재생 어댑터, ESP32, 규칙이 너무 많이 필요한 필터) src 구독에서 dst로
+// 보내는 사용자 공간 전달로 같은 일을 한다. 고침은 커널과 같이 AND → OR → XOR → SET 순서 (연산마다 하나).
+typedef enum {
+    CAN_ROUTE_AND = 0,
+    CAN_ROUTE_OR,
+    CAN_ROUTE_XOR,
+    CAN_ROUTE_SET,
+} can_route_op_t;
+
+#define CAN_ROUTE_MOD_ID        0x01    // ID (SET은 value.flags의 EXTID/RTR도 같이 바꾼다)
+#define CAN_ROUTE_MOD_LEN       0x02    // 데이터 길이
+#define CAN_ROUTE_MOD_DATA      0x04    // 데이터 (클래식 8바이트, FD 64바이트)
+#define CAN_ROUTE_MOD_FLAGS     0x08    // BRS/ESI (FD 경로만)
+
+typedef struct {
+    can_route_op_t  op;
+    uint8_t         fields;     // CAN_ROUTE_MOD_*
+    CanFrame        value;      // 연산 값 (fields에 해당하는 필드만 본다)
+} CanRouteMod;
+
+#define CAN_ROUTE_FD            0x01    // can_route_add flags: FD 프레임만 전달 (없으면 클래식 프레임만)
+
+typedef struct {
+    uint64_t    forwarded;      // dst로 보낸 프레임
+    uint64_t    dropped;        // dst 송신 실패
+    uint64_t    deleted;        // 고친 뒤 길이가 맞지 않아 버린 프레임 (커널은 hop 제한 포함)
+    uint32_t    rules;          // 커널 규칙 수 (0: 사용자 공간 전달)
+} CanRouteStats;
+
+// 기록/재생 어댑터 설정 (can_trace_config, can_init 전에). 채널마다 <dir>/<채널 이름>.cantrace 하나 (형식은 cantrace.h)
+typedef struct {
+    const char* dir;            // NULL이면 현재 디렉터리
+    float       speed;          // 재생 속도 배율 (1: 기록된 간격 그대로, 2: 두 배 빠르게, 0: 기다리지 않고 최대 속도)
+    uint32_t    loops;          // 재생 반복 횟수 (0이면 1)
+    uint32_t    start_delay_ms; // can_init 후 재생 시작까지 (구독을 마칠 시간). 모든 채널이 같은 시각을 기준으로 맞춰진다
+    size_t      max_bytes;      // 기록 파일 최대 크기 (0이면 64 MiB). 넘치는 프레임은 버린다
+    void      (*on_done)(const char* channel, void* user);     // 채널 재생이 끝났을 때 (재생 스레드에서)
+    void*       user;
+} CanTraceConfig;
+
+// 어댑터 스레드 실행 정책 (can_set_thread_policy).
+// Linux: reactor 스레드 하나 (모든 채널의 수신/송신/Job). ESP32: 채널의 twai_rx / twai_tx 태스크.
+// 비동기 구독 워커, 주기 감시 스레드 등 채널 쪽 스레드는 그대로 둔다.
+typedef struct {
+    int         priority;       // Linux: SCHED_FIFO 1~99 (0: 기본 SCHED_OTHER). ESP32: RX 태스크 우선순위, TX는 하나 아래 (0: 기본 10/9)
+    uint32_t    cpu_mask;       // bit i = CPU(코어) i에 고정 (0: 고정 안 함). ESP32는 비트 하나만 (코어 0/1)
+    uint32_t    stack_size;     // 스택 바이트 (0: 기본). 스레드를 만들 때만 쓰이므로 can_init/can_open 전에
+    int         lock_memory;    // Linux: mlockall로 페이지 폴트를 막음 (CAP_IPC_LOCK 또는 무제한 RLIMIT_MEMLOCK). ESP32는 무시
+    int         fallback_nice;  // Linux: SCHED_FIFO 권한이 없을 때 대신 걸 nice (-20~19, 0: 안 함)
+} CanThreadPolicy;
+typedef void (*can_bus_callback_t)(can_bus_state_t state, void* user);
 typedef void (*can_callback_t)(const CanFrame* frame, void* user);
 typedef void (*can_tx_prepare_cb_t)(CanFrame* io_frame, void* user);
 
+// 이름 검색 없이 채널에 바로 접근하는 핸들 (can_open_h / can_get_h).
+// can_close / can_close_h / can_dispose 전까지 유효하다.
+typedef struct Channel CanChannel;
+
+// ID별 최신 값 우편함 (can_mailbox_open). ID마다 마지막 프레임 한 칸만 두고 RX 스레드가 덮어쓴다.
+// 읽기 함수는 락 없이 어느 스레드에서나 부를 수 있다. can_mailbox_close / can_close 전까지 유효하다.
+typedef struct CanMailbox CanMailbox;
+
+// DLC 코드(0~15) ↔ 데이터 길이(바이트). 9~15는 FD 전용 (12,16,20,24,32,48,64)
+uint8_t     can_dlc_to_len(uint8_t dlc);
+uint8_t     can_len_to_dlc(uint8_t len);   // 딱 맞는 코드가 없으면 올림
+
 can_err_t   can_init(can_device_t device);
 void        can_dispose();
+can_err_t   can_trace_config        (const CanTraceConfig* cfg);    // CAN_DEVICE_RECORD/REPLAY로 can_init 하기 전에
+can_err_t   can_set_thread_policy   (const CanThreadPolicy* policy);    // can_init 전: 만들 때 적용, 뒤: 돌고 있는 스레드에 바로 (스택 제외)
+                                                                    // 권한이 없어 일부만 걸렸으면 CAN_ERR_PERMISSION (동작은 계속, 걸린 만큼만)
 can_err_t   can_open                (const char* name, CanConfig cfg);
 can_err_t   can_close               (const char* name);
 can_err_t   can_send                (const char* name, CanFrame frame, uint32_t timeout_ms);
 can_err_t   can_recv                (const char* name, CanFrame* out, uint32_t timeout_ms);
+// 주기 Job은 기본적으로 reactor가 만기마다 보낸다 (소켓이 가득 차면 TX 큐의 ID 우선순위를 따르고, 통계는 실제 송신 시각 기준).
+// CanConfig.bcmJobs인 Linux 채널에서는 can_register_job을 커널 BCM(TX_SETUP)에 맡겨 송신 때 사용자 공간이 깨지 않는다. 대신:
+//   - TX 큐를 거치지 않으므로 다른 송신과의 우선순위 순서를 보장하지 않는다
+//   - can_get_job_stats는 경과 주기 수로 추정한 sent만 준다 (failed/skipped/지연/지터는 0)
+//   - 보낸 프레임은 같은 채널 구독/can_recv에 올라오지 않는다 (같은 ID를 이 호스트의 다른 소켓이 보내도 함께 걸러짐)
+//   - 같은 채널에 같은 ID의 BCM Job이 이미 있거나 can-bcm 모듈이 없으면 reactor로 처리한다
+// can_update_job은 어느 쪽이든 주기를 유지한 채 다음 송신부터 새 프레임을 보낸다 (BCM Job은 커널 작업의 데이터만 바꿈).
 can_err_t   can_register_job        (const char* name, int* jobId, const CanFrame* frame, uint32_t period_ms);
 can_err_t   can_register_job_dynamic(const char* name, int* jobId, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms);
 can_err_t   can_cancel_job          (const char* name, int jobId);
+can_err_t   can_get_job_stats       (const char* name, int jobId, CanJobStats* out);
+can_err_t   can_update_job          (const char* name, int jobId, const CanFrame* frame);   // 주기 유지, 다음 송신부터 새 프레임
 can_err_t   can_subscribe           (const char* name, int* subId, CanFilter filter, can_callback_t callback, void* user);
-can_err_t   can_unsubscribe         (const char* name, int subId);
+can_err_t   can_unsubscribe         (const char* name, int subId);    // 진행 중인 콜백이 끝난 뒤 반환 (콜백 안에서 부르면 바로)
+can_err_t   can_subscribe_ex        (const char* name, int* subId, CanFilter filter, can_callback_t callback, void* user, const CanSubOptions* opt);
+can_err_t   can_subscribe_on_change (const char* name, int* subId, const CanChangeFilter* filter, can_callback_t callback, can_timeout_callback_t on_timeout, void* user);
+int         can_sub_fd              (const char* name, int subId);
+int         can_sub_drain           (const char* name, int subId, uint32_t maxFrames);
+can_err_t   can_sub_get_stats       (const char* name, int subId, CanSubStats* out);
+can_err_t   can_get_latency         (const char* name, CanLatencyHist* out);
 can_err_t   can_recover             (const char* name);
-can_bus_state_t can_get_status      (const char* name);
\ No newline at end of file
+can_err_t   can_set_bus_callback    (const char* name, can_bus_callback_t cb, void* user);
+can_err_t   can_get_stats           (const char* name, CanStats* out);
+can_err_t   can_stats_enable        (const char* name, int enable);   // ID별 통계 on/off (켜면 커널 필터도 연다)
+can_err_t   can_get_id_stats        (const char* name, CanIdStats* out, size_t max, size_t* count);
+can_err_t   can_isotp_open          (const char* name, int* tpId, const CanIsoTpConfig* cfg);
+can_err_t   can_isotp_send          (const char* name, int tpId, const void* data, size_t len, uint32_t timeout_ms);    // 끝날 때까지 블로킹 (timeout_ms: 전체 제한, 0이면 FC 대기만)
+can_err_t   can_isotp_recv          (const char* name, int tpId, void* buf, size_t cap, size_t* len, uint32_t timeout_ms);   // cap보다 길면 잘라 담고 CAN_ERR_INVALID
+can_err_t   can_isotp_close         (const char* name, int tpId);
+
+// ===== 핸들 API (송수신이 잦은 경로용, 문자열 API는 이 위의 얇은 래퍼) =====
+can_err_t   can_open_h              (const char* name, CanConfig cfg, CanChannel** out);
+CanChannel* can_get_h               (const char* name);
+can_err_t   can_close_h             (CanChannel* ch);
+can_err_t   can_send_h              (CanChannel* ch, const CanFrame* frame, uint32_t timeout_ms);
+can_err_t   can_recv_h              (CanChannel* ch, CanFrame* out, uint32_t timeout_ms);
+can_err_t   can_send_batch_h        (CanChannel* ch, const CanFrame* frames, size_t n, size_t* sent, uint32_t timeout_ms);
+can_err_t   can_recv_batch_h        (CanChannel* ch, CanFrame* out, size_t max, size_t* got, uint32_t timeout_ms);
+can_bus_state_t can_get_status      (const char* name);
+
+// ===== 최신 값 우편함 (주기 신호의 마지막 값만 필요할 때. 콜백/큐 없이 읽는 쪽이 필요할 때 가져간다) =====
+can_err_t   can_mailbox_open        (const char* name, const uint32_t* ids, size_t n, CanMailbox** out);
+can_err_t   can_mailbox_close       (CanMailbox* mb);
+can_err_t   can_mailbox_read        (const CanMailbox* mb, uint32_t id, CanFrame* out, uint64_t* age_ns);  // 아직 못 받았으면 CAN_ERR_AGAIN (age_ns: 수신 후 경과, NULL 가능)
+uint64_t    can_mailbox_generation  (const CanMailbox* mb);    // 내용이 바뀔 때마다 1씩 오른다 (같은 값 재수신은 그대로)
+can_err_t   can_mailbox_changed     (const CanMailbox* mb, uint64_t* gen, uint32_t* ids, size_t max, size_t* count);
+            // *gen 세대 이후 내용이 바뀐 ID를 담고 *gen을 지금 세대로 올린다 (처음엔 0).
+            // max가 모자라면 CAN_ERR_AGAIN (*gen은 그대로). max = can_mailbox_open의 n이면 항상 충분
+
+// ===== 주기 감시 (주기 송신되어야 할 프레임이 끊겼는지. 감시마다 스레드/타이머를 두지 않는다) =====
+can_err_t   can_watch_period        (const char* name, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance,
+                                     can_period_callback_t cb, void* user);     // tolerance: 주기 대비 허용 지연 (0이면 0.5)
+can_err_t   can_unwatch_period      (const char* name, int watchId);
+can_err_t   can_get_period_stats    (const char* name, int watchId, CanPeriodStats* out);
+
+// ===== 신호 구독 (같은 메시지의 신호들은 채널 구독 하나로 묶여 프레임당 한 번 디코드) =====
+can_err_t   can_subscribe_signal    (const char* name, int* subId, const struct CanDb* db, uint16_t sig, double deadband,
+                                     can_signal_callback_t cb, void* user);     // deadband 0: 값이 바뀔 때마다
+can_err_t   can_unsubscribe_signal  (const char* name, int subId);
+can_err_t   can_get_signal          (const char* name, int subId, double* value, uint64_t* age_ns);  // 마지막 디코드 값 (아직이면 CAN_ERR_AGAIN)
+
+// ===== 게이트웨이 경로 (버스 사이 전달. 경로는 can_route_del 또는 src/dst 중 하나를 닫을 때까지) =====
+can_err_t   can_route_add           (const char* src, const char* dst, const CanFilter* filter,
+                                     const CanRouteMod* mods, size_t nMods, uint32_t flags, int* routeId);
+can_err_t   can_route_del           (int routeId);
+can_err_t   can_route_get_stats     (int routeId, CanRouteStats* out);
\ No newline at end of file
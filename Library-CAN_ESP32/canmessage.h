@@ -3,7 +3,7 @@
 #include "can_api.h"
 // 공통 union: payload 뷰
 typedef union {
-    uint8_t raw[8];
+    uint8_t raw[CAN_FRAME_DATA_MAX];    // FD 메시지까지 담을 수 있게 64바이트
     struct {
         uint8_t sig_flag;
     } dcu_reset;
@@ -39,6 +39,12 @@ typedef union {
         float    sig_user_info_value;
     } tcu_sca_user_info;
 
+    // FD: user info를 연속 구간으로 한 번에 (index부터 15개)
+    struct {
+        uint32_t sig_user_info_index;
+        float    sig_user_info_value[15];
+    } tcu_sca_user_info_fd;
+
     struct {
         uint64_t sig_user_nfc;
     } tcu_sca_user_info_nfc;
@@ -207,6 +213,7 @@ typedef enum {
     PCAN_ID_SCA_TCU_USER_INFO_REQ               = 0x102,
     PCAN_ID_SCA_DCU_AUTH_STATE                  = 0x103,
     PCAN_ID_TCU_SCA_USER_INFO                   = 0x104,
+    PCAN_ID_TCU_SCA_USER_INFO_FD                = 0x105,    // FD 전용
     PCAN_ID_TCU_SCA_USER_INFO_NFC               = 0x107,
     PCAN_ID_TCU_SCA_USER_INFO_BLE_SESS          = 0x108,
     PCAN_ID_TCU_SCA_USER_INFO_BLE_CHALL         = 0x109,
@@ -240,6 +247,7 @@ typedef enum {
     PCAN_DLC_SCA_TCU_USER_INFO_REQ               = 1,
     PCAN_DLC_SCA_DCU_AUTH_STATE                  = 2,
     PCAN_DLC_TCU_SCA_USER_INFO                   = 8,
+    PCAN_DLC_TCU_SCA_USER_INFO_FD                = 64,
     PCAN_DLC_TCU_SCA_USER_INFO_NFC               = 8,
     PCAN_DLC_TCU_SCA_USER_INFO_BLE_SESS          = 8,
     PCAN_DLC_TCU_SCA_USER_INFO_BLE_CHALL         = 8,
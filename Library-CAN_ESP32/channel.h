@@ -8,11 +8,47 @@ can_err_t       channel_start               (const char* name, CanConfig cfg, Ad
 can_err_t       channel_stop                (Channel* ch); 
 can_err_t       channel_write               (Channel* ch, const CanFrame* frame, uint32_t timeout_ms);
 can_err_t       channel_read                (Channel* ch, CanFrame* out, uint32_t timeout_ms);
+can_err_t       channel_write_batch         (Channel* ch, const CanFrame* frames, size_t n, size_t* sent, uint32_t timeout_ms);
+can_err_t       channel_read_batch          (Channel* ch, CanFrame* out, size_t max, size_t* got, uint32_t timeout_ms);
 can_err_t       channel_register_job        (Channel* ch, int* jobId, const CanFrame* frame, uint32_t period_ms);
 can_err_t       channel_register_job_dynamic(Channel* ch, int* jobId, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms);
 can_err_t       channel_cancel_job          (Channel* ch, int jobId);
+can_err_t       channel_get_job_stats       (Channel* ch, int jobId, CanJobStats* out);
+can_err_t       channel_update_job          (Channel* ch, int jobId, const CanFrame* frame);
 can_err_t       channel_subscribe           (Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user);
+can_err_t       channel_subscribe_ex        (Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user, const CanSubOptions* opt);
+can_err_t       channel_subscribe_on_change (Channel* ch, int* subId, const CanChangeFilter* filter, can_callback_t cb, can_timeout_callback_t on_timeout, void* user);
 can_err_t       channel_unsubscribe         (Channel* ch, int subId);
+int             channel_sub_fd              (Channel* ch, int subId);
+int             channel_sub_drain           (Channel* ch, int subId, uint32_t maxFrames);
+can_err_t       channel_sub_get_stats       (Channel* ch, int subId, CanSubStats* out);
+can_err_t       channel_get_latency         (Channel* ch, CanLatencyHist* out);
 const char*     channel_name                (const Channel* ch);
 can_err_t       channel_recover             (Channel* ch);
 can_bus_state_t channel_status              (Channel* ch);
+can_err_t       channel_set_bus_callback    (Channel* ch, can_bus_callback_t cb, void* user);
+can_err_t       channel_get_stats           (Channel* ch, CanStats* out);
+can_err_t       channel_stats_enable        (Channel* ch, int enable);
+can_err_t       channel_get_id_stats        (Channel* ch, CanIdStats* out, size_t max, size_t* count);
+can_err_t       channel_isotp_open          (Channel* ch, int* tpId, const CanIsoTpConfig* cfg);
+can_err_t       channel_isotp_send          (Channel* ch, int tpId, const void* data, size_t len, uint32_t timeout_ms);
+can_err_t       channel_isotp_recv          (Channel* ch, int tpId, void* buf, size_t cap, size_t* len, uint32_t timeout_ms);
+can_err_t       channel_isotp_close         (Channel* ch, int tpId);
+can_err_t       channel_watch_period        (Channel* ch, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance, can_period_callback_t cb, void* user);
+can_err_t       channel_unwatch_period      (Channel* ch, int watchId);
+can_err_t       channel_get_period_stats    (Channel* ch, int watchId, CanPeriodStats* out);
+can_err_t       channel_subscribe_signal    (Channel* ch, int* subId, const struct CanDb* db, uint16_t sig, double deadband, can_signal_callback_t cb, void* user);
+can_err_t       channel_unsubscribe_signal  (Channel* ch, int subId);
+can_err_t       channel_get_signal          (Channel* ch, int subId, double* value, uint64_t* age_ns);
+
+// 라이브러리 내부용: 구독이 빠지고 RX 스레드가 user를 더 이상 볼 수 없게 되면 release(user) 호출
+// (unsubscribe 직후 진행 중이던 콜백이 한 번 더 돌 수 있으므로 user를 바로 해제하면 안 되는 경우)
+can_err_t       channel_subscribe_owned     (Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user, void (*release)(void*));
+
+// 라이브러리 내부용: 필터 하나를 (id, mask) CAN_FILTER_MASK 목록으로 (전부 통과는 {0, 0} 하나). max를 넘으면 -1
+int             channel_filter_compile      (const CanFilter* f, CanFilter* out, int max);
+
+// 라이브러리 내부용 (route.c): 어댑터 ch_route_* 훅. 두 채널이 같은 어댑터가 아니거나 훅이 없으면 CAN_ERR_NODEV
+can_err_t       channel_route_offload       (Channel* src, Channel* dst, const CanRouteRule* rule, void** link);
+can_err_t       channel_route_offload_stats (Channel* src, void* link, CanRouteStats* io);
+void            channel_route_unload        (Channel* src, void* link);
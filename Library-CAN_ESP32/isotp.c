@@ -0,0 +1,420 @@
+#include "isotp.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ISOTP_DEFAULT_TIMEOUT_MS    1000
+#define ISOTP_DEFAULT_QUEUE         4
+#define ISOTP_MAX_WFT               8       // 연속 FC(WAIT) 허용 횟수
+#define ISOTP_DEFAULT_PAD           0xCC    // FD 프레임을 유효 DLC로 맞출 때 채우는 값
+
+// PCI (첫 바이트 상위 4비트)
+#define ISOTP_PCI_SF    0x0
+#define ISOTP_PCI_FF    0x1
+#define ISOTP_PCI_CF    0x2
+#define ISOTP_PCI_FC    0x3
+
+// FC flow status
+#define ISOTP_FC_CTS    0x0
+#define ISOTP_FC_WAIT   0x1
+#define ISOTP_FC_OVFLW  0x2
+
+typedef struct {
+    uint8_t* data;
+    size_t   len;
+} IsoTpMsg;
+
+struct IsoTp {
+    Channel*        ch;
+    CanIsoTpConfig  cfg;
+    int             sub;
+    size_t          tx_dl;          // 프레임 하나의 최대 길이 (클래식 8, FD 64)
+    atomic_int      refs;           // 소유자 몫 + 디스패치 테이블 몫
+
+    pthread_mutex_t tx_mtx;         // 송신 직렬화
+    pthread_mutex_t mtx;            // 아래 필드와 cv
+    pthread_cond_t  cv;
+    atomic_int      closing;
+
+    // 상대가 보낸 FC (RX 스레드가 쓰고 송신 쪽이 fc_seq 변화를 기다린다)
+    uint32_t        fc_seq;
+    uint8_t         fc_status, fc_bs, fc_stmin;
+
+    // 재조립 중인 메시지 (RX 스레드만)
+    uint8_t*        rx_buf;
+    size_t          rx_len, rx_got;
+    uint8_t         rx_sn;
+    uint8_t         rx_bs_cnt;
+    uint64_t        rx_last_ns;
+
+    // 다 받은 메시지 큐 (mtx)
+    IsoTpMsg*       q;
+    uint16_t        q_cap, q_head, q_count;
+};
+
+static inline uint64_t isotp_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void isotp_deadline(struct timespec* ts, uint32_t ms){
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec  += ms / 1000;
+    ts->tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L){ ts->tv_sec++; ts->tv_nsec -= 1000000000L; }
+}
+
+// STmin 바이트 → us (예약 값은 최대치 127ms로 본다)
+static uint32_t isotp_stmin_us(uint8_t st){
+    if (st <= 0x7F) return (uint32_t)st * 1000u;
+    if (st >= 0xF1 && st <= 0xF9) return (uint32_t)(st - 0xF0) * 100u;
+    return 127000u;
+}
+
+// FD에서 쓸 수 있는 가장 가까운 길이로 올림
+static size_t isotp_fd_len(size_t n){
+    static const uint8_t lens[] = { 8, 12, 16, 20, 24, 32, 48, 64 };
+    if (n <= 8) return n;
+    for (size_t i = 0; i < sizeof(lens); ++i) if (n <= lens[i]) return lens[i];
+    return 64;
+}
+
+static void isotp_release(void* arg){
+    IsoTp* tp = (IsoTp*)arg;
+    if (!tp || atomic_fetch_sub(&tp->refs, 1) != 1) return;
+    for (uint16_t i = 0; i < tp->q_count; ++i) free(tp->q[(tp->q_head + i) % tp->q_cap].data);
+    free(tp->q);
+    free(tp->rx_buf);
+    pthread_cond_destroy(&tp->cv);
+    pthread_mutex_destroy(&tp->mtx);
+    pthread_mutex_destroy(&tp->tx_mtx);
+    free(tp);
+}
+
+/* PCI+데이터 n바이트를 프레임 하나로 보낸다. 패딩 규칙:
+ *  - 클래식: padding이 켜져 있으면 8바이트로
+ *  - FD: 8바이트를 넘으면 유효 DLC로 올림 (padding이 켜져 있으면 8 이하도 8로) */
+static can_err_t isotp_frame(IsoTp* tp, const uint8_t* b, size_t n, uint32_t timeout_ms){
+    CanFrame fr;
+    fr.id    = tp->cfg.tx_id;
+    fr.flags = tp->cfg.flags & (CAN_FRAME_EXTID | CAN_FRAME_FD | CAN_FRAME_BRS);
+    fr.timestamp_ns = 0;
+
+    size_t dlc = n;
+    if (tp->cfg.padding && dlc < 8) dlc = 8;
+    if (tp->cfg.flags & CAN_FRAME_FD) dlc = isotp_fd_len(dlc);
+    uint8_t pad = tp->cfg.padding ? (uint8_t)tp->cfg.padding : ISOTP_DEFAULT_PAD;
+
+    memcpy(fr.data, b, n);
+    memset(fr.data + n, pad, dlc - n);
+    fr.dlc = (uint8_t)dlc;
+    return channel_write(tp->ch, &fr, timeout_ms);
+}
+
+static void isotp_send_fc(IsoTp* tp, uint8_t status){
+    uint8_t b[3] = { (uint8_t)(ISOTP_PCI_FC << 4 | status), tp->cfg.block_size, tp->cfg.stmin };
+    (void)isotp_frame(tp, b, sizeof(b), 0);     // RX 스레드라 기다리지 않는다. 못 보내면 상대가 N_Bs 타임아웃으로 정리
+}
+
+static void isotp_rx_abort(IsoTp* tp){
+    free(tp->rx_buf);
+    tp->rx_buf = NULL;
+}
+
+/* 다 받은 메시지를 큐에 넣는다 (data 소유권을 넘겨받음). 큐가 가득 차면 버린다 */
+static void isotp_deliver(IsoTp* tp, uint8_t* data, size_t len){
+    pthread_mutex_lock(&tp->mtx);
+    if (tp->q_count < tp->q_cap){
+        IsoTpMsg* m = &tp->q[(tp->q_head + tp->q_count) % tp->q_cap];
+        m->data = data;
+        m->len  = len;
+        tp->q_count++;
+        data = NULL;
+        pthread_cond_broadcast(&tp->cv);
+    }
+    pthread_mutex_unlock(&tp->mtx);
+    free(data);
+}
+
+static int isotp_queue_full(IsoTp* tp){
+    pthread_mutex_lock(&tp->mtx);
+    int full = tp->q_count >= tp->q_cap;
+    pthread_mutex_unlock(&tp->mtx);
+    return full;
+}
+
+/* RX 스레드: rx_id로 들어온 프레임 */
+static void isotp_on_rx(const CanFrame* f, void* user){
+    IsoTp* tp = (IsoTp*)user;
+    if ((f->flags & CAN_FRAME_EXTID) != (tp->cfg.flags & CAN_FRAME_EXTID)) return;
+    if (f->dlc == 0 || (f->flags & CAN_FRAME_RTR)) return;
+
+    const uint8_t* d = f->data;
+    switch (d[0] >> 4){
+    case ISOTP_PCI_SF: {
+        size_t len = d[0] & 0x0F, off = 1;
+        if (len == 0 && f->dlc > 8){ len = d[1]; off = 2; }     // FD 확장 SF
+        if (len == 0 || off + len > f->dlc) return;
+        isotp_rx_abort(tp);                                    // 재조립 중이었으면 새 메시지가 우선
+        uint8_t* buf = (uint8_t*)malloc(len);
+        if (!buf) return;
+        memcpy(buf, d + off, len);
+        isotp_deliver(tp, buf, len);
+        break;
+    }
+    case ISOTP_PCI_FF: {
+        if (f->dlc < 8) return;
+        size_t len = ((size_t)(d[0] & 0x0F) << 8) | d[1];
+        isotp_rx_abort(tp);
+        if (len == 0){                                          // 4095바이트를 넘는 FF (32비트 길이)
+            isotp_send_fc(tp, ISOTP_FC_OVFLW);
+            return;
+        }
+        size_t first = (size_t)f->dlc - 2;
+        if (len <= first) return;                               // SF로 보냈어야 할 길이
+        if (isotp_queue_full(tp) || !(tp->rx_buf = (uint8_t*)malloc(len))){
+            isotp_send_fc(tp, ISOTP_FC_OVFLW);
+            return;
+        }
+        memcpy(tp->rx_buf, d + 2, first);
+        tp->rx_len = len;
+        tp->rx_got = first;
+        tp->rx_sn = 1;
+        tp->rx_bs_cnt = 0;
+        tp->rx_last_ns = isotp_now_ns();
+        isotp_send_fc(tp, ISOTP_FC_CTS);
+        break;
+    }
+    case ISOTP_PCI_CF: {
+        if (!tp->rx_buf) return;
+        uint64_t now = isotp_now_ns();
+        if (now - tp->rx_last_ns > (uint64_t)tp->cfg.timeout_ms * 1000000ULL ||   // N_Cr 초과
+            (d[0] & 0x0F) != tp->rx_sn){                                          // 순번 어긋남
+            isotp_rx_abort(tp);
+            return;
+        }
+        size_t n = (size_t)f->dlc - 1;
+        if (n > tp->rx_len - tp->rx_got) n = tp->rx_len - tp->rx_got;
+        memcpy(tp->rx_buf + tp->rx_got, d + 1, n);
+        tp->rx_got += n;
+        tp->rx_sn = (uint8_t)((tp->rx_sn + 1) & 0x0F);
+        tp->rx_last_ns = now;
+        if (tp->rx_got >= tp->rx_len){
+            uint8_t* buf = tp->rx_buf;
+            tp->rx_buf = NULL;
+            isotp_deliver(tp, buf, tp->rx_len);
+        } else if (tp->cfg.block_size && ++tp->rx_bs_cnt == tp->cfg.block_size){
+            tp->rx_bs_cnt = 0;
+            isotp_send_fc(tp, ISOTP_FC_CTS);
+        }
+        break;
+    }
+    case ISOTP_PCI_FC:
+        if (f->dlc < 3) return;
+        pthread_mutex_lock(&tp->mtx);
+        tp->fc_status = d[0] & 0x0F;
+        tp->fc_bs     = d[1];
+        tp->fc_stmin  = d[2];
+        tp->fc_seq++;
+        pthread_cond_broadcast(&tp->cv);
+        pthread_mutex_unlock(&tp->mtx);
+        break;
+    default:
+        break;
+    }
+}
+
+can_err_t isotp_create(Channel* ch, const CanIsoTpConfig* cfg, IsoTp** out){
+    if (!ch || !cfg || !out) return CAN_ERR_INVALID;
+    IsoTp* tp = (IsoTp*)calloc(1, sizeof(IsoTp));
+    if (!tp) return CAN_ERR_MEMORY;
+    tp->cfg = *cfg;
+    if (!tp->cfg.timeout_ms) tp->cfg.timeout_ms = ISOTP_DEFAULT_TIMEOUT_MS;
+    if (!tp->cfg.rx_queue)   tp->cfg.rx_queue   = ISOTP_DEFAULT_QUEUE;
+    tp->ch = ch;
+    tp->tx_dl = (cfg->flags & CAN_FRAME_FD) ? CAN_FRAME_DATA_MAX : 8;
+    tp->q_cap = tp->cfg.rx_queue;
+    tp->q = (IsoTpMsg*)calloc(tp->q_cap, sizeof(IsoTpMsg));
+    if (!tp->q){ free(tp); return CAN_ERR_MEMORY; }
+    atomic_init(&tp->refs, 2);
+    atomic_init(&tp->closing, 0);
+    pthread_mutex_init(&tp->tx_mtx, NULL);
+    pthread_mutex_init(&tp->mtx, NULL);
+    pthread_cond_init(&tp->cv, NULL);
+
+    CanFilter flt;
+    memset(&flt, 0, sizeof(flt));
+    flt.type = CAN_FILTER_MASK;
+    flt.data.mask.id   = cfg->rx_id;
+    flt.data.mask.mask = 0x1FFFFFFFu;
+    can_err_t e = channel_subscribe_owned(ch, &tp->sub, &flt, isotp_on_rx, tp, isotp_release);
+    if (e != CAN_OK){
+        atomic_store(&tp->refs, 1);
+        isotp_release(tp);
+        return e;
+    }
+    *out = tp;
+    return CAN_OK;
+}
+
+void isotp_shutdown(IsoTp* tp){
+    if (!tp) return;
+    pthread_mutex_lock(&tp->mtx);
+    atomic_store(&tp->closing, 1);
+    pthread_cond_broadcast(&tp->cv);
+    pthread_mutex_unlock(&tp->mtx);
+}
+
+void isotp_destroy(IsoTp* tp){
+    if (!tp) return;
+    isotp_shutdown(tp);
+    // 구독이 빠지면 디스패치 테이블 몫 참조는 RX 스레드가 테이블을 놓은 뒤 풀린다
+    if (channel_unsubscribe(tp->ch, tp->sub) != CAN_OK) return;    // 구독이 남으면 channel_stop이 정리
+    isotp_release(tp);
+}
+
+/* 상대 FC를 기다린다 (*seq: 마지막으로 본 fc_seq). WAIT는 ISOTP_MAX_WFT번까지 다시 기다림 */
+static can_err_t isotp_wait_fc(IsoTp* tp, uint32_t* seq, uint64_t end_ns, uint8_t* bs, uint8_t* stmin){
+    unsigned wft = 0;
+    pthread_mutex_lock(&tp->mtx);
+    for (;;){
+        uint32_t wait_ms = tp->cfg.timeout_ms;                  // N_Bs
+        if (end_ns){
+            uint64_t now = isotp_now_ns();
+            uint64_t left = end_ns > now ? (end_ns - now) / 1000000ULL : 0;
+            if (left < wait_ms) wait_ms = (uint32_t)left;
+        }
+        struct timespec ts;
+        isotp_deadline(&ts, wait_ms);
+        while (!tp->closing && tp->fc_seq == *seq){
+            if (pthread_cond_timedwait(&tp->cv, &tp->mtx, &ts) == ETIMEDOUT && tp->fc_seq == *seq){
+                pthread_mutex_unlock(&tp->mtx);
+                return CAN_ERR_TIMEOUT;
+            }
+        }
+        if (tp->closing){
+            pthread_mutex_unlock(&tp->mtx);
+            return CAN_ERR_STATE;
+        }
+        *seq = tp->fc_seq;
+        if (tp->fc_status == ISOTP_FC_CTS){
+            *bs = tp->fc_bs;
+            *stmin = tp->fc_stmin;
+            pthread_mutex_unlock(&tp->mtx);
+            return CAN_OK;
+        }
+        if (tp->fc_status != ISOTP_FC_WAIT || ++wft > ISOTP_MAX_WFT){
+            pthread_mutex_unlock(&tp->mtx);
+            return tp->fc_status == ISOTP_FC_WAIT ? CAN_ERR_TIMEOUT : CAN_ERR_AGAIN;   // OVFLW: 상대 버퍼 부족
+        }
+    }
+}
+
+static uint32_t isotp_fc_seq(IsoTp* tp){
+    pthread_mutex_lock(&tp->mtx);
+    uint32_t s = tp->fc_seq;
+    pthread_mutex_unlock(&tp->mtx);
+    return s;
+}
+
+/* 남은 시간 (ms). end_ns == 0 이면 제한 없음 → 프레임 하나당 N_Bs */
+static uint32_t isotp_left_ms(const IsoTp* tp, uint64_t end_ns){
+    if (!end_ns) return tp->cfg.timeout_ms;
+    uint64_t now = isotp_now_ns();
+    return end_ns > now ? (uint32_t)((end_ns - now + 999999ULL) / 1000000ULL) : 0;
+}
+
+static can_err_t isotp_send_locked(IsoTp* tp, const uint8_t* p, size_t len, uint64_t end_ns){
+    uint8_t b[CAN_FRAME_DATA_MAX];
+    const size_t dl = tp->tx_dl;
+
+    // Single Frame: 클래식 7바이트, FD는 확장 SF(길이 바이트 분리)로 62바이트까지
+    if (len <= 7 || len <= dl - 2){
+        size_t off = 1;
+        if (len <= 7) b[0] = (uint8_t)len;
+        else { b[0] = 0; b[1] = (uint8_t)len; off = 2; }
+        memcpy(b + off, p, len);
+        return isotp_frame(tp, b, off + len, isotp_left_ms(tp, end_ns));
+    }
+
+    // First Frame. FC를 놓치지 않도록 보내기 전에 fc_seq를 찍어 둔다
+    uint32_t seq = isotp_fc_seq(tp);
+    b[0] = (uint8_t)(ISOTP_PCI_FF << 4 | (len >> 8));
+    b[1] = (uint8_t)len;
+    memcpy(b + 2, p, dl - 2);
+    size_t off = dl - 2;
+    can_err_t e = isotp_frame(tp, b, dl, isotp_left_ms(tp, end_ns));
+    if (e != CAN_OK) return e;
+
+    uint8_t sn = 1;
+    while (off < len){
+        uint8_t bs, stmin;
+        e = isotp_wait_fc(tp, &seq, end_ns, &bs, &stmin);
+        if (e != CAN_OK) return e;
+        uint32_t gap_us = isotp_stmin_us(stmin);
+
+        for (unsigned k = 0; off < len; ++k){
+            if (k && gap_us) usleep(gap_us);
+            if (atomic_load(&tp->closing)) return CAN_ERR_STATE;
+
+            size_t n = len - off;
+            if (n > dl - 1) n = dl - 1;
+            int block_end = bs && k + 1 == bs && off + n < len;
+            if (block_end) seq = isotp_fc_seq(tp);
+
+            b[0] = (uint8_t)(ISOTP_PCI_CF << 4 | (sn & 0x0F));
+            memcpy(b + 1, p + off, n);
+            uint32_t wait_ms = isotp_left_ms(tp, end_ns);
+            if (end_ns && wait_ms == 0) return CAN_ERR_TIMEOUT;
+            e = isotp_frame(tp, b, 1 + n, wait_ms);
+            if (e != CAN_OK) return e;
+            off += n;
+            sn++;
+            if (block_end) break;
+        }
+    }
+    return CAN_OK;
+}
+
+can_err_t isotp_send(IsoTp* tp, const void* data, size_t len, uint32_t timeout_ms){
+    if (!tp || !data || len == 0 || len > CAN_ISOTP_MAX_LEN) return CAN_ERR_INVALID;
+    uint64_t end_ns = timeout_ms ? isotp_now_ns() + (uint64_t)timeout_ms * 1000000ULL : 0;
+    pthread_mutex_lock(&tp->tx_mtx);
+    can_err_t e = atomic_load(&tp->closing) ? CAN_ERR_STATE : isotp_send_locked(tp, (const uint8_t*)data, len, end_ns);
+    pthread_mutex_unlock(&tp->tx_mtx);
+    return e;
+}
+
+can_err_t isotp_recv(IsoTp* tp, void* buf, size_t cap, size_t* len, uint32_t timeout_ms){
+    if (!tp || (!buf && cap) || !len) return CAN_ERR_INVALID;
+    *len = 0;
+    struct timespec ts;
+    isotp_deadline(&ts, timeout_ms);
+
+    pthread_mutex_lock(&tp->mtx);
+    while (!tp->closing && tp->q_count == 0){
+        if (timeout_ms == 0 || pthread_cond_timedwait(&tp->cv, &tp->mtx, &ts) == ETIMEDOUT){
+            if (tp->q_count) break;
+            pthread_mutex_unlock(&tp->mtx);
+            return CAN_ERR_TIMEOUT;
+        }
+    }
+    if (tp->q_count == 0){
+        pthread_mutex_unlock(&tp->mtx);
+        return CAN_ERR_STATE;
+    }
+    IsoTpMsg m = tp->q[tp->q_head];
+    tp->q_head = (uint16_t)((tp->q_head + 1) % tp->q_cap);
+    tp->q_count--;
+    pthread_mutex_unlock(&tp->mtx);
+
+    if (cap) memcpy(buf, m.data, m.len < cap ? m.len : cap);
+    *len = m.len;
+    free(m.data);
+    return m.len > cap ? CAN_ERR_INVALID : CAN_OK;
+}
@@ -0,0 +1,202 @@
+#include "mailbox.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// 변경 기록 링 크기: ID 수의 4배 (2의 거듭제곱, 64 ~ 4096). 폴링 사이에 이보다 많이 바뀌면 전체를 훑는다
+#define MAILBOX_LOG_MIN     64u
+#define MAILBOX_LOG_MAX     4096u
+// 기록 한 칸 = (세대 하위 40비트 << 24) | 칸 번호. 세대가 맞지 않으면 덮어쓰인 칸
+#define MAILBOX_IDX_BITS    24
+#define MAILBOX_IDX_MASK    ((1u << MAILBOX_IDX_BITS) - 1u)
+#define MAILBOX_GEN_MASK    ((1ULL << (64 - MAILBOX_IDX_BITS)) - 1ULL)
+
+typedef struct {
+    atomic_uint_fast64_t seq;       // 0: 아직 못 받음, 홀수: RX 스레드가 쓰는 중
+    atomic_uint_fast64_t gen;       // 마지막으로 내용이 바뀐 세대
+    uint64_t             rx_ns;     // CLOCK_MONOTONIC
+    CanFrame             fr;
+} MbSlot;
+
+struct CanMailbox {
+    Channel*                ch;
+    int                     sub;
+    uint32_t                n;
+    uint32_t*               ids;    // 오름차순 (칸 번호 = 인덱스)
+    MbSlot*                 slots;
+    uint32_t                log_mask;
+    atomic_uint_fast64_t*   log;
+    atomic_uint_fast64_t    gen;    // RX 스레드만 올린다
+};
+
+static uint64_t mb_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int mb_find(const CanMailbox* mb, uint32_t id){
+    uint32_t lo = 0, hi = mb->n;
+    while (lo < hi){
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (mb->ids[mid] < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < mb->n && mb->ids[lo] == id) ? (int)lo : -1;
+}
+
+static int cmp_u32(const void* a, const void* b){
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+/* RX 스레드 (구독 콜백). 칸을 쓰는 쪽은 이 스레드 하나뿐이다 */
+static void mailbox_on_rx(const CanFrame* f, void* user){
+    CanMailbox* mb = (CanMailbox*)user;
+    int i = mb_find(mb, f->id);
+    if (i < 0) return;
+    MbSlot* s = &mb->slots[i];
+
+    uint64_t q = atomic_load_explicit(&s->seq, memory_order_relaxed);
+    int changed = q == 0 || s->fr.dlc != f->dlc || s->fr.flags != f->flags ||
+                  memcmp(s->fr.data, f->data, f->dlc) != 0;
+
+    atomic_store_explicit(&s->seq, q + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    s->fr    = *f;
+    s->rx_ns = f->timestamp_ns ? f->timestamp_ns : mb_now_ns();
+    atomic_store_explicit(&s->seq, q + 2, memory_order_release);
+
+    if (changed){
+        uint64_t g = atomic_load_explicit(&mb->gen, memory_order_relaxed) + 1;
+        atomic_store_explicit(&mb->log[g & mb->log_mask],
+                              ((g & MAILBOX_GEN_MASK) << MAILBOX_IDX_BITS) | (uint64_t)i, memory_order_relaxed);
+        atomic_store_explicit(&s->gen, g, memory_order_relaxed);
+        atomic_store_explicit(&mb->gen, g, memory_order_release);
+    }
+}
+
+static void mailbox_free(CanMailbox* mb){
+    free(mb->log);
+    free(mb->slots);
+    free(mb->ids);
+    free(mb);
+}
+
+static void mailbox_release(void* user){
+    mailbox_free((CanMailbox*)user);
+}
+
+can_err_t mailbox_create(Channel* ch, const uint32_t* ids, size_t n, CanMailbox** out){
+    if (!ch || !ids || n == 0 || n > MAILBOX_IDX_MASK || !out) return CAN_ERR_INVALID;
+
+    CanMailbox* mb = (CanMailbox*)calloc(1, sizeof(CanMailbox));
+    if (!mb) return CAN_ERR_MEMORY;
+    mb->ids = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (!mb->ids){ free(mb); return CAN_ERR_MEMORY; }
+    memcpy(mb->ids, ids, n * sizeof(uint32_t));
+    qsort(mb->ids, n, sizeof(uint32_t), cmp_u32);
+    uint32_t k = 0;
+    for (size_t i = 0; i < n; ++i){
+        if (mb->ids[i] > 0x1FFFFFFFu){ mailbox_free(mb); return CAN_ERR_INVALID; }
+        if (k == 0 || mb->ids[k-1] != mb->ids[i]) mb->ids[k++] = mb->ids[i];
+    }
+    mb->n = k;
+
+    uint32_t lsz = MAILBOX_LOG_MIN;
+    while (lsz < 4u * k && lsz < MAILBOX_LOG_MAX) lsz <<= 1;
+    mb->log_mask = lsz - 1;
+    mb->slots = (MbSlot*)calloc(k, sizeof(MbSlot));
+    mb->log   = (atomic_uint_fast64_t*)calloc(lsz, sizeof(atomic_uint_fast64_t));
+    if (!mb->slots || !mb->log){ mailbox_free(mb); return CAN_ERR_MEMORY; }
+    for (uint32_t i = 0; i < k; ++i){
+        atomic_init(&mb->slots[i].seq, 0);
+        atomic_init(&mb->slots[i].gen, 0);
+    }
+    for (uint32_t i = 0; i < lsz; ++i) atomic_init(&mb->log[i], 0);
+    atomic_init(&mb->gen, 0);
+    mb->ch = ch;
+
+    CanFilter flt;
+    memset(&flt, 0, sizeof(flt));
+    flt.type = CAN_FILTER_LIST;
+    flt.data.list.list  = mb->ids;
+    flt.data.list.count = k;
+    can_err_t e = channel_subscribe_owned(ch, &mb->sub, &flt, mailbox_on_rx, mb, mailbox_release);
+    if (e != CAN_OK){ mailbox_free(mb); return e; }
+    *out = mb;
+    return CAN_OK;
+}
+
+can_err_t mailbox_destroy(CanMailbox* mb){
+    if (!mb) return CAN_ERR_INVALID;
+    return channel_unsubscribe(mb->ch, mb->sub);
+}
+
+can_err_t mailbox_read(const CanMailbox* mb, uint32_t id, CanFrame* out, uint64_t* age_ns){
+    if (!mb || !out) return CAN_ERR_INVALID;
+    int i = mb_find(mb, id);
+    if (i < 0) return CAN_ERR_INVALID;
+    const MbSlot* s = &mb->slots[i];
+
+    uint64_t rx;
+    for (;;){
+        uint64_t q = atomic_load_explicit(&s->seq, memory_order_acquire);
+        if (q == 0) return CAN_ERR_AGAIN;
+        if (q & 1) continue;                    // 쓰는 중 (프레임 한 개 복사 동안)
+        *out = s->fr;
+        rx   = s->rx_ns;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&s->seq, memory_order_relaxed) == q) break;
+    }
+    if (age_ns){
+        uint64_t now = mb_now_ns();
+        *age_ns = now > rx ? now - rx : 0;
+    }
+    return CAN_OK;
+}
+
+uint64_t mailbox_generation(const CanMailbox* mb){
+    return mb ? atomic_load_explicit(&mb->gen, memory_order_acquire) : 0;
+}
+
+static int listed(const uint32_t* ids, size_t k, uint32_t id){
+    for (size_t i = 0; i < k; ++i) if (ids[i] == id) return 1;
+    return 0;
+}
+
+can_err_t mailbox_changed(const CanMailbox* mb, uint64_t* gen, uint32_t* ids, size_t max, size_t* count){
+    if (!mb || !gen || !count || (!ids && max)) return CAN_ERR_INVALID;
+    uint64_t since = *gen;
+    uint64_t now   = atomic_load_explicit(&mb->gen, memory_order_acquire);
+    size_t   k     = 0;
+    *count = 0;
+    if (since >= now){ *gen = now; return CAN_OK; }
+
+    // 최근 세대부터 거꾸로: 칸의 gen이 그 기록의 세대와 같을 때(가장 최근 변경)만 담는다
+    int full = now - since > (uint64_t)mb->log_mask + 1;
+    for (uint64_t g = now; !full && g > since; --g){
+        uint64_t e = atomic_load_explicit(&mb->log[g & mb->log_mask], memory_order_acquire);
+        if ((e >> MAILBOX_IDX_BITS) != (g & MAILBOX_GEN_MASK)){ full = 1; break; }   // 읽는 사이 덮어씀
+        uint32_t i  = (uint32_t)(e & MAILBOX_IDX_MASK);
+        uint64_t sg = atomic_load_explicit(&mb->slots[i].gen, memory_order_acquire);
+        if (sg != g){
+            if (sg <= now) continue;                    // 더 최근 기록에서 이미 담음
+            if (listed(ids, k, mb->ids[i])) continue;   // now 이후에 또 바뀐 칸
+        }
+        if (k == max){ *count = k; return CAN_ERR_AGAIN; }
+        ids[k++] = mb->ids[i];
+    }
+    if (full){
+        k = 0;
+        for (uint32_t i = 0; i < mb->n; ++i){
+            if (atomic_load_explicit(&mb->slots[i].gen, memory_order_acquire) <= since) continue;
+            if (k == max){ *count = k; return CAN_ERR_AGAIN; }
+            ids[k++] = mb->ids[i];
+        }
+    }
+    *count = k;
+    *gen   = now;
+    return CAN_OK;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "can_api.h"
+#include "channel.h"
+
+/*
+ * 최신 값 우편함 (can_mailbox_*).
+ * ID마다 마지막 프레임 한 칸만 두고, 채널 구독 콜백(RX 스레드)이 seqlock으로 덮어쓴다.
+ *  - 읽기는 락/시스템 콜 없이 어느 스레드에서나 (쓰는 중이면 그 칸만 다시 읽는다)
+ *  - 쓰는 쪽은 채널의 RX 스레드 하나뿐이라고 가정한다
+ *  - 내용(길이/플래그/데이터)이 바뀐 칸만 세대를 올리고 변경 기록(링)에 남긴다
+ *    → mailbox_changed는 바뀐 칸 수만큼만 일하고, 기록이 밀렸으면 전체를 한 번 훑는다
+ */
+can_err_t   mailbox_create      (Channel* ch, const uint32_t* ids, size_t n, CanMailbox** out);
+can_err_t   mailbox_destroy     (CanMailbox* mb);      // 구독 해제. 메모리는 RX 스레드가 놓은 뒤 해제
+can_err_t   mailbox_read        (const CanMailbox* mb, uint32_t id, CanFrame* out, uint64_t* age_ns);
+uint64_t    mailbox_generation  (const CanMailbox* mb);
+can_err_t   mailbox_changed     (const CanMailbox* mb, uint64_t* gen, uint32_t* ids, size_t max, size_t* count);
@@ -0,0 +1,1771 @@
+// pcan.dbc에서 dbcgen.py로 생성됨. 직접 고치지 말고 DBC를 고친 뒤 다시 생성할 것.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "candb.h"
+
+// ---- 0x001 DCU_RESET (1 byte, DCU)
+#define PCAN_DCU_RESET_ID   0x001u
+#define PCAN_DCU_RESET_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_RESET_LEN) && PCAN_DCU_RESET_LEN <= CAN_FRAME_DATA_MAX, "DCU_RESET: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_RESET_LEN * 8, "DCU_RESET.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;
+} pcan_dcu_reset_t;
+
+static inline void pcan_dcu_reset_unpack(pcan_dcu_reset_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_dcu_reset_pack(uint8_t* d, const pcan_dcu_reset_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_reset_decode(const CanFrame* fr, pcan_dcu_reset_t* m){
+    pcan_dcu_reset_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_RESET_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_reset_encode(const pcan_dcu_reset_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_RESET_ID;
+    fr.dlc          = PCAN_DCU_RESET_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_reset_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_reset_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_reset_decode(fr, (pcan_dcu_reset_t*)m);
+}
+
+// ---- 0x002 DCU_RESET_ACK (2 bytes, Vector__XXX)
+#define PCAN_DCU_RESET_ACK_ID   0x002u
+#define PCAN_DCU_RESET_ACK_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_RESET_ACK_LEN) && PCAN_DCU_RESET_ACK_LEN <= CAN_FRAME_DATA_MAX, "DCU_RESET_ACK: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_RESET_ACK_LEN * 8, "DCU_RESET_ACK.sig_index: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_DCU_RESET_ACK_LEN * 8, "DCU_RESET_ACK.sig_status: out of frame");
+
+typedef struct {
+    uint8_t   sig_index;
+    uint8_t   sig_status;
+} pcan_dcu_reset_ack_t;
+
+static inline void pcan_dcu_reset_ack_unpack(pcan_dcu_reset_ack_t* m, const uint8_t* d){
+    const uint32_t r_sig_index = (uint32_t)d[0];
+    m->sig_index = (uint8_t)(r_sig_index);
+    const uint32_t r_sig_status = (uint32_t)d[1];
+    m->sig_status = (uint8_t)(r_sig_status);
+}
+
+static inline void pcan_dcu_reset_ack_pack(uint8_t* d, const pcan_dcu_reset_ack_t* m){
+    const uint32_t r_sig_index = (uint32_t)m->sig_index;
+    const uint32_t r_sig_status = (uint32_t)m->sig_status;
+    d[0] = (uint8_t)(r_sig_index);
+    d[1] = (uint8_t)(r_sig_status);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_reset_ack_decode(const CanFrame* fr, pcan_dcu_reset_ack_t* m){
+    pcan_dcu_reset_ack_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_RESET_ACK_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_reset_ack_encode(const pcan_dcu_reset_ack_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_RESET_ACK_ID;
+    fr.dlc          = PCAN_DCU_RESET_ACK_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_reset_ack_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_reset_ack_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_reset_ack_decode(fr, (pcan_dcu_reset_ack_t*)m);
+}
+
+// ---- 0x003 SCA_DCU_DRIVER_EVENT (1 byte, SCA)
+#define PCAN_SCA_DCU_DRIVER_EVENT_ID   0x003u
+#define PCAN_SCA_DCU_DRIVER_EVENT_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_DCU_DRIVER_EVENT_LEN) && PCAN_SCA_DCU_DRIVER_EVENT_LEN <= CAN_FRAME_DATA_MAX, "SCA_DCU_DRIVER_EVENT: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_SCA_DCU_DRIVER_EVENT_LEN * 8, "SCA_DCU_DRIVER_EVENT.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;
+} pcan_sca_dcu_driver_event_t;
+
+static inline void pcan_sca_dcu_driver_event_unpack(pcan_sca_dcu_driver_event_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_sca_dcu_driver_event_pack(uint8_t* d, const pcan_sca_dcu_driver_event_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_dcu_driver_event_decode(const CanFrame* fr, pcan_sca_dcu_driver_event_t* m){
+    pcan_sca_dcu_driver_event_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_DCU_DRIVER_EVENT_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_dcu_driver_event_encode(const pcan_sca_dcu_driver_event_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_DCU_DRIVER_EVENT_ID;
+    fr.dlc          = PCAN_SCA_DCU_DRIVER_EVENT_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_dcu_driver_event_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_dcu_driver_event_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_dcu_driver_event_decode(fr, (pcan_sca_dcu_driver_event_t*)m);
+}
+
+// ---- 0x005 DCU_SCA_DRIVE_STATUS (1 byte, DCU)
+#define PCAN_DCU_SCA_DRIVE_STATUS_ID   0x005u
+#define PCAN_DCU_SCA_DRIVE_STATUS_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_SCA_DRIVE_STATUS_LEN) && PCAN_DCU_SCA_DRIVE_STATUS_LEN <= CAN_FRAME_DATA_MAX, "DCU_SCA_DRIVE_STATUS: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_SCA_DRIVE_STATUS_LEN * 8, "DCU_SCA_DRIVE_STATUS.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;  // [0..1]
+} pcan_dcu_sca_drive_status_t;
+
+static inline void pcan_dcu_sca_drive_status_unpack(pcan_dcu_sca_drive_status_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_dcu_sca_drive_status_pack(uint8_t* d, const pcan_dcu_sca_drive_status_t* m){
+    uint8_t v_sig_flag = m->sig_flag;
+    v_sig_flag = v_sig_flag > 1 ? 1 : v_sig_flag;
+    const uint32_t r_sig_flag = (uint32_t)v_sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_sca_drive_status_decode(const CanFrame* fr, pcan_dcu_sca_drive_status_t* m){
+    pcan_dcu_sca_drive_status_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_SCA_DRIVE_STATUS_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_sca_drive_status_encode(const pcan_dcu_sca_drive_status_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_SCA_DRIVE_STATUS_ID;
+    fr.dlc          = PCAN_DCU_SCA_DRIVE_STATUS_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_sca_drive_status_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_sca_drive_status_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_sca_drive_status_decode(fr, (pcan_dcu_sca_drive_status_t*)m);
+}
+
+// ---- 0x101 DCU_SCA_USER_FACE_REQ (1 byte, DCU)
+#define PCAN_DCU_SCA_USER_FACE_REQ_ID   0x101u
+#define PCAN_DCU_SCA_USER_FACE_REQ_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_SCA_USER_FACE_REQ_LEN) && PCAN_DCU_SCA_USER_FACE_REQ_LEN <= CAN_FRAME_DATA_MAX, "DCU_SCA_USER_FACE_REQ: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_SCA_USER_FACE_REQ_LEN * 8, "DCU_SCA_USER_FACE_REQ.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;
+} pcan_dcu_sca_user_face_req_t;
+
+static inline void pcan_dcu_sca_user_face_req_unpack(pcan_dcu_sca_user_face_req_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_dcu_sca_user_face_req_pack(uint8_t* d, const pcan_dcu_sca_user_face_req_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_sca_user_face_req_decode(const CanFrame* fr, pcan_dcu_sca_user_face_req_t* m){
+    pcan_dcu_sca_user_face_req_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_SCA_USER_FACE_REQ_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_sca_user_face_req_encode(const pcan_dcu_sca_user_face_req_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_SCA_USER_FACE_REQ_ID;
+    fr.dlc          = PCAN_DCU_SCA_USER_FACE_REQ_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_sca_user_face_req_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_sca_user_face_req_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_sca_user_face_req_decode(fr, (pcan_dcu_sca_user_face_req_t*)m);
+}
+
+// ---- 0x102 SCA_TCU_USER_INFO_REQ (1 byte, SCA)
+#define PCAN_SCA_TCU_USER_INFO_REQ_ID   0x102u
+#define PCAN_SCA_TCU_USER_INFO_REQ_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_TCU_USER_INFO_REQ_LEN) && PCAN_SCA_TCU_USER_INFO_REQ_LEN <= CAN_FRAME_DATA_MAX, "SCA_TCU_USER_INFO_REQ: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_SCA_TCU_USER_INFO_REQ_LEN * 8, "SCA_TCU_USER_INFO_REQ.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;
+} pcan_sca_tcu_user_info_req_t;
+
+static inline void pcan_sca_tcu_user_info_req_unpack(pcan_sca_tcu_user_info_req_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_sca_tcu_user_info_req_pack(uint8_t* d, const pcan_sca_tcu_user_info_req_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_tcu_user_info_req_decode(const CanFrame* fr, pcan_sca_tcu_user_info_req_t* m){
+    pcan_sca_tcu_user_info_req_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_TCU_USER_INFO_REQ_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_tcu_user_info_req_encode(const pcan_sca_tcu_user_info_req_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_TCU_USER_INFO_REQ_ID;
+    fr.dlc          = PCAN_SCA_TCU_USER_INFO_REQ_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_tcu_user_info_req_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_tcu_user_info_req_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_tcu_user_info_req_decode(fr, (pcan_sca_tcu_user_info_req_t*)m);
+}
+
+// ---- 0x103 SCA_DCU_AUTH_STATE (2 bytes, SCA)
+#define PCAN_SCA_DCU_AUTH_STATE_ID   0x103u
+#define PCAN_SCA_DCU_AUTH_STATE_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_DCU_AUTH_STATE_LEN) && PCAN_SCA_DCU_AUTH_STATE_LEN <= CAN_FRAME_DATA_MAX, "SCA_DCU_AUTH_STATE: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_SCA_DCU_AUTH_STATE_LEN * 8, "SCA_DCU_AUTH_STATE.sig_auth_step: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_SCA_DCU_AUTH_STATE_LEN * 8, "SCA_DCU_AUTH_STATE.sig_auth_state: out of frame");
+
+typedef struct {
+    uint8_t   sig_auth_step;  // [0..3]
+    uint8_t   sig_auth_state;
+} pcan_sca_dcu_auth_state_t;
+
+static inline void pcan_sca_dcu_auth_state_unpack(pcan_sca_dcu_auth_state_t* m, const uint8_t* d){
+    const uint32_t r_sig_auth_step = (uint32_t)d[0];
+    m->sig_auth_step = (uint8_t)(r_sig_auth_step);
+    const uint32_t r_sig_auth_state = (uint32_t)d[1];
+    m->sig_auth_state = (uint8_t)(r_sig_auth_state);
+}
+
+static inline void pcan_sca_dcu_auth_state_pack(uint8_t* d, const pcan_sca_dcu_auth_state_t* m){
+    uint8_t v_sig_auth_step = m->sig_auth_step;
+    v_sig_auth_step = v_sig_auth_step > 3 ? 3 : v_sig_auth_step;
+    const uint32_t r_sig_auth_step = (uint32_t)v_sig_auth_step;
+    const uint32_t r_sig_auth_state = (uint32_t)m->sig_auth_state;
+    d[0] = (uint8_t)(r_sig_auth_step);
+    d[1] = (uint8_t)(r_sig_auth_state);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_dcu_auth_state_decode(const CanFrame* fr, pcan_sca_dcu_auth_state_t* m){
+    pcan_sca_dcu_auth_state_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_DCU_AUTH_STATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_dcu_auth_state_encode(const pcan_sca_dcu_auth_state_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_DCU_AUTH_STATE_ID;
+    fr.dlc          = PCAN_SCA_DCU_AUTH_STATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_dcu_auth_state_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_dcu_auth_state_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_dcu_auth_state_decode(fr, (pcan_sca_dcu_auth_state_t*)m);
+}
+
+// ---- 0x104 TCU_SCA_USER_INFO (8 bytes, TCU)
+#define PCAN_TCU_SCA_USER_INFO_ID   0x104u
+#define PCAN_TCU_SCA_USER_INFO_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_LEN) && PCAN_TCU_SCA_USER_INFO_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO: invalid length");
+CANDB_STATIC_ASSERT(31 < PCAN_TCU_SCA_USER_INFO_LEN * 8, "TCU_SCA_USER_INFO.sig_user_info_index: out of frame");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_LEN * 8, "TCU_SCA_USER_INFO.sig_user_info_value: out of frame");
+
+typedef struct {
+    uint32_t  sig_user_info_index;
+    float     sig_user_info_value;
+} pcan_tcu_sca_user_info_t;
+
+static inline void pcan_tcu_sca_user_info_unpack(pcan_tcu_sca_user_info_t* m, const uint8_t* d){
+    const uint32_t r_sig_user_info_index = (uint32_t)d[0]
+        | ((uint32_t)d[1] << 8)
+        | ((uint32_t)d[2] << 16)
+        | ((uint32_t)d[3] << 24);
+    m->sig_user_info_index = (uint32_t)(r_sig_user_info_index);
+    const uint32_t r_sig_user_info_value = (uint32_t)d[4]
+        | ((uint32_t)d[5] << 8)
+        | ((uint32_t)d[6] << 16)
+        | ((uint32_t)d[7] << 24);
+    m->sig_user_info_value = (float)(candb_f32(r_sig_user_info_value));
+}
+
+static inline void pcan_tcu_sca_user_info_pack(uint8_t* d, const pcan_tcu_sca_user_info_t* m){
+    const uint32_t r_sig_user_info_index = (uint32_t)m->sig_user_info_index;
+    const uint32_t r_sig_user_info_value = candb_u32(m->sig_user_info_value);
+    d[0] = (uint8_t)(r_sig_user_info_index);
+    d[1] = (uint8_t)((r_sig_user_info_index >> 8));
+    d[2] = (uint8_t)((r_sig_user_info_index >> 16));
+    d[3] = (uint8_t)((r_sig_user_info_index >> 24));
+    d[4] = (uint8_t)(r_sig_user_info_value);
+    d[5] = (uint8_t)((r_sig_user_info_value >> 8));
+    d[6] = (uint8_t)((r_sig_user_info_value >> 16));
+    d[7] = (uint8_t)((r_sig_user_info_value >> 24));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_decode(const CanFrame* fr, pcan_tcu_sca_user_info_t* m){
+    pcan_tcu_sca_user_info_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_encode(const pcan_tcu_sca_user_info_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_decode(fr, (pcan_tcu_sca_user_info_t*)m);
+}
+
+// ---- 0x105 TCU_SCA_USER_INFO_FD (64 bytes, FD, TCU): FD 전용: sig_user_info_index부터 연속 15개 값
+#define PCAN_TCU_SCA_USER_INFO_FD_ID   0x105u
+#define PCAN_TCU_SCA_USER_INFO_FD_LEN  64
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_FD_LEN) && PCAN_TCU_SCA_USER_INFO_FD_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO_FD: invalid length");
+CANDB_STATIC_ASSERT(31 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_index: out of frame");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_0: out of frame");
+CANDB_STATIC_ASSERT(95 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_1: out of frame");
+CANDB_STATIC_ASSERT(127 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_2: out of frame");
+CANDB_STATIC_ASSERT(159 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_3: out of frame");
+CANDB_STATIC_ASSERT(191 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_4: out of frame");
+CANDB_STATIC_ASSERT(223 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_5: out of frame");
+CANDB_STATIC_ASSERT(255 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_6: out of frame");
+CANDB_STATIC_ASSERT(287 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_7: out of frame");
+CANDB_STATIC_ASSERT(319 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_8: out of frame");
+CANDB_STATIC_ASSERT(351 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_9: out of frame");
+CANDB_STATIC_ASSERT(383 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_10: out of frame");
+CANDB_STATIC_ASSERT(415 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_11: out of frame");
+CANDB_STATIC_ASSERT(447 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_12: out of frame");
+CANDB_STATIC_ASSERT(479 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_13: out of frame");
+CANDB_STATIC_ASSERT(511 < PCAN_TCU_SCA_USER_INFO_FD_LEN * 8, "TCU_SCA_USER_INFO_FD.sig_user_info_value_14: out of frame");
+
+typedef struct {
+    uint32_t  sig_user_info_index;
+    float     sig_user_info_value_0;
+    float     sig_user_info_value_1;
+    float     sig_user_info_value_2;
+    float     sig_user_info_value_3;
+    float     sig_user_info_value_4;
+    float     sig_user_info_value_5;
+    float     sig_user_info_value_6;
+    float     sig_user_info_value_7;
+    float     sig_user_info_value_8;
+    float     sig_user_info_value_9;
+    float     sig_user_info_value_10;
+    float     sig_user_info_value_11;
+    float     sig_user_info_value_12;
+    float     sig_user_info_value_13;
+    float     sig_user_info_value_14;
+} pcan_tcu_sca_user_info_fd_t;
+
+static inline void pcan_tcu_sca_user_info_fd_unpack(pcan_tcu_sca_user_info_fd_t* m, const uint8_t* d){
+    const uint32_t r_sig_user_info_index = (uint32_t)d[0]
+        | ((uint32_t)d[1] << 8)
+        | ((uint32_t)d[2] << 16)
+        | ((uint32_t)d[3] << 24);
+    m->sig_user_info_index = (uint32_t)(r_sig_user_info_index);
+    const uint32_t r_sig_user_info_value_0 = (uint32_t)d[4]
+        | ((uint32_t)d[5] << 8)
+        | ((uint32_t)d[6] << 16)
+        | ((uint32_t)d[7] << 24);
+    m->sig_user_info_value_0 = (float)(candb_f32(r_sig_user_info_value_0));
+    const uint32_t r_sig_user_info_value_1 = (uint32_t)d[8]
+        | ((uint32_t)d[9] << 8)
+        | ((uint32_t)d[10] << 16)
+        | ((uint32_t)d[11] << 24);
+    m->sig_user_info_value_1 = (float)(candb_f32(r_sig_user_info_value_1));
+    const uint32_t r_sig_user_info_value_2 = (uint32_t)d[12]
+        | ((uint32_t)d[13] << 8)
+        | ((uint32_t)d[14] << 16)
+        | ((uint32_t)d[15] << 24);
+    m->sig_user_info_value_2 = (float)(candb_f32(r_sig_user_info_value_2));
+    const uint32_t r_sig_user_info_value_3 = (uint32_t)d[16]
+        | ((uint32_t)d[17] << 8)
+        | ((uint32_t)d[18] << 16)
+        | ((uint32_t)d[19] << 24);
+    m->sig_user_info_value_3 = (float)(candb_f32(r_sig_user_info_value_3));
+    const uint32_t r_sig_user_info_value_4 = (uint32_t)d[20]
+        | ((uint32_t)d[21] << 8)
+        | ((uint32_t)d[22] << 16)
+        | ((uint32_t)d[23] << 24);
+    m->sig_user_info_value_4 = (float)(candb_f32(r_sig_user_info_value_4));
+    const uint32_t r_sig_user_info_value_5 = (uint32_t)d[24]
+        | ((uint32_t)d[25] << 8)
+        | ((uint32_t)d[26] << 16)
+        | ((uint32_t)d[27] << 24);
+    m->sig_user_info_value_5 = (float)(candb_f32(r_sig_user_info_value_5));
+    const uint32_t r_sig_user_info_value_6 = (uint32_t)d[28]
+        | ((uint32_t)d[29] << 8)
+        | ((uint32_t)d[30] << 16)
+        | ((uint32_t)d[31] << 24);
+    m->sig_user_info_value_6 = (float)(candb_f32(r_sig_user_info_value_6));
+    const uint32_t r_sig_user_info_value_7 = (uint32_t)d[32]
+        | ((uint32_t)d[33] << 8)
+        | ((uint32_t)d[34] << 16)
+        | ((uint32_t)d[35] << 24);
+    m->sig_user_info_value_7 = (float)(candb_f32(r_sig_user_info_value_7));
+    const uint32_t r_sig_user_info_value_8 = (uint32_t)d[36]
+        | ((uint32_t)d[37] << 8)
+        | ((uint32_t)d[38] << 16)
+        | ((uint32_t)d[39] << 24);
+    m->sig_user_info_value_8 = (float)(candb_f32(r_sig_user_info_value_8));
+    const uint32_t r_sig_user_info_value_9 = (uint32_t)d[40]
+        | ((uint32_t)d[41] << 8)
+        | ((uint32_t)d[42] << 16)
+        | ((uint32_t)d[43] << 24);
+    m->sig_user_info_value_9 = (float)(candb_f32(r_sig_user_info_value_9));
+    const uint32_t r_sig_user_info_value_10 = (uint32_t)d[44]
+        | ((uint32_t)d[45] << 8)
+        | ((uint32_t)d[46] << 16)
+        | ((uint32_t)d[47] << 24);
+    m->sig_user_info_value_10 = (float)(candb_f32(r_sig_user_info_value_10));
+    const uint32_t r_sig_user_info_value_11 = (uint32_t)d[48]
+        | ((uint32_t)d[49] << 8)
+        | ((uint32_t)d[50] << 16)
+        | ((uint32_t)d[51] << 24);
+    m->sig_user_info_value_11 = (float)(candb_f32(r_sig_user_info_value_11));
+    const uint32_t r_sig_user_info_value_12 = (uint32_t)d[52]
+        | ((uint32_t)d[53] << 8)
+        | ((uint32_t)d[54] << 16)
+        | ((uint32_t)d[55] << 24);
+    m->sig_user_info_value_12 = (float)(candb_f32(r_sig_user_info_value_12));
+    const uint32_t r_sig_user_info_value_13 = (uint32_t)d[56]
+        | ((uint32_t)d[57] << 8)
+        | ((uint32_t)d[58] << 16)
+        | ((uint32_t)d[59] << 24);
+    m->sig_user_info_value_13 = (float)(candb_f32(r_sig_user_info_value_13));
+    const uint32_t r_sig_user_info_value_14 = (uint32_t)d[60]
+        | ((uint32_t)d[61] << 8)
+        | ((uint32_t)d[62] << 16)
+        | ((uint32_t)d[63] << 24);
+    m->sig_user_info_value_14 = (float)(candb_f32(r_sig_user_info_value_14));
+}
+
+static inline void pcan_tcu_sca_user_info_fd_pack(uint8_t* d, const pcan_tcu_sca_user_info_fd_t* m){
+    const uint32_t r_sig_user_info_index = (uint32_t)m->sig_user_info_index;
+    const uint32_t r_sig_user_info_value_0 = candb_u32(m->sig_user_info_value_0);
+    const uint32_t r_sig_user_info_value_1 = candb_u32(m->sig_user_info_value_1);
+    const uint32_t r_sig_user_info_value_2 = candb_u32(m->sig_user_info_value_2);
+    const uint32_t r_sig_user_info_value_3 = candb_u32(m->sig_user_info_value_3);
+    const uint32_t r_sig_user_info_value_4 = candb_u32(m->sig_user_info_value_4);
+    const uint32_t r_sig_user_info_value_5 = candb_u32(m->sig_user_info_value_5);
+    const uint32_t r_sig_user_info_value_6 = candb_u32(m->sig_user_info_value_6);
+    const uint32_t r_sig_user_info_value_7 = candb_u32(m->sig_user_info_value_7);
+    const uint32_t r_sig_user_info_value_8 = candb_u32(m->sig_user_info_value_8);
+    const uint32_t r_sig_user_info_value_9 = candb_u32(m->sig_user_info_value_9);
+    const uint32_t r_sig_user_info_value_10 = candb_u32(m->sig_user_info_value_10);
+    const uint32_t r_sig_user_info_value_11 = candb_u32(m->sig_user_info_value_11);
+    const uint32_t r_sig_user_info_value_12 = candb_u32(m->sig_user_info_value_12);
+    const uint32_t r_sig_user_info_value_13 = candb_u32(m->sig_user_info_value_13);
+    const uint32_t r_sig_user_info_value_14 = candb_u32(m->sig_user_info_value_14);
+    d[0] = (uint8_t)(r_sig_user_info_index);
+    d[1] = (uint8_t)((r_sig_user_info_index >> 8));
+    d[2] = (uint8_t)((r_sig_user_info_index >> 16));
+    d[3] = (uint8_t)((r_sig_user_info_index >> 24));
+    d[4] = (uint8_t)(r_sig_user_info_value_0);
+    d[5] = (uint8_t)((r_sig_user_info_value_0 >> 8));
+    d[6] = (uint8_t)((r_sig_user_info_value_0 >> 16));
+    d[7] = (uint8_t)((r_sig_user_info_value_0 >> 24));
+    d[8] = (uint8_t)(r_sig_user_info_value_1);
+    d[9] = (uint8_t)((r_sig_user_info_value_1 >> 8));
+    d[10] = (uint8_t)((r_sig_user_info_value_1 >> 16));
+    d[11] = (uint8_t)((r_sig_user_info_value_1 >> 24));
+    d[12] = (uint8_t)(r_sig_user_info_value_2);
+    d[13] = (uint8_t)((r_sig_user_info_value_2 >> 8));
+    d[14] = (uint8_t)((r_sig_user_info_value_2 >> 16));
+    d[15] = (uint8_t)((r_sig_user_info_value_2 >> 24));
+    d[16] = (uint8_t)(r_sig_user_info_value_3);
+    d[17] = (uint8_t)((r_sig_user_info_value_3 >> 8));
+    d[18] = (uint8_t)((r_sig_user_info_value_3 >> 16));
+    d[19] = (uint8_t)((r_sig_user_info_value_3 >> 24));
+    d[20] = (uint8_t)(r_sig_user_info_value_4);
+    d[21] = (uint8_t)((r_sig_user_info_value_4 >> 8));
+    d[22] = (uint8_t)((r_sig_user_info_value_4 >> 16));
+    d[23] = (uint8_t)((r_sig_user_info_value_4 >> 24));
+    d[24] = (uint8_t)(r_sig_user_info_value_5);
+    d[25] = (uint8_t)((r_sig_user_info_value_5 >> 8));
+    d[26] = (uint8_t)((r_sig_user_info_value_5 >> 16));
+    d[27] = (uint8_t)((r_sig_user_info_value_5 >> 24));
+    d[28] = (uint8_t)(r_sig_user_info_value_6);
+    d[29] = (uint8_t)((r_sig_user_info_value_6 >> 8));
+    d[30] = (uint8_t)((r_sig_user_info_value_6 >> 16));
+    d[31] = (uint8_t)((r_sig_user_info_value_6 >> 24));
+    d[32] = (uint8_t)(r_sig_user_info_value_7);
+    d[33] = (uint8_t)((r_sig_user_info_value_7 >> 8));
+    d[34] = (uint8_t)((r_sig_user_info_value_7 >> 16));
+    d[35] = (uint8_t)((r_sig_user_info_value_7 >> 24));
+    d[36] = (uint8_t)(r_sig_user_info_value_8);
+    d[37] = (uint8_t)((r_sig_user_info_value_8 >> 8));
+    d[38] = (uint8_t)((r_sig_user_info_value_8 >> 16));
+    d[39] = (uint8_t)((r_sig_user_info_value_8 >> 24));
+    d[40] = (uint8_t)(r_sig_user_info_value_9);
+    d[41] = (uint8_t)((r_sig_user_info_value_9 >> 8));
+    d[42] = (uint8_t)((r_sig_user_info_value_9 >> 16));
+    d[43] = (uint8_t)((r_sig_user_info_value_9 >> 24));
+    d[44] = (uint8_t)(r_sig_user_info_value_10);
+    d[45] = (uint8_t)((r_sig_user_info_value_10 >> 8));
+    d[46] = (uint8_t)((r_sig_user_info_value_10 >> 16));
+    d[47] = (uint8_t)((r_sig_user_info_value_10 >> 24));
+    d[48] = (uint8_t)(r_sig_user_info_value_11);
+    d[49] = (uint8_t)((r_sig_user_info_value_11 >> 8));
+    d[50] = (uint8_t)((r_sig_user_info_value_11 >> 16));
+    d[51] = (uint8_t)((r_sig_user_info_value_11 >> 24));
+    d[52] = (uint8_t)(r_sig_user_info_value_12);
+    d[53] = (uint8_t)((r_sig_user_info_value_12 >> 8));
+    d[54] = (uint8_t)((r_sig_user_info_value_12 >> 16));
+    d[55] = (uint8_t)((r_sig_user_info_value_12 >> 24));
+    d[56] = (uint8_t)(r_sig_user_info_value_13);
+    d[57] = (uint8_t)((r_sig_user_info_value_13 >> 8));
+    d[58] = (uint8_t)((r_sig_user_info_value_13 >> 16));
+    d[59] = (uint8_t)((r_sig_user_info_value_13 >> 24));
+    d[60] = (uint8_t)(r_sig_user_info_value_14);
+    d[61] = (uint8_t)((r_sig_user_info_value_14 >> 8));
+    d[62] = (uint8_t)((r_sig_user_info_value_14 >> 16));
+    d[63] = (uint8_t)((r_sig_user_info_value_14 >> 24));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_fd_decode(const CanFrame* fr, pcan_tcu_sca_user_info_fd_t* m){
+    pcan_tcu_sca_user_info_fd_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_FD_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_fd_encode(const pcan_tcu_sca_user_info_fd_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_FD_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_FD_LEN;
+    fr.flags        = CAN_FRAME_FD | CAN_FRAME_BRS;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_fd_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_fd_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_fd_decode(fr, (pcan_tcu_sca_user_info_fd_t*)m);
+}
+
+// ---- 0x107 TCU_SCA_USER_INFO_NFC (8 bytes, TCU)
+#define PCAN_TCU_SCA_USER_INFO_NFC_ID   0x107u
+#define PCAN_TCU_SCA_USER_INFO_NFC_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_NFC_LEN) && PCAN_TCU_SCA_USER_INFO_NFC_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO_NFC: invalid length");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_NFC_LEN * 8, "TCU_SCA_USER_INFO_NFC.sig_user_nfc: out of frame");
+
+typedef struct {
+    uint64_t  sig_user_nfc;
+} pcan_tcu_sca_user_info_nfc_t;
+
+static inline void pcan_tcu_sca_user_info_nfc_unpack(pcan_tcu_sca_user_info_nfc_t* m, const uint8_t* d){
+    const uint64_t r_sig_user_nfc = (uint64_t)d[0]
+        | ((uint64_t)d[1] << 8)
+        | ((uint64_t)d[2] << 16)
+        | ((uint64_t)d[3] << 24)
+        | ((uint64_t)d[4] << 32)
+        | ((uint64_t)d[5] << 40)
+        | ((uint64_t)d[6] << 48)
+        | ((uint64_t)d[7] << 56);
+    m->sig_user_nfc = (uint64_t)(r_sig_user_nfc);
+}
+
+static inline void pcan_tcu_sca_user_info_nfc_pack(uint8_t* d, const pcan_tcu_sca_user_info_nfc_t* m){
+    const uint64_t r_sig_user_nfc = (uint64_t)m->sig_user_nfc;
+    d[0] = (uint8_t)(r_sig_user_nfc);
+    d[1] = (uint8_t)((r_sig_user_nfc >> 8));
+    d[2] = (uint8_t)((r_sig_user_nfc >> 16));
+    d[3] = (uint8_t)((r_sig_user_nfc >> 24));
+    d[4] = (uint8_t)((r_sig_user_nfc >> 32));
+    d[5] = (uint8_t)((r_sig_user_nfc >> 40));
+    d[6] = (uint8_t)((r_sig_user_nfc >> 48));
+    d[7] = (uint8_t)((r_sig_user_nfc >> 56));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_nfc_decode(const CanFrame* fr, pcan_tcu_sca_user_info_nfc_t* m){
+    pcan_tcu_sca_user_info_nfc_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_NFC_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_nfc_encode(const pcan_tcu_sca_user_info_nfc_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_NFC_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_NFC_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_nfc_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_nfc_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_nfc_decode(fr, (pcan_tcu_sca_user_info_nfc_t*)m);
+}
+
+// ---- 0x108 TCU_SCA_USER_INFO_BLE_SESS (8 bytes, TCU)
+#define PCAN_TCU_SCA_USER_INFO_BLE_SESS_ID   0x108u
+#define PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN) && PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO_BLE_SESS: invalid length");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN * 8, "TCU_SCA_USER_INFO_BLE_SESS.sig_data: out of frame");
+
+typedef struct {
+    uint64_t  sig_data;
+} pcan_tcu_sca_user_info_ble_sess_t;
+
+static inline void pcan_tcu_sca_user_info_ble_sess_unpack(pcan_tcu_sca_user_info_ble_sess_t* m, const uint8_t* d){
+    const uint64_t r_sig_data = (uint64_t)d[0]
+        | ((uint64_t)d[1] << 8)
+        | ((uint64_t)d[2] << 16)
+        | ((uint64_t)d[3] << 24)
+        | ((uint64_t)d[4] << 32)
+        | ((uint64_t)d[5] << 40)
+        | ((uint64_t)d[6] << 48)
+        | ((uint64_t)d[7] << 56);
+    m->sig_data = (uint64_t)(r_sig_data);
+}
+
+static inline void pcan_tcu_sca_user_info_ble_sess_pack(uint8_t* d, const pcan_tcu_sca_user_info_ble_sess_t* m){
+    const uint64_t r_sig_data = (uint64_t)m->sig_data;
+    d[0] = (uint8_t)(r_sig_data);
+    d[1] = (uint8_t)((r_sig_data >> 8));
+    d[2] = (uint8_t)((r_sig_data >> 16));
+    d[3] = (uint8_t)((r_sig_data >> 24));
+    d[4] = (uint8_t)((r_sig_data >> 32));
+    d[5] = (uint8_t)((r_sig_data >> 40));
+    d[6] = (uint8_t)((r_sig_data >> 48));
+    d[7] = (uint8_t)((r_sig_data >> 56));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_ble_sess_decode(const CanFrame* fr, pcan_tcu_sca_user_info_ble_sess_t* m){
+    pcan_tcu_sca_user_info_ble_sess_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_ble_sess_encode(const pcan_tcu_sca_user_info_ble_sess_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_BLE_SESS_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_BLE_SESS_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_ble_sess_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_ble_sess_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_ble_sess_decode(fr, (pcan_tcu_sca_user_info_ble_sess_t*)m);
+}
+
+// ---- 0x109 TCU_SCA_USER_INFO_BLE_CHALL (8 bytes, TCU)
+#define PCAN_TCU_SCA_USER_INFO_BLE_CHALL_ID   0x109u
+#define PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN) && PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO_BLE_CHALL: invalid length");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN * 8, "TCU_SCA_USER_INFO_BLE_CHALL.sig_data: out of frame");
+
+typedef struct {
+    uint64_t  sig_data;
+} pcan_tcu_sca_user_info_ble_chall_t;
+
+static inline void pcan_tcu_sca_user_info_ble_chall_unpack(pcan_tcu_sca_user_info_ble_chall_t* m, const uint8_t* d){
+    const uint64_t r_sig_data = (uint64_t)d[0]
+        | ((uint64_t)d[1] << 8)
+        | ((uint64_t)d[2] << 16)
+        | ((uint64_t)d[3] << 24)
+        | ((uint64_t)d[4] << 32)
+        | ((uint64_t)d[5] << 40)
+        | ((uint64_t)d[6] << 48)
+        | ((uint64_t)d[7] << 56);
+    m->sig_data = (uint64_t)(r_sig_data);
+}
+
+static inline void pcan_tcu_sca_user_info_ble_chall_pack(uint8_t* d, const pcan_tcu_sca_user_info_ble_chall_t* m){
+    const uint64_t r_sig_data = (uint64_t)m->sig_data;
+    d[0] = (uint8_t)(r_sig_data);
+    d[1] = (uint8_t)((r_sig_data >> 8));
+    d[2] = (uint8_t)((r_sig_data >> 16));
+    d[3] = (uint8_t)((r_sig_data >> 24));
+    d[4] = (uint8_t)((r_sig_data >> 32));
+    d[5] = (uint8_t)((r_sig_data >> 40));
+    d[6] = (uint8_t)((r_sig_data >> 48));
+    d[7] = (uint8_t)((r_sig_data >> 56));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_ble_chall_decode(const CanFrame* fr, pcan_tcu_sca_user_info_ble_chall_t* m){
+    pcan_tcu_sca_user_info_ble_chall_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_ble_chall_encode(const pcan_tcu_sca_user_info_ble_chall_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_BLE_CHALL_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_BLE_CHALL_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_ble_chall_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_ble_chall_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_ble_chall_decode(fr, (pcan_tcu_sca_user_info_ble_chall_t*)m);
+}
+
+// ---- 0x110 TCU_SCA_USER_INFO_BLE_FLAG (8 bytes, TCU)
+#define PCAN_TCU_SCA_USER_INFO_BLE_FLAG_ID   0x110u
+#define PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN) && PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN <= CAN_FRAME_DATA_MAX, "TCU_SCA_USER_INFO_BLE_FLAG: invalid length");
+CANDB_STATIC_ASSERT(63 < PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN * 8, "TCU_SCA_USER_INFO_BLE_FLAG.sig_data: out of frame");
+
+typedef struct {
+    uint64_t  sig_data;
+} pcan_tcu_sca_user_info_ble_flag_t;
+
+static inline void pcan_tcu_sca_user_info_ble_flag_unpack(pcan_tcu_sca_user_info_ble_flag_t* m, const uint8_t* d){
+    const uint64_t r_sig_data = (uint64_t)d[0]
+        | ((uint64_t)d[1] << 8)
+        | ((uint64_t)d[2] << 16)
+        | ((uint64_t)d[3] << 24)
+        | ((uint64_t)d[4] << 32)
+        | ((uint64_t)d[5] << 40)
+        | ((uint64_t)d[6] << 48)
+        | ((uint64_t)d[7] << 56);
+    m->sig_data = (uint64_t)(r_sig_data);
+}
+
+static inline void pcan_tcu_sca_user_info_ble_flag_pack(uint8_t* d, const pcan_tcu_sca_user_info_ble_flag_t* m){
+    const uint64_t r_sig_data = (uint64_t)m->sig_data;
+    d[0] = (uint8_t)(r_sig_data);
+    d[1] = (uint8_t)((r_sig_data >> 8));
+    d[2] = (uint8_t)((r_sig_data >> 16));
+    d[3] = (uint8_t)((r_sig_data >> 24));
+    d[4] = (uint8_t)((r_sig_data >> 32));
+    d[5] = (uint8_t)((r_sig_data >> 40));
+    d[6] = (uint8_t)((r_sig_data >> 48));
+    d[7] = (uint8_t)((r_sig_data >> 56));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_sca_user_info_ble_flag_decode(const CanFrame* fr, pcan_tcu_sca_user_info_ble_flag_t* m){
+    pcan_tcu_sca_user_info_ble_flag_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_sca_user_info_ble_flag_encode(const pcan_tcu_sca_user_info_ble_flag_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_SCA_USER_INFO_BLE_FLAG_ID;
+    fr.dlc          = PCAN_TCU_SCA_USER_INFO_BLE_FLAG_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_sca_user_info_ble_flag_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_sca_user_info_ble_flag_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_sca_user_info_ble_flag_decode(fr, (pcan_tcu_sca_user_info_ble_flag_t*)m);
+}
+
+// ---- 0x111 SCA_TCU_USER_INFO_ACK (2 bytes, SCA)
+#define PCAN_SCA_TCU_USER_INFO_ACK_ID   0x111u
+#define PCAN_SCA_TCU_USER_INFO_ACK_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_TCU_USER_INFO_ACK_LEN) && PCAN_SCA_TCU_USER_INFO_ACK_LEN <= CAN_FRAME_DATA_MAX, "SCA_TCU_USER_INFO_ACK: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_SCA_TCU_USER_INFO_ACK_LEN * 8, "SCA_TCU_USER_INFO_ACK.sig_ack_index: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_SCA_TCU_USER_INFO_ACK_LEN * 8, "SCA_TCU_USER_INFO_ACK.sig_ack_state: out of frame");
+
+typedef struct {
+    uint8_t   sig_ack_index;
+    uint8_t   sig_ack_state;
+} pcan_sca_tcu_user_info_ack_t;
+
+static inline void pcan_sca_tcu_user_info_ack_unpack(pcan_sca_tcu_user_info_ack_t* m, const uint8_t* d){
+    const uint32_t r_sig_ack_index = (uint32_t)d[0];
+    m->sig_ack_index = (uint8_t)(r_sig_ack_index);
+    const uint32_t r_sig_ack_state = (uint32_t)d[1];
+    m->sig_ack_state = (uint8_t)(r_sig_ack_state);
+}
+
+static inline void pcan_sca_tcu_user_info_ack_pack(uint8_t* d, const pcan_sca_tcu_user_info_ack_t* m){
+    const uint32_t r_sig_ack_index = (uint32_t)m->sig_ack_index;
+    const uint32_t r_sig_ack_state = (uint32_t)m->sig_ack_state;
+    d[0] = (uint8_t)(r_sig_ack_index);
+    d[1] = (uint8_t)(r_sig_ack_state);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_tcu_user_info_ack_decode(const CanFrame* fr, pcan_sca_tcu_user_info_ack_t* m){
+    pcan_sca_tcu_user_info_ack_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_TCU_USER_INFO_ACK_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_tcu_user_info_ack_encode(const pcan_sca_tcu_user_info_ack_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_TCU_USER_INFO_ACK_ID;
+    fr.dlc          = PCAN_SCA_TCU_USER_INFO_ACK_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_tcu_user_info_ack_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_tcu_user_info_ack_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_tcu_user_info_ack_decode(fr, (pcan_sca_tcu_user_info_ack_t*)m);
+}
+
+// ---- 0x112 SCA_DCU_AUTH_RESULT (8 bytes, SCA)
+#define PCAN_SCA_DCU_AUTH_RESULT_ID   0x112u
+#define PCAN_SCA_DCU_AUTH_RESULT_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_DCU_AUTH_RESULT_LEN) && PCAN_SCA_DCU_AUTH_RESULT_LEN <= CAN_FRAME_DATA_MAX, "SCA_DCU_AUTH_RESULT: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_SCA_DCU_AUTH_RESULT_LEN * 8, "SCA_DCU_AUTH_RESULT.sig_flag: out of frame");
+CANDB_STATIC_ASSERT(63 < PCAN_SCA_DCU_AUTH_RESULT_LEN * 8, "SCA_DCU_AUTH_RESULT.sig_user_id: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;  // 0x01: 실패, 그 외: 성공
+    uint64_t  sig_user_id;  // 사용자 ID 앞 7바이트 (나머지는 SCA_DCU_AUTH_RESULT_ADD)
+} pcan_sca_dcu_auth_result_t;
+
+static inline void pcan_sca_dcu_auth_result_unpack(pcan_sca_dcu_auth_result_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+    const uint64_t r_sig_user_id = (uint64_t)d[1]
+        | ((uint64_t)d[2] << 8)
+        | ((uint64_t)d[3] << 16)
+        | ((uint64_t)d[4] << 24)
+        | ((uint64_t)d[5] << 32)
+        | ((uint64_t)d[6] << 40)
+        | ((uint64_t)d[7] << 48);
+    m->sig_user_id = (uint64_t)(r_sig_user_id);
+}
+
+static inline void pcan_sca_dcu_auth_result_pack(uint8_t* d, const pcan_sca_dcu_auth_result_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    const uint64_t r_sig_user_id = (uint64_t)m->sig_user_id;
+    d[0] = (uint8_t)(r_sig_flag);
+    d[1] = (uint8_t)(r_sig_user_id);
+    d[2] = (uint8_t)((r_sig_user_id >> 8));
+    d[3] = (uint8_t)((r_sig_user_id >> 16));
+    d[4] = (uint8_t)((r_sig_user_id >> 24));
+    d[5] = (uint8_t)((r_sig_user_id >> 32));
+    d[6] = (uint8_t)((r_sig_user_id >> 40));
+    d[7] = (uint8_t)((r_sig_user_id >> 48));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_dcu_auth_result_decode(const CanFrame* fr, pcan_sca_dcu_auth_result_t* m){
+    pcan_sca_dcu_auth_result_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_DCU_AUTH_RESULT_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_dcu_auth_result_encode(const pcan_sca_dcu_auth_result_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_DCU_AUTH_RESULT_ID;
+    fr.dlc          = PCAN_SCA_DCU_AUTH_RESULT_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_dcu_auth_result_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_dcu_auth_result_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_dcu_auth_result_decode(fr, (pcan_sca_dcu_auth_result_t*)m);
+}
+
+// ---- 0x113 SCA_DCU_AUTH_RESULT_ADD (8 bytes, SCA)
+#define PCAN_SCA_DCU_AUTH_RESULT_ADD_ID   0x113u
+#define PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN  8
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN) && PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN <= CAN_FRAME_DATA_MAX, "SCA_DCU_AUTH_RESULT_ADD: invalid length");
+CANDB_STATIC_ASSERT(63 < PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN * 8, "SCA_DCU_AUTH_RESULT_ADD.sig_user_id: out of frame");
+
+typedef struct {
+    uint64_t  sig_user_id;
+} pcan_sca_dcu_auth_result_add_t;
+
+static inline void pcan_sca_dcu_auth_result_add_unpack(pcan_sca_dcu_auth_result_add_t* m, const uint8_t* d){
+    const uint64_t r_sig_user_id = (uint64_t)d[0]
+        | ((uint64_t)d[1] << 8)
+        | ((uint64_t)d[2] << 16)
+        | ((uint64_t)d[3] << 24)
+        | ((uint64_t)d[4] << 32)
+        | ((uint64_t)d[5] << 40)
+        | ((uint64_t)d[6] << 48)
+        | ((uint64_t)d[7] << 56);
+    m->sig_user_id = (uint64_t)(r_sig_user_id);
+}
+
+static inline void pcan_sca_dcu_auth_result_add_pack(uint8_t* d, const pcan_sca_dcu_auth_result_add_t* m){
+    const uint64_t r_sig_user_id = (uint64_t)m->sig_user_id;
+    d[0] = (uint8_t)(r_sig_user_id);
+    d[1] = (uint8_t)((r_sig_user_id >> 8));
+    d[2] = (uint8_t)((r_sig_user_id >> 16));
+    d[3] = (uint8_t)((r_sig_user_id >> 24));
+    d[4] = (uint8_t)((r_sig_user_id >> 32));
+    d[5] = (uint8_t)((r_sig_user_id >> 40));
+    d[6] = (uint8_t)((r_sig_user_id >> 48));
+    d[7] = (uint8_t)((r_sig_user_id >> 56));
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_sca_dcu_auth_result_add_decode(const CanFrame* fr, pcan_sca_dcu_auth_result_add_t* m){
+    pcan_sca_dcu_auth_result_add_unpack(m, fr->data);
+    return fr->dlc >= PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_sca_dcu_auth_result_add_encode(const pcan_sca_dcu_auth_result_add_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_SCA_DCU_AUTH_RESULT_ADD_ID;
+    fr.dlc          = PCAN_SCA_DCU_AUTH_RESULT_ADD_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_sca_dcu_auth_result_add_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_sca_dcu_auth_result_add_decode_any(const CanFrame* fr, void* m){
+    return pcan_sca_dcu_auth_result_add_decode(fr, (pcan_sca_dcu_auth_result_add_t*)m);
+}
+
+// ---- 0x201 DCU_TCU_USER_PROFILE_REQ (1 byte, DCU)
+#define PCAN_DCU_TCU_USER_PROFILE_REQ_ID   0x201u
+#define PCAN_DCU_TCU_USER_PROFILE_REQ_LEN  1
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_TCU_USER_PROFILE_REQ_LEN) && PCAN_DCU_TCU_USER_PROFILE_REQ_LEN <= CAN_FRAME_DATA_MAX, "DCU_TCU_USER_PROFILE_REQ: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_TCU_USER_PROFILE_REQ_LEN * 8, "DCU_TCU_USER_PROFILE_REQ.sig_flag: out of frame");
+
+typedef struct {
+    uint8_t   sig_flag;
+} pcan_dcu_tcu_user_profile_req_t;
+
+static inline void pcan_dcu_tcu_user_profile_req_unpack(pcan_dcu_tcu_user_profile_req_t* m, const uint8_t* d){
+    const uint32_t r_sig_flag = (uint32_t)d[0];
+    m->sig_flag = (uint8_t)(r_sig_flag);
+}
+
+static inline void pcan_dcu_tcu_user_profile_req_pack(uint8_t* d, const pcan_dcu_tcu_user_profile_req_t* m){
+    const uint32_t r_sig_flag = (uint32_t)m->sig_flag;
+    d[0] = (uint8_t)(r_sig_flag);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_tcu_user_profile_req_decode(const CanFrame* fr, pcan_dcu_tcu_user_profile_req_t* m){
+    pcan_dcu_tcu_user_profile_req_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_TCU_USER_PROFILE_REQ_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_tcu_user_profile_req_encode(const pcan_dcu_tcu_user_profile_req_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_TCU_USER_PROFILE_REQ_ID;
+    fr.dlc          = PCAN_DCU_TCU_USER_PROFILE_REQ_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_tcu_user_profile_req_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_tcu_user_profile_req_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_tcu_user_profile_req_decode(fr, (pcan_dcu_tcu_user_profile_req_t*)m);
+}
+
+// ---- 0x202 TCU_DCU_USER_PROFILE_SEAT (4 bytes, TCU)
+#define PCAN_TCU_DCU_USER_PROFILE_SEAT_ID   0x202u
+#define PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN  4
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN) && PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN <= CAN_FRAME_DATA_MAX, "TCU_DCU_USER_PROFILE_SEAT: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN * 8, "TCU_DCU_USER_PROFILE_SEAT.sig_seat_position: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN * 8, "TCU_DCU_USER_PROFILE_SEAT.sig_seat_angle: out of frame");
+CANDB_STATIC_ASSERT(23 < PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN * 8, "TCU_DCU_USER_PROFILE_SEAT.sig_seat_front_height: out of frame");
+CANDB_STATIC_ASSERT(31 < PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN * 8, "TCU_DCU_USER_PROFILE_SEAT.sig_seat_rear_height: out of frame");
+
+typedef struct {
+    uint8_t   sig_seat_position;  // [0..100] %
+    uint8_t   sig_seat_angle;  // [0..180] deg
+    uint8_t   sig_seat_front_height;  // [0..100] %
+    uint8_t   sig_seat_rear_height;  // [0..100] %
+} pcan_tcu_dcu_user_profile_seat_t;
+
+static inline void pcan_tcu_dcu_user_profile_seat_unpack(pcan_tcu_dcu_user_profile_seat_t* m, const uint8_t* d){
+    const uint32_t r_sig_seat_position = (uint32_t)d[0];
+    m->sig_seat_position = (uint8_t)(r_sig_seat_position);
+    const uint32_t r_sig_seat_angle = (uint32_t)d[1];
+    m->sig_seat_angle = (uint8_t)(r_sig_seat_angle);
+    const uint32_t r_sig_seat_front_height = (uint32_t)d[2];
+    m->sig_seat_front_height = (uint8_t)(r_sig_seat_front_height);
+    const uint32_t r_sig_seat_rear_height = (uint32_t)d[3];
+    m->sig_seat_rear_height = (uint8_t)(r_sig_seat_rear_height);
+}
+
+static inline void pcan_tcu_dcu_user_profile_seat_pack(uint8_t* d, const pcan_tcu_dcu_user_profile_seat_t* m){
+    uint8_t v_sig_seat_position = m->sig_seat_position;
+    v_sig_seat_position = v_sig_seat_position > 100 ? 100 : v_sig_seat_position;
+    const uint32_t r_sig_seat_position = (uint32_t)v_sig_seat_position;
+    uint8_t v_sig_seat_angle = m->sig_seat_angle;
+    v_sig_seat_angle = v_sig_seat_angle > 180 ? 180 : v_sig_seat_angle;
+    const uint32_t r_sig_seat_angle = (uint32_t)v_sig_seat_angle;
+    uint8_t v_sig_seat_front_height = m->sig_seat_front_height;
+    v_sig_seat_front_height = v_sig_seat_front_height > 100 ? 100 : v_sig_seat_front_height;
+    const uint32_t r_sig_seat_front_height = (uint32_t)v_sig_seat_front_height;
+    uint8_t v_sig_seat_rear_height = m->sig_seat_rear_height;
+    v_sig_seat_rear_height = v_sig_seat_rear_height > 100 ? 100 : v_sig_seat_rear_height;
+    const uint32_t r_sig_seat_rear_height = (uint32_t)v_sig_seat_rear_height;
+    d[0] = (uint8_t)(r_sig_seat_position);
+    d[1] = (uint8_t)(r_sig_seat_angle);
+    d[2] = (uint8_t)(r_sig_seat_front_height);
+    d[3] = (uint8_t)(r_sig_seat_rear_height);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_dcu_user_profile_seat_decode(const CanFrame* fr, pcan_tcu_dcu_user_profile_seat_t* m){
+    pcan_tcu_dcu_user_profile_seat_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_dcu_user_profile_seat_encode(const pcan_tcu_dcu_user_profile_seat_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_DCU_USER_PROFILE_SEAT_ID;
+    fr.dlc          = PCAN_TCU_DCU_USER_PROFILE_SEAT_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_dcu_user_profile_seat_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_dcu_user_profile_seat_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_dcu_user_profile_seat_decode(fr, (pcan_tcu_dcu_user_profile_seat_t*)m);
+}
+
+// ---- 0x203 TCU_DCU_USER_PROFILE_MIRROR (6 bytes, TCU)
+#define PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID   0x203u
+#define PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN  6
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN) && PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN <= CAN_FRAME_DATA_MAX, "TCU_DCU_USER_PROFILE_MIRROR: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_left_yaw: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_left_pitch: out of frame");
+CANDB_STATIC_ASSERT(23 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_right_yaw: out of frame");
+CANDB_STATIC_ASSERT(31 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_right_pitch: out of frame");
+CANDB_STATIC_ASSERT(39 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_room_yaw: out of frame");
+CANDB_STATIC_ASSERT(47 < PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN * 8, "TCU_DCU_USER_PROFILE_MIRROR.sig_mirror_room_pitch: out of frame");
+
+typedef struct {
+    uint8_t   sig_mirror_left_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_left_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_right_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_right_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_room_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_room_pitch;  // [0..180] deg
+} pcan_tcu_dcu_user_profile_mirror_t;
+
+static inline void pcan_tcu_dcu_user_profile_mirror_unpack(pcan_tcu_dcu_user_profile_mirror_t* m, const uint8_t* d){
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)d[0];
+    m->sig_mirror_left_yaw = (uint8_t)(r_sig_mirror_left_yaw);
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)d[1];
+    m->sig_mirror_left_pitch = (uint8_t)(r_sig_mirror_left_pitch);
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)d[2];
+    m->sig_mirror_right_yaw = (uint8_t)(r_sig_mirror_right_yaw);
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)d[3];
+    m->sig_mirror_right_pitch = (uint8_t)(r_sig_mirror_right_pitch);
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)d[4];
+    m->sig_mirror_room_yaw = (uint8_t)(r_sig_mirror_room_yaw);
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)d[5];
+    m->sig_mirror_room_pitch = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+static inline void pcan_tcu_dcu_user_profile_mirror_pack(uint8_t* d, const pcan_tcu_dcu_user_profile_mirror_t* m){
+    uint8_t v_sig_mirror_left_yaw = m->sig_mirror_left_yaw;
+    v_sig_mirror_left_yaw = v_sig_mirror_left_yaw > 180 ? 180 : v_sig_mirror_left_yaw;
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)v_sig_mirror_left_yaw;
+    uint8_t v_sig_mirror_left_pitch = m->sig_mirror_left_pitch;
+    v_sig_mirror_left_pitch = v_sig_mirror_left_pitch > 180 ? 180 : v_sig_mirror_left_pitch;
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)v_sig_mirror_left_pitch;
+    uint8_t v_sig_mirror_right_yaw = m->sig_mirror_right_yaw;
+    v_sig_mirror_right_yaw = v_sig_mirror_right_yaw > 180 ? 180 : v_sig_mirror_right_yaw;
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)v_sig_mirror_right_yaw;
+    uint8_t v_sig_mirror_right_pitch = m->sig_mirror_right_pitch;
+    v_sig_mirror_right_pitch = v_sig_mirror_right_pitch > 180 ? 180 : v_sig_mirror_right_pitch;
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)v_sig_mirror_right_pitch;
+    uint8_t v_sig_mirror_room_yaw = m->sig_mirror_room_yaw;
+    v_sig_mirror_room_yaw = v_sig_mirror_room_yaw > 180 ? 180 : v_sig_mirror_room_yaw;
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)v_sig_mirror_room_yaw;
+    uint8_t v_sig_mirror_room_pitch = m->sig_mirror_room_pitch;
+    v_sig_mirror_room_pitch = v_sig_mirror_room_pitch > 180 ? 180 : v_sig_mirror_room_pitch;
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)v_sig_mirror_room_pitch;
+    d[0] = (uint8_t)(r_sig_mirror_left_yaw);
+    d[1] = (uint8_t)(r_sig_mirror_left_pitch);
+    d[2] = (uint8_t)(r_sig_mirror_right_yaw);
+    d[3] = (uint8_t)(r_sig_mirror_right_pitch);
+    d[4] = (uint8_t)(r_sig_mirror_room_yaw);
+    d[5] = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_dcu_user_profile_mirror_decode(const CanFrame* fr, pcan_tcu_dcu_user_profile_mirror_t* m){
+    pcan_tcu_dcu_user_profile_mirror_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_dcu_user_profile_mirror_encode(const pcan_tcu_dcu_user_profile_mirror_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID;
+    fr.dlc          = PCAN_TCU_DCU_USER_PROFILE_MIRROR_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_dcu_user_profile_mirror_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_dcu_user_profile_mirror_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_dcu_user_profile_mirror_decode(fr, (pcan_tcu_dcu_user_profile_mirror_t*)m);
+}
+
+// ---- 0x204 TCU_DCU_USER_PROFILE_WHEEL (2 bytes, TCU)
+#define PCAN_TCU_DCU_USER_PROFILE_WHEEL_ID   0x204u
+#define PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN) && PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN <= CAN_FRAME_DATA_MAX, "TCU_DCU_USER_PROFILE_WHEEL: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN * 8, "TCU_DCU_USER_PROFILE_WHEEL.sig_wheel_position: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN * 8, "TCU_DCU_USER_PROFILE_WHEEL.sig_wheel_angle: out of frame");
+
+typedef struct {
+    uint8_t   sig_wheel_position;  // [0..100] %
+    uint8_t   sig_wheel_angle;  // [0..180] deg
+} pcan_tcu_dcu_user_profile_wheel_t;
+
+static inline void pcan_tcu_dcu_user_profile_wheel_unpack(pcan_tcu_dcu_user_profile_wheel_t* m, const uint8_t* d){
+    const uint32_t r_sig_wheel_position = (uint32_t)d[0];
+    m->sig_wheel_position = (uint8_t)(r_sig_wheel_position);
+    const uint32_t r_sig_wheel_angle = (uint32_t)d[1];
+    m->sig_wheel_angle = (uint8_t)(r_sig_wheel_angle);
+}
+
+static inline void pcan_tcu_dcu_user_profile_wheel_pack(uint8_t* d, const pcan_tcu_dcu_user_profile_wheel_t* m){
+    uint8_t v_sig_wheel_position = m->sig_wheel_position;
+    v_sig_wheel_position = v_sig_wheel_position > 100 ? 100 : v_sig_wheel_position;
+    const uint32_t r_sig_wheel_position = (uint32_t)v_sig_wheel_position;
+    uint8_t v_sig_wheel_angle = m->sig_wheel_angle;
+    v_sig_wheel_angle = v_sig_wheel_angle > 180 ? 180 : v_sig_wheel_angle;
+    const uint32_t r_sig_wheel_angle = (uint32_t)v_sig_wheel_angle;
+    d[0] = (uint8_t)(r_sig_wheel_position);
+    d[1] = (uint8_t)(r_sig_wheel_angle);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_dcu_user_profile_wheel_decode(const CanFrame* fr, pcan_tcu_dcu_user_profile_wheel_t* m){
+    pcan_tcu_dcu_user_profile_wheel_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_dcu_user_profile_wheel_encode(const pcan_tcu_dcu_user_profile_wheel_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_DCU_USER_PROFILE_WHEEL_ID;
+    fr.dlc          = PCAN_TCU_DCU_USER_PROFILE_WHEEL_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_dcu_user_profile_wheel_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_dcu_user_profile_wheel_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_dcu_user_profile_wheel_decode(fr, (pcan_tcu_dcu_user_profile_wheel_t*)m);
+}
+
+// ---- 0x205 DCU_TCU_USER_PROFILE_ACK (2 bytes, DCU)
+#define PCAN_DCU_TCU_USER_PROFILE_ACK_ID   0x205u
+#define PCAN_DCU_TCU_USER_PROFILE_ACK_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_TCU_USER_PROFILE_ACK_LEN) && PCAN_DCU_TCU_USER_PROFILE_ACK_LEN <= CAN_FRAME_DATA_MAX, "DCU_TCU_USER_PROFILE_ACK: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_TCU_USER_PROFILE_ACK_LEN * 8, "DCU_TCU_USER_PROFILE_ACK.sig_ack_index: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_DCU_TCU_USER_PROFILE_ACK_LEN * 8, "DCU_TCU_USER_PROFILE_ACK.sig_ack_state: out of frame");
+
+typedef struct {
+    uint8_t   sig_ack_index;
+    uint8_t   sig_ack_state;
+} pcan_dcu_tcu_user_profile_ack_t;
+
+static inline void pcan_dcu_tcu_user_profile_ack_unpack(pcan_dcu_tcu_user_profile_ack_t* m, const uint8_t* d){
+    const uint32_t r_sig_ack_index = (uint32_t)d[0];
+    m->sig_ack_index = (uint8_t)(r_sig_ack_index);
+    const uint32_t r_sig_ack_state = (uint32_t)d[1];
+    m->sig_ack_state = (uint8_t)(r_sig_ack_state);
+}
+
+static inline void pcan_dcu_tcu_user_profile_ack_pack(uint8_t* d, const pcan_dcu_tcu_user_profile_ack_t* m){
+    const uint32_t r_sig_ack_index = (uint32_t)m->sig_ack_index;
+    const uint32_t r_sig_ack_state = (uint32_t)m->sig_ack_state;
+    d[0] = (uint8_t)(r_sig_ack_index);
+    d[1] = (uint8_t)(r_sig_ack_state);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_tcu_user_profile_ack_decode(const CanFrame* fr, pcan_dcu_tcu_user_profile_ack_t* m){
+    pcan_dcu_tcu_user_profile_ack_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_TCU_USER_PROFILE_ACK_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_tcu_user_profile_ack_encode(const pcan_dcu_tcu_user_profile_ack_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_TCU_USER_PROFILE_ACK_ID;
+    fr.dlc          = PCAN_DCU_TCU_USER_PROFILE_ACK_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_tcu_user_profile_ack_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_tcu_user_profile_ack_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_tcu_user_profile_ack_decode(fr, (pcan_dcu_tcu_user_profile_ack_t*)m);
+}
+
+// ---- 0x206 DCU_TCU_USER_PROFILE_SEAT_UPDATE (4 bytes, DCU)
+#define PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_ID   0x206u
+#define PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN  4
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN) && PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN <= CAN_FRAME_DATA_MAX, "DCU_TCU_USER_PROFILE_SEAT_UPDATE: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_SEAT_UPDATE.sig_seat_position: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_SEAT_UPDATE.sig_seat_angle: out of frame");
+CANDB_STATIC_ASSERT(23 < PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_SEAT_UPDATE.sig_seat_front_height: out of frame");
+CANDB_STATIC_ASSERT(31 < PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_SEAT_UPDATE.sig_seat_rear_height: out of frame");
+
+typedef struct {
+    uint8_t   sig_seat_position;  // [0..100] %
+    uint8_t   sig_seat_angle;  // [0..180] deg
+    uint8_t   sig_seat_front_height;  // [0..100] %
+    uint8_t   sig_seat_rear_height;  // [0..100] %
+} pcan_dcu_tcu_user_profile_seat_update_t;
+
+static inline void pcan_dcu_tcu_user_profile_seat_update_unpack(pcan_dcu_tcu_user_profile_seat_update_t* m, const uint8_t* d){
+    const uint32_t r_sig_seat_position = (uint32_t)d[0];
+    m->sig_seat_position = (uint8_t)(r_sig_seat_position);
+    const uint32_t r_sig_seat_angle = (uint32_t)d[1];
+    m->sig_seat_angle = (uint8_t)(r_sig_seat_angle);
+    const uint32_t r_sig_seat_front_height = (uint32_t)d[2];
+    m->sig_seat_front_height = (uint8_t)(r_sig_seat_front_height);
+    const uint32_t r_sig_seat_rear_height = (uint32_t)d[3];
+    m->sig_seat_rear_height = (uint8_t)(r_sig_seat_rear_height);
+}
+
+static inline void pcan_dcu_tcu_user_profile_seat_update_pack(uint8_t* d, const pcan_dcu_tcu_user_profile_seat_update_t* m){
+    uint8_t v_sig_seat_position = m->sig_seat_position;
+    v_sig_seat_position = v_sig_seat_position > 100 ? 100 : v_sig_seat_position;
+    const uint32_t r_sig_seat_position = (uint32_t)v_sig_seat_position;
+    uint8_t v_sig_seat_angle = m->sig_seat_angle;
+    v_sig_seat_angle = v_sig_seat_angle > 180 ? 180 : v_sig_seat_angle;
+    const uint32_t r_sig_seat_angle = (uint32_t)v_sig_seat_angle;
+    uint8_t v_sig_seat_front_height = m->sig_seat_front_height;
+    v_sig_seat_front_height = v_sig_seat_front_height > 100 ? 100 : v_sig_seat_front_height;
+    const uint32_t r_sig_seat_front_height = (uint32_t)v_sig_seat_front_height;
+    uint8_t v_sig_seat_rear_height = m->sig_seat_rear_height;
+    v_sig_seat_rear_height = v_sig_seat_rear_height > 100 ? 100 : v_sig_seat_rear_height;
+    const uint32_t r_sig_seat_rear_height = (uint32_t)v_sig_seat_rear_height;
+    d[0] = (uint8_t)(r_sig_seat_position);
+    d[1] = (uint8_t)(r_sig_seat_angle);
+    d[2] = (uint8_t)(r_sig_seat_front_height);
+    d[3] = (uint8_t)(r_sig_seat_rear_height);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_tcu_user_profile_seat_update_decode(const CanFrame* fr, pcan_dcu_tcu_user_profile_seat_update_t* m){
+    pcan_dcu_tcu_user_profile_seat_update_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_tcu_user_profile_seat_update_encode(const pcan_dcu_tcu_user_profile_seat_update_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_ID;
+    fr.dlc          = PCAN_DCU_TCU_USER_PROFILE_SEAT_UPDATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_tcu_user_profile_seat_update_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_tcu_user_profile_seat_update_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_tcu_user_profile_seat_update_decode(fr, (pcan_dcu_tcu_user_profile_seat_update_t*)m);
+}
+
+// ---- 0x207 DCU_TCU_USER_PROFILE_MIRROR_UPDATE (6 bytes, DCU)
+#define PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_ID   0x207u
+#define PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN  6
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN) && PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN <= CAN_FRAME_DATA_MAX, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_left_yaw: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_left_pitch: out of frame");
+CANDB_STATIC_ASSERT(23 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_right_yaw: out of frame");
+CANDB_STATIC_ASSERT(31 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_right_pitch: out of frame");
+CANDB_STATIC_ASSERT(39 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_room_yaw: out of frame");
+CANDB_STATIC_ASSERT(47 < PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_MIRROR_UPDATE.sig_mirror_room_pitch: out of frame");
+
+typedef struct {
+    uint8_t   sig_mirror_left_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_left_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_right_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_right_pitch;  // [0..180] deg
+    uint8_t   sig_mirror_room_yaw;  // [0..180] deg
+    uint8_t   sig_mirror_room_pitch;  // [0..180] deg
+} pcan_dcu_tcu_user_profile_mirror_update_t;
+
+static inline void pcan_dcu_tcu_user_profile_mirror_update_unpack(pcan_dcu_tcu_user_profile_mirror_update_t* m, const uint8_t* d){
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)d[0];
+    m->sig_mirror_left_yaw = (uint8_t)(r_sig_mirror_left_yaw);
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)d[1];
+    m->sig_mirror_left_pitch = (uint8_t)(r_sig_mirror_left_pitch);
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)d[2];
+    m->sig_mirror_right_yaw = (uint8_t)(r_sig_mirror_right_yaw);
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)d[3];
+    m->sig_mirror_right_pitch = (uint8_t)(r_sig_mirror_right_pitch);
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)d[4];
+    m->sig_mirror_room_yaw = (uint8_t)(r_sig_mirror_room_yaw);
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)d[5];
+    m->sig_mirror_room_pitch = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+static inline void pcan_dcu_tcu_user_profile_mirror_update_pack(uint8_t* d, const pcan_dcu_tcu_user_profile_mirror_update_t* m){
+    uint8_t v_sig_mirror_left_yaw = m->sig_mirror_left_yaw;
+    v_sig_mirror_left_yaw = v_sig_mirror_left_yaw > 180 ? 180 : v_sig_mirror_left_yaw;
+    const uint32_t r_sig_mirror_left_yaw = (uint32_t)v_sig_mirror_left_yaw;
+    uint8_t v_sig_mirror_left_pitch = m->sig_mirror_left_pitch;
+    v_sig_mirror_left_pitch = v_sig_mirror_left_pitch > 180 ? 180 : v_sig_mirror_left_pitch;
+    const uint32_t r_sig_mirror_left_pitch = (uint32_t)v_sig_mirror_left_pitch;
+    uint8_t v_sig_mirror_right_yaw = m->sig_mirror_right_yaw;
+    v_sig_mirror_right_yaw = v_sig_mirror_right_yaw > 180 ? 180 : v_sig_mirror_right_yaw;
+    const uint32_t r_sig_mirror_right_yaw = (uint32_t)v_sig_mirror_right_yaw;
+    uint8_t v_sig_mirror_right_pitch = m->sig_mirror_right_pitch;
+    v_sig_mirror_right_pitch = v_sig_mirror_right_pitch > 180 ? 180 : v_sig_mirror_right_pitch;
+    const uint32_t r_sig_mirror_right_pitch = (uint32_t)v_sig_mirror_right_pitch;
+    uint8_t v_sig_mirror_room_yaw = m->sig_mirror_room_yaw;
+    v_sig_mirror_room_yaw = v_sig_mirror_room_yaw > 180 ? 180 : v_sig_mirror_room_yaw;
+    const uint32_t r_sig_mirror_room_yaw = (uint32_t)v_sig_mirror_room_yaw;
+    uint8_t v_sig_mirror_room_pitch = m->sig_mirror_room_pitch;
+    v_sig_mirror_room_pitch = v_sig_mirror_room_pitch > 180 ? 180 : v_sig_mirror_room_pitch;
+    const uint32_t r_sig_mirror_room_pitch = (uint32_t)v_sig_mirror_room_pitch;
+    d[0] = (uint8_t)(r_sig_mirror_left_yaw);
+    d[1] = (uint8_t)(r_sig_mirror_left_pitch);
+    d[2] = (uint8_t)(r_sig_mirror_right_yaw);
+    d[3] = (uint8_t)(r_sig_mirror_right_pitch);
+    d[4] = (uint8_t)(r_sig_mirror_room_yaw);
+    d[5] = (uint8_t)(r_sig_mirror_room_pitch);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_tcu_user_profile_mirror_update_decode(const CanFrame* fr, pcan_dcu_tcu_user_profile_mirror_update_t* m){
+    pcan_dcu_tcu_user_profile_mirror_update_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_tcu_user_profile_mirror_update_encode(const pcan_dcu_tcu_user_profile_mirror_update_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_ID;
+    fr.dlc          = PCAN_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_tcu_user_profile_mirror_update_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_tcu_user_profile_mirror_update_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_tcu_user_profile_mirror_update_decode(fr, (pcan_dcu_tcu_user_profile_mirror_update_t*)m);
+}
+
+// ---- 0x208 DCU_TCU_USER_PROFILE_WHEEL_UPDATE (2 bytes, DCU)
+#define PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_ID   0x208u
+#define PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN) && PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN <= CAN_FRAME_DATA_MAX, "DCU_TCU_USER_PROFILE_WHEEL_UPDATE: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_WHEEL_UPDATE.sig_wheel_position: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN * 8, "DCU_TCU_USER_PROFILE_WHEEL_UPDATE.sig_wheel_angle: out of frame");
+
+typedef struct {
+    uint8_t   sig_wheel_position;  // [0..100] %
+    uint8_t   sig_wheel_angle;  // [0..180] deg
+} pcan_dcu_tcu_user_profile_wheel_update_t;
+
+static inline void pcan_dcu_tcu_user_profile_wheel_update_unpack(pcan_dcu_tcu_user_profile_wheel_update_t* m, const uint8_t* d){
+    const uint32_t r_sig_wheel_position = (uint32_t)d[0];
+    m->sig_wheel_position = (uint8_t)(r_sig_wheel_position);
+    const uint32_t r_sig_wheel_angle = (uint32_t)d[1];
+    m->sig_wheel_angle = (uint8_t)(r_sig_wheel_angle);
+}
+
+static inline void pcan_dcu_tcu_user_profile_wheel_update_pack(uint8_t* d, const pcan_dcu_tcu_user_profile_wheel_update_t* m){
+    uint8_t v_sig_wheel_position = m->sig_wheel_position;
+    v_sig_wheel_position = v_sig_wheel_position > 100 ? 100 : v_sig_wheel_position;
+    const uint32_t r_sig_wheel_position = (uint32_t)v_sig_wheel_position;
+    uint8_t v_sig_wheel_angle = m->sig_wheel_angle;
+    v_sig_wheel_angle = v_sig_wheel_angle > 180 ? 180 : v_sig_wheel_angle;
+    const uint32_t r_sig_wheel_angle = (uint32_t)v_sig_wheel_angle;
+    d[0] = (uint8_t)(r_sig_wheel_position);
+    d[1] = (uint8_t)(r_sig_wheel_angle);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_dcu_tcu_user_profile_wheel_update_decode(const CanFrame* fr, pcan_dcu_tcu_user_profile_wheel_update_t* m){
+    pcan_dcu_tcu_user_profile_wheel_update_unpack(m, fr->data);
+    return fr->dlc >= PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_dcu_tcu_user_profile_wheel_update_encode(const pcan_dcu_tcu_user_profile_wheel_update_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_ID;
+    fr.dlc          = PCAN_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_dcu_tcu_user_profile_wheel_update_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_dcu_tcu_user_profile_wheel_update_decode_any(const CanFrame* fr, void* m){
+    return pcan_dcu_tcu_user_profile_wheel_update_decode(fr, (pcan_dcu_tcu_user_profile_wheel_update_t*)m);
+}
+
+// ---- 0x209 TCU_DCU_USER_PROFILE_UPDATE_ACK (2 bytes, TCU)
+#define PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_ID   0x209u
+#define PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN  2
+CANDB_STATIC_ASSERT(CANDB_VALID_LEN(PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN) && PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN <= CAN_FRAME_DATA_MAX, "TCU_DCU_USER_PROFILE_UPDATE_ACK: invalid length");
+CANDB_STATIC_ASSERT(7 < PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN * 8, "TCU_DCU_USER_PROFILE_UPDATE_ACK.sig_ack_index: out of frame");
+CANDB_STATIC_ASSERT(15 < PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN * 8, "TCU_DCU_USER_PROFILE_UPDATE_ACK.sig_ack_state: out of frame");
+
+typedef struct {
+    uint8_t   sig_ack_index;
+    uint8_t   sig_ack_state;
+} pcan_tcu_dcu_user_profile_update_ack_t;
+
+static inline void pcan_tcu_dcu_user_profile_update_ack_unpack(pcan_tcu_dcu_user_profile_update_ack_t* m, const uint8_t* d){
+    const uint32_t r_sig_ack_index = (uint32_t)d[0];
+    m->sig_ack_index = (uint8_t)(r_sig_ack_index);
+    const uint32_t r_sig_ack_state = (uint32_t)d[1];
+    m->sig_ack_state = (uint8_t)(r_sig_ack_state);
+}
+
+static inline void pcan_tcu_dcu_user_profile_update_ack_pack(uint8_t* d, const pcan_tcu_dcu_user_profile_update_ack_t* m){
+    const uint32_t r_sig_ack_index = (uint32_t)m->sig_ack_index;
+    const uint32_t r_sig_ack_state = (uint32_t)m->sig_ack_state;
+    d[0] = (uint8_t)(r_sig_ack_index);
+    d[1] = (uint8_t)(r_sig_ack_state);
+}
+
+// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다
+static inline can_err_t pcan_tcu_dcu_user_profile_update_ack_decode(const CanFrame* fr, pcan_tcu_dcu_user_profile_update_ack_t* m){
+    pcan_tcu_dcu_user_profile_update_ack_unpack(m, fr->data);
+    return fr->dlc >= PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN ? CAN_OK : CAN_ERR_INVALID;
+}
+
+static inline CanFrame pcan_tcu_dcu_user_profile_update_ack_encode(const pcan_tcu_dcu_user_profile_update_ack_t* m){
+    CanFrame fr;
+    fr.id           = PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_ID;
+    fr.dlc          = PCAN_TCU_DCU_USER_PROFILE_UPDATE_ACK_LEN;
+    fr.flags        = 0;
+    fr.timestamp_ns = 0;
+    pcan_tcu_dcu_user_profile_update_ack_pack(fr.data, m);
+    return fr;
+}
+
+static inline can_err_t pcan_tcu_dcu_user_profile_update_ack_decode_any(const CanFrame* fr, void* m){
+    return pcan_tcu_dcu_user_profile_update_ack_decode(fr, (pcan_tcu_dcu_user_profile_update_ack_t*)m);
+}
+
+// ---- PCAN 버스 전체
+typedef union {
+    pcan_dcu_reset_t dcu_reset;
+    pcan_dcu_reset_ack_t dcu_reset_ack;
+    pcan_sca_dcu_driver_event_t sca_dcu_driver_event;
+    pcan_dcu_sca_drive_status_t dcu_sca_drive_status;
+    pcan_dcu_sca_user_face_req_t dcu_sca_user_face_req;
+    pcan_sca_tcu_user_info_req_t sca_tcu_user_info_req;
+    pcan_sca_dcu_auth_state_t sca_dcu_auth_state;
+    pcan_tcu_sca_user_info_t tcu_sca_user_info;
+    pcan_tcu_sca_user_info_fd_t tcu_sca_user_info_fd;
+    pcan_tcu_sca_user_info_nfc_t tcu_sca_user_info_nfc;
+    pcan_tcu_sca_user_info_ble_sess_t tcu_sca_user_info_ble_sess;
+    pcan_tcu_sca_user_info_ble_chall_t tcu_sca_user_info_ble_chall;
+    pcan_tcu_sca_user_info_ble_flag_t tcu_sca_user_info_ble_flag;
+    pcan_sca_tcu_user_info_ack_t sca_tcu_user_info_ack;
+    pcan_sca_dcu_auth_result_t sca_dcu_auth_result;
+    pcan_sca_dcu_auth_result_add_t sca_dcu_auth_result_add;
+    pcan_dcu_tcu_user_profile_req_t dcu_tcu_user_profile_req;
+    pcan_tcu_dcu_user_profile_seat_t tcu_dcu_user_profile_seat;
+    pcan_tcu_dcu_user_profile_mirror_t tcu_dcu_user_profile_mirror;
+    pcan_tcu_dcu_user_profile_wheel_t tcu_dcu_user_profile_wheel;
+    pcan_dcu_tcu_user_profile_ack_t dcu_tcu_user_profile_ack;
+    pcan_dcu_tcu_user_profile_seat_update_t dcu_tcu_user_profile_seat_update;
+    pcan_dcu_tcu_user_profile_mirror_update_t dcu_tcu_user_profile_mirror_update;
+    pcan_dcu_tcu_user_profile_wheel_update_t dcu_tcu_user_profile_wheel_update;
+    pcan_tcu_dcu_user_profile_update_ack_t tcu_dcu_user_profile_update_ack;
+} pcan_db_t;
+
+enum {
+    PCAN_MSG_DCU_RESET = 0,
+    PCAN_MSG_DCU_RESET_ACK = 1,
+    PCAN_MSG_SCA_DCU_DRIVER_EVENT = 2,
+    PCAN_MSG_DCU_SCA_DRIVE_STATUS = 3,
+    PCAN_MSG_DCU_SCA_USER_FACE_REQ = 4,
+    PCAN_MSG_SCA_TCU_USER_INFO_REQ = 5,
+    PCAN_MSG_SCA_DCU_AUTH_STATE = 6,
+    PCAN_MSG_TCU_SCA_USER_INFO = 7,
+    PCAN_MSG_TCU_SCA_USER_INFO_FD = 8,
+    PCAN_MSG_TCU_SCA_USER_INFO_NFC = 9,
+    PCAN_MSG_TCU_SCA_USER_INFO_BLE_SESS = 10,
+    PCAN_MSG_TCU_SCA_USER_INFO_BLE_CHALL = 11,
+    PCAN_MSG_TCU_SCA_USER_INFO_BLE_FLAG = 12,
+    PCAN_MSG_SCA_TCU_USER_INFO_ACK = 13,
+    PCAN_MSG_SCA_DCU_AUTH_RESULT = 14,
+    PCAN_MSG_SCA_DCU_AUTH_RESULT_ADD = 15,
+    PCAN_MSG_DCU_TCU_USER_PROFILE_REQ = 16,
+    PCAN_MSG_TCU_DCU_USER_PROFILE_SEAT = 17,
+    PCAN_MSG_TCU_DCU_USER_PROFILE_MIRROR = 18,
+    PCAN_MSG_TCU_DCU_USER_PROFILE_WHEEL = 19,
+    PCAN_MSG_DCU_TCU_USER_PROFILE_ACK = 20,
+    PCAN_MSG_DCU_TCU_USER_PROFILE_SEAT_UPDATE = 21,
+    PCAN_MSG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE = 22,
+    PCAN_MSG_DCU_TCU_USER_PROFILE_WHEEL_UPDATE = 23,
+    PCAN_MSG_TCU_DCU_USER_PROFILE_UPDATE_ACK = 24,
+    PCAN_MSG_COUNT = 25
+};
+
+enum {
+    PCAN_SIG_DCU_RESET_SIG_FLAG = 0,
+    PCAN_SIG_DCU_RESET_ACK_SIG_INDEX = 1,
+    PCAN_SIG_DCU_RESET_ACK_SIG_STATUS = 2,
+    PCAN_SIG_SCA_DCU_DRIVER_EVENT_SIG_FLAG = 3,
+    PCAN_SIG_DCU_SCA_DRIVE_STATUS_SIG_FLAG = 4,
+    PCAN_SIG_DCU_SCA_USER_FACE_REQ_SIG_FLAG = 5,
+    PCAN_SIG_SCA_TCU_USER_INFO_REQ_SIG_FLAG = 6,
+    PCAN_SIG_SCA_DCU_AUTH_STATE_SIG_AUTH_STEP = 7,
+    PCAN_SIG_SCA_DCU_AUTH_STATE_SIG_AUTH_STATE = 8,
+    PCAN_SIG_TCU_SCA_USER_INFO_SIG_USER_INFO_INDEX = 9,
+    PCAN_SIG_TCU_SCA_USER_INFO_SIG_USER_INFO_VALUE = 10,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_INDEX = 11,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_0 = 12,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_1 = 13,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_2 = 14,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_3 = 15,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_4 = 16,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_5 = 17,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_6 = 18,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_7 = 19,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_8 = 20,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_9 = 21,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_10 = 22,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_11 = 23,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_12 = 24,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_13 = 25,
+    PCAN_SIG_TCU_SCA_USER_INFO_FD_SIG_USER_INFO_VALUE_14 = 26,
+    PCAN_SIG_TCU_SCA_USER_INFO_NFC_SIG_USER_NFC = 27,
+    PCAN_SIG_TCU_SCA_USER_INFO_BLE_SESS_SIG_DATA = 28,
+    PCAN_SIG_TCU_SCA_USER_INFO_BLE_CHALL_SIG_DATA = 29,
+    PCAN_SIG_TCU_SCA_USER_INFO_BLE_FLAG_SIG_DATA = 30,
+    PCAN_SIG_SCA_TCU_USER_INFO_ACK_SIG_ACK_INDEX = 31,
+    PCAN_SIG_SCA_TCU_USER_INFO_ACK_SIG_ACK_STATE = 32,
+    PCAN_SIG_SCA_DCU_AUTH_RESULT_SIG_FLAG = 33,
+    PCAN_SIG_SCA_DCU_AUTH_RESULT_SIG_USER_ID = 34,
+    PCAN_SIG_SCA_DCU_AUTH_RESULT_ADD_SIG_USER_ID = 35,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_REQ_SIG_FLAG = 36,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_SEAT_SIG_SEAT_POSITION = 37,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_SEAT_SIG_SEAT_ANGLE = 38,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_SEAT_SIG_SEAT_FRONT_HEIGHT = 39,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_SEAT_SIG_SEAT_REAR_HEIGHT = 40,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_LEFT_YAW = 41,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_LEFT_PITCH = 42,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_RIGHT_YAW = 43,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_RIGHT_PITCH = 44,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_ROOM_YAW = 45,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_MIRROR_SIG_MIRROR_ROOM_PITCH = 46,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_WHEEL_SIG_WHEEL_POSITION = 47,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_WHEEL_SIG_WHEEL_ANGLE = 48,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_ACK_SIG_ACK_INDEX = 49,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_ACK_SIG_ACK_STATE = 50,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_SEAT_UPDATE_SIG_SEAT_POSITION = 51,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_SEAT_UPDATE_SIG_SEAT_ANGLE = 52,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_SEAT_UPDATE_SIG_SEAT_FRONT_HEIGHT = 53,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_SEAT_UPDATE_SIG_SEAT_REAR_HEIGHT = 54,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_LEFT_YAW = 55,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_LEFT_PITCH = 56,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_RIGHT_YAW = 57,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_RIGHT_PITCH = 58,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_ROOM_YAW = 59,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_MIRROR_UPDATE_SIG_MIRROR_ROOM_PITCH = 60,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_SIG_WHEEL_POSITION = 61,
+    PCAN_SIG_DCU_TCU_USER_PROFILE_WHEEL_UPDATE_SIG_WHEEL_ANGLE = 62,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_UPDATE_ACK_SIG_ACK_INDEX = 63,
+    PCAN_SIG_TCU_DCU_USER_PROFILE_UPDATE_ACK_SIG_ACK_STATE = 64,
+    PCAN_SIG_COUNT = 65
+};
+
+static const CanDbSignal pcan_db_signals[PCAN_SIG_COUNT] = {
+    { "sig_flag", 0, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_index", 1, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_status", 1, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_flag", 2, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_flag", 3, 0, 8, 0, 1.0, 0.0, 0.0, 1.0 },
+    { "sig_flag", 4, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_flag", 5, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_auth_step", 6, 0, 8, 0, 1.0, 0.0, 0.0, 3.0 },
+    { "sig_auth_state", 6, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_index", 7, 0, 32, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value", 7, 32, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_index", 8, 0, 32, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_0", 8, 32, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_1", 8, 64, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_2", 8, 96, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_3", 8, 128, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_4", 8, 160, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_5", 8, 192, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_6", 8, 224, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_7", 8, 256, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_8", 8, 288, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_9", 8, 320, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_10", 8, 352, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_11", 8, 384, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_12", 8, 416, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_13", 8, 448, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_info_value_14", 8, 480, 32, CANDB_SIG_SIGNED | CANDB_SIG_FLOAT, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_nfc", 9, 0, 64, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_data", 10, 0, 64, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_data", 11, 0, 64, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_data", 12, 0, 64, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_ack_index", 13, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_ack_state", 13, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_flag", 14, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_id", 14, 8, 56, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_user_id", 15, 0, 64, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_flag", 16, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_seat_position", 17, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_angle", 17, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_seat_front_height", 17, 16, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_rear_height", 17, 24, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_mirror_left_yaw", 18, 0, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_left_pitch", 18, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_yaw", 18, 16, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_pitch", 18, 24, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_yaw", 18, 32, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_pitch", 18, 40, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_wheel_position", 19, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_wheel_angle", 19, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_ack_index", 20, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_ack_state", 20, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_seat_position", 21, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_angle", 21, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_seat_front_height", 21, 16, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_seat_rear_height", 21, 24, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_mirror_left_yaw", 22, 0, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_left_pitch", 22, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_yaw", 22, 16, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_right_pitch", 22, 24, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_yaw", 22, 32, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_mirror_room_pitch", 22, 40, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_wheel_position", 23, 0, 8, 0, 1.0, 0.0, 0.0, 100.0 },
+    { "sig_wheel_angle", 23, 8, 8, 0, 1.0, 0.0, 0.0, 180.0 },
+    { "sig_ack_index", 24, 0, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+    { "sig_ack_state", 24, 8, 8, 0, 1.0, 0.0, 0.0, 0.0 },
+};
+
+static const CanDbMessage pcan_db_messages[PCAN_MSG_COUNT] = {
+    { "DCU_RESET", 0x001u, 0, 1, 0, 1, pcan_dcu_reset_decode_any },
+    { "DCU_RESET_ACK", 0x002u, 0, 2, 1, 2, pcan_dcu_reset_ack_decode_any },
+    { "SCA_DCU_DRIVER_EVENT", 0x003u, 0, 1, 3, 1, pcan_sca_dcu_driver_event_decode_any },
+    { "DCU_SCA_DRIVE_STATUS", 0x005u, 0, 1, 4, 1, pcan_dcu_sca_drive_status_decode_any },
+    { "DCU_SCA_USER_FACE_REQ", 0x101u, 0, 1, 5, 1, pcan_dcu_sca_user_face_req_decode_any },
+    { "SCA_TCU_USER_INFO_REQ", 0x102u, 0, 1, 6, 1, pcan_sca_tcu_user_info_req_decode_any },
+    { "SCA_DCU_AUTH_STATE", 0x103u, 0, 2, 7, 2, pcan_sca_dcu_auth_state_decode_any },
+    { "TCU_SCA_USER_INFO", 0x104u, 0, 8, 9, 2, pcan_tcu_sca_user_info_decode_any },
+    { "TCU_SCA_USER_INFO_FD", 0x105u, CAN_FRAME_FD, 64, 11, 16, pcan_tcu_sca_user_info_fd_decode_any },
+    { "TCU_SCA_USER_INFO_NFC", 0x107u, 0, 8, 27, 1, pcan_tcu_sca_user_info_nfc_decode_any },
+    { "TCU_SCA_USER_INFO_BLE_SESS", 0x108u, 0, 8, 28, 1, pcan_tcu_sca_user_info_ble_sess_decode_any },
+    { "TCU_SCA_USER_INFO_BLE_CHALL", 0x109u, 0, 8, 29, 1, pcan_tcu_sca_user_info_ble_chall_decode_any },
+    { "TCU_SCA_USER_INFO_BLE_FLAG", 0x110u, 0, 8, 30, 1, pcan_tcu_sca_user_info_ble_flag_decode_any },
+    { "SCA_TCU_USER_INFO_ACK", 0x111u, 0, 2, 31, 2, pcan_sca_tcu_user_info_ack_decode_any },
+    { "SCA_DCU_AUTH_RESULT", 0x112u, 0, 8, 33, 2, pcan_sca_dcu_auth_result_decode_any },
+    { "SCA_DCU_AUTH_RESULT_ADD", 0x113u, 0, 8, 35, 1, pcan_sca_dcu_auth_result_add_decode_any },
+    { "DCU_TCU_USER_PROFILE_REQ", 0x201u, 0, 1, 36, 1, pcan_dcu_tcu_user_profile_req_decode_any },
+    { "TCU_DCU_USER_PROFILE_SEAT", 0x202u, 0, 4, 37, 4, pcan_tcu_dcu_user_profile_seat_decode_any },
+    { "TCU_DCU_USER_PROFILE_MIRROR", 0x203u, 0, 6, 41, 6, pcan_tcu_dcu_user_profile_mirror_decode_any },
+    { "TCU_DCU_USER_PROFILE_WHEEL", 0x204u, 0, 2, 47, 2, pcan_tcu_dcu_user_profile_wheel_decode_any },
+    { "DCU_TCU_USER_PROFILE_ACK", 0x205u, 0, 2, 49, 2, pcan_dcu_tcu_user_profile_ack_decode_any },
+    { "DCU_TCU_USER_PROFILE_SEAT_UPDATE", 0x206u, 0, 4, 51, 4, pcan_dcu_tcu_user_profile_seat_update_decode_any },
+    { "DCU_TCU_USER_PROFILE_MIRROR_UPDATE", 0x207u, 0, 6, 55, 6, pcan_dcu_tcu_user_profile_mirror_update_decode_any },
+    { "DCU_TCU_USER_PROFILE_WHEEL_UPDATE", 0x208u, 0, 2, 61, 2, pcan_dcu_tcu_user_profile_wheel_update_decode_any },
+    { "TCU_DCU_USER_PROFILE_UPDATE_ACK", 0x209u, 0, 2, 63, 2, pcan_tcu_dcu_user_profile_update_ack_decode_any },
+};
+
+static const CanDb pcan_db = { pcan_db_messages, pcan_db_signals, PCAN_MSG_COUNT, PCAN_SIG_COUNT };
+
+// 표준 ID → (메시지 인덱스 + 1), 0은 미등록
+static const uint8_t pcan_db_slot[0x20A] = {
+     0, 1, 2, 3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x000
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x010
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x020
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x030
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x040
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x050
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x060
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x070
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x080
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x090
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0A0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0B0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0C0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0D0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0E0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x0F0
+     0, 5, 6, 7, 8, 9, 0,10,11,12, 0, 0, 0, 0, 0, 0,  // 0x100
+    13,14,15,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x110
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x120
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x130
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x140
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x150
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x160
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x170
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x180
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x190
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1A0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1B0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1C0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1D0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1E0
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x1F0
+     0,17,18,19,20,21,22,23,24,25,  // 0x200
+};
+
+static inline const CanDbMessage* pcan_db_find(uint32_t id, uint32_t flags){
+    if (flags & CAN_FRAME_EXTID) return NULL;
+    if (id >= sizeof(pcan_db_slot) / sizeof(pcan_db_slot[0]) || !pcan_db_slot[id]) return NULL;
+    return &pcan_db_messages[pcan_db_slot[id] - 1];
+}
+
+// ID로 디코더를 찾아 out의 해당 멤버에 unpack. msg에는 찾은 메시지 디스크립터 (NULL 가능)
+static inline can_err_t pcan_db_decode(const CanFrame* fr, pcan_db_t* out, const CanDbMessage** msg){
+    const CanDbMessage* m = pcan_db_find(fr->id, fr->flags);
+    if (msg) *msg = m;
+    if (!m) return CAN_ERR_INVALID;
+    return m->decode(fr, out);
+}
+
+static inline const CanDbSignal* pcan_db_signal(const char* msg, const char* sig){
+    for (size_t i = 0; i < PCAN_SIG_COUNT; ++i) {
+        const CanDbSignal* s = &pcan_db_signals[i];
+        if (!strcmp(s->name, sig) && !strcmp(pcan_db_messages[s->msg].name, msg)) return s;
+    }
+    return NULL;
+}
@@ -0,0 +1,371 @@
+#include "periodwatch.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define PWATCH_TOLERANCE_DEFAULT    0.5f    // tolerance <= 0: 1.5주기 동안 안 오면 타임아웃
+// 만기 계산은 CLOCK_MONOTONIC, 대기는 (공용 코드라) CLOCK_REALTIME timedwait이므로
+// 벽시계가 뒤로 가도 이 이상 늦지 않게 잘라서 잔다
+#define PWATCH_MAX_SLEEP_NS         100000000ULL
+
+enum { PW_WAITING = 0, PW_OK, PW_TIMEOUT };
+
+typedef struct PWatch {
+    int                     id;         // watchId
+    int                     sub;        // 구독 ID
+    uint32_t                can_id;
+    uint32_t                expected_ms;
+    uint64_t                limit_ns;   // 마지막 도착 후 이 시간이 지나면 타임아웃
+    can_period_callback_t   cb;
+    void*                   user;
+    struct PeriodWatcher*   pw;
+
+    // RX 스레드만 쓴다
+    atomic_uint_fast64_t    last_ns;    // 마지막 도착 (처음엔 감시 시작 시각)
+    atomic_uint_fast64_t    count;
+    atomic_uint_fast64_t    sum_ns;     // 도착 간격 합 (count - 1개)
+    atomic_uint_fast64_t    min_ns;
+    atomic_uint_fast64_t    max_ns;
+    atomic_int              recover;    // 타임아웃 중에 도착함 → 감시 스레드가 복구 처리
+
+    // 감시 스레드 (pw->mtx)
+    atomic_int              state;      // PW_*
+    uint64_t                timeouts;
+    uint64_t                deadline;
+    size_t                  hidx;       // heap 위치 (SIZE_MAX: heap 밖)
+    int                     removed;
+
+    atomic_int              refs;       // 목록 몫 + 구독 몫 + 콜백 중인 감시 스레드
+    struct PWatch*          next;
+} PWatch;
+
+struct PeriodWatcher {
+    Channel*        ch;
+    pthread_mutex_t mtx;
+    pthread_cond_t  cv;
+    pthread_t       thread;
+    int             closing;
+    int             orphan;     // 콜백 안에서 destroy됨: 감시 스레드가 나가면서 스스로 해제
+    int             next_id;
+    PWatch*         list;
+    PWatch**        heap;       // deadline 기준 min-heap
+    size_t          n, cap;
+    atomic_int      kick;       // 복구 대기 감시가 있다
+};
+
+static uint64_t pw_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void pw_put(PWatch* w){
+    if (atomic_fetch_sub(&w->refs, 1) == 1) free(w);
+}
+
+static void pw_release(void* user){
+    pw_put((PWatch*)user);
+}
+
+/* ========= heap (pw->mtx) ========= */
+static void heap_set(PeriodWatcher* pw, size_t i, PWatch* w){
+    pw->heap[i] = w;
+    w->hidx = i;
+}
+
+static void heap_up(PeriodWatcher* pw, size_t i){
+    PWatch* w = pw->heap[i];
+    while (i > 0){
+        size_t p = (i - 1) / 2;
+        if (pw->heap[p]->deadline <= w->deadline) break;
+        heap_set(pw, i, pw->heap[p]);
+        i = p;
+    }
+    heap_set(pw, i, w);
+}
+
+static void heap_down(PeriodWatcher* pw, size_t i){
+    PWatch* w = pw->heap[i];
+    for (;;){
+        size_t c = 2*i + 1;
+        if (c >= pw->n) break;
+        if (c + 1 < pw->n && pw->heap[c+1]->deadline < pw->heap[c]->deadline) c++;
+        if (w->deadline <= pw->heap[c]->deadline) break;
+        heap_set(pw, i, pw->heap[c]);
+        i = c;
+    }
+    heap_set(pw, i, w);
+}
+
+static int heap_push(PeriodWatcher* pw, PWatch* w){
+    if (pw->n == pw->cap){
+        size_t nc = pw->cap ? pw->cap * 2 : 16;
+        PWatch** nh = (PWatch**)realloc(pw->heap, nc * sizeof(PWatch*));
+        if (!nh) return 0;
+        pw->heap = nh;
+        pw->cap  = nc;
+    }
+    heap_set(pw, pw->n++, w);
+    heap_up(pw, w->hidx);
+    return 1;
+}
+
+static void heap_remove(PeriodWatcher* pw, PWatch* w){
+    size_t i = w->hidx;
+    if (i == SIZE_MAX) return;
+    w->hidx = SIZE_MAX;
+    PWatch* last = pw->heap[--pw->n];
+    if (i == pw->n) return;
+    heap_set(pw, i, last);
+    heap_up(pw, i);
+    heap_down(pw, last->hidx);
+}
+
+/* ========= RX 스레드 ========= */
+static void pw_on_rx(const CanFrame* f, void* user){
+    PWatch* w = (PWatch*)user;
+    uint64_t now = f->timestamp_ns ? f->timestamp_ns : pw_now_ns();
+    uint64_t n   = atomic_load_explicit(&w->count, memory_order_relaxed);
+    if (n){
+        uint64_t prev = atomic_load_explicit(&w->last_ns, memory_order_relaxed);
+        uint64_t dt = now > prev ? now - prev : 0;
+        atomic_store_explicit(&w->sum_ns, atomic_load_explicit(&w->sum_ns, memory_order_relaxed) + dt, memory_order_relaxed);
+        if (n == 1 || dt < atomic_load_explicit(&w->min_ns, memory_order_relaxed))
+            atomic_store_explicit(&w->min_ns, dt, memory_order_relaxed);
+        if (dt > atomic_load_explicit(&w->max_ns, memory_order_relaxed))
+            atomic_store_explicit(&w->max_ns, dt, memory_order_relaxed);
+    }
+    atomic_store_explicit(&w->count, n + 1, memory_order_relaxed);
+    atomic_store(&w->last_ns, now);
+
+    // 감시 스레드는 state를 TIMEOUT으로 바꾼 뒤 last_ns를 다시 본다 (둘 다 seq_cst):
+    // 여기서 TIMEOUT을 못 보면 감시 스레드가 이 도착을 보고 타임아웃을 취소한다
+    if (atomic_load(&w->state) == PW_TIMEOUT && !atomic_exchange(&w->recover, 1)){
+        PeriodWatcher* pw = w->pw;
+        atomic_store(&pw->kick, 1);
+        pthread_mutex_lock(&pw->mtx);
+        pthread_cond_signal(&pw->cv);
+        pthread_mutex_unlock(&pw->mtx);
+    }
+}
+
+/* ========= 감시 스레드 ========= */
+// 콜백은 락 밖에서. 감시가 그 사이 제거돼도 참조를 잡고 있으므로 안전
+static void pw_fire(PeriodWatcher* pw, PWatch* w, can_period_event_t ev){
+    atomic_fetch_add(&w->refs, 1);
+    pthread_mutex_unlock(&pw->mtx);
+    w->cb(w->can_id, ev, w->user);
+    pthread_mutex_lock(&pw->mtx);
+    pw_put(w);
+}
+
+static void pw_free(PeriodWatcher* pw){
+    free(pw->heap);
+    pthread_cond_destroy(&pw->cv);
+    pthread_mutex_destroy(&pw->mtx);
+    free(pw);
+}
+
+static void* pw_thread(void* arg){
+    PeriodWatcher* pw = (PeriodWatcher*)arg;
+    pthread_mutex_lock(&pw->mtx);
+    while (!pw->closing){
+        // 1) 타임아웃 중에 다시 들어온 감시 → 복구
+        if (atomic_exchange(&pw->kick, 0)){
+            for (PWatch* w = pw->list; w && !pw->closing; ){
+                if (!atomic_exchange(&w->recover, 0)){ w = w->next; continue; }
+                atomic_store(&w->state, PW_OK);
+                w->deadline = atomic_load(&w->last_ns) + w->limit_ns;
+                if (w->hidx == SIZE_MAX) heap_push(pw, w);
+                pw_fire(pw, w, CAN_PERIOD_RECOVERED);
+                w = pw->list;       // 콜백 중에 목록이 바뀌었을 수 있으므로 처음부터 (recover는 이미 0)
+            }
+            continue;
+        }
+
+        // 2) 만기 처리: 그 사이 프레임이 왔으면 새 만기로 다시 넣고, 아니면 타임아웃
+        uint64_t now = pw_now_ns();
+        if (pw->n && pw->heap[0]->deadline <= now){
+            PWatch* w = pw->heap[0];
+            uint64_t last = atomic_load(&w->last_ns);
+            uint64_t dl   = last + w->limit_ns;
+            if (dl > now){
+                w->deadline = dl;
+                heap_down(pw, 0);
+                continue;
+            }
+            atomic_store(&w->state, PW_TIMEOUT);
+            if (atomic_load(&w->last_ns) != last){
+                // 바로 그 사이에 도착 (RX 스레드는 아직 OK를 봤을 수 있다)
+                atomic_store(&w->state, PW_OK);
+                atomic_store(&w->recover, 0);
+                continue;
+            }
+            heap_remove(pw, w);     // 다시 도착할 때까지 heap 밖 (타임아웃은 한 번만)
+            w->timeouts++;
+            pw_fire(pw, w, CAN_PERIOD_TIMEOUT);
+            continue;
+        }
+
+        // 3) 다음 만기까지 잔다
+        uint64_t wait_ns = PWATCH_MAX_SLEEP_NS;
+        if (pw->n && pw->heap[0]->deadline - now < wait_ns) wait_ns = pw->heap[0]->deadline - now;
+        if (atomic_load(&pw->kick)) continue;
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        uint64_t ns = (uint64_t)ts.tv_nsec + wait_ns;
+        ts.tv_sec  += (time_t)(ns / 1000000000ULL);
+        ts.tv_nsec  = (long)(ns % 1000000000ULL);
+        pthread_cond_timedwait(&pw->cv, &pw->mtx, &ts);
+    }
+    int orphan = pw->orphan;
+    pthread_mutex_unlock(&pw->mtx);
+    if (orphan) pw_free(pw);
+    return NULL;
+}
+
+/* ========= 공개 (channel.c) ========= */
+PeriodWatcher* pwatch_create(Channel* ch){
+    PeriodWatcher* pw = (PeriodWatcher*)calloc(1, sizeof(PeriodWatcher));
+    if (!pw) return NULL;
+    pw->ch = ch;
+    atomic_init(&pw->kick, 0);
+    pthread_mutex_init(&pw->mtx, NULL);
+    pthread_cond_init(&pw->cv, NULL);
+    if (pthread_create(&pw->thread, NULL, pw_thread, pw) != 0){
+        pthread_cond_destroy(&pw->cv);
+        pthread_mutex_destroy(&pw->mtx);
+        free(pw);
+        return NULL;
+    }
+    return pw;
+}
+
+can_err_t pwatch_add(PeriodWatcher* pw, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance,
+                     can_period_callback_t cb, void* user){
+    if (!pw || !watchId || !cb || expected_ms == 0 || id > 0x1FFFFFFFu) return CAN_ERR_INVALID;
+    if (tolerance <= 0.0f) tolerance = PWATCH_TOLERANCE_DEFAULT;
+
+    PWatch* w = (PWatch*)calloc(1, sizeof(PWatch));
+    if (!w) return CAN_ERR_MEMORY;
+    w->can_id      = id;
+    w->expected_ms = expected_ms;
+    w->limit_ns    = (uint64_t)((double)expected_ms * 1000000.0 * (1.0 + (double)tolerance));
+    w->cb          = cb;
+    w->user        = user;
+    w->pw          = pw;
+    w->hidx        = SIZE_MAX;
+    atomic_init(&w->last_ns, pw_now_ns());
+    atomic_init(&w->count, 0);
+    atomic_init(&w->sum_ns, 0);
+    atomic_init(&w->min_ns, 0);
+    atomic_init(&w->max_ns, 0);
+    atomic_init(&w->recover, 0);
+    atomic_init(&w->state, PW_WAITING);
+    atomic_init(&w->refs, 2);
+
+    // heap에 먼저 넣어 둔다 (구독 전이라도 첫 만기는 감시 시작 + limit)
+    pthread_mutex_lock(&pw->mtx);
+    w->deadline = atomic_load(&w->last_ns) + w->limit_ns;
+    if (!heap_push(pw, w)){
+        pthread_mutex_unlock(&pw->mtx);
+        free(w);
+        return CAN_ERR_MEMORY;
+    }
+    w->id   = ++pw->next_id;
+    w->next = pw->list;
+    pw->list = w;
+    pthread_cond_signal(&pw->cv);
+    pthread_mutex_unlock(&pw->mtx);
+
+    CanFilter flt;
+    memset(&flt, 0, sizeof(flt));
+    flt.type = CAN_FILTER_MASK;
+    flt.data.mask.id   = id;
+    flt.data.mask.mask = 0x1FFFFFFFu;
+    can_err_t e = channel_subscribe_owned(pw->ch, &w->sub, &flt, pw_on_rx, w, pw_release);
+    if (e != CAN_OK){
+        pw_put(w);                      // 구독 몫 (release는 불리지 않는다)
+        pwatch_remove(pw, w->id);
+        return e;
+    }
+    *watchId = w->id;
+    return CAN_OK;
+}
+
+static PWatch* pw_unlink(PeriodWatcher* pw, int watchId){
+    PWatch** pp = &pw->list;
+    while (*pp && (*pp)->id != watchId) pp = &(*pp)->next;
+    PWatch* w = *pp;
+    if (!w) return NULL;
+    *pp = w->next;
+    heap_remove(pw, w);
+    w->removed = 1;
+    return w;
+}
+
+can_err_t pwatch_remove(PeriodWatcher* pw, int watchId){
+    if (!pw) return CAN_ERR_INVALID;
+    pthread_mutex_lock(&pw->mtx);
+    PWatch* w = pw_unlink(pw, watchId);
+    pthread_mutex_unlock(&pw->mtx);
+    if (!w) return CAN_ERR_INVALID;
+    if (w->sub) channel_unsubscribe(pw->ch, w->sub);   // 구독 몫은 release가 놓는다
+    pw_put(w);
+    return CAN_OK;
+}
+
+can_err_t pwatch_get_stats(PeriodWatcher* pw, int watchId, CanPeriodStats* out){
+    if (!pw || !out) return CAN_ERR_INVALID;
+    pthread_mutex_lock(&pw->mtx);
+    PWatch* w = pw->list;
+    while (w && w->id != watchId) w = w->next;
+    if (!w){
+        pthread_mutex_unlock(&pw->mtx);
+        return CAN_ERR_INVALID;
+    }
+    memset(out, 0, sizeof(*out));
+    uint64_t n    = atomic_load_explicit(&w->count, memory_order_relaxed);
+    uint64_t last = atomic_load(&w->last_ns);
+    uint64_t now  = pw_now_ns();
+    out->id          = w->can_id;
+    out->expected_ms = w->expected_ms;
+    out->count       = n;
+    out->timeouts    = w->timeouts;
+    out->timed_out   = atomic_load(&w->state) == PW_TIMEOUT;
+    if (n > 1){
+        out->min_us = (uint32_t)(atomic_load_explicit(&w->min_ns, memory_order_relaxed) / 1000);
+        out->max_us = (uint32_t)(atomic_load_explicit(&w->max_ns, memory_order_relaxed) / 1000);
+        out->avg_us = (uint32_t)(atomic_load_explicit(&w->sum_ns, memory_order_relaxed) / (n - 1) / 1000);
+    }
+    out->age_ms = now > last ? (uint32_t)((now - last) / 1000000ULL) : 0;
+    pthread_mutex_unlock(&pw->mtx);
+    return CAN_OK;
+}
+
+void pwatch_destroy(PeriodWatcher* pw){
+    if (!pw) return;
+    // 콜백 안에서 채널을 닫은 경우 자기 자신은 join할 수 없다 → 콜백이 돌아간 뒤 스레드가 해제
+    int self = pthread_equal(pthread_self(), pw->thread);
+    pthread_mutex_lock(&pw->mtx);
+    pw->closing = 1;
+    pthread_cond_broadcast(&pw->cv);
+    pthread_mutex_unlock(&pw->mtx);
+    if (!self) pthread_join(pw->thread, NULL);
+
+    pthread_mutex_lock(&pw->mtx);
+    while (pw->list){
+        PWatch* w = pw_unlink(pw, pw->list->id);
+        pthread_mutex_unlock(&pw->mtx);
+        channel_unsubscribe(pw->ch, w->sub);
+        pw_put(w);
+        pthread_mutex_lock(&pw->mtx);
+    }
+    pw->orphan = self;
+    pthread_mutex_unlock(&pw->mtx);
+    if (self) pthread_detach(pw->thread);
+    else pw_free(pw);
+}
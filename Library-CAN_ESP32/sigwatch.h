@@ -0,0 +1,21 @@
+#pragma once
+#include "can_api.h"
+#include "candb.h"
+#include "channel.h"
+
+/*
+ * 신호 단위 변화 구독 (can_subscribe_signal).
+ * 채널마다 표 하나, 메시지(ID)마다 채널 구독 하나로 묶는다.
+ *  - 프레임이 오면 그 메시지에서 구독된 신호를 디스크립터마다 한 번만 디코드한다 (같은 신호를 여럿이 구독해도 한 번)
+ *  - 마지막 디코드 값, deadband, 마지막으로 알린 값은 메시지별 struct-of-arrays로 둔다
+ *    → RX 스레드는 연속된 double 배열만 훑는다
+ *  - 콜백은 RX 스레드에서 표 락을 놓은 뒤에 부른다 (콜백 안에서 구독/해제해도 된다)
+ */
+typedef struct SignalTable SignalTable;
+
+SignalTable*    sigtab_create   (Channel* ch);
+can_err_t       sigtab_add      (SignalTable* t, int* subId, const CanDb* db, uint16_t sig, double deadband,
+                                 can_signal_callback_t cb, void* user);
+can_err_t       sigtab_remove   (SignalTable* t, int subId);
+can_err_t       sigtab_get      (SignalTable* t, int subId, double* value, uint64_t* age_ns);
+void            sigtab_destroy  (SignalTable* t);      // channel_stop: 구독 해제. 메모리는 RX 스레드가 놓은 뒤 해제
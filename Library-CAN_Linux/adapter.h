@@ -8,6 +8,17 @@ typedef void (*adapter_rx_cb_t)(const CanFrame* frame, void* user);
 typedef void (*adapter_err_cb_t)(can_err_t err, void* user);
 // (선택) 버스 상태 변화 알림
 typedef void (*adapter_bus_cb_t)(can_bus_state_t state, void* user);
+// (선택) 송신 프레임을 실제로 소켓/컨트롤러에 넘긴 시점 알림 (t_ns: CLOCK_MONOTONIC)
+typedef void (*adapter_tx_cb_t)(const CanFrame* frame, uint64_t t_ns, void* user);
+
+// 어댑터가 직접 처리하는 채널 간 전달 규칙 하나 (route.c가 경로 필터를 (id, mask)마다 하나씩 넘긴다)
+typedef struct {
+    uint32_t            id;
+    uint32_t            mask;
+    uint32_t            flags;      // CAN_ROUTE_FD
+    const CanRouteMod*  mods;       // 연산(op)마다 최대 하나
+    size_t              nMods;
+} CanRouteRule;
 
 typedef struct AdapterVTable {
     can_err_t (*probe)(Adapter* self);
@@ -23,6 +34,8 @@ typedef struct AdapterVTable {
     );
 
     can_err_t (*write)(Adapter* self, AdapterHandle handle, const CanFrame* fr, uint32_t timeout_ms);
+    // (선택) 직접 읽기. ch_set_callbacks로 수신을 올려주는 어댑터는 채널이 수신 링에서 꺼내므로 필요 없다
+    // (수신 스레드와 같은 소켓/큐를 읽으면 프레임을 서로 가져가 버림)
     can_err_t (*read )(Adapter* self, AdapterHandle handle,       CanFrame* out, uint32_t timeout_ms);
 
     can_bus_state_t (*status)(Adapter* self, AdapterHandle handle);
@@ -32,13 +45,90 @@ typedef struct AdapterVTable {
     can_err_t   (*ch_cancel_job)            (Adapter* self, AdapterHandle h, int jobId);
     can_err_t   (*ch_register_job_dynamic)  (Adapter* self, int* id, AdapterHandle h, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms);
 
+    // (선택) 하드웨어/커널 수신 필터. 채널이 구독 필터 합집합을 CAN_FILTER_MASK 목록으로 컴파일해서 전달.
+    // filters == NULL 이면 전체 허용. 정확한 매칭은 채널이 다시 하므로 상위집합이어도 된다.
+    can_err_t   (*ch_set_filters)           (Adapter* self, AdapterHandle h, const CanFilter* filters, size_t count);
+
+    // (선택) 주기 송신 Job 통계
+    can_err_t   (*ch_get_job_stats)         (Adapter* self, AdapterHandle h, int jobId, CanJobStats* out);
+
+    // (선택) 내용 변화 감시. 콜백은 어댑터 수신 스레드에서 불린다.
+    //  - watch_del이 돌아온 뒤에는 그 감시의 콜백이 더 이상 불리지 않아야 한다
+    can_err_t   (*ch_watch_add)             (Adapter* self, AdapterHandle h, const CanChangeFilter* flt,
+                                             can_callback_t cb, can_timeout_callback_t on_timeout, void* user, int* watchId);
+    can_err_t   (*ch_watch_del)             (Adapter* self, AdapterHandle h, int watchId);
+
+    // (선택) 등록된 Job의 프레임을 취소/재등록 없이 교체 (주기와 위상은 유지)
+    can_err_t   (*ch_update_job)            (Adapter* self, AdapterHandle h, int jobId, const CanFrame* fr);
+
+    // (선택) 여러 프레임을 한 번에 송신. 없으면 채널이 write를 반복한다.
+    // 보낸 개수를 *sent에. 일부만 보냈으면 그 시점의 에러를 반환
+    can_err_t   (*write_batch)              (Adapter* self, AdapterHandle h, const CanFrame* frs, size_t n, size_t* sent, uint32_t timeout_ms);
+
+    // (선택) 송신/에러/버스 상태 카운터. 채널이 수신 카운터와 구간 평균을 채운 CanStats에
+    // tx_*, err_*, bus_errors, arb_lost, rx_overflows, bus_off_count, 에러 카운터, state를 채우고
+    // 송신분 버스 점유 시간을 bus_time_ns에 더한다.
+    can_err_t   (*ch_get_bus_stats)         (Adapter* self, AdapterHandle h, CanStats* io);
+
+    // (선택) 어댑터가 직접 처리하는 ISO-TP 연결 (예: 커널 CAN_ISOTP 소켓).
+    // open이 CAN_ERR_NODEV를 돌려주거나 훅이 없으면 채널이 사용자 공간 구현(isotp.c)을 쓴다.
+    //  - send/recv는 호출자 스레드에서 블로킹. recv에서 cap보다 긴 메시지는 잘라 담고 CAN_ERR_INVALID
+//    (*len은 전체 길이, 알 수 없으면 담은 길이)
+    can_err_t   (*ch_isotp_open)            (Adapter* self, AdapterHandle h, const CanIsoTpConfig* cfg, void** link);
+    can_err_t   (*ch_isotp_send)            (Adapter* self, void* link, const void* data, size_t len, uint32_t timeout_ms);
+    can_err_t   (*ch_isotp_recv)            (Adapter* self, void* link, void* buf, size_t cap, size_t* len, uint32_t timeout_ms);
+    void        (*ch_isotp_close)           (Adapter* self, void* link);
+
+    // (선택) 어댑터가 직접 처리하는 채널 간 전달 (예: 커널 CAN_GW 규칙).
+    // add가 CAN_ERR_NODEV/CAN_ERR_PERMISSION을 돌려주거나 훅이 없으면 채널 구독으로 전달한다 (route.c).
+    //  - 전달한 프레임은 dst에서 보낸 프레임처럼 같은 호스트의 다른 소켓에도 보여야 한다
+    //  - stats는 io의 forwarded/dropped/deleted에 더한다
+    can_err_t   (*ch_route_add)             (Adapter* self, AdapterHandle src, AdapterHandle dst, const CanRouteRule* rule, void** route);
+    can_err_t   (*ch_route_stats)           (Adapter* self, void* route, CanRouteStats* io);
+    void        (*ch_route_del)             (Adapter* self, void* route);
+
+    // (선택) can_init 뒤의 can_set_thread_policy를 이미 돌고 있는 어댑터 스레드에 건다 (스택 크기 제외).
+    // 만들 때의 정책은 can_thread_policy_get으로 읽는다. 훅이 없으면 뒤에 만드는 스레드부터 적용.
+    //  - 권한이 없어 일부만 걸었으면 CAN_ERR_PERMISSION
+    can_err_t   (*set_thread_policy)        (Adapter* self, const CanThreadPolicy* policy);
+
+    // (선택) 송신 확인 알림 (트레이스 기록용). ch_open 직후, 송신/Job 등록 전에 한 번 건다.
+    //  - write/write_batch, TX 큐, 주기 Job 등 어느 경로든 프레임이 실제로 나간 시점에 어느 스레드에서나 불린다
+    //  - 큐에서 버려지거나 실패한 프레임은 알리지 않는다. 커널이 알아서 보내는 경로(BCM Job 등)는 이 채널에서 쓰지 않는다
+    can_err_t   (*ch_set_tx_callback)       (Adapter* self, AdapterHandle h, adapter_tx_cb_t on_tx, void* user);
+
     // 어댑터 자체 파기
     void (*destroy)(Adapter* self);
 } AdapterVTable;
 
+// 프레임 하나가 버스를 점유하는 시간 추정 (ns, 스터핑 비트 제외, IFS 3비트 포함).
+// FD+BRS는 데이터 구간(ESI~CRC 구분자)만 dataBitrate로 계산한다.
+static inline uint64_t can_frame_bus_time_ns(const CanFrame* f, int bitrate, int dataBitrate) {
+    if (bitrate <= 0) return 0;
+    uint32_t ext = (f->flags & CAN_FRAME_EXTID) ? 1u : 0u;
+    uint32_t len = (f->flags & CAN_FRAME_RTR) ? 0u : f->dlc;
+    uint32_t nom, dat = 0;
+    if (!(f->flags & CAN_FRAME_FD)) {
+        nom = (ext ? 67u : 47u) + 8u * len;
+    } else {
+        nom = (ext ? 36u : 17u) + 12u;                      // 중재 구간 + ACK/EOF/IFS
+        dat = 5u + 8u * len + (len <= 16 ? 21u : 25u);     // ESI,DLC + 데이터 + 스터프 카운트/CRC
+        if (!(f->flags & CAN_FRAME_BRS) || dataBitrate <= 0) { nom += dat; dat = 0; }
+    }
+    uint64_t ns = (uint64_t)nom * 1000000000ull / (uint32_t)bitrate;
+    if (dat) ns += (uint64_t)dat * 1000000000ull / (uint32_t)dataBitrate;
+    return ns;
+}
+
 struct Adapter {
     const AdapterVTable* v;
     void* priv;
  };
 
-Adapter* create_adapter(can_device_t device);
\ No newline at end of file
+Adapter* create_adapter(can_device_t device);
+
+// can_trace_config로 지정한 기록/재생 설정 (지정한 적 없으면 전부 0)
+const CanTraceConfig* can_trace_get_config(void);
+
+// can_set_thread_policy로 지정한 어댑터 스레드 정책 (지정한 적 없으면 전부 0)
+const CanThreadPolicy* can_thread_policy_get(void);
\ No newline at end of file
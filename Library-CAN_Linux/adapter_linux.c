@@ -1,4 +1,7 @@
 // adapter_linux.c — Raspberry Pi / Jetson Nano (Linux, SocketCAN)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE           // recvmmsg / sendmmsg
+#endif
 #include "adapter.h"
 #include <stdlib.h>
 #include <string.h>
@@ -6,41 +9,133 @@
 #include <stdio.h>
 
 #include <unistd.h>
+#include <limits.h>                 // PTHREAD_STACK_MIN
 #include <pthread.h>
+#include <stdatomic.h>
 #include <time.h>
 #include <fcntl.h>
 #include <poll.h>
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/can/bcm.h>          // 정적 Job을 커널 타이머로 (TX_SETUP)
+#include <linux/can/error.h>        // 에러 프레임 (CAN_ERR_*)
+#if defined(__has_include)
+  #if __has_include(<linux/can/isotp.h>)
+    #include <linux/can/isotp.h>    // 커널 ISO-TP (5.10+, 없으면 채널의 사용자 공간 구현)
+    #define LINUX_HAVE_ISOTP 1
+  #endif
+#endif
+#include <linux/net_tstamp.h>       // SO_TIMESTAMPING 플래그
+#include <linux/errqueue.h>         // struct scm_timestamping
+
+#include "canlink.h"                // rtnetlink 인터페이스 설정 (bring-up, bus-off restart)
+#include "canrt.h"                  // reactor 스레드 SCHED_FIFO/CPU 고정/mlockall (can_set_thread_policy)
 
-#ifdef USE_LIBSOCKETCAN
-  #include <libsocketcan.h>
-  #include <linux/can/netlink.h>   // CAN_CTRLMODE_* 플래그
+#ifndef CAN_RAW_FILTER_MAX
+#define CAN_RAW_FILTER_MAX   512    // 커널 net/can/raw.c 상한
 #endif
 
-/* ========= Linux 전용 채널 핸들 ========= */
+#define LINUX_DEFAULT_BATCH  32
+#define LINUX_MAX_BATCH      256
+#define LINUX_RX_ROUNDS      4      // 한 번 깨어났을 때 채널당 recvmmsg 최대 호출 수 (공정성)
+#define LINUX_TXQ_DEFAULT    64     // 소프트웨어 TX 큐 기본 크기 (CanConfig.txQueueDepth == 0)
+#define LINUX_TXQ_DEADLINE_MS 100   // timeout 0으로 큐에 들어간 프레임의 유효 시간
+#define LINUX_TXQ_RETRY_NS   200000ULL  // ENOBUFS 뒤 재시도 간격
+
+// 수신 타임스탬프 cmsg 한 개가 들어갈 크기 (SO_TIMESTAMPING이 가장 큼)
+#define LINUX_RX_CMSG_SPACE  CMSG_SPACE(sizeof(struct scm_timestamping))
+
+typedef enum {
+    LINUX_TS_NONE = 0,        // 커널 타임스탬프 없음: 꺼낸 시각으로 대신
+    LINUX_TS_TIMESTAMPING,    // SO_TIMESTAMPING (소프트웨어 RX)
+    LINUX_TS_TIMESTAMPNS      // SO_TIMESTAMPNS
+} linux_ts_mode_t;
+
+/* ========= Linux 전용 채널 핸들 =========
+ * 채널마다 RX/TX 스레드를 두지 않고, 어댑터 하나당 reactor 스레드 1개가
+ * epoll로 모든 채널 소켓을 감시한다.
+ *  - 채널 소켓(EPOLLIN)  : 수신 프레임 → on_rx
+ *  - timerfd             : 가장 이른 Job 만기 시각으로 arm → 주기 송신
+ *  - eventfd             : Job 등록/채널 close/어댑터 파기 시 reactor 깨우기
+ */
+struct LinuxPriv;
+
+typedef struct LinuxCh LinuxCh;
+
+/* 주기 송신 Job. 어댑터 전체 Job이 next_due_ns 기준 min-heap 하나에 들어간다. */
 typedef struct Job {
     int id;
+    LinuxCh* ch;                 // 소속 채널
     CanFrame fr;                 // 내부 복사본
-    uint32_t period_ms;
-    uint64_t next_due_ms;        // 만기 시간
+    uint64_t period_ns;
+    uint64_t next_due_ns;        // 만기 시각 (CLOCK_MONOTONIC, ns)
     can_tx_prepare_cb_t prep;    // 옵션 콜백
     void* prep_user;
-    struct Job* next;
+    size_t heap_idx;             // ad->heap 안 위치 (bcm Job은 heap에 없음)
+
+    // 정적 Job은 가능하면 BCM(TX_SETUP)에 맡겨 커널 타이머가 송신한다 (reactor가 깨지 않음)
+    int      bcm;                // 1: BCM Job
+    canid_t  bcm_id;             // BCM 작업 키 (EFF 플래그 포함 can_id)
+    size_t   bcm_mtu;            // CAN_MTU / CANFD_MTU (FD 작업은 키가 따로)
+    uint64_t bcm_start_ns;       // 현재 타이머 시작 시각 (송신 횟수 추정용)
+    uint64_t bcm_base;           // 타이머 재시작 전까지 추정 송신 횟수
+
+    // 통계. skipped/period_ms는 ad->mtx, 송신 결과(sent/failed/지연/지터)는 ch->tx_mtx (TX 큐가 나중에 채움)
+    // 읽을 때는 둘 다 잡는다
+    CanJobStats st;
+    uint64_t    late_sum_ns;
+    uint64_t    last_sent_ns;
+
+    struct Job* next;            // 채널 소유 목록 / graveyard
 } Job;
 
+/* 내용 변화 감시 (CAN_BCM RX_SETUP). 채널의 bcm 소켓 하나에 (can_id, FD 여부)별로 하나씩. */
+typedef struct Watch {
+    int                     id;
+    canid_t                 can_id;
+    size_t                  mtu;
+    can_callback_t          cb;
+    can_timeout_callback_t  on_timeout;
+    void*                   user;
+    struct Watch*           next;
+} Watch;
+
 typedef struct {
+    Job*                job;
     CanFrame            fr;        // 프레임 스냅샷
     can_tx_prepare_cb_t prep;      // 콜백 스냅샷
     void*               prep_user;
+    uint64_t            due_ns;    // 이번에 처리하는 주기의 만기 시각
+    int                 sent;      // 송신 결과 (PEND_QUEUED: TX 큐에 들어감, 결과는 txq_done이 기록)
 } Pending;
 
-typedef struct {
+#define PEND_QUEUED     (-1)
+
+/* 소프트웨어 TX 큐 항목. 소켓(qdisc)이 가득 차 바로 못 보낸 프레임이 중재 우선순위 순으로 기다린다.
+ * 결과를 기다리는 v_write 호출자의 항목은 호출자 스택에, 나머지는 채널이 미리 잡아 둔 슬롯에 있다. */
+typedef struct TxEnt {
+    CanFrame    fr;
+    uint32_t    prio;            // tx_prio: 작을수록 버스에서 이긴다
+    uint64_t    seq;             // 같은 prio 안에서는 넣은 순서
+    uint64_t    deadline_ns;     // 이 시각까지 못 보내면 버린다 (tx_late)
+    size_t      idx;             // ch->txq 안 위치
+    int         waiter;          // 1: 호출자 스택 항목 (done/result를 기다림)
+    struct Job* job;             // Job 프레임이면 그 Job (나간/버려진 뒤 통계를 여기서 남긴다, 취소되면 NULL)
+    uint64_t    due_ns;          // 〃 이번 주기 만기 시각
+    int         done;
+    can_err_t   result;
+    struct TxEnt* next;          // 빈 슬롯 목록
+} TxEnt;
+
+struct LinuxCh {
     int sock;                    // SocketCAN fd
     char ifname[IFNAMSIZ];
 
@@ -48,220 +143,897 @@ typedef struct {
     adapter_rx_cb_t  on_rx;   void* on_rx_user;
     adapter_err_cb_t on_err;  void* on_err_user;
     adapter_bus_cb_t on_bus;  void* on_bus_user;
-
-    // RX 스레드
-    pthread_t rx_thread;
-    volatile int rx_running;
-
-    // TX(Job) 스케줄러
-    pthread_t tx_thread;
-    volatile int tx_running;
-    pthread_mutex_t mtx;      // job 리스트 보호
+    adapter_tx_cb_t  on_tx;   void* on_tx_user;   // ch_open 직후에만 바뀐다 (트레이스 기록)
+
+    // recvmmsg 배치 버퍼 (reactor 전용)
+    int               batch;
+    struct canfd_frame* rxf;  // FD가 아닌 채널도 같은 버퍼 (클래식은 앞 CAN_MTU만 채워짐)
+    struct mmsghdr*   rxm;
+    struct iovec*     rxv;
+    int               fd;     // CAN_RAW_FD_FRAMES 켜짐
+    char*             rxc;    // 프레임별 cmsg 버퍼 (LINUX_RX_CMSG_SPACE씩)
+    linux_ts_mode_t   ts_mode;
+
+    // 버스 상태/통계. reactor, v_write 호출자, can_get_stats가 함께 쓰므로 atomic
+    int                  bitrate, dbitrate;     // 버스 점유 시간 추정용
+    uint32_t             link_setup_us;         // can_open 때 bring-up에 걸린 시간
+    atomic_int           state;                 // can_bus_state_t
+    atomic_uint          tec, rec;
+    atomic_uint_fast64_t tx_frames, tx_bytes, tx_failed, tx_bus_ns;
+    atomic_uint_fast64_t err_frames, bus_errors, arb_lost, rx_overflows, bus_off_count;
+
+    // 소프트웨어 TX 큐 (tx_mtx 보호). txq_cap == 0이면 꺼짐 (예전처럼 바로 실패)
+    // 소켓이 받아 주는 동안은 거치지 않고, 가득 찼을 때만 쌓았다가 EPOLLOUT/재시도 타이머로 내보낸다.
+    pthread_mutex_t tx_mtx;
+    pthread_cond_t  tx_cv;       // 큐에 넣고 결과를 기다리는 v_write 호출자
+    TxEnt**  txq;                // (prio, seq) 기준 min-heap
+    size_t   txq_n, txq_cap;
+    TxEnt*   txe;                // 슬롯 txq_cap개
+    TxEnt*   txe_free;
+    uint64_t txq_seq;
+    uint32_t txq_high;
+    int      tx_pollout;         // EPOLLOUT 등록 중
+    atomic_int tx_retry;         // ENOBUFS: reactor 타이머로 다시 시도
+    atomic_uint_fast64_t tx_queued, tx_late, tx_dropped;
+
+    // TX(Job) 목록 (ad->mtx 보호)
     Job* jobs;
     int  next_job_id;
-
-} LinuxCh;
-
-typedef struct { int dummy; } LinuxPriv;
+    int  bcm_sock;            // CAN_BCM 소켓 (첫 정적 Job/감시 때 연다, -1: 아직/사용 불가)
+    int  bcm_tried;
+    int  bcm_jobs;            // CanConfig.bcmJobs: 고정 프레임 Job을 BCM에 맡김
+    atomic_int bcm_tx;        // BCM에 맡긴 Job 수 (0이 아니면 rx_drain이 그 루프백 프레임을 거른다)
+    Watch* watches;           // 내용 변화 감시 목록 (ad->mtx 보호)
+    int    next_watch_id;
+
+    // reactor 소속 정보
+    struct LinuxPriv* ad;
+    int     dead;             // reactor 스레드 안에서 close된 채널 (배치 끝에 해제)
+    LinuxCh* next;            // ad->chans 연결 리스트
+};
+
+typedef struct LinuxPriv {
+    int epfd;                 // epoll
+    int evfd;                 // 깨우기용 eventfd
+    int tfd;                  // Job 스케줄용 timerfd (CLOCK_MONOTONIC)
+    atomic_int tx_retry;      // TX 큐 재시도가 필요한 채널이 있음
+
+    pthread_t    thread;
+    int          tid;            // reactor 스레드 tid (시작할 때 한 번, mtx). 스레드 정책은 tid로 건다
+    volatile int running;
+
+    // 채널 목록/배치 동기화
+    // reactor는 epoll_wait 한 번에 받은 이벤트 묶음(배치)을 락 밖에서 처리하고,
+    // 끝나면 seq를 올린다. close하는 쪽은 epoll에서 fd를 뺀 뒤 seq가 바뀔 때까지
+    // 기다리면, 그 채널을 가리키는 이벤트가 더 이상 처리되지 않음이 보장된다.
+    pthread_mutex_t mtx;
+    pthread_cond_t  cv;
+    uint64_t        seq;
+    LinuxCh*        chans;
+    LinuxCh*        graveyard;   // reactor 스레드 안에서 close된 채널들
+    struct LinuxRoute* routes;   // 걸어 둔 CAN_GW 규칙 (같은 uid 중복 확인용)
+
+    // Job 스케줄러: next_due_ns 기준 min-heap (mtx 보호)
+    Job**    heap;
+    size_t   heap_n;
+    size_t   heap_cap;
+    Job*     job_graveyard;      // 취소된 Job (배치 끝에 해제)
+
+    // 송신 스냅샷 버퍼 + sendmmsg용 병렬 배열.
+    // Job 등록 시 Job 수만큼 미리 늘려 두므로 reactor 루프에서는 할당하지 않는다.
+    Pending*          pend;
+    struct canfd_frame* txf;
+    struct mmsghdr*   txm;
+    struct iovec*     txv;
+    size_t            pend_cap;
+} LinuxPriv;
 
 /* ========= 유틸 ========= */
-static inline uint64_t now_ms(void){
+static inline uint64_t now_ns(void){
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec*1000ULL + (uint64_t)ts.tv_nsec/1000000ULL;
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
 }
 
-static void canframe_from_linux(const struct can_frame* in, CanFrame* out){
+/* struct can_frame은 canfd_frame의 앞 CAN_MTU 바이트와 배치가 같으므로 버퍼는 canfd_frame 하나로 쓴다.
+ * mtu: 수신 길이 (CAN_MTU: 클래식, CANFD_MTU: FD) */
+static void canframe_from_linux(const struct canfd_frame* in, size_t mtu, CanFrame* out){
     out->id    = in->can_id & CAN_EFF_MASK;
     out->flags = 0;
     if (in->can_id & CAN_EFF_FLAG) out->flags |= CAN_FRAME_EXTID;
+    out->timestamp_ns = 0;
+    memset(out->data, 0, sizeof(out->data));
+    if (mtu == CANFD_MTU) {
+        out->flags |= CAN_FRAME_FD;
+        if (in->flags & CANFD_BRS) out->flags |= CAN_FRAME_BRS;
+        if (in->flags & CANFD_ESI) out->flags |= CAN_FRAME_ESI;
+        out->dlc = in->len > CANFD_MAX_DLEN ? CANFD_MAX_DLEN : in->len;
+        memcpy(out->data, in->data, out->dlc);
+        return;
+    }
     if (in->can_id & CAN_RTR_FLAG) out->flags |= CAN_FRAME_RTR;
-    out->dlc = in->can_dlc;
-    memset(out->data, 0, 8);
+    out->dlc = in->len > CAN_MAX_DLEN ? CAN_MAX_DLEN : in->len;
     if (!(out->flags & CAN_FRAME_RTR)) {
         memcpy(out->data, in->data, out->dlc);
     }
 }
 
-static void linux_from_canframe(const CanFrame* in, struct can_frame* out){
+/* 반환: 소켓에 쓸 길이 (CAN_MTU / CANFD_MTU).
+ * FD 채널이 아니면 FD 프레임도 클래식 8바이트로 내린다 (동적 Job이 prep에서 FD로 바꾼 경우 등) */
+static size_t linux_from_canframe(const LinuxCh* ch, const CanFrame* in, struct canfd_frame* out){
     memset(out, 0, sizeof(*out));
     canid_t cid = in->id & CAN_SFF_MASK;
     if (in->flags & CAN_FRAME_EXTID) {
         cid = (in->id & CAN_EFF_MASK) | CAN_EFF_FLAG;
     }
+    if ((in->flags & CAN_FRAME_FD) && ch->fd) {
+        out->can_id = cid;
+        // FD 길이는 DLC 코드로 표현 가능한 값만 (남는 칸은 0 패딩)
+        uint8_t len = in->dlc > CANFD_MAX_DLEN ? CANFD_MAX_DLEN : in->dlc;
+        out->len = can_dlc_to_len(can_len_to_dlc(len));
+        if (in->flags & CAN_FRAME_BRS) out->flags |= CANFD_BRS;
+#ifdef CANFD_FDF
+        out->flags |= CANFD_FDF;
+#endif
+        memcpy(out->data, in->data, len);
+        return CANFD_MTU;
+    }
     if (in->flags & CAN_FRAME_RTR) {
         cid |= CAN_RTR_FLAG;
     }
-    out->can_id  = cid;
-    out->can_dlc = (in->dlc > 8) ? 8 : in->dlc;
+    out->can_id = cid;
+    out->len    = (in->dlc > CAN_MAX_DLEN) ? CAN_MAX_DLEN : in->dlc;
     if (!(in->flags & CAN_FRAME_RTR)) {
-        memcpy(out->data, in->data, out->can_dlc);
+        memcpy(out->data, in->data, out->len);
     }
+    return CAN_MTU;
+}
+
+/* 인터페이스 bring-up: CanConfig를 rtnetlink 설정으로 옮겨 canlink_configure에 맡긴다.
+ * 이미 같은 설정으로 올라와 있으면 손대지 않는다 (다른 프로세스가 먼저 열어 둔 경우). */
+static uint32_t per_mille(float sp){
+    return sp > 0.0f ? (uint32_t)(sp * 1000.0f + 0.5f) : 0;
 }
 
-#ifndef USE_LIBSOCKETCAN
-/* === 옵션 2: libsocketcan 없을 때 fallback (원치 않으면 제거 가능) === */
-static int fallback_bringup_with_ip(const char* ifname, int bitrate, int listen_only){
-    char cmd[256];
-    // down (있어도 되고 없어도 됨)
-    snprintf(cmd, sizeof(cmd), "/sbin/ip link set %s down", ifname);
-    (void)system(cmd);
+static int bringup_can_iface(const char* ifname, const CanConfig* cfg, CanLinkTiming* tm){
+    if (!ifname || !cfg) return -EINVAL;
+
+    CanLinkConfig lc = {0};
+    lc.bitrate      = cfg->bitrate > 0 ? (uint32_t)cfg->bitrate : 0;
+    lc.sample_point = per_mille(cfg->samplePoint);
+    lc.sjw          = cfg->sjw > 0 ? (uint32_t)cfg->sjw : 0;
+    lc.ctrl_mask    = CAN_CTRLMODE_LISTENONLY | CAN_CTRLMODE_LOOPBACK;
+    if (cfg->mode == CAN_MODE_SILENT || cfg->mode == CAN_MODE_SILENT_LOOPBACK)
+        lc.ctrl_flags |= CAN_CTRLMODE_LISTENONLY;
+    if (cfg->mode == CAN_MODE_LOOPBACK || cfg->mode == CAN_MODE_SILENT_LOOPBACK)
+        lc.ctrl_flags |= CAN_CTRLMODE_LOOPBACK;
+    if (cfg->fd) {
+        // FD를 끄는 쪽은 건드리지 않는다 (FD 인터페이스에서도 클래식 프레임은 그대로 오간다)
+        lc.dbitrate      = (uint32_t)(cfg->dataBitrate > 0 ? cfg->dataBitrate : cfg->bitrate);
+        lc.dsample_point = per_mille(cfg->dataSamplePoint);
+        lc.ctrl_mask    |= CAN_CTRLMODE_FD;
+        lc.ctrl_flags   |= CAN_CTRLMODE_FD;
+    }
+    lc.txqueuelen   = cfg->ifTxQueueLen;
+    lc.restart_ms   = cfg->restartMs > 0 ? cfg->restartMs : (cfg->restartMs < 0 ? 0 : -1);
+
+    int r = canlink_configure(ifname, &lc, tm);
+    if (r == -EPERM || r == -EACCES) {
+        fprintf(stderr, "canlink(%s): bring-up needs CAP_NET_ADMIN (link is down or configured differently)\n", ifname);
+    } else if (r) {
+        fprintf(stderr, "canlink(%s): %s\n", ifname, strerror(-r));
+    }
+    return r;
+}
+
+/* ========= Reactor ========= */
+static void reactor_wake(LinuxPriv* ad){
+    uint64_t one = 1;
+    (void)!write(ad->evfd, &one, sizeof(one));
+}
+
+static inline int in_reactor(const LinuxPriv* ad){
+    return pthread_equal(pthread_self(), ad->thread);
+}
+
+/* 커널 타임스탬프는 CLOCK_REALTIME이므로 now_ns()와 같은 CLOCK_MONOTONIC으로 옮긴다 */
+static int64_t realtime_to_mono_offset(void){
+    struct timespec rt;
+    clock_gettime(CLOCK_REALTIME, &rt);
+    uint64_t mono = now_ns();
+    return (int64_t)((uint64_t)rt.tv_sec*1000000000ULL + (uint64_t)rt.tv_nsec - mono);
+}
+
+static uint64_t rx_timestamp(const struct msghdr* mh, int64_t rt_off, uint64_t fallback){
+    for (struct cmsghdr* c = CMSG_FIRSTHDR(mh); c; c = CMSG_NXTHDR((struct msghdr*)mh, c)){
+        if (c->cmsg_level != SOL_SOCKET) continue;
+        const struct timespec* ts = NULL;
+        if (c->cmsg_type == SCM_TIMESTAMPING){
+            // ts[0]: 소프트웨어, ts[2]: 하드웨어(raw). 하드웨어 시계는 시스템 시계와 달라 쓰지 않는다
+            ts = &((const struct scm_timestamping*)CMSG_DATA(c))->ts[0];
+        } else if (c->cmsg_type == SCM_TIMESTAMPNS){
+            ts = (const struct timespec*)CMSG_DATA(c);
+        }
+        if (ts && (ts->tv_sec || ts->tv_nsec)){
+            int64_t v = (int64_t)((uint64_t)ts->tv_sec*1000000000ULL + (uint64_t)ts->tv_nsec) - rt_off;
+            return v > 0 ? (uint64_t)v : fallback;
+        }
+    }
+    return fallback;
+}
+
+static inline void stat_inc(atomic_uint_fast64_t* c, uint64_t v){
+    atomic_fetch_add_explicit(c, v, memory_order_relaxed);
+}
+
+static void tx_account(LinuxCh* ch, const CanFrame* f, int ok){
+    if (!ok){ stat_inc(&ch->tx_failed, 1); return; }
+    stat_inc(&ch->tx_frames, 1);
+    stat_inc(&ch->tx_bytes, f->dlc);
+    stat_inc(&ch->tx_bus_ns, can_frame_bus_time_ns(f, ch->bitrate, ch->dbitrate));
+    if (ch->on_tx) ch->on_tx(f, now_ns(), ch->on_tx_user);
+}
+
+/* ========= 소프트웨어 TX 큐 (ch->tx_mtx 보유 상태에서 호출) =========
+ * 소켓 txqueue(qdisc)는 FIFO라 가득 차면 먼저 들어온 벌크/주기 프레임 뒤에서 안전 프레임이 기다리거나
+ * 그냥 실패한다. 가득 찼을 때만 여기 쌓아 두고 버스 중재와 같은 순서(낮은 ID 먼저)로 내보낸다.
+ */
+enum { TXQ_IDLE = 0, TXQ_POLLOUT, TXQ_RETRY };
+
+// 중재 필드 순서: base ID(11) → RTR/SRR → IDE → 확장 ID(18) → RTR
+// 같은 base ID면 표준 데이터 < 표준 리모트 < 확장 프레임
+static inline uint32_t tx_prio(const CanFrame* f){
+    uint32_t rtr = (f->flags & CAN_FRAME_RTR) ? 1u : 0u;
+    if (!(f->flags & CAN_FRAME_EXTID))
+        return ((f->id & CAN_SFF_MASK) << 21) | (rtr << 20);
+    return (((f->id >> 18) & CAN_SFF_MASK) << 21) | (3u << 19) | ((f->id & 0x3FFFFu) << 1) | rtr;
+}
+
+static inline int txq_before(const TxEnt* a, const TxEnt* b){
+    return a->prio != b->prio ? a->prio < b->prio : a->seq < b->seq;
+}
+
+static inline void txq_set(LinuxCh* ch, size_t i, TxEnt* e){
+    ch->txq[i] = e;
+    e->idx = i;
+}
 
-    // bitrate 설정
-    if (listen_only) {
-        snprintf(cmd, sizeof(cmd),
-                 "/sbin/ip link set %s type can bitrate %d dbitrate %d "
-                 "fd off berr-reporting on", ifname, bitrate, bitrate);
-        // listen-only는 ctrlmode에서 처리하는 게 정석이라 여기선 생략/주석
+static void txq_up(LinuxCh* ch, size_t i){
+    TxEnt* e = ch->txq[i];
+    while (i > 0){
+        size_t p = (i - 1) / 2;
+        if (!txq_before(e, ch->txq[p])) break;
+        txq_set(ch, i, ch->txq[p]);
+        i = p;
+    }
+    txq_set(ch, i, e);
+}
+
+static void txq_down(LinuxCh* ch, size_t i){
+    TxEnt* e = ch->txq[i];
+    for (;;){
+        size_t c = 2*i + 1;
+        if (c >= ch->txq_n) break;
+        if (c + 1 < ch->txq_n && txq_before(ch->txq[c+1], ch->txq[c])) c++;
+        if (!txq_before(ch->txq[c], e)) break;
+        txq_set(ch, i, ch->txq[c]);
+        i = c;
+    }
+    txq_set(ch, i, e);
+}
+
+static void job_account(Job* j, uint64_t due_ns, uint64_t sent_ns, int ok);
+
+/* 큐에서 빼고 결과를 남긴다. 기다리는 호출자가 있으면 깨우고, 아니면 슬롯을 돌려준다.
+ * Job 프레임은 여기서 Job 통계에 남긴다 (밀려나거나 기한이 지나면 failed, 나가면 실제 송신 시각으로 지연/지터) */
+static void txq_done(LinuxCh* ch, TxEnt* e, can_err_t r){
+    size_t i = e->idx;
+    TxEnt* last = ch->txq[--ch->txq_n];
+    if (i != ch->txq_n){
+        txq_set(ch, i, last);
+        txq_up(ch, i);
+        txq_down(ch, last->idx);
+    }
+    tx_account(ch, &e->fr, r == CAN_OK);
+    if (e->job) job_account(e->job, e->due_ns, now_ns(), r == CAN_OK);
+    if (e->waiter){
+        e->result = r;
+        e->done = 1;
+        pthread_cond_broadcast(&ch->tx_cv);
     } else {
-        snprintf(cmd, sizeof(cmd),
-                 "/sbin/ip link set %s type can bitrate %d", ifname, bitrate);
+        e->next = ch->txe_free;
+        ch->txe_free = e;
+    }
+}
+
+/* w: 결과를 기다릴 호출자 스택 항목 (NULL이면 슬롯 사용). job: Job 프레임이면 그 Job과 만기 시각 (아니면 NULL).
+ * 가득 찼으면 큐에서 가장 늦게 나갈 항목보다 앞설 때만 그것을 밀어내고 들어간다. */
+static can_err_t txq_push(LinuxCh* ch, TxEnt* w, const CanFrame* fr, uint64_t deadline_ns, struct Job* job, uint64_t due_ns){
+    TxEnt tmp = { .prio = tx_prio(fr), .seq = ch->txq_seq };
+    if (ch->txq_n == ch->txq_cap){
+        TxEnt* worst = ch->txq[ch->txq_n / 2];      // 가장 늦은 항목은 잎 노드 중 하나
+        for (size_t i = ch->txq_n / 2 + 1; i < ch->txq_n; ++i)
+            if (txq_before(worst, ch->txq[i])) worst = ch->txq[i];
+        stat_inc(&ch->tx_dropped, 1);
+        if (!txq_before(&tmp, worst)){
+            stat_inc(&ch->tx_failed, 1);
+            return CAN_ERR_AGAIN;
+        }
+        txq_done(ch, worst, CAN_ERR_AGAIN);
     }
-    if (system(cmd) != 0) return -1;
+    TxEnt* e = w;
+    if (!e){
+        e = ch->txe_free;                           // 기다리는 호출자 항목이 아닌 것은 txq_cap개를 넘지 않는다
+        ch->txe_free = e->next;
+    }
+    e->fr = *fr;
+    e->prio = tmp.prio;
+    e->seq = ch->txq_seq++;
+    e->deadline_ns = deadline_ns;
+    e->waiter = (w != NULL);
+    e->job = job;
+    e->due_ns = due_ns;
+    e->done = 0;
+    ch->txq[ch->txq_n++] = e;
+    txq_up(ch, ch->txq_n - 1);
+    if (ch->txq_n > ch->txq_high) ch->txq_high = (uint32_t)ch->txq_n;
+    stat_inc(&ch->tx_queued, 1);
+    return CAN_OK;
+}
 
-    // up
-    snprintf(cmd, sizeof(cmd), "/sbin/ip link set %s up", ifname);
-    if (system(cmd) != 0) return -1;
+/* 앞에서부터 소켓이 받아 주는 만큼 내보낸다. 기한이 지난 항목은 버린다 */
+static int txq_drain(LinuxCh* ch){
+    uint64_t t = now_ns();
+    while (ch->txq_n){
+        TxEnt* e = ch->txq[0];
+        if (e->deadline_ns <= t){
+            stat_inc(&ch->tx_late, 1);
+            txq_done(ch, e, CAN_ERR_TIMEOUT);
+            continue;
+        }
+        struct canfd_frame lf;
+        size_t mtu = linux_from_canframe(ch, &e->fr, &lf);
+        ssize_t n = write(ch->sock, &lf, mtu);
+        if (n == (ssize_t)mtu){ txq_done(ch, e, CAN_OK); continue; }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return TXQ_POLLOUT;
+        // CAN은 qdisc가 가득 차면 ENOBUFS를 주고 POLLOUT으로는 알 수 없다 → 타이머로 재시도
+        if (n < 0 && errno == ENOBUFS) return TXQ_RETRY;
+        txq_done(ch, e, CAN_ERR_IO);
+    }
+    return TXQ_IDLE;
+}
 
-    return 0;
+/* drain 후 남은 게 있으면 다음에 깨울 방법(EPOLLOUT 또는 reactor 재시도 타이머)을 건다 */
+static void txq_kick(LinuxCh* ch){
+    int r = txq_drain(ch);
+    int want_out = (r == TXQ_POLLOUT);
+    if (want_out != ch->tx_pollout){
+        struct epoll_event ev = { .events = EPOLLIN | (want_out ? EPOLLOUT : 0u), .data.ptr = ch };
+        if (epoll_ctl(ch->ad->epfd, EPOLL_CTL_MOD, ch->sock, &ev) == 0) ch->tx_pollout = want_out;
+    }
+    if (r == TXQ_RETRY && !atomic_exchange(&ch->tx_retry, 1)){
+        atomic_store(&ch->ad->tx_retry, 1);
+        if (!in_reactor(ch->ad)) reactor_wake(ch->ad);
+    }
+}
+
+/* reactor: ENOBUFS로 멈춘 채널들을 다시 내보낸다. 반환: 아직 재시도가 필요한 채널이 있음 */
+static int txq_retry(LinuxPriv* ad){
+    int again = 0;
+    pthread_mutex_lock(&ad->mtx);
+    for (LinuxCh* ch = ad->chans; ch; ch = ch->next){
+        if (ch->dead || !atomic_exchange(&ch->tx_retry, 0)) continue;
+        pthread_mutex_lock(&ch->tx_mtx);
+        txq_kick(ch);
+        pthread_mutex_unlock(&ch->tx_mtx);
+        again |= atomic_load(&ch->tx_retry);
+    }
+    pthread_mutex_unlock(&ad->mtx);
+    return again;
+}
+
+static void set_bus_state(LinuxCh* ch, can_bus_state_t st){
+    if ((can_bus_state_t)atomic_exchange(&ch->state, (int)st) != st && ch->on_bus)
+        ch->on_bus(st, ch->on_bus_user);
 }
+
+/* 에러 프레임 해석 (linux/can/error.h). reactor에서 불린다.
+ * CRTL 상태 비트로 error active/passive, BUSOFF/RESTARTED로 bus-off 진입/복귀를 판단한다.
+ * warning 단계는 can_bus_state_t에 없으므로 active로 본다 (passive에서 내려올 때 드라이버가 warning을 보냄). */
+static void rx_error_frame(LinuxCh* ch, const struct canfd_frame* ef){
+    canid_t c = ef->can_id;
+    can_bus_state_t st = (can_bus_state_t)atomic_load(&ch->state);
+    stat_inc(&ch->err_frames, 1);
+
+    if (c & CAN_ERR_CRTL){
+        uint8_t d = ef->data[1];
+        if (d & (CAN_ERR_CRTL_RX_OVERFLOW | CAN_ERR_CRTL_TX_OVERFLOW)) stat_inc(&ch->rx_overflows, 1);
+        if (d & (CAN_ERR_CRTL_RX_PASSIVE | CAN_ERR_CRTL_TX_PASSIVE))    st = CAN_BUS_STATE_ERROR_PASSIVE;
+        else if (d & (CAN_ERR_CRTL_RX_WARNING | CAN_ERR_CRTL_TX_WARNING)) st = CAN_BUS_STATE_ERROR_ACTIVE;
+#ifdef CAN_ERR_CRTL_ACTIVE
+        else if (d & CAN_ERR_CRTL_ACTIVE)                                 st = CAN_BUS_STATE_ERROR_ACTIVE;
 #endif
+    }
+    if (c & CAN_ERR_LOSTARB) stat_inc(&ch->arb_lost, 1);
+    if (c & (CAN_ERR_PROT | CAN_ERR_TRX | CAN_ERR_ACK | CAN_ERR_BUSERROR)) stat_inc(&ch->bus_errors, 1);
+    if (c & CAN_ERR_BUSOFF){
+        st = CAN_BUS_STATE_BUS_OFF;
+        stat_inc(&ch->bus_off_count, 1);
+    }
+    if (c & CAN_ERR_RESTARTED) st = CAN_BUS_STATE_ERROR_ACTIVE;
 
-static int bringup_can_iface(const char* ifname, const CanConfig* cfg){
-    if (!ifname || !cfg) return -EINVAL;
+    // TEC/REC: 최신 커널은 CAN_ERR_CNT로 유효함을 알려주고, 그 전에는 상태 변화 프레임에만 채워진다
+#ifdef CAN_ERR_CNT
+    if (c & CAN_ERR_CNT){
+#else
+    if (c & (CAN_ERR_CRTL | CAN_ERR_BUSOFF)){
+#endif
+        atomic_store_explicit(&ch->tec, ef->data[6], memory_order_relaxed);
+        atomic_store_explicit(&ch->rec, ef->data[7], memory_order_relaxed);
+    }
+
+    set_bus_state(ch, st);
+    if (ch->on_err){
+        if      (c & CAN_ERR_BUSOFF)     ch->on_err(CAN_ERR_BUSOFF,  ch->on_err_user);
+        else if (c & CAN_ERR_TX_TIMEOUT) ch->on_err(CAN_ERR_TIMEOUT, ch->on_err_user);
+        else if (c & (CAN_ERR_PROT | CAN_ERR_TRX | CAN_ERR_ACK | CAN_ERR_BUSERROR))
+            ch->on_err(CAN_ERR_IO, ch->on_err_user);
+    }
+}
+
+static int bcm_is_own(LinuxCh* ch, canid_t id, size_t mtu);
 
-#ifdef USE_LIBSOCKETCAN
-    // 1) stop (down)
-    int r = can_do_stop(ifname);
-    if (r && r != -ENETDOWN) {
-        fprintf(stderr, "can_do_stop(%s): %s\n", ifname, strerror(-r));
-        return r;
-    }
-
-    // 2) bitrate 설정
-    r = can_set_bitrate(ifname, cfg->bitrate);
-    if (r) {
-        fprintf(stderr, "can_set_bitrate(%s,%d): %s\n", ifname, cfg->bitrate, strerror(-r));
-        return r;
-    }
-
-    // 3) ctrlmode (listen-only 등) 설정
-    //    CAN_MODE_LOOPBACK / SILENT_LOOPBACK은 사용자 공간에서 완벽 대응이 애매하므로
-    //    최소 listen-only만 반영. (loopback은 소켓 레벨 옵션으로도 가능)
-    struct can_ctrlmode cm = {0};
-    switch (cfg->mode) {
-        case CAN_MODE_SILENT:
-            cm.mask  = CAN_CTRLMODE_LISTENONLY;
-            cm.flags = CAN_CTRLMODE_LISTENONLY;
-            break;
-        default:
-            cm.mask  = CAN_CTRLMODE_LISTENONLY;
-            cm.flags = 0;
-            break;
-    }
-    if (cm.mask) {
-        r = can_set_ctrlmode(ifname, &cm);
-        if (r) {
-            fprintf(stderr, "can_set_ctrlmode(%s): %s\n", ifname, strerror(-r));
-            // 치명적이지 않으니 계속 진행할 수도 있음
+static void rx_drain(LinuxCh* ch){
+    // 한 번의 recvmmsg로 최대 batch개 프레임을 가져온다.
+    // level-triggered 이므로 한 번에 너무 오래 붙잡지 않는다 (다른 채널 공정성)
+    for (int round = 0; round < LINUX_RX_ROUNDS && !ch->dead; ++round){
+        for (int i = 0; i < ch->batch; ++i){
+            ch->rxm[i].msg_len = 0;
+            ch->rxm[i].msg_hdr.msg_controllen = ch->rxc ? LINUX_RX_CMSG_SPACE : 0;
         }
+        int n = recvmmsg(ch->sock, ch->rxm, (unsigned)ch->batch, MSG_DONTWAIT, NULL);
+        if (n <= 0) break;
+        uint64_t now = now_ns();
+        int64_t  off = ch->ts_mode != LINUX_TS_NONE ? realtime_to_mono_offset() : 0;
+        int      own = atomic_load(&ch->bcm_tx) > 0;
+        for (int i = 0; i < n && !ch->dead; ++i){
+            unsigned len = ch->rxm[i].msg_len;
+            if (len != CAN_MTU && len != CANFD_MTU) continue;
+            if (ch->rxf[i].can_id & CAN_ERR_FLAG){ rx_error_frame(ch, &ch->rxf[i]); continue; }
+            if (own && (ch->rxm[i].msg_hdr.msg_flags & MSG_DONTROUTE) && bcm_is_own(ch, ch->rxf[i].can_id, len)) continue;
+            CanFrame f; canframe_from_linux(&ch->rxf[i], len, &f);
+            f.timestamp_ns = ch->ts_mode != LINUX_TS_NONE
+                ? rx_timestamp(&ch->rxm[i].msg_hdr, off, now) : now;
+            if (ch->on_rx) ch->on_rx(&f, ch->on_rx_user);
+        }
+        if (n < ch->batch) break;
     }
+}
 
-    // (선택) 자동 재시작 ms
-    // r = can_set_restart_ms(ifname, 100);
+static void rx_error(LinuxCh* ch){
+    // 인터페이스 down 등: 소켓 에러를 읽어서 지워야 EPOLLERR가 반복되지 않는다
+    int soerr = 0; socklen_t len = sizeof(soerr);
+    getsockopt(ch->sock, SOL_SOCKET, SO_ERROR, &soerr, &len);
+    if (soerr && ch->on_err) ch->on_err(CAN_ERR_IO, ch->on_err_user);
+}
 
-    // 4) start (up)
-    r = can_do_start(ifname);
-    if (r) {
-        fprintf(stderr, "can_do_start(%s): %s\n", ifname, strerror(-r));
-        return r;
+/* ===== Job min-heap (ad->mtx 보유 상태에서 호출) ===== */
+static inline void heap_set(LinuxPriv* ad, size_t i, Job* j){
+    ad->heap[i] = j;
+    j->heap_idx = i;
+}
+
+static void heap_up(LinuxPriv* ad, size_t i){
+    Job* j = ad->heap[i];
+    while (i > 0){
+        size_t p = (i - 1) / 2;
+        if (ad->heap[p]->next_due_ns <= j->next_due_ns) break;
+        heap_set(ad, i, ad->heap[p]);
+        i = p;
     }
-    return 0;
+    heap_set(ad, i, j);
+}
 
-#else
-    // libsocketcan 없음 → fallback (선택 사항)
-    int listen_only = (cfg->mode == CAN_MODE_SILENT);
-    int r = fallback_bringup_with_ip(ifname, cfg->bitrate, listen_only);
-    if (r != 0) {
-        fprintf(stderr, "fallback ip(%s) bring-up failed. Need root/CAP_NET_ADMIN?\n", ifname);
-        return -EPERM;
+static void heap_down(LinuxPriv* ad, size_t i){
+    Job* j = ad->heap[i];
+    for (;;){
+        size_t c = 2*i + 1;
+        if (c >= ad->heap_n) break;
+        if (c + 1 < ad->heap_n && ad->heap[c+1]->next_due_ns < ad->heap[c]->next_due_ns) c++;
+        if (j->next_due_ns <= ad->heap[c]->next_due_ns) break;
+        heap_set(ad, i, ad->heap[c]);
+        i = c;
     }
-    return 0;
-#endif
+    heap_set(ad, i, j);
 }
 
-/* ========= RX 스레드 ========= */
-static void* rx_thread_fn(void* arg){
-    LinuxCh* ch = (LinuxCh*)arg;
+static void heap_remove(LinuxPriv* ad, Job* j){
+    if (j->bcm) return;
+    size_t i = j->heap_idx;
+    Job* last = ad->heap[--ad->heap_n];
+    if (i == ad->heap_n) return;
+    heap_set(ad, i, last);
+    heap_up(ad, i);
+    heap_down(ad, last->heap_idx);
+}
 
-    // 논블로킹 poll 루프
-    struct pollfd pfd;
-    pfd.fd = ch->sock;
-    pfd.events = POLLIN;
+/* heap/pend 버퍼를 n개 Job까지 받을 수 있게 늘린다 */
+static int jobs_reserve(LinuxPriv* ad, size_t n){
+    if (n <= ad->heap_cap) return 1;
+    size_t ncap = ad->heap_cap ? ad->heap_cap : 16;
+    while (ncap < n) ncap *= 2;
+
+    Job** h = (Job**)realloc(ad->heap, ncap*sizeof(*h));
+    if (!h) return 0;
+    ad->heap = h;
+    Pending* p = (Pending*)realloc(ad->pend, ncap*sizeof(*p));
+    if (!p) return 0;
+    ad->pend = p;
+    struct canfd_frame* f = (struct canfd_frame*)realloc(ad->txf, ncap*sizeof(*f));
+    if (!f) return 0;
+    ad->txf = f;
+    struct mmsghdr* m = (struct mmsghdr*)realloc(ad->txm, ncap*sizeof(*m));
+    if (!m) return 0;
+    ad->txm = m;
+    struct iovec* v = (struct iovec*)realloc(ad->txv, ncap*sizeof(*v));
+    if (!v) return 0;
+    ad->txv = v;
+    ad->heap_cap = ad->pend_cap = ncap;
+    return 1;
+}
 
-    while (ch->rx_running){
-        int r = poll(&pfd, 1, 100); // 100ms 타임아웃
-        if (r > 0 && (pfd.revents & POLLIN)){
-            struct can_frame fr;
-            ssize_t n = read(ch->sock, &fr, sizeof(fr));
-            if (n == (ssize_t)sizeof(fr)){
-                CanFrame f; canframe_from_linux(&fr, &f);
-                if (ch->on_rx) ch->on_rx(&f, ch->on_rx_user);
-            }
+/* 같은 채널로 가는 프레임 묶음을 batch 단위 sendmmsg로 송신. 반환: 실제 송신된 개수 */
+static size_t tx_flush(LinuxCh* ch, struct canfd_frame* frs, struct mmsghdr* msgs, struct iovec* iov, size_t n){
+    for (size_t i = 0; i < n; ++i){
+        iov[i].iov_base = &frs[i];      // iov_len은 변환할 때 프레임별 MTU로 채워 둠
+        memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].msg_hdr.msg_iov    = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    size_t off = 0;
+    while (off < n){
+        size_t chunk = n - off;
+        if (chunk > (size_t)ch->batch) chunk = (size_t)ch->batch;
+        int r = sendmmsg(ch->sock, &msgs[off], (unsigned)chunk, MSG_DONTWAIT);
+        if (r <= 0) break;   // txqueue 가득 참 등 → 이번 주기 나머지는 실패로 집계
+        off += (size_t)r;
+    }
+    return off;
+}
+
+/* 한 채널의 Job 프레임 송신. TX 큐에 기다리는 프레임이 있으면 바로 보내지 않고 그 사이에 우선순위대로 넣고,
+ * 소켓이 가득 차 못 보낸 것도 큐로 넘긴다. 큐 항목의 기한은 다음 주기 만기 (그 뒤엔 새 프레임이 대신한다). */
+static void job_flush(LinuxCh* ch, Pending* pend, struct canfd_frame* frs, struct mmsghdr* msgs, struct iovec* iov, size_t n){
+    size_t sent = 0;
+    if (ch->txq_cap) pthread_mutex_lock(&ch->tx_mtx);
+    if (!ch->txq_n) sent = tx_flush(ch, frs, msgs, iov, n);
+    for (size_t k = 0; k < n; ++k){
+        if (k < sent){ pend[k].sent = 1; tx_account(ch, &pend[k].fr, 1); continue; }
+        if (!ch->txq_cap){ pend[k].sent = 0; tx_account(ch, &pend[k].fr, 0); continue; }
+        // 큐에 들어가면 결과는 나중에 txq_done이 남긴다 (밀려나거나 기한을 넘기면 failed)
+        pend[k].sent = txq_push(ch, NULL, &pend[k].fr, pend[k].due_ns + pend[k].job->period_ns,
+                                pend[k].job, pend[k].due_ns) == CAN_OK ? PEND_QUEUED : 0;
+    }
+    if (ch->txq_cap){
+        if (sent < n) txq_kick(ch);
+        pthread_mutex_unlock(&ch->tx_mtx);
+    }
+}
+
+/* 송신 결과를 Job 통계에 (j->ch->tx_mtx 보유 상태에서 호출) */
+static void job_account(Job* j, uint64_t due_ns, uint64_t sent_ns, int ok){
+    CanJobStats* st = &j->st;
+    if (!ok){ st->failed++; return; }
+
+    uint64_t late = sent_ns > due_ns ? sent_ns - due_ns : 0;
+    st->sent++;
+    j->late_sum_ns += late;
+    if (late / 1000 > st->late_max_us) st->late_max_us = (uint32_t)(late / 1000);
+    st->late_avg_us = (uint32_t)(j->late_sum_ns / st->sent / 1000);
+
+    if (j->last_sent_ns){
+        uint64_t iv = sent_ns - j->last_sent_ns;
+        uint64_t dev = iv > j->period_ns ? iv - j->period_ns : j->period_ns - iv;
+        if (dev / 1000 > st->jitter_max_us) st->jitter_max_us = (uint32_t)(dev / 1000);
+    }
+    j->last_sent_ns = sent_ns;
+}
+
+/* 만기된 Job 스냅샷 + 송신. 반환값: 다음 만기 시각(ns, 0이면 Job 없음)
+ * - 락 안에서는 heap에서 만기된 것만 꺼내 스냅샷하고, 락 밖에서 prep + transmit 수행
+ */
+static uint64_t run_jobs(LinuxPriv* ad){
+    uint64_t t = now_ns();
+    size_t np = 0;
+
+    pthread_mutex_lock(&ad->mtx);
+    while (ad->heap_n && ad->heap[0]->next_due_ns <= t){   // Job당 최대 1개 → np <= pend_cap
+        Job* j = ad->heap[0];
+        // catch-up: 밀린 만큼 수학적으로 점프, 건너뛴 주기는 통계에 남긴다
+        uint64_t k = (t - j->next_due_ns) / j->period_ns;
+        Pending* p = &ad->pend[np++];
+        p->job = j; p->fr = j->fr; p->prep = j->prep; p->prep_user = j->prep_user;
+        p->due_ns = j->next_due_ns + k * j->period_ns;
+        j->st.skipped += k;
+        j->next_due_ns += (k + 1) * j->period_ns;
+        heap_down(ad, 0);
+    }
+    uint64_t next_due = ad->heap_n ? ad->heap[0]->next_due_ns : 0;
+    pthread_mutex_unlock(&ad->mtx);
+    if (np == 0) return next_due;
+
+    // 락 밖: prep + 송신 (채널/Job은 이 배치가 끝날 때까지 해제되지 않음)
+    // 채널별로 모아서(안정 정렬, 채널 안에서는 만기 순서 유지) sendmmsg 한 번에 내보낸다
+    for (size_t i = 1; i < np; ++i){
+        Pending tmp = ad->pend[i];
+        size_t k = i;
+        while (k > 0 && (uintptr_t)ad->pend[k-1].job->ch > (uintptr_t)tmp.job->ch){
+            ad->pend[k] = ad->pend[k-1];
+            k--;
         }
-        // 에러/버스 상태 변화 감지도 여기서 가능(필요 시)
+        ad->pend[k] = tmp;
     }
-    return NULL;
+    for (size_t i = 0; i < np; ++i){
+        Pending* p = &ad->pend[i];
+        if (p->prep) p->prep(&p->fr, p->prep_user);
+        ad->txv[i].iov_len = linux_from_canframe(p->job->ch, &p->fr, &ad->txf[i]);
+    }
+    size_t run = 0;
+    for (size_t i = 0; i < np; ++i){
+        LinuxCh* ch = ad->pend[i].job->ch;
+        if (i+1 < np && ad->pend[i+1].job->ch == ch) continue;
+        size_t n = i + 1 - run;
+        if (!ch->dead) job_flush(ch, &ad->pend[run], &ad->txf[run], &ad->txm[run], &ad->txv[run], n);
+        else for (size_t k = 0; k < n; ++k) ad->pend[run+k].sent = 0;
+        run = i + 1;
+    }
+
+    uint64_t sent_ns = now_ns();
+    pthread_mutex_lock(&ad->mtx);
+    for (size_t i = 0; i < np; ){       // pend는 채널별로 모여 있다
+        LinuxCh* ch = ad->pend[i].job->ch;
+        pthread_mutex_lock(&ch->tx_mtx);
+        for (; i < np && ad->pend[i].job->ch == ch; ++i)
+            if (ad->pend[i].sent != PEND_QUEUED)
+                job_account(ad->pend[i].job, ad->pend[i].due_ns, sent_ns, ad->pend[i].sent);
+        pthread_mutex_unlock(&ch->tx_mtx);
+    }
+    next_due = ad->heap_n ? ad->heap[0]->next_due_ns : 0;
+    pthread_mutex_unlock(&ad->mtx);
+    return next_due;
 }
 
-/* ========= TX(Job) 스케줄러 스레드 =========
- * - 락 안에서 오래 머무르지 않도록, 보낼 Job 포인터만 모아두고
- *   락 밖에서 prep + transmit 수행
+static void arm_timer(LinuxPriv* ad, uint64_t due_ns){
+    struct itimerspec its = {0};   // due_ns == 0 → disarm
+    if (due_ns){
+        its.it_value.tv_sec  = (time_t)(due_ns / 1000000000ULL);
+        its.it_value.tv_nsec = (long)(due_ns % 1000000000ULL);
+    }
+    timerfd_settime(ad->tfd, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+static void free_channel(LinuxCh* ch){
+    Job* j = ch->jobs;
+    while (j){
+        Job* nx = j->next;
+        free(j);
+        j = nx;
+    }
+    for (Watch* w = ch->watches; w; ){
+        Watch* nx = w->next;
+        free(w);
+        w = nx;
+    }
+    if (ch->sock >= 0) close(ch->sock);
+    if (ch->bcm_sock >= 0) close(ch->bcm_sock);     // 소켓을 닫으면 커널이 BCM 작업도 지운다
+    free(ch->rxf); free(ch->rxm); free(ch->rxv); free(ch->rxc);
+    free(ch->txq); free(ch->txe);
+    pthread_mutex_destroy(&ch->tx_mtx);
+    pthread_cond_destroy(&ch->tx_cv);
+    free(ch);
+}
+
+/* ====== BCM (bcm_drain, bcm_is_own 외에는 ad->mtx 보유 상태에서 호출) ======
+ * CanConfig.bcmJobs인 채널의 정적 Job은 CAN_BCM TX_SETUP(SETTIMER|STARTTIMER)으로 커널에 맡긴다.
+ * BCM은 (can_id, FD 여부)로 작업을 구분하므로 같은 ID의 정적 Job이 이미 BCM에 있으면
+ * 새 Job은 reactor heap으로 보낸다. BCM을 쓸 수 없는 커널(can-bcm 모듈 없음)도 heap으로.
  */
-static void* tx_thread_fn(void* arg){
-    LinuxCh* ch = (LinuxCh*)arg;
-    while (ch->tx_running){
-        uint64_t t = now_ms();
-        uint32_t sleep_ms = 50;
-
-        Pending* pend = NULL; size_t np=0, cap=0;
-
-        pthread_mutex_lock(&ch->mtx);
-        for (Job* j=ch->jobs; j; j=j->next){
-            if (j->next_due_ms == 0) j->next_due_ms = t + j->period_ms;
-            if (t >= j->next_due_ms){
-                if (np == cap){
-                    size_t ncap = cap? cap*2 : 8;
-                    Pending* tmp = (Pending*)realloc(pend, ncap*sizeof(Pending));
-                    if (!tmp) break; // 메모리 부족 → 일부만 전송
-                    pend = tmp; cap = ncap;
+typedef struct {
+    struct bcm_msg_head h;
+    struct canfd_frame  f;
+} BcmTx;
+
+static int bcm_open(LinuxCh* ch){
+    if (ch->bcm_sock >= 0) return 1;
+    if (ch->bcm_tried) return 0;
+    ch->bcm_tried = 1;
+
+    int s = socket(PF_CAN, SOCK_DGRAM, CAN_BCM);
+    if (s < 0) return 0;
+    struct ifreq ifr = {0};
+    memcpy(ifr.ifr_name, ch->ifname, sizeof(ifr.ifr_name));
+    struct sockaddr_can addr = {0};
+    addr.can_family = AF_CAN;
+    if (ioctl(s, SIOCGIFINDEX, &ifr) < 0){ close(s); return 0; }
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (connect(s, (struct sockaddr*)&addr, sizeof(addr)) < 0){ close(s); return 0; }
+    fcntl(s, F_SETFL, O_NONBLOCK);
+    if (ch->ts_mode != LINUX_TS_NONE){
+        int on = 1;
+        setsockopt(s, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+    }
+    // RX_CHANGED/RX_TIMEOUT 알림은 reactor가 읽는다
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = (void*)((uintptr_t)ch | 1u) };
+    if (epoll_ctl(ch->ad->epfd, EPOLL_CTL_ADD, s, &ev) != 0){ close(s); return 0; }
+    ch->bcm_sock = s;
+    return 1;
+}
+
+/* ival_ns: TX_SETUP은 송신 주기(ival2), RX_SETUP은 수신 타임아웃(ival1) */
+static int bcm_send(LinuxCh* ch, uint32_t opcode, uint32_t flags, const struct canfd_frame* f, size_t mtu, uint64_t ival_ns){
+    BcmTx m;
+    memset(&m, 0, sizeof(m));
+    m.h.opcode = opcode;
+    m.h.flags  = flags;
+    m.h.can_id = f->can_id;
+    struct bcm_timeval* iv = (opcode == RX_SETUP) ? &m.h.ival1 : &m.h.ival2;
+    iv->tv_sec  = (long)(ival_ns / 1000000000ULL);
+    iv->tv_usec = (long)(ival_ns % 1000000000ULL / 1000ULL);
+    if (mtu == CANFD_MTU){
+#ifdef CAN_FD_FRAME
+        m.h.flags |= CAN_FD_FRAME;
+#else
+        return -1;
+#endif
+    }
+    size_t len = sizeof(m.h);
+    if (opcode == TX_SETUP || opcode == RX_SETUP){
+        m.h.nframes = 1;
+        memcpy(&m.f, f, mtu);
+        len += mtu;
+    }
+    return write(ch->bcm_sock, &m, len) == (ssize_t)len ? 0 : -1;
+}
+
+/* RX_CHANGED / RX_TIMEOUT 알림 처리 (reactor).
+ * 콜백 정보는 락 안에서 복사하고 락 밖에서 부른다. 다른 스레드의 watch_del은 배치가 끝날 때까지
+ * 기다리고, 콜백 안에서 지운 감시는 다음 조회부터 보이지 않는다. */
+static void bcm_drain(LinuxCh* ch){
+    LinuxPriv* ad = ch->ad;
+    for (int k = 0; k < LINUX_RX_ROUNDS * LINUX_DEFAULT_BATCH && !ch->dead; ++k){
+        BcmTx m;
+        union { char buf[LINUX_RX_CMSG_SPACE]; struct cmsghdr align; } cbuf;
+        struct iovec iov = { .iov_base = &m, .iov_len = sizeof(m) };
+        struct msghdr mh = { .msg_iov = &iov, .msg_iovlen = 1, .msg_control = cbuf.buf, .msg_controllen = sizeof(cbuf.buf) };
+        ssize_t n = recvmsg(ch->bcm_sock, &mh, MSG_DONTWAIT);
+        if (n < (ssize_t)sizeof(m.h)) break;
+        if (m.h.opcode != RX_CHANGED && m.h.opcode != RX_TIMEOUT) continue;
+
+        size_t mtu = CAN_MTU;
+#ifdef CAN_FD_FRAME
+        if (m.h.flags & CAN_FD_FRAME) mtu = CANFD_MTU;
+#endif
+        can_callback_t cb = NULL; can_timeout_callback_t to = NULL; void* user = NULL;
+        pthread_mutex_lock(&ad->mtx);
+        for (Watch* w = ch->watches; w; w = w->next){
+            if (w->can_id == m.h.can_id && w->mtu == mtu){ cb = w->cb; to = w->on_timeout; user = w->user; break; }
+        }
+        pthread_mutex_unlock(&ad->mtx);
+
+        if (m.h.opcode == RX_TIMEOUT){
+            if (to) to(m.h.can_id & CAN_EFF_MASK, user);
+        } else if (cb && m.h.nframes >= 1 && (size_t)n >= sizeof(m.h) + mtu){
+            uint64_t now = now_ns();
+            CanFrame f; canframe_from_linux(&m.f, mtu, &f);
+            f.timestamp_ns = ch->ts_mode != LINUX_TS_NONE
+                ? rx_timestamp(&mh, realtime_to_mono_offset(), now) : now;
+            cb(&f, user);
+        }
+    }
+}
+
+static int bcm_id_free(const LinuxCh* ch, canid_t id, size_t mtu, const Job* self){
+    for (const Job* j = ch->jobs; j; j = j->next)
+        if (j != self && j->bcm && j->bcm_id == id && j->bcm_mtu == mtu) return 0;
+    return 1;
+}
+
+/* BCM이 보낸 프레임은 같은 인터페이스의 raw 소켓에도 로컬 루프백(MSG_DONTROUTE)으로 올라온다
+ * (CAN_RAW_RECV_OWN_MSGS는 보낸 소켓 자신에만 해당). rx_drain이 이 채널의 BCM Job과 같은
+ * (can_id, mtu)인 로컬 프레임을 버릴 때 쓴다. 같은 ID를 다른 프로세스가 보내도 함께 걸러진다.
+ * reactor에서 ad->mtx 없이 부르므로 여기서 잡는다 (on_rx 콜백이 Job API를 부를 수 있어 밖에서 잡지 않음). */
+static int bcm_is_own(LinuxCh* ch, canid_t id, size_t mtu){
+    pthread_mutex_lock(&ch->ad->mtx);
+    int own = !bcm_id_free(ch, id, mtu, NULL);
+    pthread_mutex_unlock(&ch->ad->mtx);
+    return own;
+}
+
+static uint64_t bcm_sent(const Job* j, uint64_t now){
+    return j->bcm_base + (now > j->bcm_start_ns ? (now - j->bcm_start_ns) / j->period_ns : 0);
+}
+
+/* 정적 Job을 BCM에 건다. 성공하면 1 (Job은 heap에 넣지 않음) */
+static int bcm_start(LinuxCh* ch, Job* j){
+    struct canfd_frame lf;
+    size_t mtu = linux_from_canframe(ch, &j->fr, &lf);
+    if (!bcm_open(ch) || !bcm_id_free(ch, lf.can_id, mtu, j)) return 0;
+    if (bcm_send(ch, TX_SETUP, SETTIMER | STARTTIMER, &lf, mtu, j->period_ns) != 0) return 0;
+    j->bcm = 1;
+    j->bcm_id = lf.can_id;
+    j->bcm_mtu = mtu;
+    j->bcm_start_ns = now_ns();
+    atomic_fetch_add(&ch->bcm_tx, 1);
+    return 1;
+}
+
+static void* reactor_fn(void* arg){
+    LinuxPriv* ad = (LinuxPriv*)arg;
+    struct epoll_event evs[16];
+
+    pthread_mutex_lock(&ad->mtx);
+    ad->tid = canrt_gettid();
+    pthread_cond_broadcast(&ad->cv);
+    pthread_mutex_unlock(&ad->mtx);
+
+    while (ad->running){
+        int n = epoll_wait(ad->epfd, evs, (int)(sizeof(evs)/sizeof(evs[0])), -1);
+        if (n < 0 && errno != EINTR) break;
+
+        int timer_fired = 0;
+        for (int i = 0; i < n; ++i){
+            void* tag = evs[i].data.ptr;
+            if (tag == &ad->evfd){
+                uint64_t v; (void)!read(ad->evfd, &v, sizeof(v));
+                timer_fired = 1;   // Job 등록 등 → 타이머 재계산
+            } else if (tag == &ad->tfd){
+                uint64_t v; (void)!read(ad->tfd, &v, sizeof(v));
+                timer_fired = 1;
+            } else if ((uintptr_t)tag & 1u){
+                // 채널의 BCM 소켓 (LinuxCh 포인터 하위 비트 1로 구분)
+                LinuxCh* ch = (LinuxCh*)((uintptr_t)tag & ~(uintptr_t)1u);
+                if (ch->dead) continue;
+                if (evs[i].events & EPOLLIN) bcm_drain(ch);
+            } else {
+                LinuxCh* ch = (LinuxCh*)tag;
+                if (ch->dead) continue;
+                if (evs[i].events & EPOLLIN) rx_drain(ch);
+                if (evs[i].events & EPOLLERR) rx_error(ch);
+                if (evs[i].events & EPOLLOUT){
+                    pthread_mutex_lock(&ch->tx_mtx);
+                    txq_kick(ch);
+                    pthread_mutex_unlock(&ch->tx_mtx);
                 }
-                // ★ 락 안에서 스냅샷
-                pend[np].fr        = j->fr;
-                pend[np].prep      = j->prep;
-                pend[np].prep_user = j->prep_user;
-                np++;
-
-                // catch-up: 밀린 만큼 수학적으로 점프
-                uint64_t late = t - j->next_due_ms;
-                uint64_t k = late / j->period_ms + 1;
-                j->next_due_ms += k * j->period_ms;
             }
-            uint32_t remain = (j->next_due_ms > t)? (uint32_t)(j->next_due_ms - t) : 0;
-            if (remain < sleep_ms) sleep_ms = remain;
         }
-        pthread_mutex_unlock(&ch->mtx);
+        if (atomic_exchange(&ad->tx_retry, 0)) timer_fired = 1;
+        if (timer_fired){
+            uint64_t due = run_jobs(ad);
+            if (txq_retry(ad)){
+                uint64_t r = now_ns() + LINUX_TXQ_RETRY_NS;
+                if (!due || r < due) due = r;
+            }
+            arm_timer(ad, due);
+        }
 
-        // 락 밖: prep + 송신
-        for (size_t i=0; i<np; ++i){
-            if (pend[i].prep) pend[i].prep(&pend[i].fr, pend[i].prep_user);
-            struct can_frame lfr; linux_from_canframe(&pend[i].fr, &lfr);
-            (void)write(ch->sock, &lfr, sizeof(lfr)); // 필요시 결과 체크
+        pthread_mutex_lock(&ad->mtx);
+        LinuxCh* g = ad->graveyard; ad->graveyard = NULL;
+        Job* gj = ad->job_graveyard; ad->job_graveyard = NULL;
+        // 취소된 Job을 가리키는 TX 큐 항목은 Job 없이 나가게 한다.
+        // seq를 올리기 전에: 밖에서 close하는 쪽이 깨어나 채널을 해제할 수 있으므로
+        for (Job* j = gj; j; j = j->next){
+            LinuxCh* ch = j->ch;
+            pthread_mutex_lock(&ch->tx_mtx);
+            for (size_t i = 0; i < ch->txq_n; ++i)
+                if (ch->txq[i]->job == j) ch->txq[i]->job = NULL;
+            pthread_mutex_unlock(&ch->tx_mtx);
         }
-        free(pend);
+        ad->seq++;
+        pthread_cond_broadcast(&ad->cv);
+        pthread_mutex_unlock(&ad->mtx);
 
-        struct timespec ts = { .tv_sec = sleep_ms/1000, .tv_nsec = (sleep_ms%1000)*1000000L };
-        nanosleep(&ts, NULL);
+        while (g){ LinuxCh* nx = g->next; free_channel(g); g = nx; }
+        while (gj){ Job* nx = gj->next; free(gj); gj = nx; }
     }
     return NULL;
 }
@@ -277,7 +1049,8 @@ static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg
     if (!name || !cfg || !out) return CAN_ERR_INVALID;
 
     // (A) 먼저 인터페이스 bring-up 시도 (비트레이트/모드 반영)
-    int br = bringup_can_iface(name, cfg);
+    CanLinkTiming lt;
+    int br = bringup_can_iface(name, cfg, &lt);
     if (br) {
         // 권한 문제 or 존재하지 않는 인터페이스
         if (br == -EPERM || br == -EACCES) return CAN_ERR_PERMISSION;
@@ -300,32 +1073,92 @@ static can_err_t v_ch_open(Adapter* self, const char* name, const CanConfig* cfg
     if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) < 0) { close(s); return CAN_ERR_IO; }
     fcntl(s, F_SETFL, O_NONBLOCK);
 
-    // 이하 기존 LinuxCh 할당, RX/TX 스레드 시작 로직 동일
+    if (cfg->fd) {
+        // 인터페이스가 FD로 올라와 있어야 FD 프레임을 보낼 수 있다 (MTU == CANFD_MTU)
+        int fd_on = 1;
+        if (ioctl(s, SIOCGIFMTU, &ifr) < 0 || ifr.ifr_mtu != CANFD_MTU ||
+            setsockopt(s, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &fd_on, sizeof(fd_on)) != 0) {
+            close(s);
+            return CAN_ERR_INVALID;
+        }
+    }
+
+    // 에러 프레임 구독: 컨트롤러 상태/에러 카운터/bus-off를 on_bus/on_err와 통계로 올린다
+    can_err_mask_t em = CAN_ERR_MASK;
+    setsockopt(s, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &em, sizeof(em));
+
     LinuxCh* ch = (LinuxCh*)calloc(1, sizeof(LinuxCh));
     if (!ch){ close(s); return CAN_ERR_MEMORY; }
 
     ch->sock = s;
+    ch->bcm_sock = -1;
+    ch->bcm_jobs = cfg->bcmJobs ? 1 : 0;
+    ch->fd   = cfg->fd ? 1 : 0;
+    ch->bitrate  = cfg->bitrate;
+    ch->dbitrate = cfg->fd ? cfg->dataBitrate : 0;
+    ch->link_setup_us = lt.total_us;
+    atomic_init(&ch->state, CAN_BUS_STATE_ERROR_ACTIVE);
     strncpy(ch->ifname, name, IFNAMSIZ-1);
-    if (pthread_mutex_init(&ch->mtx, NULL) != 0){
-        free(ch); close(s); return CAN_ERR_MEMORY;
-    }
+    ch->jobs = NULL;
+    ch->next_job_id = 0;
 
-    ch->rx_running = 1;
-    if (pthread_create(&ch->rx_thread, NULL, rx_thread_fn, ch) != 0){
-        pthread_mutex_destroy(&ch->mtx); free(ch); close(s); return CAN_ERR_MEMORY;
+    // recvmmsg 배치 버퍼 준비
+    ch->batch = cfg->batchSize > 0 ? cfg->batchSize : LINUX_DEFAULT_BATCH;
+    if (ch->batch > LINUX_MAX_BATCH) ch->batch = LINUX_MAX_BATCH;
+    ch->rxf = (struct canfd_frame*)calloc((size_t)ch->batch, sizeof(*ch->rxf));
+    ch->rxm = (struct mmsghdr*)  calloc((size_t)ch->batch, sizeof(*ch->rxm));
+    ch->rxv = (struct iovec*)    calloc((size_t)ch->batch, sizeof(*ch->rxv));
+    ch->rxc = (char*)            calloc((size_t)ch->batch, LINUX_RX_CMSG_SPACE);
+    if (!ch->rxf || !ch->rxm || !ch->rxv || !ch->rxc){
+        free(ch->rxf); free(ch->rxm); free(ch->rxv); free(ch->rxc);
+        free(ch); close(s);
+        return CAN_ERR_MEMORY;
+    }
+    for (int i = 0; i < ch->batch; ++i){
+        ch->rxv[i].iov_base = &ch->rxf[i];
+        ch->rxv[i].iov_len  = sizeof(ch->rxf[i]);
+        ch->rxm[i].msg_hdr.msg_iov    = &ch->rxv[i];
+        ch->rxm[i].msg_hdr.msg_iovlen = 1;
+        ch->rxm[i].msg_hdr.msg_control = ch->rxc + (size_t)i * LINUX_RX_CMSG_SPACE;
     }
 
-    ch->tx_running = 1;
-    if (pthread_create(&ch->tx_thread, NULL, tx_thread_fn, ch) != 0){
-        // rx 종료 후 정리
-        ch->rx_running = 0;
-        pthread_join(ch->rx_thread, NULL);
-        pthread_mutex_destroy(&ch->mtx); free(ch); close(s);
-        return CAN_ERR_MEMORY;
+    // 소프트웨어 TX 큐 (음수: 끔)
+    pthread_mutex_init(&ch->tx_mtx, NULL);
+    pthread_cond_init(&ch->tx_cv, NULL);
+    if (cfg->txQueueDepth >= 0){
+        ch->txq_cap = cfg->txQueueDepth > 0 ? (size_t)cfg->txQueueDepth : LINUX_TXQ_DEFAULT;
+        ch->txq = (TxEnt**)calloc(ch->txq_cap, sizeof(*ch->txq));
+        ch->txe = (TxEnt*) calloc(ch->txq_cap, sizeof(*ch->txe));
+        if (!ch->txq || !ch->txe){ free_channel(ch); return CAN_ERR_MEMORY; }
+        for (size_t i = 0; i < ch->txq_cap; ++i){
+            ch->txe[i].next = ch->txe_free;
+            ch->txe_free = &ch->txe[i];
+        }
     }
 
-    ch->jobs = NULL;
-    ch->next_job_id = 0;
+    // 수신 타임스탬프: SO_TIMESTAMPING(소프트웨어 RX) → 안 되면 SO_TIMESTAMPNS
+    int tsf = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    int on = 1;
+    if (setsockopt(s, SOL_SOCKET, SO_TIMESTAMPING, &tsf, sizeof(tsf)) == 0)
+        ch->ts_mode = LINUX_TS_TIMESTAMPING;
+    else if (setsockopt(s, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) == 0)
+        ch->ts_mode = LINUX_TS_TIMESTAMPNS;
+    else
+        ch->ts_mode = LINUX_TS_NONE;
+
+    // reactor에 등록 (스레드는 어댑터 생성 시 이미 떠 있음)
+    LinuxPriv* ad = (LinuxPriv*)self->priv;
+    ch->ad = ad;
+    pthread_mutex_lock(&ad->mtx);
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = ch };
+    if (epoll_ctl(ad->epfd, EPOLL_CTL_ADD, s, &ev) != 0){
+        pthread_mutex_unlock(&ad->mtx);
+        ch->sock = -1; free_channel(ch); close(s);
+        return CAN_ERR_IO;
+    }
+    ch->next = ad->chans;
+    ad->chans = ch;
+    pthread_mutex_unlock(&ad->mtx);
 
     *out = (AdapterHandle)ch;
     return CAN_OK;
@@ -335,33 +1168,32 @@ static void v_ch_close(Adapter* self, AdapterHandle h){
     (void)self;
     if (!h) return;
     LinuxCh* ch = (LinuxCh*)h;
-
-    // 스레드 종료
-    ch->rx_running = 0;
-    ch->tx_running = 0;
-
-    // 가벼운 깨우기(논블록이라 자연 종료; 필요시 잠깐 delay)
-    struct timespec ts = {.tv_sec=0,.tv_nsec=100*1000000L};
-    nanosleep(&ts, NULL);
-
-    pthread_join(ch->rx_thread, NULL);
-    pthread_join(ch->tx_thread, NULL);
-
-    // Job 정리
-    pthread_mutex_lock(&ch->mtx);
-    Job* j = ch->jobs;
-    while (j){
-        Job* nx = j->next;
-        free(j);
-        j = nx;
+    LinuxPriv* ad = ch->ad;
+
+    pthread_mutex_lock(&ad->mtx);
+    LinuxCh** pp = &ad->chans;
+    while (*pp && *pp != ch) pp = &(*pp)->next;
+    if (*pp) *pp = ch->next;
+    epoll_ctl(ad->epfd, EPOLL_CTL_DEL, ch->sock, NULL);
+    if (ch->bcm_sock >= 0) epoll_ctl(ad->epfd, EPOLL_CTL_DEL, ch->bcm_sock, NULL);
+    for (Job* j = ch->jobs; j; j = j->next) heap_remove(ad, j);
+
+    if (in_reactor(ad)){
+        // 콜백 안에서 close: 현재 배치가 이 채널을 아직 참조할 수 있으므로 배치 끝에 해제
+        ch->dead = 1;
+        ch->next = ad->graveyard;
+        ad->graveyard = ch;
+        pthread_mutex_unlock(&ad->mtx);
+        return;
     }
-    ch->jobs = NULL;
-    pthread_mutex_unlock(&ch->mtx);
 
-    pthread_mutex_destroy(&ch->mtx);
+    // 진행 중인 배치가 끝날 때까지 대기 (eventfd로 즉시 깨움 → 100ms 지연 없음)
+    uint64_t seq = ad->seq;
+    reactor_wake(ad);
+    while (ad->running && ad->seq == seq) pthread_cond_wait(&ad->cv, &ad->mtx);
+    pthread_mutex_unlock(&ad->mtx);
 
-    if (ch->sock >= 0) close(ch->sock);
-    free(ch);
+    free_channel(ch);
 }
 
 static can_err_t v_ch_set_callbacks(
@@ -379,141 +1211,814 @@ static can_err_t v_ch_set_callbacks(
     return CAN_OK;
 }
 
+/* 채널이 컴파일한 (id, mask) 목록을 CAN_RAW_FILTER로 커널에 내린다.
+ * EFF/RTR 플래그 비트는 mask에 넣지 않으므로 표준/확장 ID 모두 id 값으로만 비교된다
+ * (channel.c filter_match와 같은 의미).
+ */
+static can_err_t v_ch_set_filters(Adapter* self, AdapterHandle h, const CanFilter* filters, size_t count){
+    (void)self;
+    if (!h) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+
+    struct can_filter all = { .can_id = 0, .can_mask = 0 };
+    if (!filters){
+        if (setsockopt(ch->sock, SOL_CAN_RAW, CAN_RAW_FILTER, &all, sizeof(all)) != 0) return CAN_ERR_IO;
+        return CAN_OK;
+    }
+    if (count > CAN_RAW_FILTER_MAX) return CAN_ERR_INVALID;
+
+    struct can_filter* kf = (struct can_filter*)calloc(count ? count : 1, sizeof(*kf));
+    if (!kf) return CAN_ERR_MEMORY;
+    for (size_t i = 0; i < count; ++i){
+        if (filters[i].type != CAN_FILTER_MASK){ free(kf); return CAN_ERR_INVALID; }
+        kf[i].can_mask = filters[i].data.mask.mask & CAN_EFF_MASK;
+        kf[i].can_id   = filters[i].data.mask.id   & kf[i].can_mask;
+    }
+    int r = setsockopt(ch->sock, SOL_CAN_RAW, CAN_RAW_FILTER, kf, (socklen_t)(count * sizeof(*kf)));
+    free(kf);
+    return r == 0 ? CAN_OK : CAN_ERR_IO;
+}
+
+/* can_send: 소켓이 받아 주면 바로 보내고, txqueue가 가득 찼거나 TX 큐에 기다리는 프레임이 있으면
+ * 우선순위 큐로 넣는다. timeout_ms 0이면 넣고 바로 CAN_OK (LINUX_TXQ_DEADLINE_MS 안에 못 나가면 tx_late),
+ * 아니면 실제로 나갈 때까지 기다린다 (reactor 스레드에서는 기다리는 동안 큐를 직접 비운다).
+ * 큐가 가득 차고 밀리는 쪽이면 CAN_ERR_AGAIN. */
 static can_err_t v_write(Adapter* self, AdapterHandle h, const CanFrame* fr, uint32_t timeout_ms){
     (void)self;
     if (!h || !fr) return CAN_ERR_INVALID;
     LinuxCh* ch = (LinuxCh*)h;
 
-    struct can_frame lfr; linux_from_canframe(fr, &lfr);
-
-    if (timeout_ms == 0){
-        ssize_t n = write(ch->sock, &lfr, sizeof(lfr));
-        if (n == (ssize_t)sizeof(lfr)) return CAN_OK;
-        if (errno == EAGAIN || errno == EWOULDBLOCK) return CAN_ERR_AGAIN;
-        return CAN_ERR_IO;
-    } else {
+    struct canfd_frame lfr;
+    size_t mtu = linux_from_canframe(ch, fr, &lfr);
+
+    if (!ch->txq_cap){
+        // TX 큐 꺼짐: 소켓에 바로
+        if (timeout_ms == 0){
+            ssize_t n = write(ch->sock, &lfr, mtu);
+            tx_account(ch, fr, n == (ssize_t)mtu);
+            if (n == (ssize_t)mtu) return CAN_OK;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)) return CAN_ERR_AGAIN;
+            return CAN_ERR_IO;      // 짧게 쓰인 경우 포함
+        }
         struct pollfd pfd; pfd.fd = ch->sock; pfd.events = POLLOUT;
         int r = poll(&pfd, 1, (int)timeout_ms);
-        if (r <= 0) return (r==0)?CAN_ERR_TIMEOUT:CAN_ERR_IO;
-        ssize_t n = write(ch->sock, &lfr, sizeof(lfr));
-        if (n == (ssize_t)sizeof(lfr)) return CAN_OK;
+        if (r <= 0){ tx_account(ch, fr, 0); return (r==0)?CAN_ERR_TIMEOUT:CAN_ERR_IO; }
+        ssize_t n = write(ch->sock, &lfr, mtu);
+        tx_account(ch, fr, n == (ssize_t)mtu);
+        if (n == (ssize_t)mtu) return CAN_OK;
         return CAN_ERR_IO;
     }
+
+    pthread_mutex_lock(&ch->tx_mtx);
+    if (ch->txq_n == 0){
+        ssize_t n = write(ch->sock, &lfr, mtu);
+        // 짧게 쓰인 경우(n >= 0)는 errno가 이전 값이므로 보지 않고 CAN_ERR_IO
+        if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS)){
+            pthread_mutex_unlock(&ch->tx_mtx);
+            tx_account(ch, fr, n == (ssize_t)mtu);
+            return n == (ssize_t)mtu ? CAN_OK : CAN_ERR_IO;
+        }
+    }
+
+    TxEnt w;
+    uint32_t ms = timeout_ms ? timeout_ms : LINUX_TXQ_DEADLINE_MS;
+    can_err_t e = txq_push(ch, timeout_ms ? &w : NULL, fr, now_ns() + (uint64_t)ms * 1000000ULL, NULL, 0);
+    if (e == CAN_OK) txq_kick(ch);      // 새 프레임이 맨 앞일 수 있고, 그새 자리가 났을 수도 있다
+    if (e != CAN_OK || !timeout_ms){
+        pthread_mutex_unlock(&ch->tx_mtx);
+        return e;
+    }
+
+    if (in_reactor(ch->ad)){
+        // 구독 콜백 안에서 보낸 경우: 큐를 비우는 것은 reactor 자신이므로 cv를 기다리면 timeout까지
+        // 모든 채널이 멈춘다. 직접 내보내면서 이 프레임이 나가거나 버려질 때까지만 기다린다.
+        uint64_t end = now_ns() + (uint64_t)timeout_ms * 1000000ULL;
+        for (;;){
+            int r = txq_drain(ch);
+            uint64_t t = now_ns();
+            if (w.done || t >= end) break;
+            pthread_mutex_unlock(&ch->tx_mtx);
+            if (r == TXQ_POLLOUT){
+                struct pollfd pfd = { .fd = ch->sock, .events = POLLOUT };
+                (void)poll(&pfd, 1, (int)((end - t + 999999ULL) / 1000000ULL));
+            } else {
+                struct timespec ts = { 0, (long)LINUX_TXQ_RETRY_NS };
+                nanosleep(&ts, NULL);
+            }
+            pthread_mutex_lock(&ch->tx_mtx);
+        }
+        if (!w.done){
+            stat_inc(&ch->tx_late, 1);
+            txq_done(ch, &w, CAN_ERR_TIMEOUT);
+        }
+        txq_kick(ch);       // 남은 프레임은 다시 EPOLLOUT/재시도 타이머로
+        e = w.result;
+        pthread_mutex_unlock(&ch->tx_mtx);
+        return e;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec  += timeout_ms / 1000;
+    ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L){ ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+    while (!w.done)
+        if (pthread_cond_timedwait(&ch->tx_cv, &ch->tx_mtx, &ts) == ETIMEDOUT) break;
+    if (!w.done){
+        stat_inc(&ch->tx_late, 1);
+        txq_done(ch, &w, CAN_ERR_TIMEOUT);
+    }
+    e = w.result;
+    pthread_mutex_unlock(&ch->tx_mtx);
+    return e;
 }
 
-static can_err_t v_read(Adapter* self, AdapterHandle h, CanFrame* out, uint32_t timeout_ms){
+/* can_send_batch_h: sendmmsg로 묶어 보내고, txqueue가 차면 남은 시간 동안 기다렸다 이어서 보낸다.
+ * 벌크 전송이므로 TX 큐에 기다리는 프레임이 있으면 그것들이 빠질 때까지 양보한다. */
+static can_err_t v_write_batch(Adapter* self, AdapterHandle h, const CanFrame* frs, size_t n, size_t* sent, uint32_t timeout_ms){
     (void)self;
-    if (!h || !out) return CAN_ERR_INVALID;
+    if (!h || (!frs && n) || !sent) return CAN_ERR_INVALID;
     LinuxCh* ch = (LinuxCh*)h;
 
-    struct pollfd pfd; pfd.fd = ch->sock; pfd.events = POLLIN;
-    int r = poll(&pfd, 1, (int)timeout_ms);
-    if (r <= 0) return (r==0)?CAN_ERR_TIMEOUT:CAN_ERR_IO;
-
-    struct can_frame lfr;
-    ssize_t n = read(ch->sock, &lfr, sizeof(lfr));
-    if (n == (ssize_t)sizeof(lfr)){
-        canframe_from_linux(&lfr, out);
-        return CAN_OK;
+    struct canfd_frame lf[LINUX_DEFAULT_BATCH];
+    struct iovec       iv[LINUX_DEFAULT_BATCH];
+    struct mmsghdr     mm[LINUX_DEFAULT_BATCH];
+    uint64_t deadline = now_ns() + (uint64_t)timeout_ms * 1000000ULL;
+    size_t done = 0;
+    can_err_t err = CAN_OK;
+
+    while (done < n){
+        size_t k = n - done;
+        if (k > LINUX_DEFAULT_BATCH) k = LINUX_DEFAULT_BATCH;
+        memset(mm, 0, k * sizeof(mm[0]));
+        for (size_t i = 0; i < k; ++i){
+            iv[i].iov_len  = linux_from_canframe(ch, &frs[done + i], &lf[i]);
+            iv[i].iov_base = &lf[i];
+            mm[i].msg_hdr.msg_iov    = &iv[i];
+            mm[i].msg_hdr.msg_iovlen = 1;
+        }
+        int busy = 0;
+        if (ch->txq_cap){
+            pthread_mutex_lock(&ch->tx_mtx);
+            if (ch->txq_n && in_reactor(ch->ad)) txq_kick(ch);    // reactor 안에서는 양보해도 비워 줄 스레드가 없다
+            busy = ch->txq_n != 0;
+            pthread_mutex_unlock(&ch->tx_mtx);
+        }
+        int r = -1;
+        if (busy) errno = ENOBUFS;
+        else r = sendmmsg(ch->sock, mm, (unsigned)k, MSG_DONTWAIT);
+        if (r > 0){
+            for (int i = 0; i < r; ++i) tx_account(ch, &frs[done + (size_t)i], 1);
+            done += (size_t)r;
+            continue;
+        }
+        if (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS){ err = CAN_ERR_IO; break; }
+
+        // txqueue 가득 참
+        if (timeout_ms == 0){ err = CAN_ERR_AGAIN; break; }
+        uint64_t now = now_ns();
+        if (now >= deadline){ err = CAN_ERR_TIMEOUT; break; }
+        if (errno == ENOBUFS){
+            // CAN은 qdisc가 가득 차면 ENOBUFS를 주고 POLLOUT으로는 알 수 없으므로 잠깐 쉬었다 재시도
+            struct timespec ts = { 0, 200000 };
+            nanosleep(&ts, NULL);
+        } else {
+            struct pollfd pfd = { .fd = ch->sock, .events = POLLOUT };
+            int wait_ms = (int)((deadline - now + 999999ULL) / 1000000ULL);
+            if (poll(&pfd, 1, wait_ms) < 0 && errno != EINTR){ err = CAN_ERR_IO; break; }
+        }
     }
-    return CAN_ERR_IO;
+    if (err != CAN_OK) stat_inc(&ch->tx_failed, n - done);
+    *sent = done;
+    return err;
+}
+
+static can_err_t v_ch_set_tx_callback(Adapter* self, AdapterHandle h, adapter_tx_cb_t on_tx, void* user){
+    (void)self;
+    if (!h) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+    ch->on_tx_user = user;
+    ch->on_tx = on_tx;
+    return CAN_OK;
 }
 
 static can_bus_state_t v_status(Adapter* self, AdapterHandle h){
-    (void)self; (void)h;
-    // SocketCAN에서 사용자 공간에서 버스오프 직접 판단은 제한적.
-    // 간단히 ACTIVE로 보고, 에러프레임/통계 확장도 가능.
-    return CAN_BUS_STATE_ERROR_ACTIVE;
+    (void)self;
+    if (!h) return CAN_BUS_STATE_BUS_OFF;
+    // 에러 프레임으로 추적한 마지막 상태
+    return (can_bus_state_t)atomic_load(&((LinuxCh*)h)->state);
 }
 
 static can_err_t v_recover(Adapter* self, AdapterHandle h){
-    (void)self; (void)h;
-    // 사용자 공간에서 bus-off recover는 일반적으로 드라이버/if 재시작 필요.
-    // 여기서는 NOT SUPPORTED.
-    return CAN_ERR_STATE;
+    (void)self;
+    if (!h) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+    if (atomic_load(&ch->state) != CAN_BUS_STATE_BUS_OFF) return CAN_OK;
+
+    // restart-ms가 0이면 드라이버가 bus-off에서 스스로 돌아오지 않으므로 수동 restart.
+    // (restart-ms가 설정돼 있으면 커널이 거부한다 → 자동 복귀를 기다리면 됨)
+    int r = canlink_restart(ch->ifname);
+    if (r == -EPERM || r == -EACCES) return CAN_ERR_PERMISSION;
+    if (r != 0) return CAN_ERR_IO;
+    atomic_store_explicit(&ch->tec, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->rec, 0, memory_order_relaxed);
+    set_bus_state(ch, CAN_BUS_STATE_ERROR_ACTIVE);
+    return CAN_OK;
 }
 
-/* ====== Job 등록/취소/확장 ====== */
-static can_err_t v_ch_register_job_dynamic(Adapter* self, int* id, AdapterHandle h, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms)
-{
+static can_err_t v_ch_get_bus_stats(Adapter* self, AdapterHandle h, CanStats* io){
     (void)self;
-    if (!h || !prep || period_ms == 0) return CAN_ERR_INVALID;
+    if (!h || !io) return CAN_ERR_INVALID;
     LinuxCh* ch = (LinuxCh*)h;
+    io->state          = (can_bus_state_t)atomic_load(&ch->state);
+    io->tx_err_counter = (uint8_t)atomic_load_explicit(&ch->tec, memory_order_relaxed);
+    io->rx_err_counter = (uint8_t)atomic_load_explicit(&ch->rec, memory_order_relaxed);
+    io->tx_frames      = atomic_load_explicit(&ch->tx_frames, memory_order_relaxed);
+    io->tx_bytes       = atomic_load_explicit(&ch->tx_bytes, memory_order_relaxed);
+    io->tx_failed      = atomic_load_explicit(&ch->tx_failed, memory_order_relaxed);
+    io->bus_time_ns   += atomic_load_explicit(&ch->tx_bus_ns, memory_order_relaxed);
+    io->err_frames     = atomic_load_explicit(&ch->err_frames, memory_order_relaxed);
+    io->bus_errors     = atomic_load_explicit(&ch->bus_errors, memory_order_relaxed);
+    io->arb_lost       = atomic_load_explicit(&ch->arb_lost, memory_order_relaxed);
+    io->rx_overflows   = atomic_load_explicit(&ch->rx_overflows, memory_order_relaxed);
+    io->bus_off_count  = atomic_load_explicit(&ch->bus_off_count, memory_order_relaxed);
+    io->tx_queued      = atomic_load_explicit(&ch->tx_queued, memory_order_relaxed);
+    io->tx_late        = atomic_load_explicit(&ch->tx_late, memory_order_relaxed);
+    io->tx_dropped     = atomic_load_explicit(&ch->tx_dropped, memory_order_relaxed);
+    io->link_setup_us  = ch->link_setup_us;
+    pthread_mutex_lock(&ch->tx_mtx);
+    io->tx_queue_high_water = ch->txq_high;
+    pthread_mutex_unlock(&ch->tx_mtx);
+
+    // BCM Job 송신분은 소켓을 거치지 않으므로 추정치를 더한다
+    uint64_t t = now_ns();
+    pthread_mutex_lock(&ch->ad->mtx);
+    for (Job* j = ch->jobs; j; j = j->next){
+        if (!j->bcm) continue;
+        uint64_t n = bcm_sent(j, t);
+        io->tx_frames   += n;
+        io->tx_bytes    += n * j->fr.dlc;
+        io->bus_time_ns += n * can_frame_bus_time_ns(&j->fr, ch->bitrate, ch->dbitrate);
+    }
+    pthread_mutex_unlock(&ch->ad->mtx);
+    return CAN_OK;
+}
 
-    Job* j = (Job*)calloc(1, sizeof(Job));
-    if (!j) return CAN_ERR_INVALID;
-    j->period_ms = period_ms;
-    j->next_due_ms = 0;
-    j->prep = prep;
-    j->prep_user = prep_user;
+/* can_subscribe_on_change: RX_SETUP에 mask 프레임 하나를 걸면 커널이 (data & mask)나
+ * 길이(RX_CHECK_DLC)가 바뀐 프레임만 올려준다. timeout_ms가 있으면 ival1 동안 수신이 없을 때
+ * RX_TIMEOUT, 다시 들어오면(RX_ANNOUNCE_RESUME) 그 프레임을 바로 전달. */
+static can_err_t v_ch_watch_add(Adapter* self, AdapterHandle h, const CanChangeFilter* flt,
+                                can_callback_t cb, can_timeout_callback_t on_timeout, void* user, int* watchId){
+    (void)self;
+    if (!h || !flt || !watchId) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+    LinuxPriv* ad = ch->ad;
 
-    pthread_mutex_lock(&ch->mtx);
-    j->id = ++ch->next_job_id;
-    j->next = ch->jobs;
-    ch->jobs = j;
-    pthread_mutex_unlock(&ch->mtx);
+    int fd = (flt->flags & CAN_FRAME_FD) ? 1 : 0;
+#ifndef CAN_FD_FRAME
+    if (fd) return CAN_ERR_INVALID;
+#endif
+    if (fd && !ch->fd) return CAN_ERR_INVALID;
+    size_t  mtu = fd ? CANFD_MTU : CAN_MTU;
+    uint8_t max = fd ? CANFD_MAX_DLEN : CAN_MAX_DLEN;
+
+    struct canfd_frame lf;
+    memset(&lf, 0, sizeof(lf));
+    lf.can_id = (flt->flags & CAN_FRAME_EXTID) ? ((flt->id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (flt->id & CAN_SFF_MASK);
+    lf.len    = max;
+    if (flt->len == 0) memset(lf.data, 0xFF, max);
+    else               memcpy(lf.data, flt->mask, flt->len > max ? max : flt->len);
+
+    uint32_t flags = RX_CHECK_DLC;
+    if (flt->timeout_ms) flags |= SETTIMER | STARTTIMER | RX_ANNOUNCE_RESUME;
+
+    Watch* w = (Watch*)calloc(1, sizeof(Watch));
+    if (!w) return CAN_ERR_MEMORY;
+    w->can_id = lf.can_id; w->mtu = mtu;
+    w->cb = cb; w->on_timeout = on_timeout; w->user = user;
+
+    can_err_t ret = CAN_OK;
+    pthread_mutex_lock(&ad->mtx);
+    if (!bcm_open(ch)) ret = CAN_ERR_NODEV;                        // can-bcm 모듈 없음
+    for (Watch* o = ch->watches; o && ret == CAN_OK; o = o->next)
+        if (o->can_id == w->can_id && o->mtu == mtu) ret = CAN_ERR_INVALID;   // BCM은 ID당 작업 하나
+    if (ret == CAN_OK && bcm_send(ch, RX_SETUP, flags, &lf, mtu, (uint64_t)flt->timeout_ms * 1000000ULL) != 0)
+        ret = CAN_ERR_IO;
+    if (ret == CAN_OK){
+        w->id = ++ch->next_watch_id;
+        w->next = ch->watches;
+        ch->watches = w;
+        *watchId = w->id;
+    }
+    pthread_mutex_unlock(&ad->mtx);
+    if (ret != CAN_OK) free(w);
+    return ret;
+}
 
-    *id = j->id;
-    
+static can_err_t v_ch_watch_del(Adapter* self, AdapterHandle h, int watchId){
+    (void)self;
+    if (!h) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+    LinuxPriv* ad = ch->ad;
+
+    pthread_mutex_lock(&ad->mtx);
+    Watch** pp = &ch->watches;
+    while (*pp && (*pp)->id != watchId) pp = &(*pp)->next;
+    Watch* del = *pp;
+    if (!del){
+        pthread_mutex_unlock(&ad->mtx);
+        return CAN_ERR_INVALID;
+    }
+    *pp = del->next;
+    struct canfd_frame lf = { .can_id = del->can_id };
+    bcm_send(ch, RX_DELETE, 0, &lf, del->mtu, 0);
+    if (!in_reactor(ad)){
+        // 이미 읽어 둔 알림으로 콜백 중일 수 있으므로 현재 배치가 끝날 때까지 대기
+        uint64_t seq = ad->seq;
+        reactor_wake(ad);
+        while (ad->running && ad->seq == seq) pthread_cond_wait(&ad->cv, &ad->mtx);
+    }
+    pthread_mutex_unlock(&ad->mtx);
+    free(del);
     return CAN_OK;
 }
 
-static can_err_t v_ch_register_job(Adapter* self, int* id, AdapterHandle h, const CanFrame* fr, uint32_t period_ms)
-{
+#ifdef LINUX_HAVE_ISOTP
+/* ====== ISO-TP (커널 CAN_ISOTP) ======
+ * 연결마다 CAN_ISOTP 소켓 하나. 분할/재조립, FC, STmin은 커널이 처리하므로
+ * reactor는 관여하지 않고 send/recv 모두 호출자 스레드에서 블로킹한다.
+ * can-isotp 모듈이 없으면 CAN_ERR_NODEV → 채널이 isotp.c로 대신한다.
+ */
+typedef struct {
+    int sock;
+} LinuxTp;
+
+static can_err_t isotp_errno(int e){
+    switch (e){
+    case ECOMM:
+    case ETIMEDOUT: return CAN_ERR_TIMEOUT;     // FC/CF 타임아웃 (N_Bs/N_Cr)
+    case EMSGSIZE:  return CAN_ERR_AGAIN;       // 상대가 FC(OVFLW)
+    case EAGAIN:    return CAN_ERR_AGAIN;
+    default:        return CAN_ERR_IO;
+    }
+}
+
+static can_err_t v_ch_isotp_open(Adapter* self, AdapterHandle h, const CanIsoTpConfig* cfg, void** link){
     (void)self;
-    if (!h || !fr || period_ms == 0) return CAN_ERR_INVALID;
+    if (!h || !cfg || !link) return CAN_ERR_INVALID;
     LinuxCh* ch = (LinuxCh*)h;
 
+    int s = socket(PF_CAN, SOCK_DGRAM | SOCK_CLOEXEC, CAN_ISOTP);
+    if (s < 0) return (errno == EPROTONOSUPPORT || errno == EAFNOSUPPORT) ? CAN_ERR_NODEV : CAN_ERR_IO;
+
+    struct can_isotp_options opt;
+    socklen_t ol = sizeof(opt);
+    memset(&opt, 0, sizeof(opt));
+    if (getsockopt(s, SOL_CAN_ISOTP, CAN_ISOTP_OPTS, &opt, &ol) != 0){
+        opt.frame_txtime  = CAN_ISOTP_DEFAULT_FRAME_TXTIME;
+        opt.txpad_content = CAN_ISOTP_DEFAULT_PAD_CONTENT;
+        opt.rxpad_content = CAN_ISOTP_DEFAULT_PAD_CONTENT;
+    }
+    opt.flags = CAN_ISOTP_WAIT_TX_DONE;        // write가 마지막 CF를 보낼 때까지 돌아오지 않게
+    if (cfg->padding){
+        opt.flags |= CAN_ISOTP_TX_PADDING;
+        opt.txpad_content = (uint8_t)cfg->padding;
+    }
+    struct can_isotp_fc_options fc = { .bs = cfg->block_size, .stmin = cfg->stmin, .wftmax = 0 };
+    int ok = setsockopt(s, SOL_CAN_ISOTP, CAN_ISOTP_OPTS, &opt, sizeof(opt)) == 0 &&
+             setsockopt(s, SOL_CAN_ISOTP, CAN_ISOTP_RECV_FC, &fc, sizeof(fc)) == 0;
+    if (ok && (cfg->flags & CAN_FRAME_FD)){
+        struct can_isotp_ll_options ll = {
+            .mtu = CANFD_MTU, .tx_dl = CANFD_MAX_DLEN,
+            .tx_flags = (cfg->flags & CAN_FRAME_BRS) ? CANFD_BRS : 0
+        };
+        ok = setsockopt(s, SOL_CAN_ISOTP, CAN_ISOTP_LL_OPTS, &ll, sizeof(ll)) == 0;
+    }
+    if (!ok){ close(s); return CAN_ERR_NODEV; }    // 옵션을 모르는 오래된 모듈
+
+    struct ifreq ifr = {0};
+    memcpy(ifr.ifr_name, ch->ifname, sizeof(ifr.ifr_name));
+    struct sockaddr_can addr = {0};
+    addr.can_family = AF_CAN;
+    if (ioctl(s, SIOCGIFINDEX, &ifr) < 0){ close(s); return CAN_ERR_IO; }
+    addr.can_ifindex = ifr.ifr_ifindex;
+    canid_t eff = (cfg->flags & CAN_FRAME_EXTID) ? CAN_EFF_FLAG : 0;
+    addr.can_addr.tp.tx_id = cfg->tx_id | eff;
+    addr.can_addr.tp.rx_id = cfg->rx_id | eff;
+    if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) < 0){ close(s); return CAN_ERR_IO; }
+
+    LinuxTp* tp = (LinuxTp*)calloc(1, sizeof(LinuxTp));
+    if (!tp){ close(s); return CAN_ERR_MEMORY; }
+    tp->sock = s;
+    *link = tp;
+    return CAN_OK;
+}
+
+static can_err_t v_ch_isotp_send(Adapter* self, void* link, const void* data, size_t len, uint32_t timeout_ms){
+    (void)self;
+    LinuxTp* tp = (LinuxTp*)link;
+    // POLLOUT: 앞선 전송이 끝났을 때 (0이면 제한 없음)
+    struct pollfd pfd = { .fd = tp->sock, .events = POLLOUT };
+    int r = poll(&pfd, 1, timeout_ms ? (int)timeout_ms : -1);
+    if (r <= 0) return (r == 0) ? CAN_ERR_TIMEOUT : CAN_ERR_IO;
+    ssize_t n = write(tp->sock, data, len);
+    if (n == (ssize_t)len) return CAN_OK;
+    return n < 0 ? isotp_errno(errno) : CAN_ERR_IO;
+}
+
+static can_err_t v_ch_isotp_recv(Adapter* self, void* link, void* buf, size_t cap, size_t* len, uint32_t timeout_ms){
+    (void)self;
+    LinuxTp* tp = (LinuxTp*)link;
+    *len = 0;
+    struct pollfd pfd = { .fd = tp->sock, .events = POLLIN };
+    int r = poll(&pfd, 1, (int)timeout_ms);
+    if (r <= 0) return (r == 0) ? CAN_ERR_TIMEOUT : CAN_ERR_IO;
+
+    struct iovec iov = { .iov_base = buf, .iov_len = cap };
+    struct msghdr mh = { .msg_iov = &iov, .msg_iovlen = 1 };
+    ssize_t n = recvmsg(tp->sock, &mh, MSG_DONTWAIT);
+    if (n < 0) return (errno == EAGAIN) ? CAN_ERR_TIMEOUT : isotp_errno(errno);
+    *len = (size_t)n;
+    return (mh.msg_flags & MSG_TRUNC) ? CAN_ERR_INVALID : CAN_OK;
+}
+
+static void v_ch_isotp_close(Adapter* self, void* link){
+    (void)self;
+    LinuxTp* tp = (LinuxTp*)link;
+    if (!tp) return;
+    close(tp->sock);
+    free(tp);
+}
+#endif
+
+/* ====== 게이트웨이 경로 (커널 CAN_GW) ======
+ * 규칙은 프로세스가 끝나도 커널에 남으므로 uid를 (src, dst, 필터, 플래그)에서 정한다.
+ * 비정상 종료 후 다시 걸면 남아 있던 규칙의 고침 값만 바뀌고 같은 프레임이 두 번 전달되지 않는다.
+ * 같은 uid를 이 프로세스가 이미 쓰고 있으면(같은 필터의 경로를 두 번) 둘째는 사용자 공간으로.
+ */
+typedef struct LinuxRoute {
+    char                src[IFNAMSIZ];
+    char                dst[IFNAMSIZ];
+    CanGwRule           rule;
+    struct LinuxRoute*  next;
+} LinuxRoute;
+
+static uint32_t gw_uid(const char* src, const char* dst, const struct can_filter* flt, uint8_t flags){
+    uint32_t h = 2166136261u;   // FNV-1a
+    const unsigned char* parts[] = { (const unsigned char*)src, (const unsigned char*)dst };
+    for (int k = 0; k < 2; ++k){
+        for (const unsigned char* p = parts[k]; *p; ++p) h = (h ^ *p) * 16777619u;
+        h = (h ^ 0xFFu) * 16777619u;
+    }
+    uint32_t v[3] = { flt->can_id, flt->can_mask, flags };
+    const unsigned char* b = (const unsigned char*)v;
+    for (size_t i = 0; i < sizeof(v); ++i) h = (h ^ b[i]) * 16777619u;
+    return h ? h : 1;
+}
+
+/* CanRouteMod → CGW 고침. ID 연산은 can_id 전체(플래그 비트 포함)에 적용되므로
+ * AND는 플래그 비트를 살려 두고, SET은 EXTID/RTR을 플래그 비트로 옮긴다 */
+static void gw_mod_from(CanGwMod* gm, const CanRouteMod* m){
+    const CanFrame* v = &m->value;
+    memset(gm, 0, sizeof(*gm));
+    gm->type = (uint8_t)(CGW_MOD_AND + m->op);
+    if (m->fields & CAN_ROUTE_MOD_ID)    gm->modtype |= CGW_MOD_ID;
+    if (m->fields & CAN_ROUTE_MOD_LEN)   gm->modtype |= CGW_MOD_LEN;
+    if (m->fields & CAN_ROUTE_MOD_DATA)  gm->modtype |= CGW_MOD_DATA;
+    if (m->fields & CAN_ROUTE_MOD_FLAGS) gm->modtype |= CGW_MOD_FLAGS;
+
+    canid_t id = v->id & CAN_EFF_MASK;
+    switch (m->op){
+    case CAN_ROUTE_AND: id |= CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG; break;
+    case CAN_ROUTE_SET:
+        id = (v->flags & CAN_FRAME_EXTID) ? (id | CAN_EFF_FLAG) : (id & CAN_SFF_MASK);
+        if (v->flags & CAN_FRAME_RTR) id |= CAN_RTR_FLAG;
+        break;
+    default: break;
+    }
+    gm->cf.can_id = id;
+    gm->cf.len    = v->dlc;
+    if (v->flags & CAN_FRAME_BRS) gm->cf.flags |= CANFD_BRS;
+    if (v->flags & CAN_FRAME_ESI) gm->cf.flags |= CANFD_ESI;
+    memcpy(gm->cf.data, v->data, CANFD_MAX_DLEN);
+}
+
+static can_err_t v_ch_route_add(Adapter* self, AdapterHandle src, AdapterHandle dst, const CanRouteRule* rule, void** route){
+    (void)self;
+    if (!src || !dst || !rule || !route) return CAN_ERR_INVALID;
+    LinuxCh* s = (LinuxCh*)src;
+    LinuxCh* d = (LinuxCh*)dst;
+    LinuxPriv* ad = s->ad;
+
+    LinuxRoute* lr = (LinuxRoute*)calloc(1, sizeof(LinuxRoute));
+    if (!lr) return CAN_ERR_MEMORY;
+    memcpy(lr->src, s->ifname, IFNAMSIZ);
+    memcpy(lr->dst, d->ifname, IFNAMSIZ);
+    lr->rule.filter.can_mask = rule->mask & CAN_EFF_MASK;
+    lr->rule.filter.can_id   = rule->id & lr->rule.filter.can_mask;
+    // ECHO: dst로 나간 프레임이 이 호스트의 다른 소켓에도 보이게 (사용자 공간 전달과 같게)
+    lr->rule.flags      = CGW_FLAGS_CAN_ECHO | ((rule->flags & CAN_ROUTE_FD) ? CGW_FLAGS_CAN_FD : 0);
+    lr->rule.limit_hops = 1;
+    for (size_t i = 0; i < rule->nMods && i < CGW_MOD_FUNCS; ++i) gw_mod_from(&lr->rule.mods[i], &rule->mods[i]);
+    lr->rule.uid = gw_uid(lr->src, lr->dst, &lr->rule.filter, lr->rule.flags);
+
+    pthread_mutex_lock(&ad->mtx);
+    for (LinuxRoute* o = ad->routes; o; o = o->next){
+        if (o->rule.uid == lr->rule.uid){
+            pthread_mutex_unlock(&ad->mtx);
+            free(lr);
+            return CAN_ERR_NODEV;
+        }
+    }
+    int r = canlink_gw_add(lr->src, lr->dst, &lr->rule);
+    if (r == 0){
+        lr->next = ad->routes;
+        ad->routes = lr;
+    }
+    pthread_mutex_unlock(&ad->mtx);
+    if (r == 0){
+        *route = lr;
+        return CAN_OK;
+    }
+    free(lr);
+    if (r == -ENOMEM) return CAN_ERR_MEMORY;
+    fprintf(stderr, "cangw(%s->%s): %s, forwarding in user space\n", s->ifname, d->ifname, strerror(-r));
+    return (r == -EPERM || r == -EACCES) ? CAN_ERR_PERMISSION : CAN_ERR_NODEV;
+}
+
+static can_err_t v_ch_route_stats(Adapter* self, void* route, CanRouteStats* io){
+    (void)self;
+    LinuxRoute* lr = (LinuxRoute*)route;
+    if (!lr || !io) return CAN_ERR_INVALID;
+    CanGwStats st;
+    int r = canlink_gw_stats(lr->rule.uid, &st);
+    if (r == -ENOENT) return CAN_ERR_STATE;     // 인터페이스가 사라지면서 커널이 지움 등
+    if (r) return CAN_ERR_IO;
+    io->forwarded += st.handled;
+    io->dropped   += st.dropped;
+    io->deleted   += st.deleted;
+    return CAN_OK;
+}
+
+static void v_ch_route_del(Adapter* self, void* route){
+    LinuxPriv* ad = (LinuxPriv*)self->priv;
+    LinuxRoute* lr = (LinuxRoute*)route;
+    if (!lr) return;
+    pthread_mutex_lock(&ad->mtx);
+    LinuxRoute** pp = &ad->routes;
+    while (*pp && *pp != lr) pp = &(*pp)->next;
+    if (*pp) *pp = lr->next;
+    int r = canlink_gw_del(lr->src, lr->dst, &lr->rule);
+    pthread_mutex_unlock(&ad->mtx);
+    if (r && r != -ENODEV) fprintf(stderr, "cangw(%s->%s): delete failed: %s\n", lr->src, lr->dst, strerror(-r));
+    free(lr);
+}
+
+/* ====== 스레드 정책 (can_set_thread_policy) ======
+ * 수신/송신/Job이 모두 reactor 스레드 하나에서 돌므로 그 스레드 하나에 건다.
+ * 권한이 없으면 걸 수 있는 만큼만 걸고 (fallback_nice 등) 계속 동작한다.
+ */
+static can_err_t thread_policy_apply(LinuxPriv* ad, const CanThreadPolicy* p){
+    unsigned got = 0;
+    int r = canrt_set_thread(ad->tid, p->priority, p->cpu_mask, p->fallback_nice, &got);
+    if (r == -EPERM){
+        if (got & CANRT_NICE)
+            fprintf(stderr, "canrt: SCHED_FIFO needs CAP_SYS_NICE or RLIMIT_RTPRIO, reactor runs at nice %d\n", p->fallback_nice);
+        else
+            fprintf(stderr, "canrt: SCHED_FIFO needs CAP_SYS_NICE or RLIMIT_RTPRIO, reactor keeps the default scheduler\n");
+    } else if (r){
+        fprintf(stderr, "canrt: reactor thread policy: %s\n", strerror(-r));
+    }
+    int m = p->lock_memory ? canrt_lock_memory() : 0;
+    if (m) fprintf(stderr, "canrt: mlockall: %s (needs CAP_IPC_LOCK or unlimited memlock)\n", strerror(-m));
+
+    if (r == -EINVAL) return CAN_ERR_INVALID;       // 없는 CPU만 고름 등
+    if (r == -EPERM || m == -EPERM || m == -ENOMEM) return CAN_ERR_PERMISSION;
+    return (r || m) ? CAN_ERR_IO : CAN_OK;
+}
+
+static can_err_t v_set_thread_policy(Adapter* self, const CanThreadPolicy* policy){
+    if (!policy) return CAN_ERR_INVALID;
+    return thread_policy_apply((LinuxPriv*)self->priv, policy);
+}
+
+/* ====== Job 등록/취소/확장 ====== */
+static can_err_t job_add(LinuxCh* ch, int* id, const CanFrame* fr, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms){
+    LinuxPriv* ad = ch->ad;
     Job* j = (Job*)calloc(1, sizeof(Job));
-    if (!j) return CAN_ERR_INVALID;
-    j->fr = *fr;
-    j->period_ms = period_ms;
-    j->next_due_ms = 0;
-    j->prep = NULL;
-    j->prep_user = NULL;
-
-    pthread_mutex_lock(&ch->mtx);
+    if (!j) return CAN_ERR_MEMORY;
+    if (fr) j->fr = *fr;
+    j->ch = ch;
+    j->period_ns = (uint64_t)period_ms * 1000000ULL;
+    j->next_due_ns = now_ns() + j->period_ns;
+    j->prep = prep;
+    j->prep_user = prep_user;
+    j->st.period_ms = period_ms;
+
+    pthread_mutex_lock(&ad->mtx);
+    // 송신 확인을 받는 채널(기록 중)은 BCM에 맡기지 않는다 (커널이 보낸 시점을 알 수 없음)
+    if (!prep && ch->bcm_jobs && !ch->on_tx && bcm_start(ch, j)){
+        j->id = ++ch->next_job_id;
+        j->next = ch->jobs;
+        ch->jobs = j;
+        pthread_mutex_unlock(&ad->mtx);
+        *id = j->id;
+        return CAN_OK;
+    }
+    if (!jobs_reserve(ad, ad->heap_n + 1)){
+        pthread_mutex_unlock(&ad->mtx);
+        free(j);
+        return CAN_ERR_MEMORY;
+    }
     j->id = ++ch->next_job_id;
     j->next = ch->jobs;
     ch->jobs = j;
-    pthread_mutex_unlock(&ch->mtx);
+    ad->heap[ad->heap_n++] = j;
+    heap_up(ad, ad->heap_n - 1);
+    int earliest = (ad->heap[0] == j);
+    pthread_mutex_unlock(&ad->mtx);
 
     *id = j->id;
-    
+    if (earliest) reactor_wake(ad);   // 타이머를 더 이른 시각으로 재설정
     return CAN_OK;
 }
 
+static can_err_t v_ch_register_job_dynamic(Adapter* self, int* id, AdapterHandle h, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms)
+{
+    (void)self;
+    if (!h || !id || !prep || period_ms == 0) return CAN_ERR_INVALID;
+    return job_add((LinuxCh*)h, id, NULL, prep, prep_user, period_ms);
+}
+
+static can_err_t v_ch_register_job(Adapter* self, int* id, AdapterHandle h, const CanFrame* fr, uint32_t period_ms)
+{
+    (void)self;
+    if (!h || !id || !fr || period_ms == 0) return CAN_ERR_INVALID;
+    return job_add((LinuxCh*)h, id, fr, NULL, NULL, period_ms);
+}
+
 static can_err_t v_ch_cancel_job(Adapter* self, AdapterHandle h, int jobId){
     (void)self;
     if (!h || jobId<=0) return CAN_ERR_INVALID;
     LinuxCh* ch = (LinuxCh*)h;
+    LinuxPriv* ad = ch->ad;
 
     can_err_t ret = CAN_ERR_INVALID;
-    pthread_mutex_lock(&ch->mtx);
+    pthread_mutex_lock(&ad->mtx);
     Job** pp = &ch->jobs;
     while (*pp){
         if ((*pp)->id == jobId){
-            Job* del = *pp; *pp = del->next; free(del);
+            Job* del = *pp; *pp = del->next;
+            if (del->bcm){
+                struct canfd_frame lf = { .can_id = del->bcm_id };
+                bcm_send(ch, TX_DELETE, 0, &lf, del->bcm_mtu, 0);
+                atomic_fetch_sub(&ch->bcm_tx, 1);
+            }
+            heap_remove(ad, del);
+            // 진행 중인 송신 배치가 참조할 수 있으므로 배치 끝에 해제
+            del->next = ad->job_graveyard;
+            ad->job_graveyard = del;
             ret = CAN_OK; break;
         }
         pp = &(*pp)->next;
     }
-    pthread_mutex_unlock(&ch->mtx);
+    pthread_mutex_unlock(&ad->mtx);
+    if (ret == CAN_OK) reactor_wake(ad);
+    return ret;
+}
+
+static can_err_t v_ch_get_job_stats(Adapter* self, AdapterHandle h, int jobId, CanJobStats* out){
+    (void)self;
+    if (!h || jobId<=0 || !out) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+
+    can_err_t ret = CAN_ERR_INVALID;
+    pthread_mutex_lock(&ch->ad->mtx);
+    for (Job* j = ch->jobs; j; j = j->next){
+        if (j->id == jobId){
+            pthread_mutex_lock(&ch->tx_mtx);
+            *out = j->st;
+            pthread_mutex_unlock(&ch->tx_mtx);
+            // BCM Job은 커널이 보내므로 시작 이후 경과 주기 수로 추정 (지연/지터는 측정 불가)
+            if (j->bcm) out->sent = bcm_sent(j, now_ns());
+            ret = CAN_OK; break;
+        }
+    }
+    pthread_mutex_unlock(&ch->ad->mtx);
+    return ret;
+}
+
+/* 정적 Job의 프레임을 취소/재등록 없이 바꾼다.
+ * heap Job은 다음 송신 스냅샷부터, BCM Job은 TX_SETUP(타이머 플래그 없음)으로 커널 안의
+ * 프레임만 교체한다. 주기/위상은 그대로. ID가 바뀌면 BCM 작업 키가 달라지므로 지우고 다시 건다. */
+static can_err_t v_ch_update_job(Adapter* self, AdapterHandle h, int jobId, const CanFrame* fr){
+    (void)self;
+    if (!h || jobId<=0 || !fr) return CAN_ERR_INVALID;
+    LinuxCh* ch = (LinuxCh*)h;
+
+    can_err_t ret = CAN_ERR_INVALID;
+    pthread_mutex_lock(&ch->ad->mtx);
+    for (Job* j = ch->jobs; j; j = j->next){
+        if (j->id != jobId) continue;
+        if (j->bcm){
+            struct canfd_frame lf;
+            size_t mtu = linux_from_canframe(ch, fr, &lf);
+            if (lf.can_id == j->bcm_id && mtu == j->bcm_mtu){
+                if (bcm_send(ch, TX_SETUP, 0, &lf, mtu, 0) != 0){ ret = CAN_ERR_IO; break; }
+            } else {
+                if (!bcm_id_free(ch, lf.can_id, mtu, j)) break;
+                uint64_t t = now_ns();
+                struct canfd_frame old = { .can_id = j->bcm_id };
+                bcm_send(ch, TX_DELETE, 0, &old, j->bcm_mtu, 0);
+                if (bcm_send(ch, TX_SETUP, SETTIMER | STARTTIMER, &lf, mtu, j->period_ns) != 0){ ret = CAN_ERR_IO; break; }
+                j->bcm_base = bcm_sent(j, t);
+                j->bcm_start_ns = t;
+                j->bcm_id = lf.can_id;
+                j->bcm_mtu = mtu;
+            }
+        }
+        j->fr = *fr;
+        ret = CAN_OK;
+        break;
+    }
+    pthread_mutex_unlock(&ch->ad->mtx);
     return ret;
 }
 
 static void v_destroy(Adapter* self){
     if (!self) return;
-    free(self->priv);
+    LinuxPriv* ad = (LinuxPriv*)self->priv;
+    if (ad){
+        pthread_mutex_lock(&ad->mtx);
+        ad->running = 0;
+        pthread_mutex_unlock(&ad->mtx);
+        reactor_wake(ad);
+        pthread_join(ad->thread, NULL);
+
+        // 닫히지 않은 채널이 남아 있으면 정리
+        LinuxCh* ch = ad->chans;
+        while (ch){ LinuxCh* nx = ch->next; free_channel(ch); ch = nx; }
+        Job* gj = ad->job_graveyard;
+        while (gj){ Job* nx = gj->next; free(gj); gj = nx; }
+
+        close(ad->tfd); close(ad->evfd); close(ad->epfd);
+        pthread_cond_destroy(&ad->cv);
+        pthread_mutex_destroy(&ad->mtx);
+        free(ad->heap);
+        free(ad->pend); free(ad->txf); free(ad->txm); free(ad->txv);
+        free(ad);
+    }
     free(self);
 }
 
+static int reactor_start(LinuxPriv* ad){
+    ad->epfd = epoll_create1(EPOLL_CLOEXEC);
+    ad->evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ad->tfd  = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (ad->epfd < 0 || ad->evfd < 0 || ad->tfd < 0) goto fail;
+
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = &ad->evfd };
+    if (epoll_ctl(ad->epfd, EPOLL_CTL_ADD, ad->evfd, &ev) != 0) goto fail;
+    ev.data.ptr = &ad->tfd;
+    if (epoll_ctl(ad->epfd, EPOLL_CTL_ADD, ad->tfd, &ev) != 0) goto fail;
+
+    if (pthread_mutex_init(&ad->mtx, NULL) != 0) goto fail;
+    if (pthread_cond_init(&ad->cv, NULL) != 0){ pthread_mutex_destroy(&ad->mtx); goto fail; }
+
+    // 스택 크기는 만들 때만 정할 수 있다 (can_init 전의 can_set_thread_policy)
+    const CanThreadPolicy* pol = can_thread_policy_get();
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (pol->stack_size)
+        pthread_attr_setstacksize(&attr, pol->stack_size < PTHREAD_STACK_MIN ? PTHREAD_STACK_MIN : pol->stack_size);
+
+    ad->running = 1;
+    int cr = pthread_create(&ad->thread, &attr, reactor_fn, ad);
+    pthread_attr_destroy(&attr);
+    if (cr != 0){
+        pthread_cond_destroy(&ad->cv); pthread_mutex_destroy(&ad->mtx);
+        goto fail;
+    }
+    pthread_mutex_lock(&ad->mtx);
+    while (!ad->tid) pthread_cond_wait(&ad->cv, &ad->mtx);
+    pthread_mutex_unlock(&ad->mtx);
+    if (pol->priority || pol->cpu_mask || pol->lock_memory) thread_policy_apply(ad, pol);
+    return 0;
+
+fail:
+    if (ad->tfd  >= 0) close(ad->tfd);
+    if (ad->evfd >= 0) close(ad->evfd);
+    if (ad->epfd >= 0) close(ad->epfd);
+    return -1;
+}
+
 /* ====== 팩토리 ====== */
 Adapter* adapter_linux_new(void){
     Adapter* ad = (Adapter*)calloc(1, sizeof(Adapter));
     if (!ad) return NULL;
     LinuxPriv* priv = (LinuxPriv*)calloc(1, sizeof(LinuxPriv));
     if (!priv){ free(ad); return NULL; }
+    if (reactor_start(priv) != 0){ free(priv); free(ad); return NULL; }
 
     static const AdapterVTable V = {
         .probe                      = v_probe,
@@ -521,12 +2026,29 @@ Adapter* adapter_linux_new(void){
         .ch_close                   = v_ch_close,
         .ch_set_callbacks           = v_ch_set_callbacks,
         .write                      = v_write,
-        .read                       = v_read,
         .status                     = v_status,
         .recover                    = v_recover,
         .ch_register_job            = v_ch_register_job,
         .ch_register_job_dynamic    = v_ch_register_job_dynamic,
         .ch_cancel_job              = v_ch_cancel_job,
+        .ch_set_filters             = v_ch_set_filters,
+        .ch_get_job_stats           = v_ch_get_job_stats,
+        .ch_get_bus_stats           = v_ch_get_bus_stats,
+        .ch_update_job              = v_ch_update_job,
+        .ch_watch_add               = v_ch_watch_add,
+        .ch_watch_del               = v_ch_watch_del,
+        .write_batch                = v_write_batch,
+        .ch_route_add               = v_ch_route_add,
+        .ch_route_stats             = v_ch_route_stats,
+        .ch_route_del               = v_ch_route_del,
+        .set_thread_policy          = v_set_thread_policy,
+        .ch_set_tx_callback         = v_ch_set_tx_callback,
+#ifdef LINUX_HAVE_ISOTP
+        .ch_isotp_open              = v_ch_isotp_open,
+        .ch_isotp_send              = v_ch_isotp_send,
+        .ch_isotp_recv              = v_ch_isotp_recv,
+        .ch_isotp_close             = v_ch_isotp_close,
+#endif
         .destroy                    = v_destroy
     };
     ad->v = &V; ad->priv = priv;
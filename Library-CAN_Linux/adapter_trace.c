@@ -0,0 +1,631 @@
+// adapter_trace.c — 트레이스 기록(CAN_DEVICE_RECORD) / 재생(CAN_DEVICE_REPLAY) 어댑터 (Linux)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "adapter.h"
+#include "cantrace.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * 기록: Linux 어댑터를 안에 두고 모든 훅을 그대로 넘기면서, 수신 프레임(on_rx, 내용 변화 감시 콜백)과
+ *       실제로 나간 송신 프레임(ch_set_tx_callback: can_send, TX 큐, 주기 Job)을 채널별 트레이스 파일에 덧붙인다.
+ *       기록 중인 채널의 Job은 BCM에 맡기지 않고 reactor가 보낸다 (송신 시점을 알기 위해).
+ *       기록되지 않는 것: 커널 ISO-TP 소켓 프레임 (채널 간 전달은 ch_route_add를 넘기지 않으므로 채널 구독 경로로 기록됨).
+ *       파일은 mmap해 두고 레코드 자리를 atomic으로 잡으므로 RX(reactor)/송신 스레드가 락 없이 쓴다.
+ * 재생: 버스 없이 트레이스의 수신 레코드를 채널별 스레드가 기록된 간격(× 1/speed)대로 on_rx에 올린다.
+ *       기준 시각이 어댑터 생성 시각 하나라서 여러 채널을 열어도 기록 때의 상대 시점이 유지된다.
+ *       송신은 버리고(통계만), Job은 등록만 받는다.
+ */
+#define TRACE_DEFAULT_BYTES  (64u << 20)
+
+Adapter* adapter_linux_new(void);
+
+static inline uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void trace_cfg_copy(CanTraceConfig* out, char* dir, size_t cap){
+    *out = *can_trace_get_config();
+    snprintf(dir, cap, "%s", out->dir && out->dir[0] ? out->dir : ".");
+    out->dir = dir;
+}
+
+static int trace_path(char* out, size_t cap, const CanTraceConfig* tc, const char* name){
+    int n = snprintf(out, cap, "%s/%s.cantrace", tc->dir, name);
+    return n > 0 && (size_t)n < cap;
+}
+
+static can_err_t trace_errno(int e){
+    switch (e){
+    case ENOENT:    return CAN_ERR_NODEV;
+    case EACCES:
+    case EPERM:     return CAN_ERR_PERMISSION;
+    case ENOMEM:    return CAN_ERR_MEMORY;
+    default:        return CAN_ERR_IO;
+    }
+}
+
+/* ========= 기록 ========= */
+typedef struct {
+    Adapter*        inner;          // 실제 버스 (Linux 어댑터)
+    uint64_t        base_ns;        // 레코드 ts 기준 (어댑터 생성 시각)
+    CanTraceConfig  tc;
+    char            dir[256];
+} RecPriv;
+
+struct RecWatch;
+
+typedef struct {
+    AdapterHandle   h;              // 안쪽 Linux 채널
+    adapter_rx_cb_t on_rx;  void* on_rx_user;
+    char            name[16];
+    int             tx_hook;        // 안쪽 어댑터가 송신 확인을 준다 (아니면 write 성공 시점에 기록)
+
+    pthread_mutex_t  wmtx;
+    struct RecWatch* watches;       // 내용 변화 감시 콜백 중계 (wmtx)
+
+    int             fd;
+    uint8_t*        map;
+    size_t          map_len;
+    atomic_size_t   tail;           // 다음 레코드 위치 (넘치면 map_len보다 커진 채로 둔다)
+    atomic_uint_fast64_t dropped;
+    uint64_t        base_ns;
+} RecCh;
+
+#define REC_INNER(self)     (((RecPriv*)(self)->priv)->inner)
+#define REC_H(h)            (((RecCh*)(h))->h)
+
+static void rec_append(RecCh* rc, const CanFrame* f, int dir, uint64_t t){
+    uint8_t len = f->dlc > CAN_FRAME_DATA_MAX ? CAN_FRAME_DATA_MAX : f->dlc;
+    size_t sz = cantrace_rec_size(len);
+    size_t off = atomic_fetch_add_explicit(&rc->tail, sz, memory_order_relaxed);
+    if (off + sz > rc->map_len){
+        atomic_fetch_add_explicit(&rc->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    CanTraceRec* r = (CanTraceRec*)(rc->map + off);
+    r->ts_ns = t > rc->base_ns ? t - rc->base_ns : 0;
+    r->id    = f->id;
+    r->len   = len;
+    r->flags = (uint8_t)f->flags;
+    r->dir   = (uint8_t)dir;
+    memcpy(r + 1, f->data, len);        // 패딩은 새로 늘린 파일이라 0
+    // size8을 마지막에 써야 읽는 쪽이 반쯤 쓴 레코드를 보지 않는다
+    atomic_thread_fence(memory_order_release);
+    *(volatile uint8_t*)&r->size8 = (uint8_t)(sz / 8);
+}
+
+static void rec_on_rx(const CanFrame* f, void* user){
+    RecCh* rc = (RecCh*)user;
+    rec_append(rc, f, CANTRACE_RX, f->timestamp_ns ? f->timestamp_ns : now_ns());
+    if (rc->on_rx) rc->on_rx(f, rc->on_rx_user);
+}
+
+static void rec_on_tx(const CanFrame* f, uint64_t t, void* user){
+    rec_append((RecCh*)user, f, CANTRACE_TX, t);
+}
+
+/* 내용 변화 감시는 어댑터가 on_rx를 거치지 않고 콜백하므로 중간에서 받아 기록한다.
+ * 커널이 값이 바뀐 프레임만 올려 주므로 트레이스에도 그것만 남는다. */
+typedef struct RecWatch {
+    RecCh*                  rc;
+    int                     id;         // 안쪽 어댑터 감시 ID
+    can_callback_t          cb;
+    can_timeout_callback_t  on_timeout;
+    void*                   user;
+    struct RecWatch*        next;
+} RecWatch;
+
+static void rec_watch_rx(const CanFrame* f, void* user){
+    RecWatch* w = (RecWatch*)user;
+    rec_append(w->rc, f, CANTRACE_RX, f->timestamp_ns ? f->timestamp_ns : now_ns());
+    if (w->cb) w->cb(f, w->user);
+}
+
+static void rec_watch_timeout(uint32_t id, void* user){
+    RecWatch* w = (RecWatch*)user;
+    w->on_timeout(id, w->user);
+}
+
+/* 정상 종료: 끝 위치를 헤더에 남기고 파일을 그 길이로 줄인다 */
+static void rec_finish(RecCh* rc){
+    if (!rc->map) return;
+    size_t lim = atomic_load(&rc->tail);
+    if (lim > rc->map_len) lim = rc->map_len;
+    size_t end = sizeof(CanTraceHeader);
+    const CanTraceRec* r;
+    while ((r = cantrace_at(rc->map, lim, end)) != NULL) end += (size_t)r->size8 * 8u;
+    ((CanTraceHeader*)rc->map)->end = end;
+    munmap(rc->map, rc->map_len);
+    rc->map = NULL;
+    if (ftruncate(rc->fd, (off_t)end) != 0) { /* 크기만 남음, 내용은 end까지 유효 */ }
+    close(rc->fd);
+    uint64_t d = atomic_load(&rc->dropped);
+    if (d) fprintf(stderr, "trace(%s): file full, %llu frames not recorded\n", rc->name, (unsigned long long)d);
+}
+
+static can_err_t r_set_thread_policy(Adapter* self, const CanThreadPolicy* policy){
+    Adapter* in = REC_INNER(self);
+    return in->v->set_thread_policy ? in->v->set_thread_policy(in, policy) : CAN_OK;
+}
+
+static can_err_t r_probe(Adapter* self){
+    Adapter* in = REC_INNER(self);
+    return in->v->probe ? in->v->probe(in) : CAN_OK;
+}
+
+static can_err_t r_ch_open(Adapter* self, const char* name, const CanConfig* cfg, AdapterHandle* out){
+    if (!name || !cfg || !out) return CAN_ERR_INVALID;
+    RecPriv* rp = (RecPriv*)self->priv;
+    char path[320];
+    if (!trace_path(path, sizeof(path), &rp->tc, name)) return CAN_ERR_INVALID;
+
+    RecCh* rc = (RecCh*)calloc(1, sizeof(RecCh));
+    if (!rc) return CAN_ERR_MEMORY;
+    can_err_t e = rp->inner->v->ch_open(rp->inner, name, cfg, &rc->h);
+    if (e != CAN_OK){ free(rc); return e; }
+
+    rc->map_len = rp->tc.max_bytes ? rp->tc.max_bytes : TRACE_DEFAULT_BYTES;
+    if (rc->map_len < sizeof(CanTraceHeader) + 80) rc->map_len = sizeof(CanTraceHeader) + 80;
+    rc->fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (rc->fd < 0 || ftruncate(rc->fd, (off_t)rc->map_len) != 0 ||
+        (rc->map = (uint8_t*)mmap(NULL, rc->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, rc->fd, 0)) == MAP_FAILED){
+        e = trace_errno(errno);
+        if (rc->fd >= 0) close(rc->fd);
+        rp->inner->v->ch_close(rp->inner, rc->h);
+        free(rc);
+        return e;
+    }
+
+    CanTraceHeader* hd = (CanTraceHeader*)rc->map;
+    struct timespec rt;
+    clock_gettime(CLOCK_REALTIME, &rt);
+    memcpy(hd->magic, CANTRACE_MAGIC, sizeof(hd->magic));
+    hd->version  = CANTRACE_VERSION;
+    hd->hdr_size = sizeof(CanTraceHeader);
+    hd->start_unix_ns = (uint64_t)rt.tv_sec*1000000000ULL + (uint64_t)rt.tv_nsec - (now_ns() - rp->base_ns);
+    strncpy(hd->channel, name, sizeof(hd->channel) - 1);
+    hd->bitrate = cfg->bitrate;
+    hd->fd      = cfg->fd;
+    strncpy(rc->name, name, sizeof(rc->name) - 1);
+    rc->base_ns = rp->base_ns;
+    atomic_init(&rc->tail, sizeof(CanTraceHeader));
+    atomic_init(&rc->dropped, 0);
+    pthread_mutex_init(&rc->wmtx, NULL);
+    rc->tx_hook = rp->inner->v->ch_set_tx_callback &&
+                  rp->inner->v->ch_set_tx_callback(rp->inner, rc->h, rec_on_tx, rc) == CAN_OK;
+    *out = (AdapterHandle)rc;
+    return CAN_OK;
+}
+
+static void r_ch_close(Adapter* self, AdapterHandle h){
+    if (!h) return;
+    RecCh* rc = (RecCh*)h;
+    REC_INNER(self)->v->ch_close(REC_INNER(self), rc->h);     // 돌아오면 on_rx가 더 불리지 않는다
+    rec_finish(rc);
+    while (rc->watches){ RecWatch* nx = rc->watches->next; free(rc->watches); rc->watches = nx; }
+    pthread_mutex_destroy(&rc->wmtx);
+    free(rc);
+}
+
+static can_err_t r_ch_set_callbacks(
+    Adapter* self, AdapterHandle h,
+    adapter_rx_cb_t on_rx,  void* on_rx_user,
+    adapter_err_cb_t on_err, void* on_err_user,
+    adapter_bus_cb_t on_bus, void* on_bus_user
+){
+    if (!h) return CAN_ERR_INVALID;
+    RecCh* rc = (RecCh*)h;
+    Adapter* in = REC_INNER(self);
+    rc->on_rx = on_rx; rc->on_rx_user = on_rx_user;
+    return in->v->ch_set_callbacks(in, rc->h, rec_on_rx, rc, on_err, on_err_user, on_bus, on_bus_user);
+}
+
+static can_err_t r_write(Adapter* self, AdapterHandle h, const CanFrame* fr, uint32_t timeout_ms){
+    if (!h || !fr) return CAN_ERR_INVALID;
+    Adapter* in = REC_INNER(self);
+    can_err_t e = in->v->write(in, REC_H(h), fr, timeout_ms);
+    if (e == CAN_OK && !((RecCh*)h)->tx_hook) rec_append((RecCh*)h, fr, CANTRACE_TX, now_ns());
+    return e;
+}
+
+static can_err_t r_write_batch(Adapter* self, AdapterHandle h, const CanFrame* frs, size_t n, size_t* sent, uint32_t timeout_ms){
+    if (!h || (!frs && n) || !sent) return CAN_ERR_INVALID;
+    Adapter* in = REC_INNER(self);
+    can_err_t e;
+    if (in->v->write_batch){
+        e = in->v->write_batch(in, REC_H(h), frs, n, sent, timeout_ms);
+    } else {
+        e = CAN_OK;
+        for (*sent = 0; *sent < n && (e = in->v->write(in, REC_H(h), &frs[*sent], timeout_ms)) == CAN_OK; ++*sent) {}
+    }
+    if (!((RecCh*)h)->tx_hook){
+        uint64_t t = now_ns();
+        for (size_t i = 0; i < *sent; ++i) rec_append((RecCh*)h, &frs[i], CANTRACE_TX, t);
+    }
+    return e;
+}
+
+static can_bus_state_t r_status(Adapter* self, AdapterHandle h){
+    Adapter* in = REC_INNER(self);
+    return in->v->status ? in->v->status(in, REC_H(h)) : CAN_BUS_STATE_ERROR_ACTIVE;
+}
+
+static can_err_t r_recover(Adapter* self, AdapterHandle h){
+    Adapter* in = REC_INNER(self);
+    return in->v->recover ? in->v->recover(in, REC_H(h)) : CAN_OK;
+}
+
+static can_err_t r_ch_register_job(Adapter* self, int* id, AdapterHandle h, const CanFrame* fr, uint32_t period_ms){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_register_job(in, id, REC_H(h), fr, period_ms);
+}
+
+static can_err_t r_ch_register_job_dynamic(Adapter* self, int* id, AdapterHandle h, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_register_job_dynamic(in, id, REC_H(h), prep, prep_user, period_ms);
+}
+
+static can_err_t r_ch_cancel_job(Adapter* self, AdapterHandle h, int jobId){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_cancel_job(in, REC_H(h), jobId);
+}
+
+static can_err_t r_ch_set_filters(Adapter* self, AdapterHandle h, const CanFilter* filters, size_t count){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_set_filters ? in->v->ch_set_filters(in, REC_H(h), filters, count) : CAN_OK;
+}
+
+static can_err_t r_ch_get_job_stats(Adapter* self, AdapterHandle h, int jobId, CanJobStats* out){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_get_job_stats ? in->v->ch_get_job_stats(in, REC_H(h), jobId, out) : CAN_ERR_STATE;
+}
+
+static can_err_t r_ch_update_job(Adapter* self, AdapterHandle h, int jobId, const CanFrame* fr){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_update_job ? in->v->ch_update_job(in, REC_H(h), jobId, fr) : CAN_ERR_STATE;
+}
+
+static can_err_t r_ch_watch_add(Adapter* self, AdapterHandle h, const CanChangeFilter* flt,
+                                can_callback_t cb, can_timeout_callback_t on_timeout, void* user, int* watchId){
+    Adapter* in = REC_INNER(self);
+    if (!in->v->ch_watch_add) return CAN_ERR_STATE;
+    RecCh* rc = (RecCh*)h;
+    RecWatch* w = (RecWatch*)calloc(1, sizeof(RecWatch));
+    if (!w) return CAN_ERR_MEMORY;
+    w->rc = rc; w->cb = cb; w->on_timeout = on_timeout; w->user = user;
+    can_err_t e = in->v->ch_watch_add(in, rc->h, flt, rec_watch_rx, on_timeout ? rec_watch_timeout : NULL, w, &w->id);
+    if (e != CAN_OK){ free(w); return e; }
+    pthread_mutex_lock(&rc->wmtx);
+    w->next = rc->watches;
+    rc->watches = w;
+    pthread_mutex_unlock(&rc->wmtx);
+    *watchId = w->id;
+    return CAN_OK;
+}
+
+static can_err_t r_ch_watch_del(Adapter* self, AdapterHandle h, int watchId){
+    Adapter* in = REC_INNER(self);
+    if (!in->v->ch_watch_del) return CAN_ERR_STATE;
+    RecCh* rc = (RecCh*)h;
+    can_err_t e = in->v->ch_watch_del(in, rc->h, watchId);     // 돌아오면 그 감시 콜백이 더 불리지 않는다
+    pthread_mutex_lock(&rc->wmtx);
+    RecWatch** pp = &rc->watches;
+    while (*pp && (*pp)->id != watchId) pp = &(*pp)->next;
+    RecWatch* del = *pp;
+    if (del) *pp = del->next;
+    pthread_mutex_unlock(&rc->wmtx);
+    free(del);
+    return e;
+}
+
+static can_err_t r_ch_get_bus_stats(Adapter* self, AdapterHandle h, CanStats* io){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_get_bus_stats ? in->v->ch_get_bus_stats(in, REC_H(h), io) : CAN_OK;
+}
+
+// ISO-TP는 링크를 안쪽 어댑터 것 그대로 쓴다 (커널 ISO-TP 프레임은 기록되지 않음)
+static can_err_t r_ch_isotp_open(Adapter* self, AdapterHandle h, const CanIsoTpConfig* cfg, void** link){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_isotp_open ? in->v->ch_isotp_open(in, REC_H(h), cfg, link) : CAN_ERR_NODEV;
+}
+
+static can_err_t r_ch_isotp_send(Adapter* self, void* link, const void* data, size_t len, uint32_t timeout_ms){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_isotp_send(in, link, data, len, timeout_ms);
+}
+
+static can_err_t r_ch_isotp_recv(Adapter* self, void* link, void* buf, size_t cap, size_t* len, uint32_t timeout_ms){
+    Adapter* in = REC_INNER(self);
+    return in->v->ch_isotp_recv(in, link, buf, cap, len, timeout_ms);
+}
+
+static void r_ch_isotp_close(Adapter* self, void* link){
+    Adapter* in = REC_INNER(self);
+    in->v->ch_isotp_close(in, link);
+}
+
+static void r_destroy(Adapter* self){
+    if (!self) return;
+    RecPriv* rp = (RecPriv*)self->priv;
+    if (rp){
+        if (rp->inner) rp->inner->v->destroy(rp->inner);
+        free(rp);
+    }
+    free(self);
+}
+
+/* ========= 재생 ========= */
+typedef struct {
+    uint64_t        start_ns;       // 레코드 ts 0에 해당하는 시각 (어댑터 생성 + start_delay_ms)
+    CanTraceConfig  tc;
+    char            dir[256];
+} RepPriv;
+
+typedef struct {
+    RepPriv*        rp;
+    char            name[16];
+    int             fd;
+    const uint8_t*  map;
+    size_t          map_len;        // 파일 크기
+    size_t          size;           // 유효 범위 (헤더 end 또는 파일 크기)
+    uint64_t        span_ns;        // 마지막 수신 레코드 ts (반복 재생 한 바퀴 길이)
+
+    adapter_rx_cb_t on_rx;  void* on_rx_user;
+    pthread_t       thread;
+    int             started;
+    pthread_mutex_t mtx;
+    pthread_cond_t  cv;             // CLOCK_MONOTONIC
+    atomic_int      stop;
+
+    int             bitrate, dbitrate;
+    atomic_int      next_job_id;
+    atomic_uint_fast64_t tx_frames, tx_bytes, tx_bus_ns;
+} RepCh;
+
+/* due까지 기다린다. 반환: 1이면 채널이 닫히는 중 */
+static int replay_wait(RepCh* c, uint64_t due){
+    if (now_ns() >= due) return atomic_load_explicit(&c->stop, memory_order_relaxed);
+    struct timespec ts = { (time_t)(due / 1000000000ULL), (long)(due % 1000000000ULL) };
+    pthread_mutex_lock(&c->mtx);
+    while (!atomic_load(&c->stop) && now_ns() < due)
+        if (pthread_cond_timedwait(&c->cv, &c->mtx, &ts) == ETIMEDOUT) break;
+    pthread_mutex_unlock(&c->mtx);
+    return atomic_load(&c->stop);
+}
+
+static void* replay_fn(void* arg){
+    RepCh* c = (RepCh*)arg;
+    const CanTraceConfig* tc = &c->rp->tc;
+    uint32_t loops = tc->loops ? tc->loops : 1;
+    double scale = tc->speed > 0 ? 1.0 / tc->speed : 0.0;
+    uint64_t hdr = ((const CanTraceHeader*)c->map)->hdr_size;
+
+    for (uint32_t l = 0; l < loops; ++l){
+        const CanTraceRec* r;
+        for (size_t off = hdr; (r = cantrace_at(c->map, c->size, off)) != NULL; off += (size_t)r->size8 * 8u){
+            if (r->dir != CANTRACE_RX) continue;
+            if (scale > 0){
+                uint64_t t = (uint64_t)l * c->span_ns + r->ts_ns;
+                if (replay_wait(c, c->rp->start_ns + (uint64_t)((double)t * scale))) return NULL;
+            } else if (atomic_load_explicit(&c->stop, memory_order_relaxed)) {
+                return NULL;
+            }
+            CanFrame f;
+            cantrace_to_frame(r, &f);
+            f.timestamp_ns = now_ns();
+            c->on_rx(&f, c->on_rx_user);
+        }
+    }
+    if (tc->on_done) tc->on_done(c->name, tc->user);
+    return NULL;
+}
+
+static can_err_t p_probe(Adapter* self){
+    (void)self;
+    return CAN_OK;
+}
+
+static can_err_t p_ch_open(Adapter* self, const char* name, const CanConfig* cfg, AdapterHandle* out){
+    if (!name || !cfg || !out) return CAN_ERR_INVALID;
+    RepPriv* rp = (RepPriv*)self->priv;
+    char path[320];
+    if (!trace_path(path, sizeof(path), &rp->tc, name)) return CAN_ERR_INVALID;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return trace_errno(errno);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CanTraceHeader)){ close(fd); return CAN_ERR_INVALID; }
+    void* m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (m == MAP_FAILED){ can_err_t e = trace_errno(errno); close(fd); return e; }
+
+    const CanTraceHeader* hd = (const CanTraceHeader*)m;
+    if (memcmp(hd->magic, CANTRACE_MAGIC, sizeof(hd->magic)) != 0 || hd->version != CANTRACE_VERSION ||
+        hd->hdr_size < sizeof(CanTraceHeader) || hd->hdr_size > (size_t)st.st_size){
+        munmap(m, (size_t)st.st_size); close(fd);
+        return CAN_ERR_INVALID;
+    }
+
+    RepCh* c = (RepCh*)calloc(1, sizeof(RepCh));
+    if (!c){ munmap(m, (size_t)st.st_size); close(fd); return CAN_ERR_MEMORY; }
+    c->rp = rp;
+    strncpy(c->name, name, sizeof(c->name) - 1);
+    c->fd = fd;
+    c->map = (const uint8_t*)m;
+    c->map_len = (size_t)st.st_size;
+    c->size = hd->end && hd->end <= (uint64_t)st.st_size ? (size_t)hd->end : (size_t)st.st_size;
+    const CanTraceRec* r;
+    for (size_t off = hd->hdr_size; (r = cantrace_at(c->map, c->size, off)) != NULL; off += (size_t)r->size8 * 8u)
+        if (r->dir == CANTRACE_RX && r->ts_ns > c->span_ns) c->span_ns = r->ts_ns;
+
+    pthread_condattr_t ca;
+    pthread_condattr_init(&ca);
+    pthread_condattr_setclock(&ca, CLOCK_MONOTONIC);
+    pthread_cond_init(&c->cv, &ca);
+    pthread_condattr_destroy(&ca);
+    pthread_mutex_init(&c->mtx, NULL);
+    atomic_init(&c->stop, 0);
+    atomic_init(&c->next_job_id, 0);
+    c->bitrate  = cfg->bitrate;
+    c->dbitrate = cfg->fd ? cfg->dataBitrate : 0;
+    *out = (AdapterHandle)c;
+    return CAN_OK;
+}
+
+static void p_ch_close(Adapter* self, AdapterHandle h){
+    (void)self;
+    if (!h) return;
+    RepCh* c = (RepCh*)h;
+    pthread_mutex_lock(&c->mtx);
+    atomic_store(&c->stop, 1);
+    pthread_cond_broadcast(&c->cv);
+    pthread_mutex_unlock(&c->mtx);
+    if (c->started){
+        // on_done 안에서 닫으면 스레드는 콜백에서 돌아와 c를 건드리지 않고 끝난다
+        if (pthread_equal(pthread_self(), c->thread)) pthread_detach(c->thread);
+        else pthread_join(c->thread, NULL);
+    }
+    munmap((void*)c->map, c->map_len);
+    close(c->fd);
+    pthread_cond_destroy(&c->cv);
+    pthread_mutex_destroy(&c->mtx);
+    free(c);
+}
+
+// 채널이 콜백을 걸면(can_open 안) 재생 시작
+static can_err_t p_ch_set_callbacks(
+    Adapter* self, AdapterHandle h,
+    adapter_rx_cb_t on_rx,  void* on_rx_user,
+    adapter_err_cb_t on_err, void* on_err_user,
+    adapter_bus_cb_t on_bus, void* on_bus_user
+){
+    (void)self; (void)on_err; (void)on_err_user; (void)on_bus; (void)on_bus_user;
+    if (!h) return CAN_ERR_INVALID;
+    RepCh* c = (RepCh*)h;
+    if (c->started || !on_rx) return c->started ? CAN_ERR_STATE : CAN_OK;
+    c->on_rx = on_rx; c->on_rx_user = on_rx_user;
+    if (pthread_create(&c->thread, NULL, replay_fn, c) != 0) return CAN_ERR_MEMORY;
+    c->started = 1;
+    return CAN_OK;
+}
+
+static can_err_t p_write(Adapter* self, AdapterHandle h, const CanFrame* fr, uint32_t timeout_ms){
+    (void)self; (void)timeout_ms;
+    if (!h || !fr) return CAN_ERR_INVALID;
+    RepCh* c = (RepCh*)h;
+    atomic_fetch_add_explicit(&c->tx_frames, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->tx_bytes, fr->dlc, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->tx_bus_ns, can_frame_bus_time_ns(fr, c->bitrate, c->dbitrate), memory_order_relaxed);
+    return CAN_OK;
+}
+
+// 재생 중에는 보낼 버스가 없으므로 Job은 ID만 내주고 송신하지 않는다
+static can_err_t p_ch_register_job(Adapter* self, int* id, AdapterHandle h, const CanFrame* fr, uint32_t period_ms){
+    (void)self; (void)fr; (void)period_ms;
+    if (!h || !id) return CAN_ERR_INVALID;
+    *id = atomic_fetch_add(&((RepCh*)h)->next_job_id, 1) + 1;
+    return CAN_OK;
+}
+
+static can_err_t p_ch_register_job_dynamic(Adapter* self, int* id, AdapterHandle h, can_tx_prepare_cb_t prep, void* prep_user, uint32_t period_ms){
+    (void)prep; (void)prep_user;
+    return p_ch_register_job(self, id, h, NULL, period_ms);
+}
+
+static can_err_t p_ch_cancel_job(Adapter* self, AdapterHandle h, int jobId){
+    (void)self;
+    if (!h || jobId <= 0 || jobId > atomic_load(&((RepCh*)h)->next_job_id)) return CAN_ERR_INVALID;
+    return CAN_OK;
+}
+
+static can_err_t p_ch_get_bus_stats(Adapter* self, AdapterHandle h, CanStats* io){
+    (void)self;
+    if (!h || !io) return CAN_ERR_INVALID;
+    RepCh* c = (RepCh*)h;
+    io->tx_frames    = atomic_load_explicit(&c->tx_frames, memory_order_relaxed);
+    io->tx_bytes     = atomic_load_explicit(&c->tx_bytes, memory_order_relaxed);
+    io->bus_time_ns += atomic_load_explicit(&c->tx_bus_ns, memory_order_relaxed);
+    return CAN_OK;
+}
+
+static void p_destroy(Adapter* self){
+    if (!self) return;
+    free(self->priv);
+    free(self);
+}
+
+/* ====== 팩토리 ====== */
+Adapter* adapter_record_new(void){
+    Adapter* ad = (Adapter*)calloc(1, sizeof(Adapter));
+    if (!ad) return NULL;
+    RecPriv* priv = (RecPriv*)calloc(1, sizeof(RecPriv));
+    if (!priv){ free(ad); return NULL; }
+    priv->inner = adapter_linux_new();
+    if (!priv->inner){ free(priv); free(ad); return NULL; }
+    trace_cfg_copy(&priv->tc, priv->dir, sizeof(priv->dir));
+    priv->base_ns = now_ns();
+
+    static const AdapterVTable V = {
+        .probe                      = r_probe,
+        .ch_open                    = r_ch_open,
+        .ch_close                   = r_ch_close,
+        .ch_set_callbacks           = r_ch_set_callbacks,
+        .write                      = r_write,
+        .status                     = r_status,
+        .recover                    = r_recover,
+        .ch_register_job            = r_ch_register_job,
+        .ch_register_job_dynamic    = r_ch_register_job_dynamic,
+        .ch_cancel_job              = r_ch_cancel_job,
+        .ch_set_filters             = r_ch_set_filters,
+        .ch_get_job_stats           = r_ch_get_job_stats,
+        .ch_get_bus_stats           = r_ch_get_bus_stats,
+        .ch_update_job              = r_ch_update_job,
+        .ch_watch_add               = r_ch_watch_add,
+        .ch_watch_del               = r_ch_watch_del,
+        .write_batch                = r_write_batch,
+        .ch_isotp_open              = r_ch_isotp_open,
+        .ch_isotp_send              = r_ch_isotp_send,
+        .ch_isotp_recv              = r_ch_isotp_recv,
+        .ch_isotp_close             = r_ch_isotp_close,
+        .set_thread_policy          = r_set_thread_policy,
+        .destroy                    = r_destroy
+    };
+    ad->v = &V; ad->priv = priv;
+    return ad;
+}
+
+Adapter* adapter_replay_new(void){
+    Adapter* ad = (Adapter*)calloc(1, sizeof(Adapter));
+    if (!ad) return NULL;
+    RepPriv* priv = (RepPriv*)calloc(1, sizeof(RepPriv));
+    if (!priv){ free(ad); return NULL; }
+    trace_cfg_copy(&priv->tc, priv->dir, sizeof(priv->dir));
+    priv->start_ns = now_ns() + (uint64_t)priv->tc.start_delay_ms * 1000000ULL;
+
+    static const AdapterVTable V = {
+        .probe                      = p_probe,
+        .ch_open                    = p_ch_open,
+        .ch_close                   = p_ch_close,
+        .ch_set_callbacks           = p_ch_set_callbacks,
+        .write                      = p_write,
+        .ch_register_job            = p_ch_register_job,
+        .ch_register_job_dynamic    = p_ch_register_job_dynamic,
+        .ch_cancel_job              = p_ch_cancel_job,
+        .ch_get_bus_stats           = p_ch_get_bus_stats,
+        .destroy                    = p_destroy
+    };
+    ad->v = &V; ad->priv = priv;
+    return ad;
+}
@@ -2,11 +2,15 @@
 
 Adapter* adapter_linux_new(void);
 Adapter* adapter_esp32_new(void);
+Adapter* adapter_record_new(void);
+Adapter* adapter_replay_new(void);
 
 Adapter* create_adapter(can_device_t device) {
     switch (device) {
         case CAN_DEVICE_LINUX:  return adapter_linux_new();
         case CAN_DEVICE_ESP32:  return adapter_esp32_new();
+        case CAN_DEVICE_RECORD: return adapter_record_new();
+        case CAN_DEVICE_REPLAY: return adapter_replay_new();
         default:                return NULL;           
     }
 }
\ No newline at end of file
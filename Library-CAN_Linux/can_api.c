@@ -1,5 +1,7 @@
 #include "can_api.h"
 #include "channel.h"
+#include "mailbox.h"
+#include "route.h"
 #include "adapter.h"
 #include <string.h>
 #include <stdbool.h>
@@ -18,6 +20,13 @@ typedef struct {
 
 static can_api_state_t g_state = { false, NULL, NULL };
 
+// can_trace_config 사본. 기록/재생 어댑터가 생성될 때 can_trace_get_config로 읽는다
+static CanTraceConfig g_trace;
+static char           g_trace_dir[256];
+
+// can_set_thread_policy 사본. 어댑터가 스레드를 만들 때 can_thread_policy_get으로 읽는다
+static CanThreadPolicy g_thread_policy;
+
 static Channel* find_by_name(const char* name) {
     for(ChannelNode* n = g_state.head; n; n = n->next) {
        if(strcmp(channel_name(n->ch), name) == 0) return n->ch;
@@ -25,6 +34,19 @@ static Channel* find_by_name(const char* name) {
     return NULL;
 }
 
+static const uint8_t k_dlc_len[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+uint8_t     can_dlc_to_len(uint8_t dlc) {
+    return k_dlc_len[dlc & 0x0F];
+}
+
+uint8_t     can_len_to_dlc(uint8_t len) {
+    if (len <= 8) return len;
+    for (uint8_t d = 9; d < 15; ++d)
+        if (len <= k_dlc_len[d]) return d;
+    return 15;
+}
+
 can_err_t   can_init(can_device_t device) {
     if (g_state.initialized) return CAN_ERR_STATE;
     Adapter* ad = create_adapter(device);
@@ -42,43 +64,47 @@ can_err_t   can_init(can_device_t device) {
     return CAN_OK;
 }
 
-can_err_t   can_open(const char* name, CanConfig cfg) {
-    if(!g_state.initialized)        return CAN_ERR_STATE;
-    if(!name || name[0] == '\0')    return CAN_ERR_INVALID;
-    if(find_by_name(name))          return CAN_ERR_INVALID;
+can_err_t   can_trace_config(const CanTraceConfig* cfg) {
+    if (g_state.initialized) return CAN_ERR_STATE;
+    if (!cfg || !(cfg->speed >= 0)) return CAN_ERR_INVALID;
+    if (cfg->dir && strlen(cfg->dir) >= sizeof(g_trace_dir)) return CAN_ERR_INVALID;
+    g_trace = *cfg;
+    if (cfg->dir) {
+        strcpy(g_trace_dir, cfg->dir);
+        g_trace.dir = g_trace_dir;
+    }
+    return CAN_OK;
+}
 
-    Channel* ch = NULL;
-    can_err_t e = channel_start(name, cfg, g_state.adapter, &ch);
-    if (e != CAN_OK) return e;
+const CanTraceConfig* can_trace_get_config(void) {
+    return &g_trace;
+}
 
-    ChannelNode* node = (ChannelNode*)calloc(1, sizeof(ChannelNode));
-    if(!node) {
-        channel_stop(ch);
-        return CAN_ERR_MEMORY;
-    }
-    node->ch = ch;
-    node->next = g_state.head;
-    g_state.head = node;
+can_err_t   can_set_thread_policy(const CanThreadPolicy* policy) {
+    if (!policy || policy->priority < 0 || policy->priority > 99) return CAN_ERR_INVALID;
+    if (policy->fallback_nice < -20 || policy->fallback_nice > 19) return CAN_ERR_INVALID;
+    g_thread_policy = *policy;
+    if (!g_state.initialized || !g_state.adapter->v->set_thread_policy) return CAN_OK;
+    return g_state.adapter->v->set_thread_policy(g_state.adapter, policy);
+}
 
-    return CAN_OK;
+const CanThreadPolicy* can_thread_policy_get(void) {
+    return &g_thread_policy;
+}
+
+can_err_t   can_open(const char* name, CanConfig cfg) {
+    CanChannel* ch = NULL;
+    return can_open_h(name, cfg, &ch);
 }
 
 can_err_t   can_close(const char* name) {
     if (!g_state.initialized) return CAN_ERR_STATE;
     if (!name) return CAN_ERR_INVALID;
 
-    ChannelNode** pp = &g_state.head;
-    while (*pp) {
-        if (strcmp(channel_name((*pp)->ch), name) == 0) {
-            ChannelNode* del = *pp;
-            *pp = del->next;
-            channel_stop(del->ch);
-            free(del);
-            return CAN_OK;
-        }
-        pp = &(*pp)->next;
-    }
-    return CAN_ERR_INVALID;
+    Channel* ch = find_by_name(name);
+    if (!ch) return CAN_ERR_INVALID;
+
+    return can_close_h(ch);
 }
 
 void        can_dispose(void)
@@ -88,6 +114,7 @@ void        can_dispose(void)
     ChannelNode* node = g_state.head;
     while(node) {
         ChannelNode* next = node->next;
+        route_close_channel(node->ch);
         channel_stop(node->ch);
         free(node);
         node = next;
@@ -107,7 +134,7 @@ can_err_t   can_send(const char* name, CanFrame frame, uint32_t timeout_ms) {
     Channel* ch = find_by_name(name);
     if(!ch) return CAN_ERR_INVALID;
 
-    return channel_write(ch, &frame, timeout_ms);
+    return can_send_h(ch, &frame, timeout_ms);
 }
 
 can_err_t   can_recv(const char* name, CanFrame* out, uint32_t timeout_ms) {
@@ -117,7 +144,7 @@ can_err_t   can_recv(const char* name, CanFrame* out, uint32_t timeout_ms) {
     Channel* ch = find_by_name(name);
     if(!ch) return CAN_ERR_INVALID;
 
-    return channel_read(ch, out, timeout_ms);  
+    return can_recv_h(ch, out, timeout_ms);
 }
 
 can_err_t   can_register_job(const char* name, int* jobId, const CanFrame* frame, uint32_t period_ms) {
@@ -150,6 +177,26 @@ can_err_t   can_cancel_job(const char* name, int jobId) {
     return channel_cancel_job(ch, jobId);
 }
 
+can_err_t   can_get_job_stats(const char* name, int jobId, CanJobStats* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_job_stats(ch, jobId, out);
+}
+
+can_err_t   can_update_job(const char* name, int jobId, const CanFrame* frame) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_update_job(ch, jobId, frame);
+}
+
 can_err_t   can_subscribe(const char* name, int* subId, CanFilter filter, can_callback_t callback, void* user) {
     if(!g_state.initialized) return CAN_ERR_STATE;
     if(!name || name[0] == '\0') return CAN_ERR_INVALID;
@@ -170,6 +217,58 @@ can_err_t   can_unsubscribe(const char* name, int subId) {
     return channel_unsubscribe(ch, subId);
 }
 
+can_err_t   can_subscribe_ex(const char* name, int* subId, CanFilter filter, can_callback_t callback, void* user, const CanSubOptions* opt) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_subscribe_ex(ch, subId, &filter, callback, user, opt);
+}
+
+can_err_t   can_subscribe_on_change(const char* name, int* subId, const CanChangeFilter* filter, can_callback_t callback, can_timeout_callback_t on_timeout, void* user) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_subscribe_on_change(ch, subId, filter, callback, on_timeout, user);
+}
+
+int         can_sub_fd(const char* name, int subId) {
+    if(!g_state.initialized || !name || name[0] == '\0') return -1;
+    Channel* ch = find_by_name(name);
+    return ch ? channel_sub_fd(ch, subId) : -1;
+}
+
+int         can_sub_drain(const char* name, int subId, uint32_t maxFrames) {
+    if(!g_state.initialized || !name || name[0] == '\0') return -1;
+    Channel* ch = find_by_name(name);
+    return ch ? channel_sub_drain(ch, subId, maxFrames) : -1;
+}
+
+can_err_t   can_sub_get_stats(const char* name, int subId, CanSubStats* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_sub_get_stats(ch, subId, out);
+}
+
+can_err_t   can_get_latency(const char* name, CanLatencyHist* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_latency(ch, out);
+}
+
 can_err_t   can_recover(const char* name) {
     if(!g_state.initialized || !name || name[0]=='\0') return CAN_ERR_STATE;
     Channel* ch = find_by_name(name);
@@ -180,4 +279,263 @@ can_bus_state_t can_get_status(const char* name) {
     if(!g_state.initialized || !name || name[0]=='\0') return CAN_BUS_STATE_BUS_OFF; // 혹은 별도 API 설계
     Channel* ch = find_by_name(name);
     return ch ? channel_status(ch) : CAN_BUS_STATE_BUS_OFF;
-}
\ No newline at end of file
+}
+
+can_err_t   can_set_bus_callback(const char* name, can_bus_callback_t cb, void* user) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_set_bus_callback(ch, cb, user);
+}
+
+can_err_t   can_get_stats(const char* name, CanStats* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_stats(ch, out);
+}
+
+can_err_t   can_stats_enable(const char* name, int enable) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_stats_enable(ch, enable);
+}
+
+can_err_t   can_get_id_stats(const char* name, CanIdStats* out, size_t max, size_t* count) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_id_stats(ch, out, max, count);
+}
+
+can_err_t   can_isotp_open(const char* name, int* tpId, const CanIsoTpConfig* cfg) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_isotp_open(ch, tpId, cfg);
+}
+
+can_err_t   can_isotp_send(const char* name, int tpId, const void* data, size_t len, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_isotp_send(ch, tpId, data, len, timeout_ms);
+}
+
+can_err_t   can_isotp_recv(const char* name, int tpId, void* buf, size_t cap, size_t* len, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_isotp_recv(ch, tpId, buf, cap, len, timeout_ms);
+}
+
+can_err_t   can_isotp_close(const char* name, int tpId) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_isotp_close(ch, tpId);
+}
+
+/* ===== 핸들 API ===== */
+can_err_t   can_open_h(const char* name, CanConfig cfg, CanChannel** out) {
+    if(!g_state.initialized)        return CAN_ERR_STATE;
+    if(!name || name[0] == '\0' || !out) return CAN_ERR_INVALID;
+    if(find_by_name(name))          return CAN_ERR_INVALID;
+
+    Channel* ch = NULL;
+    can_err_t e = channel_start(name, cfg, g_state.adapter, &ch);
+    if (e != CAN_OK) return e;
+
+    ChannelNode* node = (ChannelNode*)calloc(1, sizeof(ChannelNode));
+    if(!node) {
+        channel_stop(ch);
+        return CAN_ERR_MEMORY;
+    }
+    node->ch = ch;
+    node->next = g_state.head;
+    g_state.head = node;
+
+    *out = ch;
+    return CAN_OK;
+}
+
+CanChannel* can_get_h(const char* name) {
+    if(!g_state.initialized || !name) return NULL;
+    return find_by_name(name);
+}
+
+can_err_t   can_close_h(CanChannel* ch) {
+    if (!g_state.initialized) return CAN_ERR_STATE;
+    if (!ch) return CAN_ERR_INVALID;
+
+    ChannelNode** pp = &g_state.head;
+    while (*pp) {
+        if ((*pp)->ch == ch) {
+            ChannelNode* del = *pp;
+            *pp = del->next;
+            route_close_channel(del->ch);   // 다른 채널로 가는/오는 경로도 같이
+            channel_stop(del->ch);
+            free(del);
+            return CAN_OK;
+        }
+        pp = &(*pp)->next;
+    }
+    return CAN_ERR_INVALID;
+}
+
+can_err_t   can_send_h(CanChannel* ch, const CanFrame* frame, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return channel_write(ch, frame, timeout_ms);
+}
+
+can_err_t   can_recv_h(CanChannel* ch, CanFrame* out, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return channel_read(ch, out, timeout_ms);
+}
+
+can_err_t   can_send_batch_h(CanChannel* ch, const CanFrame* frames, size_t n, size_t* sent, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return channel_write_batch(ch, frames, n, sent, timeout_ms);
+}
+
+can_err_t   can_recv_batch_h(CanChannel* ch, CanFrame* out, size_t max, size_t* got, uint32_t timeout_ms) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return channel_read_batch(ch, out, max, got, timeout_ms);
+}
+
+/* ===== 최신 값 우편함 ===== */
+can_err_t   can_mailbox_open(const char* name, const uint32_t* ids, size_t n, CanMailbox** out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return mailbox_create(ch, ids, n, out);
+}
+
+can_err_t   can_mailbox_close(CanMailbox* mb) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return mailbox_destroy(mb);
+}
+
+can_err_t   can_mailbox_read(const CanMailbox* mb, uint32_t id, CanFrame* out, uint64_t* age_ns) {
+    return mailbox_read(mb, id, out, age_ns);
+}
+
+uint64_t    can_mailbox_generation(const CanMailbox* mb) {
+    return mailbox_generation(mb);
+}
+
+can_err_t   can_mailbox_changed(const CanMailbox* mb, uint64_t* gen, uint32_t* ids, size_t max, size_t* count) {
+    return mailbox_changed(mb, gen, ids, max, count);
+}
+
+can_err_t   can_watch_period(const char* name, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance,
+                             can_period_callback_t cb, void* user) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_watch_period(ch, watchId, id, expected_ms, tolerance, cb, user);
+}
+
+can_err_t   can_unwatch_period(const char* name, int watchId) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_unwatch_period(ch, watchId);
+}
+
+can_err_t   can_get_period_stats(const char* name, int watchId, CanPeriodStats* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_period_stats(ch, watchId, out);
+}
+
+can_err_t   can_subscribe_signal(const char* name, int* subId, const struct CanDb* db, uint16_t sig, double deadband,
+                                 can_signal_callback_t cb, void* user) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_subscribe_signal(ch, subId, db, sig, deadband, cb, user);
+}
+
+can_err_t   can_unsubscribe_signal(const char* name, int subId) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_unsubscribe_signal(ch, subId);
+}
+
+can_err_t   can_get_signal(const char* name, int subId, double* value, uint64_t* age_ns) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!name || name[0] == '\0') return CAN_ERR_INVALID;
+
+    Channel* ch = find_by_name(name);
+    if(!ch) return CAN_ERR_INVALID;
+
+    return channel_get_signal(ch, subId, value, age_ns);
+}
+
+can_err_t   can_route_add(const char* src, const char* dst, const CanFilter* filter,
+                          const CanRouteMod* mods, size_t nMods, uint32_t flags, int* routeId) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    if(!src || !dst) return CAN_ERR_INVALID;
+
+    Channel* s = find_by_name(src);
+    Channel* d = find_by_name(dst);
+    if(!s || !d) return CAN_ERR_INVALID;
+
+    return route_add(s, d, filter, mods, nMods, flags, routeId);
+}
+
+can_err_t   can_route_del(int routeId) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return route_del(routeId);
+}
+
+can_err_t   can_route_get_stats(int routeId, CanRouteStats* out) {
+    if(!g_state.initialized) return CAN_ERR_STATE;
+    return route_get_stats(routeId, out);
+}
@@ -0,0 +1,252 @@
+#define _GNU_SOURCE
+#include "cancapture.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+
+#define CANCAP_BLOCK_SIZE       (128u << 10)
+#define CANCAP_BLOCK_COUNT      32u
+#define CANCAP_TIMEOUT_MS       100u
+#define CANCAP_FRAME_SIZE       256u    // V3에서는 검사용 값일 뿐 (실제 패킷은 블록 안에 빈틈없이)
+#define CANCAP_CLASS_CHUNK      256u    // 필터가 있을 때 한 번에 분류하는 패킷 수
+
+struct CanCap {
+    int             fd;
+    uint8_t*        map;
+    size_t          map_len;
+    uint32_t        block_size;
+    uint32_t        block_count;
+    uint32_t        cur;            // 다음에 넘겨받을 블록
+    CanCapStats     st;
+
+    CanClass*       cls;            // NULL: 필터 없음
+    uint32_t        nhit, ihit;     // hits[ihit..nhit) = 블록의 다음 패킷들 (CAN이 아닌 패킷 자리도 포함)
+    uint32_t        ids[CANCAP_CLASS_CHUNK];
+    uint64_t        hits[CANCAP_CLASS_CHUNK];
+};
+
+static struct tpacket_block_desc* cap_block(const CanCap* c, uint32_t i){
+    return (struct tpacket_block_desc*)(c->map + (size_t)i * c->block_size);
+}
+
+static uint32_t block_status(const struct tpacket_block_desc* bd){
+    uint32_t s = *(volatile const uint32_t*)&bd->hdr.bh1.block_status;
+    atomic_thread_fence(memory_order_acquire);     // 상태를 본 뒤에 블록 내용을 읽는다
+    return s;
+}
+
+static int64_t mono_ms(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+int cancap_open(const char* ifname, const CanCapConfig* cfg, CanCap** out){
+    if (!ifname || !out) return -EINVAL;
+    *out = NULL;
+    CanCapConfig d = { 0 };
+    if (cfg) d = *cfg;
+    const long page = sysconf(_SC_PAGESIZE);
+    if (!d.block_size)       d.block_size = CANCAP_BLOCK_SIZE;
+    if (!d.block_count)      d.block_count = CANCAP_BLOCK_COUNT;
+    if (!d.block_timeout_ms) d.block_timeout_ms = CANCAP_TIMEOUT_MS;
+    if (page <= 0 || d.block_size % (uint32_t)page || d.block_size < CANCAP_FRAME_SIZE) return -EINVAL;
+
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    if (strlen(ifname) >= sizeof(ifr.ifr_name)) return -EINVAL;
+    strcpy(ifr.ifr_name, ifname);
+
+    // CAN 장치는 링크 헤더가 없어서 SOCK_DGRAM이든 RAW든 패킷 = can_frame / canfd_frame
+    int fd = socket(AF_PACKET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -errno;
+    int e = 0;
+    if (ioctl(fd, SIOCGIFHWADDR, &ifr) < 0){ e = -errno; goto fail; }
+    if (ifr.ifr_hwaddr.sa_family != ARPHRD_CAN){ e = -EINVAL; goto fail; }
+    const int ifindex = (int)if_nametoindex(ifname);
+    if (!ifindex){ e = -ENODEV; goto fail; }
+
+    int v = TPACKET_V3;
+    if (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &v, sizeof(v)) < 0){ e = -errno; goto fail; }
+    if (d.rx_only){
+        v = 1;
+        if (setsockopt(fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &v, sizeof(v)) < 0){ e = -errno; goto fail; }
+    }
+    struct tpacket_req3 req;
+    memset(&req, 0, sizeof(req));
+    req.tp_block_size       = d.block_size;
+    req.tp_block_nr         = d.block_count;
+    req.tp_frame_size       = CANCAP_FRAME_SIZE;
+    req.tp_frame_nr         = (d.block_size / CANCAP_FRAME_SIZE) * d.block_count;
+    req.tp_retire_blk_tov   = d.block_timeout_ms;
+    if (setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0){ e = -errno; goto fail; }
+
+    const size_t len = (size_t)d.block_size * d.block_count;
+    uint8_t* map = (uint8_t*)mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, fd, 0);
+    if (map == MAP_FAILED) map = (uint8_t*)mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);  // RLIMIT_MEMLOCK
+    if (map == MAP_FAILED){ e = -errno; goto fail; }
+
+    // 링을 걸고 나서 bind (그 전에 들어온 패킷이 일반 수신 큐에 쌓이지 않게)
+    struct sockaddr_ll sll;
+    memset(&sll, 0, sizeof(sll));
+    sll.sll_family   = AF_PACKET;
+    sll.sll_protocol = htons(ETH_P_ALL);
+    sll.sll_ifindex  = ifindex;
+    if (bind(fd, (struct sockaddr*)&sll, sizeof(sll)) < 0){
+        e = -errno;
+        munmap(map, len);
+        goto fail;
+    }
+
+    CanCap* c = (CanCap*)calloc(1, sizeof(CanCap));
+    if (!c){
+        munmap(map, len);
+        e = -ENOMEM;
+        goto fail;
+    }
+    c->fd          = fd;
+    c->map         = map;
+    c->map_len     = len;
+    c->block_size  = d.block_size;
+    c->block_count = d.block_count;
+    *out = c;
+    return 0;
+
+fail:
+    close(fd);
+    return e;
+}
+
+void cancap_close(CanCap* c){
+    if (!c) return;
+    canclass_free(c->cls);
+    munmap(c->map, c->map_len);
+    close(c->fd);
+    free(c);
+}
+
+int cancap_fd(const CanCap* c){
+    return c ? c->fd : -1;
+}
+
+int cancap_next(CanCap* c, CanCapBatch* b, int timeout_ms){
+    if (!c || !b) return -EINVAL;
+    const int64_t due = timeout_ms >= 0 ? mono_ms() + timeout_ms : 0;
+    for (;;){
+        struct tpacket_block_desc* bd = cap_block(c, c->cur);
+        if (block_status(bd) & TP_STATUS_USER){
+            b->blk   = bd;
+            b->pos   = (const uint8_t*)bd + bd->hdr.bh1.offset_to_first_pkt;
+            b->count = b->left = bd->hdr.bh1.num_pkts;
+            c->nhit = c->ihit = 0;
+            c->st.blocks++;
+            if (b->count) return (int)b->count;
+            cancap_release(c, b);   // 빈 블록 (커널이 넘기지는 않지만 혹시)
+            continue;
+        }
+        int wait = -1;
+        if (timeout_ms >= 0){
+            int64_t left = due - mono_ms();
+            if (left <= 0) return 0;
+            wait = (int)left;
+        }
+        struct pollfd p = { c->fd, POLLIN | POLLERR, 0 };
+        if (poll(&p, 1, wait) < 0 && errno != EINTR) return -errno;
+    }
+}
+
+/* 블록의 다음 패킷 최대 CANCAP_CLASS_CHUNK개의 ID를 모아 한 번에 분류 (CAN이 아닌 패킷은 자리만 채움) */
+static void cap_classify(CanCap* c, const CanCapBatch* b){
+    const uint8_t* pos = b->pos;
+    uint32_t n = 0;
+    while (n < b->left && n < CANCAP_CLASS_CHUNK){
+        const struct tpacket3_hdr* h = (const struct tpacket3_hdr*)pos;
+        const uint32_t len = h->tp_snaplen;
+        c->ids[n++] = (len == CAN_MTU || len == CANFD_MTU)
+                    ? ((const struct canfd_frame*)((const uint8_t*)h + h->tp_mac))->can_id & CAN_EFF_MASK : 0;
+        pos += h->tp_next_offset;
+    }
+    canclass_classify(c->cls, c->ids, n, c->hits);
+    c->nhit = n;
+    c->ihit = 0;
+}
+
+int cancap_batch_next(CanCap* c, CanCapBatch* b, CanCapFrame* out){
+    if (!c || !b || !out) return 0;
+    while (b->left){
+        uint64_t hits = 0;
+        if (c->cls){
+            if (c->ihit == c->nhit) cap_classify(c, b);
+            hits = c->hits[c->ihit++];
+        }
+        const struct tpacket3_hdr* h = (const struct tpacket3_hdr*)b->pos;
+        b->pos += h->tp_next_offset;
+        b->left--;
+        const uint32_t len = h->tp_snaplen;
+        if (len != CAN_MTU && len != CANFD_MTU){   // CAN XL 등
+            c->st.skipped++;
+            continue;
+        }
+        if (c->cls && !hits){
+            c->st.filtered++;
+            continue;
+        }
+        const struct sockaddr_ll* sll = (const struct sockaddr_ll*)((const uint8_t*)h + TPACKET_ALIGN(sizeof(*h)));
+        out->ts_ns = (uint64_t)h->tp_sec*1000000000ULL + h->tp_nsec;
+        out->cf    = (const struct canfd_frame*)((const uint8_t*)h + h->tp_mac);
+        out->fd    = len == CANFD_MTU;
+        out->tx    = sll->sll_pkttype == PACKET_OUTGOING;
+        out->hits  = hits;
+        return 1;
+    }
+    return 0;
+}
+
+void cancap_release(CanCap* c, CanCapBatch* b){
+    if (!c || !b || !b->blk) return;
+    struct tpacket_block_desc* bd = (struct tpacket_block_desc*)b->blk;
+    atomic_thread_fence(memory_order_release);     // 블록을 다 읽은 뒤에 돌려준다
+    *(volatile uint32_t*)&bd->hdr.bh1.block_status = TP_STATUS_KERNEL;
+    c->cur = (c->cur + 1) % c->block_count;
+    c->nhit = c->ihit = 0;
+    memset(b, 0, sizeof(*b));
+}
+
+int cancap_get_stats(CanCap* c, CanCapStats* out){
+    if (!c || !out) return -EINVAL;
+    struct tpacket_stats_v3 ks;
+    socklen_t sl = sizeof(ks);
+    memset(&ks, 0, sizeof(ks));
+    if (getsockopt(c->fd, SOL_PACKET, PACKET_STATISTICS, &ks, &sl) < 0) return -errno;
+    // 커널 값은 읽을 때마다 0으로 돌아가므로 여기서 누적. tp_packets는 버린 것도 센다
+    c->st.packets += ks.tp_packets - ks.tp_drops;
+    c->st.drops   += ks.tp_drops;
+    c->st.freezes += ks.tp_freeze_q_cnt;
+    *out = c->st;
+    return 0;
+}
+
+int cancap_set_filters(CanCap* c, const CanFilter* filters, size_t n){
+    if (!c || (n && !filters)) return -EINVAL;
+    CanClass* cls = NULL;
+    if (n){
+        int e = canclass_build(filters, n, 0, &cls);
+        if (e) return e;
+    }
+    canclass_free(c->cls);
+    c->cls = cls;
+    c->nhit = c->ihit = 0;     // 읽던 블록의 나머지도 새 필터로 다시 분류
+    return 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <linux/can.h>
+#include "canclassify.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 버스 로거용 CAN 캡처 (AF_PACKET + TPACKET_V3 mmap 링). Linux 전용, C++에서도 그대로 include.
+ * 커널이 프레임을 공유 링의 블록에 직접 채우고, 블록이 차거나 block_timeout_ms가 지나면 넘겨준다.
+ * 읽는 쪽은 블록 단위로 깨어나 프레임을 링 안에서 그대로 읽으므로 프레임마다의 시스템 콜/복사가 없다.
+ *  - CAN_RAW 소켓/라이브러리 채널과 독립이라 can_open한 데몬 옆에서 따로 돌려도 된다
+ *  - 이 호스트가 보낸 프레임도 tx = 1로 잡힌다 (rx_only면 받지 않음)
+ *  - CAP_NET_RAW 필요 (-EPERM). CAN 장치가 아니면 -EINVAL
+ *  - 핸들 하나는 스레드 하나에서만 쓴다 (인터페이스마다 핸들을 따로 연다)
+ *  - cancap_set_filters로 필터를 걸면 블록의 ID를 묶음으로 canclassify에 대 보고 걸린 프레임만 넘긴다
+ *  - 반환은 0(또는 개수) 또는 -errno (canlink와 같음)
+ */
+typedef struct {
+    uint32_t    block_size;         // 블록 크기 (페이지 배수). 0이면 128 KiB (클래식 프레임 약 1100개)
+    uint32_t    block_count;        // 0이면 32 → 읽지 않아도 1Mbit/s 최대 부하에서 약 4초 버팀
+    uint32_t    block_timeout_ms;   // 덜 찬 블록도 이 시간이 지나면 넘겨받음. 0이면 100
+    int         rx_only;            // 1: 이 호스트의 송신 프레임은 받지 않음 (PACKET_IGNORE_OUTGOING)
+} CanCapConfig;
+
+typedef struct {
+    uint64_t                    ts_ns;  // 커널 수신 시각 (CLOCK_REALTIME)
+    const struct canfd_frame*   cf;     // 링 안의 프레임 (cancap_release 전까지 유효). 클래식 프레임은 len이 can_dlc
+    uint8_t                     fd;     // 1: FD 프레임 (CANFD_MTU)
+    uint8_t                     tx;     // 1: 이 호스트가 보낸 프레임
+    uint64_t                    hits;   // 걸린 필터 비트 (필터 i → 비트 i). 필터가 없으면 0
+} CanCapFrame;
+
+// cancap_next가 채우는 블록 하나. 프레임은 cancap_batch_next로 하나씩 꺼낸다
+typedef struct {
+    void*           blk;    // 내부용
+    const uint8_t*  pos;
+    uint32_t        left;
+    uint32_t        count;  // 블록의 패킷 수 (CAN XL 등 건너뛰는 것 포함)
+} CanCapBatch;
+
+typedef struct {
+    uint64_t    packets;    // 커널이 링에 넣은 패킷
+    uint64_t    drops;      // 링이 꽉 차서 버린 패킷
+    uint64_t    freezes;    // 링이 꽉 찬 적 (tp_freeze_q_cnt)
+    uint64_t    blocks;     // 넘겨받은 블록
+    uint64_t    skipped;    // CAN/CAN FD가 아닌 패킷 (cancap_batch_next가 지나간 것)
+    uint64_t    filtered;   // 어느 필터에도 걸리지 않아 지나간 프레임
+} CanCapStats;
+
+typedef struct CanCap CanCap;
+
+int     cancap_open         (const char* ifname, const CanCapConfig* cfg, CanCap** out);   // cfg는 NULL 가능
+void    cancap_close        (CanCap* c);
+int     cancap_fd           (const CanCap* c);      // epoll 등에 직접 넣을 때 (POLLIN: 넘겨받을 블록 있음)
+int     cancap_next         (CanCap* c, CanCapBatch* b, int timeout_ms);  // 블록 하나를 기다림. >0: 패킷 수, 0: 시간 초과 (timeout_ms < 0: 무한)
+int     cancap_batch_next   (CanCap* c, CanCapBatch* b, CanCapFrame* out);  // 1: 프레임 하나, 0: 블록 끝
+void    cancap_release      (CanCap* c, CanCapBatch* b);            // 블록을 커널에 돌려줌 (다음 cancap_next 전에 꼭)
+int     cancap_get_stats    (CanCap* c, CanCapStats* out);          // 연 뒤로 누적
+int     cancap_set_filters  (CanCap* c, const CanFilter* filters, size_t n);  // n = 0: 모두 받음. 최대 CANCLASS_MAX_FILTERS
+
+#ifdef __cplusplus
+}
+#endif
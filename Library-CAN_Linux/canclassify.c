@@ -0,0 +1,264 @@
+#include "canclassify.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define CANCLASS_X86    1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CANCLASS_NEON   1
+#include <arm_neon.h>
+#endif
+
+#define CANCLASS_LANES  8       // 항목 묶음 (AVX2 벡터 하나, SSE2/NEON 벡터 둘)
+#define CANCLASS_STEP   8       // 한 단계에 처리하는 ID 수
+#define CANCLASS_ALIGN  32
+
+typedef void (*classify_fn)(const CanClass*, const uint32_t*, size_t, uint64_t*);
+
+/*
+ * 항목 e는 ((id & mask[e]) == val[e]) && (id - lo[e] <= span[e]) 일 때 걸린다 (뺄셈/비교는 부호 없음).
+ *  MASK     : mask/val, 범위는 전체
+ *  RANGE    : mask 0, lo = min, span = max - min
+ *  LIST 항목: mask 전체, val = 그 ID
+ * 앞쪽 nprim개는 항목 e = 필터 e라 묶음의 히트 비트를 결과에 그대로 자리 맞춰 넣는다.
+ * LIST의 두 번째 항목부터는 그 뒤에 두고 bit[]로 필터 번호를 찾는다.
+ * 빈 칸(mask 0, val 1)은 절대 걸리지 않는다.
+ */
+struct CanClass {
+    uint32_t*   mask;       // 네 배열은 한 블록 (CANCLASS_ALIGN 정렬, 길이 nent)
+    uint32_t*   val;
+    uint32_t*   lo;
+    uint32_t*   span;
+    uint8_t*    bit;
+    uint32_t    nprim;      // CANCLASS_LANES 배수
+    uint32_t    nent;       // CANCLASS_LANES 배수
+    classify_fn fn;
+    const char* impl;
+};
+
+static inline uint64_t extra_bits(const CanClass* c, uint32_t base, uint32_t hits){
+    uint64_t r = 0;
+    while (hits){
+        r |= 1ULL << c->bit[base + (uint32_t)__builtin_ctz(hits)];
+        hits &= hits - 1;
+    }
+    return r;
+}
+
+static inline uint64_t chunk_bits(const CanClass* c, uint32_t e, uint32_t hits){
+    if (e < c->nprim) return (uint64_t)hits << e;
+    return hits ? extra_bits(c, e, hits) : 0;
+}
+
+static void classify_scalar(const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out){
+    for (size_t i = 0; i < n; ++i){
+        const uint32_t id = ids[i];
+        uint64_t r = 0;
+        for (uint32_t e = 0; e < c->nent; ++e){
+            uint64_t hit = ((id & c->mask[e]) == c->val[e]) & ((uint32_t)(id - c->lo[e]) <= c->span[e]);
+            r |= hit << (e < c->nprim ? e : c->bit[e]);
+        }
+        out[i] = r;
+    }
+}
+
+#if CANCLASS_X86
+__attribute__((target("avx2")))
+static void classify_avx2(const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out){
+    for (size_t i = 0; i < n; i += CANCLASS_STEP){
+        const size_t nb = n - i < CANCLASS_STEP ? n - i : CANCLASS_STEP;
+        __m256i  v[CANCLASS_STEP];
+        uint64_t r[CANCLASS_STEP] = {0};
+        for (size_t j = 0; j < nb; ++j) v[j] = _mm256_set1_epi32((int)ids[i+j]);
+
+        for (uint32_t e = 0; e < c->nent; e += CANCLASS_LANES){
+            const __m256i m  = _mm256_load_si256((const __m256i*)(c->mask + e));
+            const __m256i vv = _mm256_load_si256((const __m256i*)(c->val  + e));
+            const __m256i lo = _mm256_load_si256((const __m256i*)(c->lo   + e));
+            const __m256i sp = _mm256_load_si256((const __m256i*)(c->span + e));
+            for (size_t j = 0; j < nb; ++j){
+                __m256i eq = _mm256_cmpeq_epi32(_mm256_and_si256(v[j], m), vv);
+                __m256i d  = _mm256_sub_epi32(v[j], lo);
+                __m256i le = _mm256_cmpeq_epi32(_mm256_min_epu32(d, sp), d);    // d <= sp (부호 없음)
+                uint32_t hits = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(eq, le)));
+                r[j] |= chunk_bits(c, e, hits);
+            }
+        }
+        memcpy(out + i, r, nb * sizeof(uint64_t));
+    }
+}
+
+static void classify_sse2(const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out){
+    const __m128i bias = _mm_set1_epi32((int)0x80000000u);     // SSE2에는 부호 없는 비교가 없다
+    for (size_t i = 0; i < n; i += CANCLASS_STEP){
+        const size_t nb = n - i < CANCLASS_STEP ? n - i : CANCLASS_STEP;
+        __m128i  v[CANCLASS_STEP];
+        uint64_t r[CANCLASS_STEP] = {0};
+        for (size_t j = 0; j < nb; ++j) v[j] = _mm_set1_epi32((int)ids[i+j]);
+
+        for (uint32_t e = 0; e < c->nent; e += CANCLASS_LANES){
+            __m128i m[2], vv[2], lo[2], sp[2];
+            for (int h = 0; h < 2; ++h){
+                m[h]  = _mm_load_si128((const __m128i*)(c->mask + e + 4*h));
+                vv[h] = _mm_load_si128((const __m128i*)(c->val  + e + 4*h));
+                lo[h] = _mm_load_si128((const __m128i*)(c->lo   + e + 4*h));
+                sp[h] = _mm_xor_si128(_mm_load_si128((const __m128i*)(c->span + e + 4*h)), bias);
+            }
+            for (size_t j = 0; j < nb; ++j){
+                uint32_t hits = 0;
+                for (int h = 0; h < 2; ++h){
+                    __m128i eq = _mm_cmpeq_epi32(_mm_and_si128(v[j], m[h]), vv[h]);
+                    __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(_mm_sub_epi32(v[j], lo[h]), bias), sp[h]);
+                    hits |= (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_andnot_si128(gt, eq))) << (4*h);
+                }
+                r[j] |= chunk_bits(c, e, hits);
+            }
+        }
+        memcpy(out + i, r, nb * sizeof(uint64_t));
+    }
+}
+#endif
+
+#if CANCLASS_NEON
+static inline uint32_t neon_movemask(uint32x4_t h, uint32x4_t w){
+    uint32x4_t x = vandq_u32(h, w);
+#if defined(__aarch64__)
+    return vaddvq_u32(x);
+#else
+    uint32x2_t s = vadd_u32(vget_low_u32(x), vget_high_u32(x));
+    return vget_lane_u32(vpadd_u32(s, s), 0);
+#endif
+}
+
+static void classify_neon(const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out){
+    static const uint32_t weights[4] = { 1, 2, 4, 8 };
+    const uint32x4_t w = vld1q_u32(weights);
+    for (size_t i = 0; i < n; i += CANCLASS_STEP){
+        const size_t nb = n - i < CANCLASS_STEP ? n - i : CANCLASS_STEP;
+        uint32x4_t v[CANCLASS_STEP];
+        uint64_t   r[CANCLASS_STEP] = {0};
+        for (size_t j = 0; j < nb; ++j) v[j] = vdupq_n_u32(ids[i+j]);
+
+        for (uint32_t e = 0; e < c->nent; e += CANCLASS_LANES){
+            uint32x4_t m[2], vv[2], lo[2], sp[2];
+            for (int h = 0; h < 2; ++h){
+                m[h]  = vld1q_u32(c->mask + e + 4*h);
+                vv[h] = vld1q_u32(c->val  + e + 4*h);
+                lo[h] = vld1q_u32(c->lo   + e + 4*h);
+                sp[h] = vld1q_u32(c->span + e + 4*h);
+            }
+            for (size_t j = 0; j < nb; ++j){
+                uint32_t hits = 0;
+                for (int h = 0; h < 2; ++h){
+                    uint32x4_t eq = vceqq_u32(vandq_u32(v[j], m[h]), vv[h]);
+                    uint32x4_t le = vcleq_u32(vsubq_u32(v[j], lo[h]), sp[h]);
+                    hits |= neon_movemask(vandq_u32(eq, le), w) << (4*h);
+                }
+                r[j] |= chunk_bits(c, e, hits);
+            }
+        }
+        memcpy(out + i, r, nb * sizeof(uint64_t));
+    }
+}
+#endif
+
+static inline size_t round_lanes(size_t n){
+    return (n + CANCLASS_LANES - 1) / CANCLASS_LANES * CANCLASS_LANES;
+}
+
+static void set_entry(CanClass* c, uint32_t e, uint32_t mask, uint32_t val, uint32_t lo, uint32_t span, uint8_t bit){
+    c->mask[e] = mask;
+    c->val[e]  = val;
+    c->lo[e]   = lo;
+    c->span[e] = span;
+    c->bit[e]  = bit;
+}
+
+int canclass_build(const CanFilter* filters, size_t n, unsigned flags, CanClass** out){
+    if (!out) return -EINVAL;
+    *out = NULL;
+    if (!filters || n == 0 || n > CANCLASS_MAX_FILTERS) return -EINVAL;
+
+    size_t extra = 0;
+    for (size_t i = 0; i < n; ++i){
+        const CanFilter* f = &filters[i];
+        if (f->type == CAN_FILTER_LIST && f->data.list.list && f->data.list.count > 1)
+            extra += f->data.list.count - 1;
+    }
+    const size_t nprim = round_lanes(n);
+    const size_t nent  = nprim + round_lanes(extra);
+    if (nent > UINT32_MAX / (4 * sizeof(uint32_t))) return -EINVAL;
+
+    CanClass* c = (CanClass*)calloc(1, sizeof(CanClass));
+    if (!c) return -ENOMEM;
+    uint32_t* blk = (uint32_t*)aligned_alloc(CANCLASS_ALIGN, 4 * nent * sizeof(uint32_t));
+    c->bit = (uint8_t*)malloc(nent);
+    if (!blk || !c->bit){
+        free(blk);
+        free(c->bit);
+        free(c);
+        return -ENOMEM;
+    }
+    c->mask  = blk;
+    c->val   = blk + nent;
+    c->lo    = blk + 2*nent;
+    c->span  = blk + 3*nent;
+    c->nprim = (uint32_t)nprim;
+    c->nent  = (uint32_t)nent;
+    for (uint32_t e = 0; e < c->nent; ++e) set_entry(c, e, 0, 1, 0, UINT32_MAX, 0);
+
+    uint32_t x = c->nprim;
+    for (size_t i = 0; i < n; ++i){
+        const CanFilter* f = &filters[i];
+        const uint32_t e = (uint32_t)i;
+        switch (f->type){
+        case CAN_FILTER_MASK:
+            set_entry(c, e, f->data.mask.mask, f->data.mask.id & f->data.mask.mask, 0, UINT32_MAX, (uint8_t)i);
+            break;
+        case CAN_FILTER_RANGE:
+            if (f->data.range.min <= f->data.range.max)
+                set_entry(c, e, 0, 0, f->data.range.min, f->data.range.max - f->data.range.min, (uint8_t)i);
+            break;
+        case CAN_FILTER_LIST:
+            if (!f->data.list.list || f->data.list.count == 0) break;
+            set_entry(c, e, UINT32_MAX, f->data.list.list[0], 0, UINT32_MAX, (uint8_t)i);
+            for (uint32_t k = 1; k < f->data.list.count; ++k)
+                set_entry(c, x++, UINT32_MAX, f->data.list.list[k], 0, UINT32_MAX, (uint8_t)i);
+            break;
+        default:
+            break;      // 모르는 형식은 아무것도 걸리지 않음 (filter_match와 같음)
+        }
+    }
+
+    c->fn   = classify_scalar;
+    c->impl = "scalar";
+    if (!(flags & CANCLASS_NO_SIMD)){
+#if CANCLASS_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")){ c->fn = classify_avx2; c->impl = "avx2"; }
+        else                               { c->fn = classify_sse2; c->impl = "sse2"; }
+#elif CANCLASS_NEON
+        c->fn = classify_neon; c->impl = "neon";
+#endif
+    }
+    *out = c;
+    return 0;
+}
+
+void canclass_free(CanClass* c){
+    if (!c) return;
+    free(c->mask);
+    free(c->bit);
+    free(c);
+}
+
+void canclass_classify(const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out){
+    if (!c || !ids || !out) return;
+    c->fn(c, ids, n, out);
+}
+
+const char* canclass_impl(const CanClass* c){
+    return c ? c->impl : "";
+}
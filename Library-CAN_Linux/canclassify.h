@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "can_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 프레임 ID 묶음을 여러 CanFilter에 한 번에 대 보는 분류기 (캡처/게이트웨이용). Linux 전용.
+ * 필터 n개(최대 CANCLASS_MAX_FILTERS)를 만들 때 한 번 struct-of-arrays로 펼쳐 두고,
+ * ID마다 "걸린 필터 i → 비트 i"인 uint64_t 마스크를 돌려준다.
+ *  - x86은 AVX2(실행 시 확인) → SSE2, ARM(Pi)은 NEON, 그 밖은 스칼라. 결과는 모두 같다
+ *  - 한 단계에 ID 8개 × 필터 8개: 필터 묶음을 한 번 읽어 ID 8개에 다시 쓴다
+ *  - 매칭 규칙은 채널 구독(filter_match)과 같다. ids는 CanFrame.id처럼 플래그 비트를 뺀 값
+ *    (캡처 프레임이면 cf->can_id & CAN_EFF_MASK)
+ *  - LIST는 항목 하나가 비교 하나 → 긴 목록은 그만큼 느려진다 (수십 개까지를 생각한 구조)
+ *  - 만든 뒤에는 읽기만 하므로 여러 스레드가 같은 핸들로 동시에 분류해도 된다
+ *  - 반환은 0 또는 -errno (cancapture와 같음)
+ */
+#define CANCLASS_MAX_FILTERS    64
+#define CANCLASS_NO_SIMD        0x1u    // 스칼라 경로 강제 (비교/검증용)
+
+typedef struct CanClass CanClass;
+
+int         canclass_build      (const CanFilter* filters, size_t n, unsigned flags, CanClass** out);    // -EINVAL: n이 0이거나 너무 많음
+void        canclass_free       (CanClass* c);
+void        canclass_classify   (const CanClass* c, const uint32_t* ids, size_t n, uint64_t* out);      // out[i]: ids[i]에 걸린 필터 비트
+const char* canclass_impl       (const CanClass* c);    // "avx2" / "sse2" / "neon" / "scalar"
+
+#ifdef __cplusplus
+}
+#endif
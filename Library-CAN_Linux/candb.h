@@ -0,0 +1,104 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "can_api.h"
+
+/*
+ * dbcgen.py가 만든 헤더(pcan_db.h, bcan_db.h)가 공통으로 쓰는 타입과 보조 함수.
+ * 메시지별 pack/unpack은 생성 코드에 펼쳐져 있고, 여기 있는 건
+ * 신호 이름/ID로 런타임에 값을 꺼내야 하는 경로(디스크립터 테이블)용이다.
+ */
+
+#ifdef __cplusplus
+#define CANDB_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+#define CANDB_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+
+// CAN FD에서 쓸 수 있는 payload 길이인지 (0..8, 12, 16, 20, 24, 32, 48, 64)
+#define CANDB_VALID_LEN(n) ((n) <= 8 || (n) == 12 || (n) == 16 || (n) == 20 || \
+                            (n) == 24 || (n) == 32 || (n) == 48 || (n) == 64)
+
+enum {
+    CANDB_SIG_SIGNED   = 1 << 0,
+    CANDB_SIG_FLOAT    = 1 << 1,    // IEEE754 (SIG_VALTYPE_ 1: 32비트, 2: 64비트)
+    CANDB_SIG_MOTOROLA = 1 << 2     // @0 빅엔디안. start는 DBC 표기대로 MSB 위치
+};
+
+typedef struct {
+    const char* name;
+    uint16_t    msg;        // 소속 메시지 (*_db_messages 인덱스)
+    uint16_t    start;      // 인텔: LSB 비트 번호, 모토로라: MSB 비트 번호
+    uint8_t     len;        // 비트 수 (1..64)
+    uint8_t     flags;      // CANDB_SIG_*
+    double      factor;
+    double      offset;
+    double      min;        // min == max 이면 범위 없음
+    double      max;
+} CanDbSignal;
+
+typedef can_err_t (*candb_decode_fn)(const CanFrame* fr, void* out);
+
+typedef struct {
+    const char*     name;
+    uint32_t        id;
+    uint32_t        flags;      // CAN_FRAME_EXTID, CAN_FRAME_FD
+    uint8_t         len;        // DBC에 적힌 payload 길이
+    uint16_t        first_sig;  // *_db_signals 시작 인덱스
+    uint16_t        n_sigs;
+    candb_decode_fn decode;     // 메시지 struct로 unpack
+} CanDbMessage;
+
+// 버스 하나의 디스크립터 테이블 (생성 헤더의 <버스>_db). can_subscribe_signal 등 라이브러리 런타임 경로에 넘긴다
+typedef struct CanDb {
+    const CanDbMessage* messages;
+    const CanDbSignal*  signals;
+    uint16_t            n_msgs;
+    uint16_t            n_sigs;
+} CanDb;
+
+static inline float candb_f32(uint32_t r){ float f; memcpy(&f, &r, sizeof(f)); return f; }
+static inline double candb_f64(uint64_t r){ double f; memcpy(&f, &r, sizeof(f)); return f; }
+static inline uint32_t candb_u32(float f){ uint32_t r; memcpy(&r, &f, sizeof(r)); return r; }
+static inline uint64_t candb_u64(double f){ uint64_t r; memcpy(&r, &f, sizeof(r)); return r; }
+
+// 디스크립터로 raw 비트를 꺼낸다 (생성된 unpack을 쓸 수 없는 범용 경로)
+static inline uint64_t candb_signal_raw(const CanDbSignal* s, const uint8_t* d){
+    uint64_t r = 0;
+    if (!(s->flags & CANDB_SIG_MOTOROLA)) {
+        unsigned pos = s->start, got = 0;
+        while (got < s->len) {
+            unsigned lo = pos & 7u, n = 8u - lo;
+            if (n > s->len - got) n = s->len - got;
+            r |= (uint64_t)((d[pos >> 3] >> lo) & ((1u << n) - 1u)) << got;
+            got += n; pos += n;
+        }
+    } else {
+        unsigned pos = s->start;
+        for (unsigned i = 0; i < s->len; ++i) {
+            r = (r << 1) | ((d[pos >> 3] >> (pos & 7u)) & 1u);
+            pos = (pos & 7u) ? pos - 1u : pos + 15u;
+        }
+    }
+    return r;
+}
+
+// raw → 물리값 (부호 확장, float 재해석, factor/offset)
+static inline double candb_signal_phys(const CanDbSignal* s, uint64_t raw){
+    if (s->flags & CANDB_SIG_FLOAT)
+        return s->len == 32 ? (double)candb_f32((uint32_t)raw) : candb_f64(raw);
+    double v;
+    if ((s->flags & CANDB_SIG_SIGNED) && s->len < 64) {
+        unsigned sh = 64u - s->len;
+        v = (double)((int64_t)(raw << sh) >> sh);
+    } else if (s->flags & CANDB_SIG_SIGNED) {
+        v = (double)(int64_t)raw;
+    } else {
+        v = (double)raw;
+    }
+    return v * s->factor + s->offset;
+}
+
+static inline double candb_signal_get(const CanDbSignal* s, const uint8_t* d){
+    return candb_signal_phys(s, candb_signal_raw(s, d));
+}
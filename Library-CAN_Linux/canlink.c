@@ -0,0 +1,467 @@
+#define _GNU_SOURCE
+#include "canlink.h"
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
+
+#define CANLINK_BUF         16384   // RTM_GETLINK 응답 (통계 포함 수 KB)
+#define CANLINK_REQ         512
+
+typedef struct {
+    struct nlmsghdr     n;
+    union {
+        struct ifinfomsg    i;      // RTM_*LINK
+        struct rtcanmsg     g;      // RTM_*ROUTE (CAN_GW)
+    };
+    char                buf[CANLINK_REQ];
+} LinkReq;
+
+static uint64_t mono_us(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000ULL + (uint64_t)ts.tv_nsec/1000ULL;
+}
+
+/* ========= 메시지 만들기 ========= */
+static struct rtattr* attr_tail(LinkReq* r){
+    return (struct rtattr*)((char*)r + NLMSG_ALIGN(r->n.nlmsg_len));
+}
+
+static int attr_put(LinkReq* r, unsigned short type, const void* data, size_t len){
+    size_t alen = RTA_LENGTH(len);
+    if (NLMSG_ALIGN(r->n.nlmsg_len) + RTA_ALIGN(alen) > sizeof(*r)) return -EMSGSIZE;
+    struct rtattr* a = attr_tail(r);
+    a->rta_type = type;
+    a->rta_len  = (unsigned short)alen;
+    if (len) memcpy(RTA_DATA(a), data, len);
+    r->n.nlmsg_len = NLMSG_ALIGN(r->n.nlmsg_len) + RTA_ALIGN(alen);
+    return 0;
+}
+
+static int attr_u32(LinkReq* r, unsigned short type, uint32_t v){
+    return attr_put(r, type, &v, sizeof(v));
+}
+
+static struct rtattr* nest_begin(LinkReq* r, unsigned short type){
+    struct rtattr* a = attr_tail(r);
+    return attr_put(r, type, NULL, 0) == 0 ? a : NULL;
+}
+
+static void nest_end(LinkReq* r, struct rtattr* a){
+    a->rta_len = (unsigned short)((char*)attr_tail(r) - (char*)a);
+}
+
+static void req_init(LinkReq* r, int ifindex, unsigned short type, unsigned short flags){
+    memset(r, 0, sizeof(*r));
+    r->n.nlmsg_len   = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    r->n.nlmsg_type  = type;
+    r->n.nlmsg_flags = NLM_F_REQUEST | flags;
+    r->i.ifi_family  = AF_UNSPEC;
+    r->i.ifi_index   = ifindex;
+}
+
+static void gw_req_init(LinkReq* r, unsigned short type, unsigned short flags){
+    memset(r, 0, sizeof(*r));
+    r->n.nlmsg_len   = NLMSG_LENGTH(sizeof(struct rtcanmsg));
+    r->n.nlmsg_type  = type;
+    r->n.nlmsg_flags = NLM_F_REQUEST | flags;
+    r->g.can_family  = AF_CAN;
+    r->g.gwtype      = CGW_TYPE_CAN_CAN;
+}
+
+/* ========= 주고받기 ========= */
+static int nl_open(void){
+    int s = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (s < 0) return -errno;
+    struct sockaddr_nl sa = { .nl_family = AF_NETLINK };
+    if (bind(s, (struct sockaddr*)&sa, sizeof(sa)) < 0){ int e = errno; close(s); return -e; }
+    return s;
+}
+
+/* 요청을 보내고 같은 seq의 응답을 기다린다. ACK(NLMSG_ERROR)면 그 에러 코드,
+ * 링크 정보(RTM_NEWLINK)가 오면 reply에 복사하고 0 */
+static int nl_talk(int s, LinkReq* r, uint32_t seq, char* reply, size_t cap){
+    r->n.nlmsg_seq = seq;
+    struct sockaddr_nl kernel = { .nl_family = AF_NETLINK };
+    if (sendto(s, &r->n, r->n.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0) return -errno;
+
+    char buf[CANLINK_BUF] __attribute__((aligned(NLMSG_ALIGNTO)));
+    for (;;){
+        ssize_t got = recv(s, buf, sizeof(buf), 0);
+        if (got < 0){
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        int n = (int)got;
+        for (struct nlmsghdr* h = (struct nlmsghdr*)buf; NLMSG_OK(h, n); h = NLMSG_NEXT(h, n)){
+            if (h->nlmsg_seq != seq) continue;
+            if (h->nlmsg_type == NLMSG_ERROR){
+                const struct nlmsgerr* e = (const struct nlmsgerr*)NLMSG_DATA(h);
+                return h->nlmsg_len < NLMSG_LENGTH(sizeof(*e)) ? -EPROTO : e->error;
+            }
+            if (h->nlmsg_type == RTM_NEWLINK && reply){
+                if (h->nlmsg_len > cap) return -EMSGSIZE;
+                memcpy(reply, h, h->nlmsg_len);
+                return 0;
+            }
+        }
+    }
+}
+
+/* 덤프 요청: NLMSG_DONE까지 type 메시지마다 cb. cb가 0이 아닌 값을 돌려주면 나머지는 읽어 버리고 그 값 */
+static int nl_dump(int s, LinkReq* r, uint32_t seq, unsigned short type,
+                   int (*cb)(const struct nlmsghdr* h, void* arg), void* arg){
+    r->n.nlmsg_seq = seq;
+    struct sockaddr_nl kernel = { .nl_family = AF_NETLINK };
+    if (sendto(s, &r->n, r->n.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0) return -errno;
+
+    char buf[CANLINK_BUF] __attribute__((aligned(NLMSG_ALIGNTO)));
+    int res = 0;
+    for (;;){
+        ssize_t got = recv(s, buf, sizeof(buf), 0);
+        if (got < 0){
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        int n = (int)got;
+        for (struct nlmsghdr* h = (struct nlmsghdr*)buf; NLMSG_OK(h, n); h = NLMSG_NEXT(h, n)){
+            if (h->nlmsg_seq != seq) continue;
+            if (h->nlmsg_type == NLMSG_DONE) return res;
+            if (h->nlmsg_type == NLMSG_ERROR){
+                const struct nlmsgerr* e = (const struct nlmsgerr*)NLMSG_DATA(h);
+                return h->nlmsg_len < NLMSG_LENGTH(sizeof(*e)) ? -EPROTO : e->error;
+            }
+            if (h->nlmsg_type == type && !res) res = cb(h, arg);
+        }
+    }
+}
+
+/* ========= 조회 ========= */
+static void parse_can_data(const struct rtattr* data, CanLinkInfo* out){
+    int len = (int)RTA_PAYLOAD(data);
+    for (const struct rtattr* a = (const struct rtattr*)RTA_DATA(data); RTA_OK(a, len); a = RTA_NEXT(a, len)){
+        const void* p = RTA_DATA(a);
+        size_t      pl = RTA_PAYLOAD(a);
+        switch (a->rta_type){
+            case IFLA_CAN_BITTIMING:
+                if (pl >= sizeof(struct can_bittiming)){
+                    const struct can_bittiming* bt = (const struct can_bittiming*)p;
+                    out->bitrate = bt->bitrate; out->sample_point = bt->sample_point; out->sjw = bt->sjw;
+                }
+                break;
+            case IFLA_CAN_DATA_BITTIMING:
+                if (pl >= sizeof(struct can_bittiming)){
+                    const struct can_bittiming* bt = (const struct can_bittiming*)p;
+                    out->dbitrate = bt->bitrate; out->dsample_point = bt->sample_point;
+                }
+                break;
+            case IFLA_CAN_CTRLMODE:
+                if (pl >= sizeof(struct can_ctrlmode)) out->ctrlmode = ((const struct can_ctrlmode*)p)->flags;
+                break;
+            case IFLA_CAN_STATE:
+                if (pl >= 4) memcpy(&out->state, p, 4);
+                break;
+            case IFLA_CAN_RESTART_MS:
+                if (pl >= 4) memcpy(&out->restart_ms, p, 4);
+                break;
+            default: break;
+        }
+    }
+}
+
+static int link_get(int s, int ifindex, CanLinkInfo* out){
+    LinkReq r;
+    req_init(&r, ifindex, RTM_GETLINK, 0);
+    char reply[CANLINK_BUF] __attribute__((aligned(NLMSG_ALIGNTO)));
+    int e = nl_talk(s, &r, 1, reply, sizeof(reply));
+    if (e) return e;
+
+    memset(out, 0, sizeof(*out));
+    const struct nlmsghdr*  h  = (const struct nlmsghdr*)reply;
+    const struct ifinfomsg* ii = (const struct ifinfomsg*)NLMSG_DATA(h);
+    out->up = (ii->ifi_flags & IFF_UP) != 0;
+
+    int len = (int)IFLA_PAYLOAD(h);
+    for (const struct rtattr* a = IFLA_RTA(ii); RTA_OK(a, len); a = RTA_NEXT(a, len)){
+        if (a->rta_type == IFLA_TXQLEN && RTA_PAYLOAD(a) >= 4){
+            memcpy(&out->txqueuelen, RTA_DATA(a), 4);
+        } else if (a->rta_type == IFLA_LINKINFO){
+            int il = (int)RTA_PAYLOAD(a);
+            for (const struct rtattr* b = (const struct rtattr*)RTA_DATA(a); RTA_OK(b, il); b = RTA_NEXT(b, il)){
+                if (b->rta_type == IFLA_INFO_KIND)
+                    out->is_can = RTA_PAYLOAD(b) >= 3 && strncmp((const char*)RTA_DATA(b), "can", RTA_PAYLOAD(b)) == 0;
+                else if (b->rta_type == IFLA_INFO_DATA)
+                    parse_can_data(b, out);
+            }
+        }
+    }
+    return 0;
+}
+
+/* ========= 설정 ========= */
+static int link_set_flags(int s, int ifindex, int up, uint32_t seq){
+    LinkReq r;
+    req_init(&r, ifindex, RTM_NEWLINK, NLM_F_ACK);
+    r.i.ifi_change = IFF_UP;
+    r.i.ifi_flags  = up ? IFF_UP : 0;
+    return nl_talk(s, &r, seq, NULL, 0);
+}
+
+// 드라이버가 tq 단위로 맞추므로 요청값과 실제값이 조금 다를 수 있다 (비트레이트 0.5%, 샘플 포인트 1%)
+static int near(uint32_t want, uint32_t have, uint32_t tol){
+    return want == 0 || (want > have ? want - have : have - want) <= tol;
+}
+
+static int can_params_match(const CanLinkConfig* c, const CanLinkInfo* li){
+    if (!near(c->bitrate, li->bitrate, c->bitrate / 200)) return 0;
+    if (c->bitrate && !near(c->sample_point, li->sample_point, 10)) return 0;
+    if (c->bitrate && c->sjw && c->sjw != li->sjw) return 0;
+    if (!near(c->dbitrate, li->dbitrate, c->dbitrate / 200)) return 0;
+    if (c->dbitrate && !near(c->dsample_point, li->dsample_point, 10)) return 0;
+    if ((li->ctrlmode & c->ctrl_mask) != (c->ctrl_flags & c->ctrl_mask)) return 0;
+    if (c->restart_ms >= 0 && (uint32_t)c->restart_ms != li->restart_ms) return 0;
+    return 1;
+}
+
+static int add_bittiming(LinkReq* r, unsigned short type, uint32_t bitrate, uint32_t sp, uint32_t sjw){
+    struct can_bittiming bt;
+    memset(&bt, 0, sizeof(bt));
+    bt.bitrate      = bitrate;
+    bt.sample_point = sp;
+    bt.sjw          = sjw;
+    return attr_put(r, type, &bt, sizeof(bt));
+}
+
+static int link_set_can(int s, int ifindex, const CanLinkConfig* c, int with_can, uint32_t seq){
+    LinkReq r;
+    req_init(&r, ifindex, RTM_NEWLINK, NLM_F_ACK);
+    int e = 0;
+    if (c->txqueuelen > 0) e = attr_u32(&r, IFLA_TXQLEN, (uint32_t)c->txqueuelen);
+
+    if (!e && with_can){
+        struct rtattr* info = nest_begin(&r, IFLA_LINKINFO);
+        if (!info || attr_put(&r, IFLA_INFO_KIND, "can", 3) != 0) return -EMSGSIZE;
+        struct rtattr* data = nest_begin(&r, IFLA_INFO_DATA);
+        if (!data) return -EMSGSIZE;
+        if (c->bitrate)
+            e = add_bittiming(&r, IFLA_CAN_BITTIMING, c->bitrate, c->sample_point, c->sjw);
+        if (!e && c->dbitrate)
+            e = add_bittiming(&r, IFLA_CAN_DATA_BITTIMING, c->dbitrate, c->dsample_point, 0);
+        if (!e && c->ctrl_mask){
+            struct can_ctrlmode cm = { .mask = c->ctrl_mask, .flags = c->ctrl_flags & c->ctrl_mask };
+            e = attr_put(&r, IFLA_CAN_CTRLMODE, &cm, sizeof(cm));
+        }
+        if (!e && c->restart_ms >= 0)
+            e = attr_u32(&r, IFLA_CAN_RESTART_MS, (uint32_t)c->restart_ms);
+        if (e) return e;
+        nest_end(&r, data);
+        nest_end(&r, info);
+    }
+    return e ? e : nl_talk(s, &r, seq, NULL, 0);
+}
+
+/* ========= 공개 API ========= */
+int canlink_get(const char* ifname, CanLinkInfo* out){
+    if (!ifname || !out) return -EINVAL;
+    int ifindex = (int)if_nametoindex(ifname);
+    if (!ifindex) return -ENODEV;
+    int s = nl_open();
+    if (s < 0) return s;
+    int e = link_get(s, ifindex, out);
+    close(s);
+    return e;
+}
+
+int canlink_configure(const char* ifname, const CanLinkConfig* cfg, CanLinkTiming* timing){
+    CanLinkTiming tm;
+    memset(&tm, 0, sizeof(tm));
+    if (!ifname || !cfg) return -EINVAL;
+    uint64_t t0 = mono_us();
+
+    int ifindex = (int)if_nametoindex(ifname);
+    if (!ifindex) return -ENODEV;
+    int s = nl_open();
+    if (s < 0) return s;
+
+    CanLinkInfo li;
+    int e = link_get(s, ifindex, &li);
+    uint64_t t = mono_us();
+    tm.query_us = (uint32_t)(t - t0);
+    if (e) goto out;
+
+    // vcan 등은 CAN 파라미터가 없다 → txqueuelen과 up만
+    int need_can = li.is_can && !can_params_match(cfg, &li);
+    int need_txq = cfg->txqueuelen > 0 && (uint32_t)cfg->txqueuelen != li.txqueuelen;
+    if (li.up && !need_can && !need_txq){
+        tm.reused = 1;
+        goto out;
+    }
+
+    uint32_t seq = 2;
+    int was_up = li.up;
+    if (need_can && li.up){
+        // 비트 타이밍/ctrlmode는 down 상태에서만 바꿀 수 있다 (up이면 -EBUSY)
+        e = link_set_flags(s, ifindex, 0, seq++);
+        uint64_t t1 = mono_us();
+        tm.down_us = (uint32_t)(t1 - t);
+        t = t1;
+        if (e) goto out;
+        li.up = 0;
+    }
+    if (need_can || need_txq){
+        e = link_set_can(s, ifindex, cfg, need_can, seq++);
+        uint64_t t1 = mono_us();
+        tm.config_us = (uint32_t)(t1 - t);
+        t = t1;
+        if (e){
+            if (was_up && !li.up) (void)link_set_flags(s, ifindex, 1, seq++);   // 원래대로 올려 둔다
+            goto out;
+        }
+    }
+    if (!li.up){
+        e = link_set_flags(s, ifindex, 1, seq++);
+        tm.up_us = (uint32_t)(mono_us() - t);
+    }
+
+out:
+    close(s);
+    tm.total_us = (uint32_t)(mono_us() - t0);
+    if (timing) *timing = tm;
+    return e;
+}
+
+int canlink_set_up(const char* ifname, int up){
+    if (!ifname) return -EINVAL;
+    int ifindex = (int)if_nametoindex(ifname);
+    if (!ifindex) return -ENODEV;
+    int s = nl_open();
+    if (s < 0) return s;
+    int e = link_set_flags(s, ifindex, up, 1);
+    close(s);
+    return e;
+}
+
+int canlink_restart(const char* ifname){
+    if (!ifname) return -EINVAL;
+    int ifindex = (int)if_nametoindex(ifname);
+    if (!ifindex) return -ENODEV;
+    int s = nl_open();
+    if (s < 0) return s;
+
+    LinkReq r;
+    req_init(&r, ifindex, RTM_NEWLINK, NLM_F_ACK);
+    struct rtattr* info = nest_begin(&r, IFLA_LINKINFO);
+    struct rtattr* data = NULL;
+    int e = (info && attr_put(&r, IFLA_INFO_KIND, "can", 3) == 0 &&
+             (data = nest_begin(&r, IFLA_INFO_DATA)) != NULL &&
+             attr_u32(&r, IFLA_CAN_RESTART, 1) == 0) ? 0 : -EMSGSIZE;
+    if (!e){
+        nest_end(&r, data);
+        nest_end(&r, info);
+        e = nl_talk(s, &r, 1, NULL, 0);
+    }
+    close(s);
+    return e;
+}
+
+/* ========= CAN_GW ========= */
+static int gw_build(LinkReq* r, int src, int dst, const CanGwRule* g){
+    r->g.flags = g->flags;
+    int fd = (g->flags & CGW_FLAGS_CAN_FD) != 0;
+    int e = 0;
+    for (int i = 0; i < CGW_MOD_FUNCS && !e; ++i){
+        const CanGwMod* m = &g->mods[i];
+        if (m->type < CGW_MOD_AND || m->type > CGW_MOD_SET || !m->modtype) continue;
+        if (fd){
+            struct cgw_fdframe_mod fm;
+            memset(&fm, 0, sizeof(fm));
+            fm.cf = m->cf;
+            fm.modtype = m->modtype;
+            e = attr_put(r, (unsigned short)(m->type - CGW_MOD_AND + CGW_FDMOD_AND), &fm, sizeof(fm));
+        } else {
+            struct cgw_frame_mod cm;
+            memset(&cm, 0, sizeof(cm));
+            cm.cf.can_id = m->cf.can_id;
+            cm.cf.len    = m->cf.len;
+            memcpy(cm.cf.data, m->cf.data, CAN_MAX_DLEN);
+            cm.modtype = m->modtype & (CGW_MOD_ID | CGW_MOD_DLC | CGW_MOD_DATA);
+            e = attr_put(r, (unsigned short)m->type, &cm, sizeof(cm));
+        }
+    }
+    if (!e && g->uid)        e = attr_u32(r, CGW_MOD_UID, g->uid);
+    if (!e && g->limit_hops) e = attr_put(r, CGW_LIM_HOPS, &g->limit_hops, 1);
+    if (!e) e = attr_put(r, CGW_FILTER, &g->filter, sizeof(g->filter));
+    if (!e) e = attr_u32(r, CGW_SRC_IF, (uint32_t)src);
+    if (!e) e = attr_u32(r, CGW_DST_IF, (uint32_t)dst);
+    return e;
+}
+
+static int gw_job(unsigned short type, const char* src_if, const char* dst_if, const CanGwRule* rule){
+    if (!src_if || !dst_if || !rule) return -EINVAL;
+    int src = (int)if_nametoindex(src_if);
+    int dst = (int)if_nametoindex(dst_if);
+    if (!src || !dst) return -ENODEV;
+    int s = nl_open();
+    if (s < 0) return s;
+
+    LinkReq r;
+    gw_req_init(&r, type, NLM_F_ACK);
+    int e = gw_build(&r, src, dst, rule);
+    if (!e) e = nl_talk(s, &r, 1, NULL, 0);
+    close(s);
+    return e;
+}
+
+int canlink_gw_add(const char* src_if, const char* dst_if, const CanGwRule* rule){
+    return gw_job(RTM_NEWROUTE, src_if, dst_if, rule);
+}
+
+int canlink_gw_del(const char* src_if, const char* dst_if, const CanGwRule* rule){
+    return gw_job(RTM_DELROUTE, src_if, dst_if, rule);
+}
+
+typedef struct {
+    uint32_t    uid;
+    CanGwStats* out;
+} GwFind;
+
+static int gw_find_cb(const struct nlmsghdr* h, void* arg){
+    GwFind* fd = (GwFind*)arg;
+    CanGwStats st;
+    memset(&st, 0, sizeof(st));
+    uint32_t uid = 0;
+    int len = (int)NLMSG_PAYLOAD(h, sizeof(struct rtcanmsg));
+    const struct rtattr* a = (const struct rtattr*)((const char*)NLMSG_DATA(h) + NLMSG_ALIGN(sizeof(struct rtcanmsg)));
+    for (; RTA_OK(a, len); a = RTA_NEXT(a, len)){
+        if (RTA_PAYLOAD(a) < 4) continue;
+        switch (a->rta_type){
+            case CGW_MOD_UID: memcpy(&uid, RTA_DATA(a), 4); break;
+            case CGW_HANDLED: memcpy(&st.handled, RTA_DATA(a), 4); break;   // 0이면 속성이 빠진다
+            case CGW_DROPPED: memcpy(&st.dropped, RTA_DATA(a), 4); break;
+            case CGW_DELETED: memcpy(&st.deleted, RTA_DATA(a), 4); break;
+            default: break;
+        }
+    }
+    if (uid != fd->uid) return 0;
+    *fd->out = st;
+    return 1;
+}
+
+int canlink_gw_stats(uint32_t uid, CanGwStats* out){
+    if (!uid || !out) return -EINVAL;
+    int s = nl_open();
+    if (s < 0) return s;
+
+    LinkReq r;
+    gw_req_init(&r, RTM_GETROUTE, NLM_F_DUMP);
+    GwFind fd = { uid, out };
+    int e = nl_dump(s, &r, 1, RTM_NEWROUTE, gw_find_cb, &fd);
+    close(s);
+    return e < 0 ? e : (e ? 0 : -ENOENT);
+}
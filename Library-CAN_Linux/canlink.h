@@ -0,0 +1,93 @@
+#pragma once
+#include <stdint.h>
+#include <linux/can.h>
+#include <linux/can/netlink.h>      // CAN_CTRLMODE_*, CAN_STATE_*
+#include <linux/can/gw.h>           // CGW_*
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CAN 인터페이스 설정을 rtnetlink(RTM_NEWLINK)로 프로세스 안에서 바로 한다.
+ * `ip link set ...`(system)이나 libsocketcan 없이 동작하고, adapter_linux.c의 can_open과
+ * 데몬의 기동 코드가 같이 쓴다 (C++에서도 그대로 include).
+ *  - 이미 같은 설정으로 up이면 down/up 없이 그대로 둔다 → 여러 데몬이 같은 인터페이스를 열어도
+ *    버스가 흔들리지 않고, 이 경우엔 CAP_NET_ADMIN도 필요 없다
+ *  - 비트 타이밍이 없는 장치(vcan 등)는 CAN 파라미터를 건너뛰고 txqueuelen/up만 맞춘다
+ *  - 반환은 0 또는 -errno (-EPERM: 권한 없음, -ENODEV: 인터페이스 없음, -EBUSY: 다른 쪽이 사용 중 등)
+ */
+typedef struct {
+    uint32_t    bitrate;        // 0이면 비트 타이밍을 건드리지 않음
+    uint32_t    sample_point;   // 0.1% 단위 (875 = 87.5%). 0이면 드라이버가 계산
+    uint32_t    sjw;            // 0이면 드라이버 기본값
+    uint32_t    dbitrate;       // FD 데이터 구간 (0이면 설정 안 함. ctrl에 CAN_CTRLMODE_FD를 같이 켠다)
+    uint32_t    dsample_point;
+    uint32_t    ctrl_mask;      // 바꿀 CAN_CTRLMODE_* 비트
+    uint32_t    ctrl_flags;     // 그 비트의 값
+    int32_t     txqueuelen;     // 0 이하면 그대로
+    int32_t     restart_ms;     // bus-off 자동 재시작. 음수면 그대로, 0이면 끔
+} CanLinkConfig;
+
+typedef struct {
+    int         up;             // IFF_UP
+    int         is_can;         // IFLA_INFO_KIND == "can" (0: vcan 등)
+    uint32_t    bitrate, sample_point, sjw;
+    uint32_t    dbitrate, dsample_point;
+    uint32_t    ctrlmode;       // CAN_CTRLMODE_*
+    uint32_t    state;          // CAN_STATE_*
+    uint32_t    restart_ms;
+    uint32_t    txqueuelen;
+} CanLinkInfo;
+
+// canlink_configure 구간별 소요 시간 (기동 시간 확인용)
+typedef struct {
+    uint32_t    total_us;
+    uint32_t    query_us;       // 현재 설정 조회 (RTM_GETLINK)
+    uint32_t    down_us;
+    uint32_t    config_us;      // 비트 타이밍/ctrlmode/txqueuelen/restart-ms
+    uint32_t    up_us;          // 드라이버 open까지 (대부분 여기서 시간이 든다)
+    int         reused;         // 1: 이미 같은 설정으로 up이라 조회만 함
+} CanLinkTiming;
+
+int canlink_get         (const char* ifname, CanLinkInfo* out);
+int canlink_configure   (const char* ifname, const CanLinkConfig* cfg, CanLinkTiming* timing);  // down → 설정 → up (timing은 NULL 가능)
+int canlink_set_up      (const char* ifname, int up);
+int canlink_restart     (const char* ifname);   // bus-off 수동 재시작 (restart_ms가 0일 때만, 아니면 -EBUSY)
+
+/*
+ * CAN_GW 전달 규칙 (RTM_NEWROUTE/RTM_DELROUTE, can-gw 모듈).
+ * src_if로 들어온 프레임 중 filter에 맞는 것을 mods로 고쳐 dst_if로 내보낸다. 커널 안에서 끝나므로
+ * 프레임이 사용자 공간을 거치지 않는다.
+ *  - 규칙은 프로세스가 끝나도 남는다. 같은 uid(0이 아닌 값)의 규칙이 이미 있으면 새로 만들지 않고
+ *    고침 값만 바꾸므로, uid를 규칙 내용에서 정하면 재시작해도 규칙이 겹치지 않는다
+ *  - 추가/삭제는 CAP_NET_ADMIN 필요 (-EPERM). 모듈이 없으면 -EPROTONOSUPPORT 등
+ *  - mods는 커널이 AND → OR → XOR → SET 순서로 적용한다 (연산마다 하나)
+ */
+typedef struct {
+    uint8_t             type;       // CGW_MOD_AND / OR / XOR / SET (0: 안 씀)
+    uint8_t             modtype;    // CGW_MOD_ID | CGW_MOD_LEN | CGW_MOD_DATA | CGW_MOD_FLAGS(FD)
+    struct canfd_frame  cf;         // 연산 값 (can_id는 EFF/RTR 플래그 비트 포함, 클래식 규칙은 data 8바이트만)
+} CanGwMod;
+
+typedef struct {
+    uint32_t            uid;
+    struct can_filter   filter;
+    uint8_t             flags;      // CGW_FLAGS_CAN_* (CGW_FLAGS_CAN_FD: FD 프레임만, mods도 FD 형식)
+    uint8_t             limit_hops; // 0이면 모듈 기본값 (max_hops)
+    CanGwMod            mods[CGW_MOD_FUNCS];
+} CanGwRule;
+
+typedef struct {
+    uint32_t    handled;        // 전달한 프레임
+    uint32_t    dropped;        // dst 송신 실패
+    uint32_t    deleted;        // hop 제한/고친 뒤 길이 초과로 버린 프레임
+} CanGwStats;
+
+int canlink_gw_add      (const char* src_if, const char* dst_if, const CanGwRule* rule);
+int canlink_gw_del      (const char* src_if, const char* dst_if, const CanGwRule* rule);   // uid로 찾는다
+int canlink_gw_stats    (uint32_t uid, CanGwStats* out);    // 규칙이 없으면 -ENOENT
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,28 +1,33 @@
 #include "canmessage.h"
 #include <string.h>
 
-CanFrame can_encode_pcan(can_msg_pcan_id_t id, const CanMessage* msg, uint8_t dlc){
+/* 8바이트를 넘으면 FD 프레임으로 만들고, 길이는 FD에서 쓸 수 있는 값으로 올림 (남는 칸은 0) */
+static CanFrame encode_frame(uint32_t id, const CanMessage* msg, uint8_t dlc){
     CanFrame fr = {0};
+    if (dlc > CAN_FRAME_DATA_MAX) dlc = CAN_FRAME_DATA_MAX;
     fr.id   = id;
     fr.dlc  = dlc;
     memcpy(fr.data, msg->raw, dlc);
     fr.flags = 0; // 필요시 확장 ID 플래그 세팅
+    if (dlc > 8) {
+        fr.flags |= CAN_FRAME_FD | CAN_FRAME_BRS;
+        fr.dlc = can_dlc_to_len(can_len_to_dlc(dlc));
+    }
     return fr;
 }
 
+CanFrame can_encode_pcan(can_msg_pcan_id_t id, const CanMessage* msg, uint8_t dlc){
+    return encode_frame(id, msg, dlc);
+}
+
 CanFrame can_encode_bcan(can_msg_bcan_id_t id, const CanMessage* msg, uint8_t dlc){
-    CanFrame fr = {0};
-    fr.id   = id;
-    fr.dlc  = dlc;
-    memcpy(fr.data, msg->raw, dlc);
-    fr.flags = 0; // 필요시 확장 ID 플래그 세팅
-    return fr;
+    return encode_frame(id, msg, dlc);
 }
 
 can_err_t can_decode_pcan(const CanFrame* fr, can_msg_pcan_id_t* id, CanMessage* payload){
     if (!fr || !payload) return CAN_ERR_INVALID;
     memset(payload, 0, sizeof(*payload));
-    memcpy(payload->raw, fr->data, fr->dlc);
+    memcpy(payload->raw, fr->data, fr->dlc > CAN_FRAME_DATA_MAX ? CAN_FRAME_DATA_MAX : fr->dlc);
     *id = fr->id;
     return CAN_OK;
 }
@@ -30,7 +35,7 @@ can_err_t can_decode_pcan(const CanFrame* fr, can_msg_pcan_id_t* id, CanMessage*
 can_err_t can_decode_bcan(const CanFrame* fr, can_msg_bcan_id_t* id, CanMessage* payload){
     if (!fr || !payload) return CAN_ERR_INVALID;
     memset(payload, 0, sizeof(*payload));
-    memcpy(payload->raw, fr->data, fr->dlc);
+    memcpy(payload->raw, fr->data, fr->dlc > CAN_FRAME_DATA_MAX ? CAN_FRAME_DATA_MAX : fr->dlc);
     *id = fr->id;
     return CAN_OK;
 }
\ No newline at end of file
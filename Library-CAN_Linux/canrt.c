@@ -0,0 +1,83 @@
+#define _GNU_SOURCE
+#include "canrt.h"
+#include <stdio.h>
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+
+#define CANRT_CAP_IPC_LOCK  14      // linux/capability.h
+
+int canrt_gettid(void){
+    return (int)syscall(SYS_gettid);
+}
+
+static int set_fifo(int tid, int prio){
+    // fork한 자식(카메라 스크립트 등)에는 물려주지 않는다
+    struct sched_param sp = { .sched_priority = prio };
+    if (sched_setscheduler(tid, SCHED_FIFO | SCHED_RESET_ON_FORK, &sp) == 0) return 0;
+    if (errno != EPERM) return -errno;
+
+    // CAP_SYS_NICE가 없어도 RLIMIT_RTPRIO(limits.conf의 rtprio) 안에서는 된다
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_RTPRIO, &rl) == 0 && rl.rlim_cur > 0 && rl.rlim_cur < (rlim_t)prio){
+        sp.sched_priority = (int)rl.rlim_cur;
+        if (sched_setscheduler(tid, SCHED_FIFO | SCHED_RESET_ON_FORK, &sp) == 0) return 0;
+    }
+    return -EPERM;
+}
+
+int canrt_set_thread(int tid, int priority, uint32_t cpu_mask, int fallback_nice, unsigned* applied){
+    unsigned got = 0;
+    int ret = 0;
+    if (applied) *applied = 0;
+    if (priority < 0 || priority > 99 || fallback_nice < -20 || fallback_nice > 19) return -EINVAL;
+    if (tid == 0) tid = canrt_gettid();     // setpriority는 0을 프로세스로 본다
+
+    if (cpu_mask){
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int i = 0; i < 32; ++i)
+            if (cpu_mask & (1u << i)) CPU_SET(i, &set);
+        if (sched_setaffinity(tid, sizeof(set), &set) == 0) got |= CANRT_PINNED;
+        else ret = -errno;      // -EINVAL: 있는 CPU가 하나도 없음
+    }
+
+    if (priority > 0){
+        int r = set_fifo(tid, priority);
+        if (r == 0) got |= CANRT_FIFO;
+        else {
+            if (fallback_nice && setpriority(PRIO_PROCESS, (id_t)tid, fallback_nice) == 0) got |= CANRT_NICE;
+            if (!ret) ret = r;
+        }
+    } else {
+        // 0: 전에 걸었던 SCHED_FIFO를 되돌림 (낮추는 것은 권한 없이 된다)
+        struct sched_param sp = { .sched_priority = 0 };
+        if (sched_setscheduler(tid, SCHED_OTHER, &sp) != 0 && !ret) ret = -errno;
+    }
+
+    if (applied) *applied = got;
+    return ret;
+}
+
+static int has_cap(int cap){
+    FILE* f = fopen("/proc/self/status", "r");
+    if (!f) return 0;
+    char line[128];
+    unsigned long long eff = 0;
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, "CapEff: %llx", &eff) == 1) break;
+    fclose(f);
+    return (int)((eff >> cap) & 1u);
+}
+
+int canrt_lock_memory(void){
+    // 한도만 있고 CAP_IPC_LOCK이 없으면 MCL_FUTURE가 뒤의 malloc/mmap/스레드 스택을 한도에서 막아 버린다
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_MEMLOCK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY && !has_cap(CANRT_CAP_IPC_LOCK))
+        return -EPERM;
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) return -errno;
+    return 0;
+}
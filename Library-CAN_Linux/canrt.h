@@ -0,0 +1,29 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CAN 스레드 실시간 설정 (SCHED_FIFO, CPU 고정, mlockall). Linux 전용, C++에서도 그대로 include.
+ * adapter_linux.c의 reactor 스레드와 SCA-Core의 RX 스레드가 같이 쓴다.
+ * 스레드는 tid(gettid)로 가리키므로 다른 스레드에서 이미 돌고 있는 스레드에 걸 수 있다 (0: 부르는 스레드).
+ *  - SCHED_FIFO는 CAP_SYS_NICE 또는 RLIMIT_RTPRIO가 있어야 한다. RLIMIT_RTPRIO만 있으면 그 값으로 낮춰 건다
+ *  - 그래도 안 되면 fallback_nice(0이 아니면)를 대신 걸고 -EPERM (음수 nice도 RLIMIT_NICE 밖이면 못 검)
+ *  - 반환은 0 또는 -errno (canlink와 같음). 일부만 걸렸으면 applied로 무엇이 걸렸는지 알 수 있다
+ */
+#define CANRT_FIFO      0x1u    // SCHED_FIFO
+#define CANRT_NICE      0x2u    // SCHED_FIFO 대신 fallback_nice
+#define CANRT_PINNED    0x4u    // cpu_mask로 고정
+
+int     canrt_gettid        (void);
+int     canrt_set_thread    (int tid, int priority, uint32_t cpu_mask, int fallback_nice, unsigned* applied);
+                            // priority: SCHED_FIFO 1~99 (0: 스케줄러는 그대로), cpu_mask: bit i = CPU i (0: 고정 안 함)
+int     canrt_lock_memory   (void);     // mlockall(MCL_CURRENT | MCL_FUTURE). -EPERM/-ENOMEM: CAP_IPC_LOCK 또는 RLIMIT_MEMLOCK 부족
+
+#ifdef __cplusplus
+}
+#endif
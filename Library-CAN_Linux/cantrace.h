@@ -0,0 +1,68 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "can_api.h"
+
+/*
+ * 기록/재생 어댑터(adapter_trace.c)의 트레이스 파일 형식. 채널 하나에 파일 하나 (<dir>/<채널>.cantrace).
+ *  - 64바이트 헤더 뒤에 레코드가 이어진다. 레코드는 16바이트 머리 + payload (8바이트 단위로 올림)
+ *    → 클래식 8바이트 프레임은 24바이트, FD 64바이트는 80바이트
+ *  - 기록 중에는 파일을 max_bytes로 늘려(sparse) mmap하고 앞에서부터 채운다. size8이 0인 레코드가 끝
+ *  - 정상 종료하면 헤더 end에 마지막 위치를 쓰고 파일을 그 길이로 줄인다
+ *  - 값은 모두 기록한 머신의 바이트 순서 (리틀 엔디안)
+ */
+#define CANTRACE_MAGIC      "CANTRACE"
+#define CANTRACE_VERSION    1
+
+enum {
+    CANTRACE_RX = 0,
+    CANTRACE_TX = 1
+};
+
+typedef struct {
+    char        magic[8];       // CANTRACE_MAGIC (NUL 없음)
+    uint32_t    version;
+    uint32_t    hdr_size;       // sizeof(CanTraceHeader). 첫 레코드 위치
+    uint64_t    start_unix_ns;  // 기록 시작 시각 (CLOCK_REALTIME, 참고용)
+    uint64_t    end;            // 마지막 레코드 끝 위치 (0: 기록 중이거나 비정상 종료 → size8로 끝을 찾는다)
+    char        channel[16];
+    int32_t     bitrate;
+    int32_t     fd;             // CanConfig.fd
+    uint64_t    reserved;
+} CanTraceHeader;
+
+typedef struct {
+    uint64_t    ts_ns;          // 기록 세션(can_init) 시작 기준 (CLOCK_MONOTONIC). 채널 파일끼리 같은 기준
+    uint32_t    id;
+    uint8_t     len;            // payload 바이트 (CanFrame.dlc)
+    uint8_t     flags;          // CanFrame.flags 하위 8비트
+    uint8_t     dir;            // CANTRACE_RX / CANTRACE_TX
+    uint8_t     size8;          // 레코드 전체 길이 / 8. 다 쓴 뒤에 채운다 (0: 여기서 끝)
+} CanTraceRec;
+
+#ifdef __cplusplus
+static_assert(sizeof(CanTraceHeader) == 64 && sizeof(CanTraceRec) == 16, "cantrace layout");
+#else
+_Static_assert(sizeof(CanTraceHeader) == 64 && sizeof(CanTraceRec) == 16, "cantrace layout");
+#endif
+
+static inline size_t cantrace_rec_size(uint8_t len){
+    return sizeof(CanTraceRec) + (((size_t)len + 7u) & ~(size_t)7u);
+}
+
+// off 위치의 레코드. 끝이거나 깨졌으면 NULL. 다음 레코드는 off + size8 * 8
+static inline const CanTraceRec* cantrace_at(const uint8_t* base, size_t size, size_t off){
+    if (off + sizeof(CanTraceRec) > size) return NULL;
+    const CanTraceRec* r = (const CanTraceRec*)(base + off);
+    if (r->size8 == 0 || r->len > CAN_FRAME_DATA_MAX) return NULL;
+    if ((size_t)r->size8 * 8u != cantrace_rec_size(r->len) || off + (size_t)r->size8 * 8u > size) return NULL;
+    return r;
+}
+
+static inline void cantrace_to_frame(const CanTraceRec* r, CanFrame* out){
+    out->id    = r->id;
+    out->dlc   = r->len;
+    out->flags = r->flags;
+    memcpy(out->data, r + 1, r->len);
+}
@@ -1,6 +1,35 @@
 #include "channel.h"
+#include "isotp.h"
+#include "periodwatch.h"
+#include "sigwatch.h"
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/eventfd.h>
+#endif
+
+// 어댑터로 내려보낼 (id, mask) 필터 최대 개수. 넘으면 전체 허용으로 둔다.
+#define CHANNEL_HW_FILTER_MAX   64
+#define CHANNEL_ID_MASK         0x1FFFFFFFu
+
+// 디스패치 테이블
+#define DISPATCH_SFF_COUNT      2048        // 11-bit ID 직접 인덱스
+#define DISPATCH_EXACT_SPAN     16          // 이 이하 폭의 RANGE는 확장 ID 해시에 펼쳐 넣는다
+#define DISPATCH_HASH_EMPTY     0xFFFFFFFFu
+
+// can_recv 수신 링 기본 크기 (CanConfig.rxQueueDepth == 0)
+#define CHANNEL_RXQ_DEFAULT     256
+
+// ID별 통계에서 확장 ID를 담을 해시 칸 수 (넘치면 id_stats 대신 eff_overflow만 센다)
+#define ID_STATS_EFF_SLOTS      512
+
+struct DispatchTable;
+struct IdStatTable;
 
 struct Channel {
     char*       name;
@@ -11,8 +40,59 @@ struct Channel {
     struct Job* jobs;
     int         next_job_id;
 
+    // 구독 목록은 쓰는 쪽(subscribe/unsubscribe)만 sub_mtx로 보호한다.
+    // RX 경로는 subs를 보지 않고, 구독 변경 때마다 새로 만든 디스패치 테이블을
+    // 원자적으로 교체(RCU)한 것만 읽으므로 락을 잡지 않는다.
+    pthread_mutex_t sub_mtx;
     struct Sub* subs;
+    struct WatchSub* watches;   // 내용 변화 구독 (어댑터가 직접 콜백, 디스패치 테이블 밖)
     int         next_sub_id;
+
+    int         has_reader;     // channel_read 사용 중이면 하드웨어 필터를 열어둔다
+    _Atomic(struct AsyncSub*) rxq;  // channel_read용 수신 링 (RX 스레드만 채움, 처음 읽을 때 생성)
+
+    _Atomic(struct DispatchTable*) table;
+    atomic_uint_fast64_t           rx_epoch;   // 홀수: RX 스레드가 테이블을 읽는 중
+    struct Retired*                retired;    // 교체된 뒤 아직 해제하지 못한 테이블
+    atomic_int                     reclaim_pending;    // retired가 남아 있음 → RX가 읽기 구간을 나오며 회수
+    atomic_int                     rx_waiters;  // 진행 중인 콜백이 끝나길 기다리는 unsubscribe 수
+    pthread_cond_t                 rx_cv;       // 〃 깨움 (sub_mtx와 함께, 놓쳐도 짧게 다시 확인)
+
+    struct TpLink* tp_links;    // ISO-TP 연결 (sub_mtx)
+    int            next_tp_id;
+    int            tp_live;     // 아직 닫히지 않은 연결 수 (목록에서 빠졌어도 send/recv가 잡고 있으면 포함, sub_mtx)
+    pthread_cond_t tp_cv;       // tp_live가 0이 되면 깨움 (channel_stop이 기다린다)
+
+    struct PeriodWatcher* pwatch;   // 주기 감시 (처음 can_watch_period 때 만든다, sub_mtx)
+    struct SignalTable*   sigtab;   // 신호 구독 (처음 can_subscribe_signal 때 만든다, sub_mtx)
+
+    // 수신 지연 히스토그램. RX 스레드만 쓰고 can_get_latency는 읽기만 한다.
+    atomic_uint_fast64_t lat_count;
+    atomic_uint_fast64_t lat_sum_us;
+    atomic_uint          lat_max_us;
+    atomic_uint_fast64_t lat_bucket[CAN_LATENCY_BUCKETS];
+
+    // 수신 카운터 (RX 스레드만 쓴다). 송신/에러 카운터는 어댑터가 ch_get_bus_stats로 준다.
+    atomic_uint_fast64_t rx_frames;
+    atomic_uint_fast64_t rx_bytes;
+    atomic_uint_fast64_t rx_bus_ns;
+    atomic_uint_fast64_t err_events;    // on_err 횟수 (어댑터가 통계를 안 주면 err_frames로 보고)
+
+    // ID별 통계. can_stats_enable로 처음 켤 때 만들고 channel_stop까지 유지한다.
+    _Atomic(struct IdStatTable*) id_stats;
+    atomic_int                   id_stats_on;
+    int                          stats_all;     // ID별 통계 중엔 하드웨어 필터를 열어둔다 (sub_mtx)
+
+    // 구간 평균(fps, load)용 직전 스냅샷
+    pthread_mutex_t stats_mtx;
+    struct {
+        uint64_t t_ns, rx_frames, rx_bytes, tx_frames, tx_bytes, bus_ns;
+    } stats_prev;
+
+    // 버스 상태 알림 (RX 스레드가 bus_mtx를 잡고 부른다)
+    pthread_mutex_t     bus_mtx;
+    can_bus_callback_t  bus_cb;
+    void*               bus_user;
 };
 
 typedef struct Sub {
@@ -20,9 +100,25 @@ typedef struct Sub {
     CanFilter       filter;
     can_callback_t  cb;
     void*           user;
+    struct AsyncSub* async;     // 비동기 구독이면 cb/user는 async_push/링
+    void          (*release)(void*);    // (선택) RX 스레드가 더 이상 user를 볼 수 없게 된 뒤 호출
     struct Sub*     next;
 } Sub;
 
+typedef struct WatchSub {
+    int              id;        // 구독 ID (일반 구독과 같은 번호 공간)
+    int              watch;     // 어댑터 감시 ID
+    struct WatchSub* next;
+} WatchSub;
+
+typedef struct TpLink {
+    int             id;
+    int             refs;       // 목록 몫 + 진행 중인 send/recv (sub_mtx)
+    void*           link;       // 어댑터가 처리하는 연결 (ch_isotp_*)
+    IsoTp*          tp;         // 사용자 공간 구현 (link 대신)
+    struct TpLink*  next;
+} TpLink;
+
 static char* xstrdup(const char* s){
     if(!s) return NULL;
     size_t n = strlen(s) + 1;
@@ -88,14 +184,815 @@ static void filter_free(CanFilter* f) {
     }
 }
 
+/* ===== 하드웨어/커널 필터 컴파일 =====
+ * 모든 구독 필터의 합집합을 (id, mask) 목록으로 바꾼다.
+ *  - MASK  : 그대로
+ *  - LIST  : id마다 완전 일치 mask
+ *  - RANGE : [min, max]를 2의 거듭제곱으로 정렬된 블록들로 쪼갬
+ * 반환: 개수, 전체 허용이 필요하면 -1
+ */
+static int hw_push(CanFilter* out, int n, int max, uint32_t id, uint32_t mask){
+    if (n < 0) return n;
+    mask &= CHANNEL_ID_MASK;
+    if (mask == 0) return -1;                   // 전부 통과하는 필터
+    id &= mask;
+    for (int i = 0; i < n; ++i){
+        if (out[i].data.mask.mask == mask && out[i].data.mask.id == id) return n;
+    }
+    if (n >= max) return -1;
+    out[n].type = CAN_FILTER_MASK;
+    out[n].data.mask.id   = id;
+    out[n].data.mask.mask = mask;
+    return n + 1;
+}
+
+static int hw_push_range(CanFilter* out, int n, int max, uint32_t lo, uint32_t hi){
+    if (hi > CHANNEL_ID_MASK) hi = CHANNEL_ID_MASK;
+    while (n >= 0 && lo <= hi){
+        // lo에서 시작하는 가장 큰 정렬 블록 중 hi를 넘지 않는 것
+        uint32_t size = lo ? (lo & (~lo + 1)) : (CHANNEL_ID_MASK + 1);
+        while (size > 1 && (uint64_t)lo + size - 1 > hi) size >>= 1;
+        n = hw_push(out, n, max, lo, ~(size - 1));
+        if ((uint64_t)lo + size > hi) break;
+        lo += size;
+    }
+    return n;
+}
+
+static void channel_update_hw_filter(Channel* ch){
+    if (!ch->adapter || !ch->adapter->v->ch_set_filters) return;
+
+    // 내용 변화 구독은 어댑터(BCM)가 따로 받으므로 raw 필터에 넣지 않는다.
+    // 구독이 감시뿐이면 빈 필터(0개)로 raw 소켓에는 아무것도 안 올라오게 한다.
+    CanFilter hw[CHANNEL_HW_FILTER_MAX];
+    int n = ((ch->subs || ch->watches) && !ch->has_reader && !ch->stats_all) ? 0 : -1;
+    for (Sub* s = ch->subs; s && n >= 0; s = s->next){
+        const CanFilter* f = &s->filter;
+        switch (f->type){
+        case CAN_FILTER_MASK:
+            n = hw_push(hw, n, CHANNEL_HW_FILTER_MAX, f->data.mask.id, f->data.mask.mask);
+            break;
+        case CAN_FILTER_RANGE:
+            if (f->data.range.min <= f->data.range.max)
+                n = hw_push_range(hw, n, CHANNEL_HW_FILTER_MAX, f->data.range.min, f->data.range.max);
+            break;
+        case CAN_FILTER_LIST:
+            for (uint32_t i = 0; i < f->data.list.count && n >= 0; ++i)
+                n = hw_push(hw, n, CHANNEL_HW_FILTER_MAX, f->data.list.list[i], CHANNEL_ID_MASK);
+            break;
+        default:
+            n = -1;
+            break;
+        }
+    }
+    if (n < 0) ch->adapter->v->ch_set_filters(ch->adapter, ch->h, NULL, 0);
+    else       ch->adapter->v->ch_set_filters(ch->adapter, ch->h, hw, (size_t)n);
+}
+
+int             channel_filter_compile(const CanFilter* f, CanFilter* out, int max) {
+    if (!f || !out || max <= 0) return -1;
+    int all = (f->type == CAN_FILTER_MASK  && (f->data.mask.mask & CHANNEL_ID_MASK) == 0) ||
+              (f->type == CAN_FILTER_RANGE && f->data.range.min == 0 && f->data.range.max >= CHANNEL_ID_MASK);
+    if (all) {
+        out[0].type = CAN_FILTER_MASK;
+        out[0].data.mask.id = out[0].data.mask.mask = 0;
+        return 1;
+    }
+    int n = 0;
+    switch (f->type) {
+    case CAN_FILTER_MASK:
+        return hw_push(out, 0, max, f->data.mask.id, f->data.mask.mask);
+    case CAN_FILTER_RANGE:
+        return f->data.range.min <= f->data.range.max
+             ? hw_push_range(out, 0, max, f->data.range.min, f->data.range.max) : 0;
+    case CAN_FILTER_LIST:
+        for (uint32_t i = 0; i < f->data.list.count && n >= 0; ++i)
+            n = hw_push(out, n, max, f->data.list.list[i], CHANNEL_ID_MASK);
+        return n;
+    default:
+        return -1;
+    }
+}
+
+/* ===== 비동기 구독 (구독별 SPSC 링) =====
+ * CAN_SUB_ASYNC_* 구독은 RX 스레드가 콜백 대신 async_push로 링에 넣기만 하고,
+ * 워커 스레드(또는 can_sub_drain을 부르는 호출자)가 꺼내서 콜백한다.
+ * 생산자는 RX 스레드 하나, 소비자도 하나라서 head/tail만으로 락 없이 주고받는다.
+ * DROP_OLDEST에서는 생산자가 가득 찬 링을 그대로 덮어쓰므로, 슬롯마다 seq를 두고
+ * 소비자가 복사 전후로 확인해서 덮어쓰인 슬롯은 건너뛴다.
+ */
+#define ASYNC_DEFAULT_DEPTH     64
+#define ASYNC_MAX_DEPTH         65536
+#define ASYNC_BLOCK_SLICE_MS    10
+#define ASYNC_BLOCK_DEFAULT_MS  10      // CanSubOptions.block_timeout_ms 0일 때
+
+typedef struct {
+    atomic_uint_fast64_t seq;           // 2*pos+1: 쓰는 중, 2*pos+2: pos번째 프레임 완료
+    CanFrame             fr;
+} AsyncSlot;
+
+typedef struct AsyncSub {
+    can_callback_t       cb;
+    void*                user;
+    can_sub_mode_t       mode;
+    can_sub_overflow_t   overflow;
+    uint32_t             block_ms;      // CAN_SUB_BLOCK: 이만큼 기다려도 안 비면 덮어쓴다
+    uint32_t             depth;         // 2의 거듭제곱
+    AsyncSlot*           slots;
+
+    atomic_uint_fast64_t head;          // 생산자(RX 스레드)만 씀
+    atomic_uint_fast64_t tail;          // 소비자만 씀
+
+    atomic_uint_fast64_t delivered;
+    atomic_uint_fast64_t dropped;
+    atomic_uint_fast64_t blocked;
+    atomic_uint          high_water;
+
+    pthread_mutex_t      mtx;           // 잠들고 깨우는 데만 쓴다
+    pthread_cond_t       cv;
+    atomic_int           consumer_waiting;
+    atomic_int           producer_waiting;
+    atomic_int           closing;
+
+    pthread_t            worker;
+    int                  has_worker;
+    int                  efd;           // CAN_SUB_ASYNC_POLL (Linux): 링이 비었다가 채워지면 신호
+    atomic_int           refs;
+} AsyncSub;
+
+static void async_release(AsyncSub* a){
+    if (!a || atomic_fetch_sub(&a->refs, 1) != 1) return;
+#ifdef __linux__
+    if (a->efd >= 0) close(a->efd);
+#endif
+    pthread_cond_destroy(&a->cv);
+    pthread_mutex_destroy(&a->mtx);
+    free(a->slots);
+    free(a);
+}
+
+static void async_wake(AsyncSub* a){
+    pthread_mutex_lock(&a->mtx);
+    pthread_cond_broadcast(&a->cv);
+    pthread_mutex_unlock(&a->mtx);
+}
+
+static void async_notify_fd(AsyncSub* a){
+#ifdef __linux__
+    if (a->efd >= 0){
+        uint64_t one = 1;
+        ssize_t r = write(a->efd, &one, sizeof(one));
+        (void)r;
+    }
+#else
+    (void)a;
+#endif
+}
+
+/* RX 스레드에서 디스패치 테이블을 통해 불린다 (구독의 cb 자리에 들어감) */
+static void async_push(const CanFrame* f, void* user){
+    AsyncSub* a = (AsyncSub*)user;
+    uint64_t h = atomic_load_explicit(&a->head, memory_order_relaxed);
+    uint64_t t = atomic_load(&a->tail);
+
+    if (h - t >= a->depth){
+        int full = 1;
+        if (a->overflow == CAN_SUB_BLOCK){
+            // 기다리는 쪽은 어댑터 RX 스레드 하나(Linux는 모든 채널의 reactor)라서 오래 잡고 있으면
+            // 다른 채널 수신/주기 송신까지 멈춘다 → block_ms까지만 기다리고 안 되면 덮어쓴다
+            atomic_fetch_add_explicit(&a->blocked, 1, memory_order_relaxed);
+            struct timespec end;
+            clock_gettime(CLOCK_REALTIME, &end);
+            uint64_t ens = (uint64_t)end.tv_nsec + (uint64_t)a->block_ms * 1000000ULL;
+            end.tv_sec += (time_t)(ens / 1000000000ULL);
+            end.tv_nsec = (long)(ens % 1000000000ULL);
+            pthread_mutex_lock(&a->mtx);
+            atomic_store(&a->producer_waiting, 1);
+            while (!atomic_load(&a->closing) && (full = h - atomic_load(&a->tail) >= a->depth)){
+                // 소비자가 깨워주지만, 놓치더라도 주기적으로 다시 확인한다
+                struct timespec ts;
+                clock_gettime(CLOCK_REALTIME, &ts);
+                if (ts.tv_sec > end.tv_sec || (ts.tv_sec == end.tv_sec && ts.tv_nsec >= end.tv_nsec)) break;
+                ts.tv_nsec += ASYNC_BLOCK_SLICE_MS * 1000000L;
+                if (ts.tv_nsec >= 1000000000L){ ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+                if (ts.tv_sec > end.tv_sec || (ts.tv_sec == end.tv_sec && ts.tv_nsec > end.tv_nsec)) ts = end;
+                pthread_cond_timedwait(&a->cv, &a->mtx, &ts);
+            }
+            atomic_store(&a->producer_waiting, 0);
+            pthread_mutex_unlock(&a->mtx);
+            if (atomic_load(&a->closing)) return;
+        }
+        if (full) atomic_fetch_add_explicit(&a->dropped, 1, memory_order_relaxed);
+    }
+
+    AsyncSlot* s = &a->slots[h & (a->depth - 1)];
+    atomic_store_explicit(&s->seq, 2*h + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    s->fr = *f;
+    atomic_store_explicit(&s->seq, 2*h + 2, memory_order_release);
+    atomic_store(&a->head, h + 1);
+
+    // head를 올린 뒤에 tail을 다시 본다: 소비자가 이 프레임을 못 보고 잠들었으면 깨운다
+    t = atomic_load(&a->tail);
+    uint64_t used = h + 1 - t;
+    if (used > a->depth) used = a->depth;
+    if (used > atomic_load_explicit(&a->high_water, memory_order_relaxed))
+        atomic_store_explicit(&a->high_water, (unsigned)used, memory_order_relaxed);
+    if (t == h) async_notify_fd(a);
+    if (atomic_load(&a->consumer_waiting)) async_wake(a);
+}
+
+/* 소비자 쪽: 프레임 하나를 꺼낸다. 비었으면 0 */
+static int async_pop(AsyncSub* a, CanFrame* out){
+    for (;;){
+        uint64_t t = atomic_load_explicit(&a->tail, memory_order_relaxed);
+        uint64_t h = atomic_load(&a->head);
+        if (t == h) return 0;
+        if (h - t > a->depth){
+            // 덮어쓰인 구간은 건너뛴다 (생산자가 이미 dropped로 셈)
+            atomic_store(&a->tail, h - a->depth);
+            continue;
+        }
+        const AsyncSlot* s = &a->slots[t & (a->depth - 1)];
+        uint64_t want = 2*t + 2;
+        if (atomic_load_explicit(&s->seq, memory_order_acquire) != want){
+            atomic_store(&a->tail, t + 1);
+            continue;
+        }
+        *out = s->fr;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&s->seq, memory_order_relaxed) != want){
+            atomic_store(&a->tail, t + 1);
+            continue;
+        }
+        atomic_store(&a->tail, t + 1);
+        if (atomic_load(&a->producer_waiting)) async_wake(a);
+        return 1;
+    }
+}
+
+static int async_drain(AsyncSub* a, uint32_t max){
+    CanFrame f;
+    int n = 0;
+    while ((max == 0 || (uint32_t)n < max) && !atomic_load(&a->closing) && async_pop(a, &f)){
+        a->cb(&f, a->user);
+        atomic_fetch_add_explicit(&a->delivered, 1, memory_order_relaxed);
+        n++;
+    }
+    return n;
+}
+
+static void* async_worker_fn(void* arg){
+    AsyncSub* a = (AsyncSub*)arg;
+    while (!atomic_load(&a->closing)){
+        async_drain(a, 0);
+        pthread_mutex_lock(&a->mtx);
+        atomic_store(&a->consumer_waiting, 1);
+        while (!atomic_load(&a->closing) &&
+               atomic_load(&a->head) == atomic_load(&a->tail))
+            pthread_cond_wait(&a->cv, &a->mtx);
+        atomic_store(&a->consumer_waiting, 0);
+        pthread_mutex_unlock(&a->mtx);
+    }
+    async_release(a);       // 워커 몫 참조
+    return NULL;
+}
+
+static AsyncSub* async_create(can_callback_t cb, void* user, const CanSubOptions* opt){
+    uint32_t depth = opt->depth ? opt->depth : ASYNC_DEFAULT_DEPTH;
+    if (depth > ASYNC_MAX_DEPTH) depth = ASYNC_MAX_DEPTH;
+    uint32_t d = 1;
+    while (d < depth) d <<= 1;
+
+    AsyncSub* a = (AsyncSub*)calloc(1, sizeof(AsyncSub));
+    if (!a) return NULL;
+    a->slots = (AsyncSlot*)calloc(d, sizeof(AsyncSlot));
+    if (!a->slots){ free(a); return NULL; }
+    a->cb = cb;
+    a->user = user;
+    a->mode = opt->mode;
+    a->overflow = opt->overflow;
+    a->block_ms = opt->block_timeout_ms ? opt->block_timeout_ms : ASYNC_BLOCK_DEFAULT_MS;
+    a->depth = d;
+    a->efd = -1;
+    for (uint32_t i = 0; i < d; ++i) atomic_init(&a->slots[i].seq, 0);
+    atomic_init(&a->head, 0);
+    atomic_init(&a->tail, 0);
+    atomic_init(&a->delivered, 0);
+    atomic_init(&a->dropped, 0);
+    atomic_init(&a->blocked, 0);
+    atomic_init(&a->high_water, 0);
+    atomic_init(&a->consumer_waiting, 0);
+    atomic_init(&a->producer_waiting, 0);
+    atomic_init(&a->closing, 0);
+    // 구독 테이블 몫 + 정지(async_stop) 몫
+    atomic_init(&a->refs, 2);
+    pthread_mutex_init(&a->mtx, NULL);
+    pthread_cond_init(&a->cv, NULL);
+
+#ifdef __linux__
+    if (a->mode == CAN_SUB_ASYNC_POLL){
+        a->efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (a->efd < 0){ atomic_store(&a->refs, 1); async_release(a); return NULL; }
+    }
+#endif
+    if (a->mode == CAN_SUB_ASYNC_WORKER){
+        atomic_fetch_add(&a->refs, 1);
+        if (pthread_create(&a->worker, NULL, async_worker_fn, a) != 0){
+            atomic_store(&a->refs, 1);
+            async_release(a);
+            return NULL;
+        }
+        a->has_worker = 1;
+    }
+    return a;
+}
+
+/* 더 이상 콜백하지 않게 하고 워커를 정리한다. 링 메모리는 테이블 몫 참조가 풀릴 때 해제 */
+static void async_stop(AsyncSub* a){
+    if (!a) return;
+    atomic_store(&a->closing, 1);
+    async_wake(a);
+    if (a->has_worker){
+        // 워커 자신의 콜백 안에서 구독 해제한 경우엔 join 대신 떼어 둔다
+        if (pthread_equal(a->worker, pthread_self())) pthread_detach(a->worker);
+        else pthread_join(a->worker, NULL);
+    }
+    async_release(a);
+}
+
+/* ===== 디스패치 테이블 =====
+ * 구독 시점에 "ID → 호출할 콜백 목록"을 미리 계산해 둔다.
+ *  - 11-bit ID(0~2047) : sff[id] 인덱스로 바로 콜백 벡터를 찾음
+ *  - 그 이상 ID        : 정확히 지정된 ID(LIST, 전체 mask, 좁은 RANGE)는 해시로,
+ *                        넓은 MASK/RANGE는 wide 목록에서 filter_match
+ * 테이블은 만든 뒤 바뀌지 않으며, 구독이 바뀌면 통째로 새로 만들어 교체한다.
+ */
+typedef struct {
+    can_callback_t cb;
+    void*          user;
+} DispatchEntry;
+
+typedef struct {
+    uint32_t      n;
+    DispatchEntry e[];
+} DispatchVec;
+
+typedef struct {
+    CanFilter      filter;      // RANGE/MASK만 (내부 포인터 없음)
+    DispatchEntry  entry;
+} DispatchWide;
+
+typedef struct DispatchTable {
+    uint16_t      sff[DISPATCH_SFF_COUNT];   // 0: 없음, k: vecs[k-1]
+    DispatchVec** vecs;
+    uint32_t      nvecs;
+
+    uint32_t*     eff_keys;                  // 오픈 어드레싱 (DISPATCH_HASH_EMPTY: 빈 칸)
+    uint16_t*     eff_vals;                  // vecs 인덱스 (sff와 같은 규칙)
+    uint32_t      eff_mask;                  // 용량-1, 0이면 해시 없음
+
+    DispatchWide* wide;
+    uint32_t      nwide;
+} DispatchTable;
+
+typedef struct Retired {
+    DispatchTable*  t;
+    struct AsyncSub* async;      // 이 교체로 빠진 비동기 구독 (테이블과 함께 해제)
+    void          (*release)(void*);    // 이 교체로 빠진 구독의 release(user)
+    void*           release_arg;
+    uint64_t        epoch;       // 교체 시점의 rx_epoch
+    struct Retired* next;
+} Retired;
+
+static void dispatch_free(DispatchTable* t){
+    if (!t) return;
+    for (uint32_t i = 0; i < t->nvecs; ++i) free(t->vecs[i]);
+    free(t->vecs);
+    free(t->eff_keys);
+    free(t->eff_vals);
+    free(t->wide);
+    free(t);
+}
+
+static inline uint32_t dispatch_hash(uint32_t id){
+    id ^= id >> 16; id *= 0x45d9f3bu; id ^= id >> 16;
+    return id;
+}
+
+// 확장 ID(>= 2048)와 매칭될 수 있는 필터인가
+static int filter_reaches_eff(const CanFilter* f){
+    switch (f->type){
+    case CAN_FILTER_RANGE: return f->data.range.max >= DISPATCH_SFF_COUNT;
+    case CAN_FILTER_MASK: {
+        uint32_t hi = CHANNEL_ID_MASK & ~(uint32_t)(DISPATCH_SFF_COUNT - 1);
+        return !((f->data.mask.mask & hi) == hi && (f->data.mask.id & hi) == 0);
+    }
+    case CAN_FILTER_LIST:
+        for (uint32_t i = 0; i < f->data.list.count; ++i)
+            if (f->data.list.list[i] >= DISPATCH_SFF_COUNT) return 1;
+        return 0;
+    default: return 0;
+    }
+}
+
+// 확장 ID 쪽을 해시(정확한 ID 나열)로 처리할 수 있는 필터인가. 아니면 wide.
+static int filter_eff_exact(const CanFilter* f){
+    switch (f->type){
+    case CAN_FILTER_LIST:  return 1;
+    case CAN_FILTER_MASK:  return (f->data.mask.mask & CHANNEL_ID_MASK) == CHANNEL_ID_MASK;
+    case CAN_FILTER_RANGE: return f->data.range.max - f->data.range.min < DISPATCH_EXACT_SPAN;
+    default: return 0;
+    }
+}
+
+/* 새 벡터를 만들거나, 직전에 만든 벡터와 내용이 같으면 재사용한다 */
+static uint16_t dispatch_intern(DispatchTable* t, const DispatchEntry* es, uint32_t n, int* ok){
+    if (n == 0) return 0;
+    if (t->nvecs){
+        const DispatchVec* last = t->vecs[t->nvecs-1];
+        if (last->n == n && memcmp(last->e, es, n*sizeof(*es)) == 0) return (uint16_t)t->nvecs;
+    }
+    if (t->nvecs >= 0xFFFF){ *ok = 0; return 0; }
+    DispatchVec* v = (DispatchVec*)malloc(sizeof(DispatchVec) + n*sizeof(DispatchEntry));
+    DispatchVec** nv = (DispatchVec**)realloc(t->vecs, (t->nvecs+1)*sizeof(*nv));
+    if (!v || !nv){ free(v); if (nv) t->vecs = nv; *ok = 0; return 0; }
+    v->n = n;
+    memcpy(v->e, es, n*sizeof(*es));
+    t->vecs = nv;
+    t->vecs[t->nvecs++] = v;
+    return (uint16_t)t->nvecs;
+}
+
+static inline const DispatchVec* dispatch_lookup_eff(const DispatchTable* t, uint32_t id);
+
+static void eff_insert(DispatchTable* t, uint32_t id, uint16_t vi){
+    uint32_t i = dispatch_hash(id) & t->eff_mask;
+    while (t->eff_keys[i] != DISPATCH_HASH_EMPTY){
+        if (t->eff_keys[i] == id) return;         // 이미 있음
+        i = (i + 1) & t->eff_mask;
+    }
+    t->eff_keys[i] = id;
+    t->eff_vals[i] = vi;
+}
+
+static DispatchTable* dispatch_build(const Sub* subs){
+    DispatchTable* t = (DispatchTable*)calloc(1, sizeof(DispatchTable));
+    if (!t) return NULL;
+
+    uint32_t nsubs = 0;
+    for (const Sub* s = subs; s; s = s->next) nsubs++;
+    if (nsubs == 0) return t;
+
+    int ok = 1;
+    DispatchEntry* es = (DispatchEntry*)malloc(nsubs*sizeof(DispatchEntry));
+    if (!es){ dispatch_free(t); return NULL; }
+
+    // (1) 11-bit ID 테이블
+    for (uint32_t id = 0; id < DISPATCH_SFF_COUNT && ok; ++id){
+        uint32_t n = 0;
+        for (const Sub* s = subs; s; s = s->next){
+            if (!filter_match(&s->filter, id)) continue;
+            es[n].cb = s->cb; es[n].user = s->user; n++;
+        }
+        t->sff[id] = dispatch_intern(t, es, n, &ok);
+    }
+
+    // (2) 확장 ID: 정확한 ID는 해시, 나머지는 wide
+    uint32_t nkeys = 0;
+    for (const Sub* s = subs; s; s = s->next){
+        const CanFilter* f = &s->filter;
+        if (!filter_reaches_eff(f)) continue;
+        if (!filter_eff_exact(f)){ t->nwide++; continue; }
+        if (f->type == CAN_FILTER_LIST)       nkeys += f->data.list.count;
+        else if (f->type == CAN_FILTER_RANGE) nkeys += f->data.range.max - f->data.range.min + 1;
+        else                                  nkeys += 1;
+    }
+    if (nkeys && ok){
+        uint32_t cap = 8;
+        while (cap < nkeys*2) cap <<= 1;
+        t->eff_keys = (uint32_t*)malloc(cap*sizeof(uint32_t));
+        t->eff_vals = (uint16_t*)calloc(cap, sizeof(uint16_t));
+        if (!t->eff_keys || !t->eff_vals) ok = 0;
+        else {
+            memset(t->eff_keys, 0xFF, cap*sizeof(uint32_t));
+            t->eff_mask = cap - 1;
+        }
+    }
+    for (const Sub* s = subs; s && ok && t->eff_mask; s = s->next){
+        const CanFilter* f = &s->filter;
+        if (!filter_reaches_eff(f) || !filter_eff_exact(f)) continue;
+        uint32_t lo, hi; const uint32_t* list = NULL;
+        if (f->type == CAN_FILTER_LIST){ list = f->data.list.list; lo = 0; hi = f->data.list.count; }
+        else if (f->type == CAN_FILTER_RANGE){ lo = f->data.range.min; hi = f->data.range.max + 1; }
+        else { lo = f->data.mask.id & CHANNEL_ID_MASK; hi = lo + 1; }
+        for (uint32_t k = lo; k < hi && ok; ++k){
+            uint32_t id = list ? list[k] : k;
+            if (id < DISPATCH_SFF_COUNT || dispatch_lookup_eff(t, id)) continue;
+            // 이 ID에 걸리는 (wide가 아닌) 구독 전부를 모은다
+            uint32_t n = 0;
+            for (const Sub* o = subs; o; o = o->next){
+                if (!filter_eff_exact(&o->filter) || !filter_match(&o->filter, id)) continue;
+                es[n].cb = o->cb; es[n].user = o->user; n++;
+            }
+            uint16_t vi = dispatch_intern(t, es, n, &ok);
+            if (ok) eff_insert(t, id, vi);
+        }
+    }
+    if (t->nwide && ok){
+        t->wide = (DispatchWide*)malloc(t->nwide*sizeof(DispatchWide));
+        if (!t->wide) ok = 0;
+        uint32_t k = 0;
+        for (const Sub* s = subs; s && ok; s = s->next){
+            if (!filter_reaches_eff(&s->filter) || filter_eff_exact(&s->filter)) continue;
+            t->wide[k].filter = s->filter;
+            t->wide[k].entry.cb = s->cb; t->wide[k].entry.user = s->user;
+            k++;
+        }
+    }
+    free(es);
+    if (!ok){ dispatch_free(t); return NULL; }
+    return t;
+}
+
+static inline const DispatchVec* dispatch_lookup_eff(const DispatchTable* t, uint32_t id){
+    if (!t->eff_mask) return NULL;
+    uint32_t i = dispatch_hash(id) & t->eff_mask;
+    for (;;){
+        uint32_t k = t->eff_keys[i];
+        if (k == id) return t->eff_vals[i] ? t->vecs[t->eff_vals[i]-1] : NULL;
+        if (k == DISPATCH_HASH_EMPTY) return NULL;
+        i = (i + 1) & t->eff_mask;
+    }
+}
+
+/* 교체된 테이블 중 RX 스레드가 더 이상 볼 수 없는 것을 해제 (sub_mtx 보유 상태에서 호출).
+ * 교체 때 못 한 것은 RX 스레드가 그 읽기 구간을 나오면서 다시 부른다. */
+static void dispatch_reclaim(Channel* ch, int force){
+    uint64_t now = atomic_load(&ch->rx_epoch);
+    Retired** pp = &ch->retired;
+    while (*pp){
+        Retired* r = *pp;
+        // 교체 시점에 RX가 밖에 있었거나(짝수), 그 뒤로 한 번이라도 빠져나갔으면 안전
+        if (force || (r->epoch & 1) == 0 || now != r->epoch){
+            *pp = r->next;
+            dispatch_free(r->t);
+            async_release(r->async);
+            if (r->release) r->release(r->release_arg);
+            free(r);
+        } else {
+            pp = &r->next;
+        }
+    }
+    atomic_store(&ch->reclaim_pending, ch->retired != NULL);
+}
+
+/* 이 스레드가 지금 디스패치 중인 채널 (콜백 안에서 불린 unsubscribe는 자기 자신을 기다릴 수 없다) */
+static _Thread_local const Channel* rx_dispatching;
+
+/* epoch(교체 직후 읽은 rx_epoch)에 진행 중이던 읽기 구간이 끝날 때까지 기다린다 (sub_mtx 없이 호출) */
+static void dispatch_quiesce(Channel* ch, uint64_t epoch){
+    if ((epoch & 1) == 0 || rx_dispatching == ch) return;
+    pthread_mutex_lock(&ch->sub_mtx);
+    atomic_fetch_add(&ch->rx_waiters, 1);
+    while (atomic_load(&ch->rx_epoch) == epoch) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += 1000000L;
+        if (ts.tv_nsec >= 1000000000L){ ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+        pthread_cond_timedwait(&ch->rx_cv, &ch->sub_mtx, &ts);
+    }
+    atomic_fetch_sub(&ch->rx_waiters, 1);
+    pthread_mutex_unlock(&ch->sub_mtx);
+}
+
+/* subs 변경 후 호출 (sub_mtx 보유). removed: 이번에 빠진 구독 (없으면 NULL).
+ * 실패하면 이전 테이블을 유지한다. */
+static can_err_t dispatch_publish(Channel* ch, const Sub* removed){
+    DispatchTable* nt = dispatch_build(ch->subs);
+    if (!nt) return CAN_ERR_MEMORY;
+    Retired* r = (Retired*)malloc(sizeof(Retired));
+    if (!r){ dispatch_free(nt); return CAN_ERR_MEMORY; }
+
+    DispatchTable* old = atomic_exchange(&ch->table, nt);
+    r->t = old;
+    r->async = removed ? removed->async : NULL;
+    r->release = removed ? removed->release : NULL;
+    r->release_arg = removed ? removed->user : NULL;
+    r->epoch = atomic_load(&ch->rx_epoch);
+    r->next = ch->retired;
+    ch->retired = r;
+    dispatch_reclaim(ch, 0);
+    return CAN_OK;
+}
+
+static inline uint64_t channel_now_ns(void){
+    // 어댑터 타임스탬프와 같은 시계 (ESP-IDF에서도 esp_timer 기반 부팅 후 시간)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* RX 스레드 전용 (쓰는 쪽이 하나라 fetch_add 대신 load/store) */
+static inline void rx_add(atomic_uint_fast64_t* c, uint64_t v){
+    atomic_store_explicit(c, atomic_load_explicit(c, memory_order_relaxed) + v, memory_order_relaxed);
+}
+
+static void latency_record(Channel* ch, uint64_t ts_ns){
+    uint64_t now = channel_now_ns();
+    uint64_t us = now > ts_ns ? (now - ts_ns) / 1000u : 0;
+    unsigned b = us < 2 ? 0 : (unsigned)(63 - __builtin_clzll(us));
+    if (b >= CAN_LATENCY_BUCKETS) b = CAN_LATENCY_BUCKETS - 1;
+    uint32_t us32 = us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+
+    rx_add(&ch->lat_bucket[b], 1);
+    rx_add(&ch->lat_sum_us, us);
+    if (us32 > atomic_load_explicit(&ch->lat_max_us, memory_order_relaxed))
+        atomic_store_explicit(&ch->lat_max_us, us32, memory_order_relaxed);
+    rx_add(&ch->lat_count, 1);
+}
+
+/* ===== ID별 수신 통계 =====
+ * RX 스레드만 쓰고 can_get_id_stats는 relaxed로 읽기만 한다 (필드 사이가 한 프레임 어긋날 수 있음).
+ * 표준 ID는 sff[id], 확장 ID는 오픈 어드레싱 해시. 해시 칸은 한 번 차면 비우지 않는다.
+ */
+typedef struct {
+    atomic_uint_fast32_t id;            // eff 칸: DISPATCH_HASH_EMPTY면 빈칸
+    atomic_uint_fast64_t count;
+    atomic_uint_fast64_t last_ns;
+    atomic_uint_fast64_t iv_avg_ns;     // 도착 간격 EWMA (1/16)
+    atomic_uint_fast64_t jit_avg_ns;    // |간격 - 평균| EWMA
+    atomic_uint_fast64_t jit_max_ns;
+} IdStat;
+
+typedef struct IdStatTable {
+    IdStat               sff[DISPATCH_SFF_COUNT];
+    IdStat               eff[ID_STATS_EFF_SLOTS];
+    atomic_uint_fast64_t eff_overflow;
+} IdStatTable;
+
+static IdStatTable* id_stats_create(void){
+    IdStatTable* t = (IdStatTable*)calloc(1, sizeof(IdStatTable));
+    if (!t) return NULL;
+    for (uint32_t i = 0; i < DISPATCH_SFF_COUNT; ++i) atomic_init(&t->sff[i].id, i);
+    for (uint32_t i = 0; i < ID_STATS_EFF_SLOTS; ++i) atomic_init(&t->eff[i].id, DISPATCH_HASH_EMPTY);
+    return t;
+}
+
+static IdStat* id_stats_slot(IdStatTable* t, const CanFrame* f){
+    if (!(f->flags & CAN_FRAME_EXTID) && f->id < DISPATCH_SFF_COUNT) return &t->sff[f->id];
+    uint32_t id = f->id & CHANNEL_ID_MASK;
+    uint32_t i = dispatch_hash(id);
+    for (uint32_t k = 0; k < ID_STATS_EFF_SLOTS; ++k, ++i) {
+        IdStat* s = &t->eff[i & (ID_STATS_EFF_SLOTS - 1)];
+        uint32_t cur = (uint32_t)atomic_load_explicit(&s->id, memory_order_relaxed);
+        if (cur == id) return s;
+        if (cur == DISPATCH_HASH_EMPTY) {
+            atomic_store_explicit(&s->id, id, memory_order_release);
+            return s;
+        }
+    }
+    rx_add(&t->eff_overflow, 1);
+    return NULL;
+}
+
+static void id_stats_record(IdStatTable* t, const CanFrame* f, uint64_t now){
+    IdStat* s = id_stats_slot(t, f);
+    if (!s) return;
+    uint64_t n    = atomic_load_explicit(&s->count, memory_order_relaxed);
+    uint64_t last = atomic_load_explicit(&s->last_ns, memory_order_relaxed);
+    if (n > 0 && now > last) {
+        uint64_t iv  = now - last;
+        uint64_t avg = n == 1 ? iv : atomic_load_explicit(&s->iv_avg_ns, memory_order_relaxed);
+        uint64_t dev = iv > avg ? iv - avg : avg - iv;
+        uint64_t ja  = atomic_load_explicit(&s->jit_avg_ns, memory_order_relaxed);
+        atomic_store_explicit(&s->iv_avg_ns, avg - avg / 16 + iv / 16, memory_order_relaxed);
+        atomic_store_explicit(&s->jit_avg_ns, ja - ja / 16 + dev / 16, memory_order_relaxed);
+        if (dev > atomic_load_explicit(&s->jit_max_ns, memory_order_relaxed))
+            atomic_store_explicit(&s->jit_max_ns, dev, memory_order_relaxed);
+    }
+    atomic_store_explicit(&s->last_ns, now, memory_order_relaxed);
+    atomic_store_explicit(&s->count, n + 1, memory_order_relaxed);
+}
+
+/* ===== channel_read 수신 링 =====
+ * 수신 스레드가 소켓/드라이버 큐를 비우는 어댑터에서 channel_read가 같은 곳을 직접 읽으면
+ * 두 쪽이 프레임을 나눠 가져가 버리므로, 읽는 쪽은 RX 스레드가 채운 링에서만 꺼낸다.
+ * 구독과 같은 AsyncSub 링(DROP_OLDEST, 워커 없음)을 쓰고, 소비자가 여럿일 수 있어 링 mtx로 직렬화한다.
+ */
+static AsyncSub* rxq_create(const CanConfig* cfg){
+    CanSubOptions opt = {
+        .mode     = CAN_SUB_INLINE,
+        .depth    = cfg->rxQueueDepth > 0 ? (uint32_t)cfg->rxQueueDepth : CHANNEL_RXQ_DEFAULT,
+        .overflow = CAN_SUB_DROP_OLDEST
+    };
+    return async_create(NULL, NULL, &opt);      // RX 스레드 몫 + 정지 몫
+}
+
+/* 링을 (없으면 만들어서) 참조를 잡고 돌려준다. 수신 콜백이 없는 어댑터면 NULL */
+static AsyncSub* channel_reader(Channel* ch){
+    AsyncSub* q = atomic_load_explicit(&ch->rxq, memory_order_acquire);
+    if (!q && ch->adapter->v->ch_set_callbacks) {
+        pthread_mutex_lock(&ch->sub_mtx);
+        q = atomic_load(&ch->rxq);
+        if (!q && (q = rxq_create(&ch->cfg))) {
+            atomic_store_explicit(&ch->rxq, q, memory_order_release);
+            // 직접 읽는 쪽은 구독과 무관한 프레임도 받아야 하므로 필터를 연다
+            ch->has_reader = 1;
+            channel_update_hw_filter(ch);
+        }
+        pthread_mutex_unlock(&ch->sub_mtx);
+    }
+    if (q) atomic_fetch_add(&q->refs, 1);
+    return q;
+}
+
+/* 첫 프레임은 timeout_ms까지 기다리고, 나머지는 링에 이미 있는 만큼만 */
+static can_err_t channel_read_ring(AsyncSub* q, CanFrame* out, size_t max, size_t* got, uint32_t timeout_ms){
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec  += timeout_ms / 1000;
+    ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L){ ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+
+    size_t n = 0;
+    pthread_mutex_lock(&q->mtx);
+    for (;;) {
+        while (n < max && async_pop(q, &out[n])) n++;
+        if (n || timeout_ms == 0 || atomic_load(&q->closing)) break;
+        // waiting을 세운 뒤 다시 확인: 그 사이 push한 생산자는 waiting을 못 봤을 수 있다
+        atomic_store(&q->consumer_waiting, 1);
+        if (atomic_load(&q->head) != atomic_load(&q->tail)) continue;
+        if (pthread_cond_timedwait(&q->cv, &q->mtx, &ts) == ETIMEDOUT) {
+            while (n < max && async_pop(q, &out[n])) n++;
+            break;
+        }
+    }
+    atomic_store(&q->consumer_waiting, 0);
+    pthread_mutex_unlock(&q->mtx);
+
+    atomic_fetch_add_explicit(&q->delivered, n, memory_order_relaxed);
+    *got = n;
+    if (n) return CAN_OK;
+    return atomic_load(&q->closing) ? CAN_ERR_STATE : CAN_ERR_TIMEOUT;
+}
+
+static void on_err_from_adapter(can_err_t err, void* user) {
+    (void)err;
+    Channel* ch = (Channel*)user;
+    atomic_fetch_add_explicit(&ch->err_events, 1, memory_order_relaxed);
+}
+
+static void on_bus_from_adapter(can_bus_state_t state, void* user) {
+    Channel* ch = (Channel*)user;
+    pthread_mutex_lock(&ch->bus_mtx);
+    if (ch->bus_cb) ch->bus_cb(state, ch->bus_user);
+    pthread_mutex_unlock(&ch->bus_mtx);
+}
+
 static void on_rx_from_adapter(const CanFrame* f, void* user) {
     Channel* ch = (Channel*)user;
-    for (Sub* s = ch->subs; s; s = s->next) {
-        if (!filter_match(&s->filter, f->id)) continue;
-        can_callback_t cb = s->cb;
-        void* u = s->user;
-        cb(f, u);
+    if (f->timestamp_ns) latency_record(ch, f->timestamp_ns);
+    rx_add(&ch->rx_frames, 1);
+    rx_add(&ch->rx_bytes, f->dlc);
+    rx_add(&ch->rx_bus_ns, can_frame_bus_time_ns(f, ch->cfg.bitrate, ch->cfg.dataBitrate));
+    if (atomic_load_explicit(&ch->id_stats_on, memory_order_relaxed)) {
+        IdStatTable* ids = atomic_load_explicit(&ch->id_stats, memory_order_acquire);
+        if (ids) id_stats_record(ids, f, f->timestamp_ns ? f->timestamp_ns : channel_now_ns());
+    }
+    const Channel* outer = rx_dispatching;
+    rx_dispatching = ch;
+    atomic_fetch_add(&ch->rx_epoch, 1);     // 읽기 구간 시작 (홀수)
+    const DispatchTable* t = atomic_load(&ch->table);
+    if (t) {
+        uint32_t id = f->id;
+        if (id < DISPATCH_SFF_COUNT) {
+            uint16_t vi = t->sff[id];
+            if (vi) {
+                const DispatchVec* v = t->vecs[vi-1];
+                for (uint32_t i = 0; i < v->n; ++i) v->e[i].cb(f, v->e[i].user);
+            }
+        } else {
+            const DispatchVec* v = dispatch_lookup_eff(t, id);
+            if (v) for (uint32_t i = 0; i < v->n; ++i) v->e[i].cb(f, v->e[i].user);
+            for (uint32_t i = 0; i < t->nwide; ++i) {
+                if (filter_match(&t->wide[i].filter, id))
+                    t->wide[i].entry.cb(f, t->wide[i].entry.user);
+            }
+        }
+    }
+    atomic_fetch_add(&ch->rx_epoch, 1);     // 읽기 구간 끝 (짝수)
+    rx_dispatching = outer;
+    if (atomic_load_explicit(&ch->rx_waiters, memory_order_relaxed)) pthread_cond_broadcast(&ch->rx_cv);
+    // 읽는 동안 교체된 테이블은 다음 구독 변경까지 두지 않고 여기서 회수 (구독 API가 잡고 있으면 다음 프레임에)
+    if (outer != ch && atomic_load_explicit(&ch->reclaim_pending, memory_order_relaxed) && pthread_mutex_trylock(&ch->sub_mtx) == 0) {
+        dispatch_reclaim(ch, 0);
+        pthread_mutex_unlock(&ch->sub_mtx);
     }
+
+    // channel_read 쪽은 복사본이 필요하므로 링에 넣는다 (구독 경로와 별개, 읽는 쪽이 있을 때만)
+    AsyncSub* q = atomic_load_explicit(&ch->rxq, memory_order_acquire);
+    if (q) async_push(f, q);
 }
 
 can_err_t       channel_start(const char* name, CanConfig cfg, Adapter* adapter, Channel** out) {
@@ -111,9 +1008,87 @@ can_err_t       channel_start(const char* name, CanConfig cfg, Adapter* adapter,
     }
     ch->cfg = cfg;
     ch->adapter = adapter;
+    if (pthread_mutex_init(&ch->sub_mtx, NULL) != 0) {
+        free(ch->name);
+        free(ch);
+        return CAN_ERR_MEMORY;
+    }
+    if (pthread_mutex_init(&ch->stats_mtx, NULL) != 0) {
+        pthread_mutex_destroy(&ch->sub_mtx);
+        free(ch->name);
+        free(ch);
+        return CAN_ERR_MEMORY;
+    }
+    if (pthread_mutex_init(&ch->bus_mtx, NULL) != 0) {
+        pthread_mutex_destroy(&ch->stats_mtx);
+        pthread_mutex_destroy(&ch->sub_mtx);
+        free(ch->name);
+        free(ch);
+        return CAN_ERR_MEMORY;
+    }
+    if (pthread_cond_init(&ch->tp_cv, NULL) != 0) {
+        pthread_mutex_destroy(&ch->bus_mtx);
+        pthread_mutex_destroy(&ch->stats_mtx);
+        pthread_mutex_destroy(&ch->sub_mtx);
+        free(ch->name);
+        free(ch);
+        return CAN_ERR_MEMORY;
+    }
+    if (pthread_cond_init(&ch->rx_cv, NULL) != 0) {
+        pthread_cond_destroy(&ch->tp_cv);
+        pthread_mutex_destroy(&ch->bus_mtx);
+        pthread_mutex_destroy(&ch->stats_mtx);
+        pthread_mutex_destroy(&ch->sub_mtx);
+        free(ch->name);
+        free(ch);
+        return CAN_ERR_MEMORY;
+    }
+    atomic_init(&ch->table, NULL);
+    atomic_init(&ch->rx_epoch, 0);
+    atomic_init(&ch->reclaim_pending, 0);
+    atomic_init(&ch->rx_waiters, 0);
+    atomic_init(&ch->rxq, NULL);
+    atomic_init(&ch->lat_count, 0);
+    atomic_init(&ch->lat_sum_us, 0);
+    atomic_init(&ch->lat_max_us, 0);
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; ++i) atomic_init(&ch->lat_bucket[i], 0);
+    atomic_init(&ch->rx_frames, 0);
+    atomic_init(&ch->rx_bytes, 0);
+    atomic_init(&ch->rx_bus_ns, 0);
+    atomic_init(&ch->err_events, 0);
+    atomic_init(&ch->id_stats, NULL);
+    atomic_init(&ch->id_stats_on, 0);
+    ch->stats_prev.t_ns = channel_now_ns();
+
+    // 수신 링 크기를 정해 주면 첫 channel_read 전에 들어온 프레임도 받아 둔다
+    AsyncSub* rxq = NULL;
+    if (cfg.rxQueueDepth > 0 && adapter->v->ch_set_callbacks) {
+        rxq = rxq_create(&cfg);
+        if (!rxq) {
+            pthread_cond_destroy(&ch->rx_cv);
+            pthread_cond_destroy(&ch->tp_cv);
+            pthread_mutex_destroy(&ch->bus_mtx);
+            pthread_mutex_destroy(&ch->stats_mtx);
+            pthread_mutex_destroy(&ch->sub_mtx);
+            free(ch->name);
+            free(ch);
+            return CAN_ERR_MEMORY;
+        }
+        atomic_store(&ch->rxq, rxq);
+        ch->has_reader = 1;
+    }
 
     can_err_t e = adapter->v->ch_open(adapter, name, &cfg, &ch->h);
     if(e != CAN_OK) {
+        if (rxq) {
+            async_stop(rxq);
+            async_release(rxq);
+        }
+        pthread_cond_destroy(&ch->rx_cv);
+        pthread_cond_destroy(&ch->tp_cv);
+        pthread_mutex_destroy(&ch->bus_mtx);
+        pthread_mutex_destroy(&ch->stats_mtx);
+        pthread_mutex_destroy(&ch->sub_mtx);
         free(ch->name);
         free(ch);
         return e;
@@ -121,31 +1096,202 @@ can_err_t       channel_start(const char* name, CanConfig cfg, Adapter* adapter,
     if (adapter->v->ch_set_callbacks) {
         adapter->v->ch_set_callbacks(adapter, ch->h,
             on_rx_from_adapter, ch,   // on_rx
-            NULL, NULL,                // on_err
-            NULL, NULL                 // on_bus
+            on_err_from_adapter, ch,   // on_err
+            on_bus_from_adapter, ch    // on_bus
         );
     }
     *out = ch;
     return CAN_OK;
 }
 
+/* ===== 게이트웨이 경로 (route.c): 어댑터가 직접 처리하는 규칙 ===== */
+can_err_t       channel_route_offload(Channel* src, Channel* dst, const CanRouteRule* rule, void** link) {
+    if (!src || !dst || !rule || !link) return CAN_ERR_INVALID;
+    if (!src->adapter || src->adapter != dst->adapter || !src->adapter->v->ch_route_add) return CAN_ERR_NODEV;
+    return src->adapter->v->ch_route_add(src->adapter, src->h, dst->h, rule, link);
+}
+
+can_err_t       channel_route_offload_stats(Channel* src, void* link, CanRouteStats* io) {
+    if (!src || !link || !io || !src->adapter->v->ch_route_stats) return CAN_ERR_STATE;
+    return src->adapter->v->ch_route_stats(src->adapter, link, io);
+}
+
+void            channel_route_unload(Channel* src, void* link) {
+    if (src && link) src->adapter->v->ch_route_del(src->adapter, link);
+}
+
+/* ===== 주기 감시 (periodwatch.c) ===== */
+static PeriodWatcher* channel_pwatch(Channel* ch, int create){
+    pthread_mutex_lock(&ch->sub_mtx);
+    if (!ch->pwatch && create) ch->pwatch = pwatch_create(ch);
+    PeriodWatcher* pw = ch->pwatch;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return pw;
+}
+
+can_err_t       channel_watch_period(Channel* ch, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance,
+                                     can_period_callback_t cb, void* user) {
+    if (!ch || !watchId || !cb || expected_ms == 0) return CAN_ERR_INVALID;
+    PeriodWatcher* pw = channel_pwatch(ch, 1);
+    if (!pw) return CAN_ERR_MEMORY;
+    return pwatch_add(pw, watchId, id, expected_ms, tolerance, cb, user);
+}
+
+can_err_t       channel_unwatch_period(Channel* ch, int watchId) {
+    if (!ch || watchId <= 0) return CAN_ERR_INVALID;
+    PeriodWatcher* pw = channel_pwatch(ch, 0);
+    return pw ? pwatch_remove(pw, watchId) : CAN_ERR_INVALID;
+}
+
+can_err_t       channel_get_period_stats(Channel* ch, int watchId, CanPeriodStats* out) {
+    if (!ch || watchId <= 0 || !out) return CAN_ERR_INVALID;
+    PeriodWatcher* pw = channel_pwatch(ch, 0);
+    return pw ? pwatch_get_stats(pw, watchId, out) : CAN_ERR_INVALID;
+}
+
+/* ===== 신호 구독 (sigwatch.c) ===== */
+static SignalTable* channel_sigtab(Channel* ch, int create){
+    pthread_mutex_lock(&ch->sub_mtx);
+    if (!ch->sigtab && create) ch->sigtab = sigtab_create(ch);
+    SignalTable* t = ch->sigtab;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return t;
+}
+
+can_err_t       channel_subscribe_signal(Channel* ch, int* subId, const CanDb* db, uint16_t sig, double deadband,
+                                         can_signal_callback_t cb, void* user) {
+    if (!ch || !subId || !db || !cb) return CAN_ERR_INVALID;
+    SignalTable* t = channel_sigtab(ch, 1);
+    if (!t) return CAN_ERR_MEMORY;
+    return sigtab_add(t, subId, db, sig, deadband, cb, user);
+}
+
+can_err_t       channel_unsubscribe_signal(Channel* ch, int subId) {
+    if (!ch || subId <= 0) return CAN_ERR_INVALID;
+    SignalTable* t = channel_sigtab(ch, 0);
+    return t ? sigtab_remove(t, subId) : CAN_ERR_INVALID;
+}
+
+can_err_t       channel_get_signal(Channel* ch, int subId, double* value, uint64_t* age_ns) {
+    if (!ch || subId <= 0 || !value) return CAN_ERR_INVALID;
+    SignalTable* t = channel_sigtab(ch, 0);
+    return t ? sigtab_get(t, subId, value, age_ns) : CAN_ERR_INVALID;
+}
+
+/* ===== ISO-TP 연결 =====
+ * 어댑터 훅(커널 CAN_ISOTP 등)을 먼저 쓰고, 없으면 isotp.c 사용자 공간 구현.
+ * send/recv는 연결에 참조를 잡으므로 channel_isotp_close 뒤에도 마지막 쪽이 닫는다.
+ * 채널은 참조로 지켜지지 않는다 → channel_stop이 tp_live가 0이 될 때까지 기다린 뒤 해제.
+ */
+static void tp_link_put(Channel* ch, TpLink* l){
+    pthread_mutex_lock(&ch->sub_mtx);
+    int last = --l->refs == 0;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    if (!last) return;
+    if (l->tp) isotp_destroy(l->tp);        // 구독 해제: 채널이 아직 살아 있어야 함
+    else ch->adapter->v->ch_isotp_close(ch->adapter, l->link);
+    free(l);
+
+    pthread_mutex_lock(&ch->sub_mtx);
+    if (--ch->tp_live == 0) pthread_cond_broadcast(&ch->tp_cv);
+    pthread_mutex_unlock(&ch->sub_mtx);     // 이 뒤로 ch를 건드리지 않는다 (channel_stop이 해제할 수 있음)
+}
+
+static TpLink* tp_link_get(Channel* ch, int tpId){
+    pthread_mutex_lock(&ch->sub_mtx);
+    TpLink* l = ch->tp_links;
+    while (l && l->id != tpId) l = l->next;
+    if (l) l->refs++;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return l;
+}
+
 can_err_t       channel_stop(Channel* ch) {
     if(!ch) return CAN_ERR_INVALID;
 
-    Sub* s = ch->subs;
-    while (s) {
-        Sub* ns = s->next;
-        filter_free(&s->filter);
-        free(s);
-        s = ns;
+    // ISO-TP 연결은 구독을 쓰므로 구독 정리 전에 닫는다
+    pthread_mutex_lock(&ch->sub_mtx);
+    TpLink* links = ch->tp_links;
+    ch->tp_links = NULL;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    while (links) {
+        TpLink* nl = links->next;
+        if (links->tp) isotp_shutdown(links->tp);
+        tp_link_put(ch, links);
+        links = nl;
     }
+    // 진행 중인 send/recv가 깨어나 마지막 참조를 놓고 연결을 닫을 때까지 (구독/어댑터가 아직 필요)
+    // 사용자 공간 연결은 shutdown으로 바로 깨고, 어댑터 연결은 그 호출의 timeout만큼 걸릴 수 있다
+    pthread_mutex_lock(&ch->sub_mtx);
+    while (ch->tp_live > 0) pthread_cond_wait(&ch->tp_cv, &ch->sub_mtx);
+    pthread_mutex_unlock(&ch->sub_mtx);
+    // 주기 감시/신호 구독도 구독을 쓴다 (감시 스레드 종료 후 구독 해제)
+    pthread_mutex_lock(&ch->sub_mtx);
+    PeriodWatcher* pw = ch->pwatch;
+    ch->pwatch = NULL;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    pwatch_destroy(pw);
+    pthread_mutex_lock(&ch->sub_mtx);
+    SignalTable* st = ch->sigtab;
+    ch->sigtab = NULL;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    sigtab_destroy(st);
 
+    // CAN_SUB_BLOCK 구독에서 RX 스레드가 기다리고 있을 수 있으므로 먼저 풀어준다
+    pthread_mutex_lock(&ch->sub_mtx);
+    for (Sub* s = ch->subs; s; s = s->next) {
+        if (s->async) {
+            atomic_store(&s->async->closing, 1);
+            async_wake(s->async);
+        }
+    }
+    pthread_mutex_unlock(&ch->sub_mtx);
+    AsyncSub* rxq = atomic_load(&ch->rxq);
+    if (rxq) {
+        atomic_store(&rxq->closing, 1);     // channel_read에서 기다리는 쪽을 깨운다
+        async_wake(rxq);
+    }
+
+    // 어댑터를 먼저 닫아 RX 콜백이 더 이상 들어오지 않게 한 뒤 구독/테이블 정리
     if (ch->adapter && ch->adapter->v->ch_set_callbacks) {
         ch->adapter->v->ch_set_callbacks(ch->adapter, ch->h, NULL, NULL, NULL, NULL, NULL, NULL);
     }
     if(ch->adapter && ch->adapter->v->ch_close) {
         ch->adapter->v->ch_close(ch->adapter, ch->h);
     }
+
+    // 어댑터를 닫으면서 감시도 모두 사라졌으므로 목록만 정리
+    for (WatchSub* w = ch->watches; w; ) {
+        WatchSub* nw = w->next;
+        free(w);
+        w = nw;
+    }
+    Sub* s = ch->subs;
+    while (s) {
+        Sub* ns = s->next;
+        if (s->async) {
+            async_stop(s->async);
+            async_release(s->async);    // 테이블 몫
+        }
+        if (s->release) s->release(s->user);
+        filter_free(&s->filter);
+        free(s);
+        s = ns;
+    }
+    dispatch_free(atomic_exchange(&ch->table, NULL));
+    dispatch_reclaim(ch, 1);
+    rxq = atomic_exchange(&ch->rxq, NULL);
+    if (rxq) {
+        async_stop(rxq);
+        async_release(rxq);     // RX 스레드 몫
+    }
+    free(atomic_exchange(&ch->id_stats, NULL));
+    pthread_cond_destroy(&ch->rx_cv);
+    pthread_cond_destroy(&ch->tp_cv);
+    pthread_mutex_destroy(&ch->bus_mtx);
+    pthread_mutex_destroy(&ch->stats_mtx);
+    pthread_mutex_destroy(&ch->sub_mtx);
+
     free(ch->name);
     free(ch);
     return CAN_OK;
@@ -155,21 +1301,73 @@ const char*     channel_name(const Channel* ch) {
     return ch ? ch->name : "";
 }
 
+/* FD 프레임은 FD 채널에서만, 길이는 클래식 8 / FD 64까지 (FD는 RTR 없음) */
+static int channel_frame_ok(const Channel* ch, const CanFrame* f){
+    if (f->flags & CAN_FRAME_FD)
+        return ch->cfg.fd && f->dlc <= CAN_FRAME_DATA_MAX && !(f->flags & CAN_FRAME_RTR);
+    return f->dlc <= 8 && !(f->flags & (CAN_FRAME_BRS | CAN_FRAME_ESI));
+}
+
 can_err_t       channel_write(Channel* ch, const CanFrame* frame, uint32_t timeout_ms) {
     if(!ch || !frame) return CAN_ERR_INVALID;
     if (!ch->adapter || !ch->adapter->v->write) return CAN_ERR_INVALID;
+    if (!channel_frame_ok(ch, frame)) return CAN_ERR_INVALID;
     return ch->adapter->v->write(ch->adapter, ch->h, frame, timeout_ms);
 }
 
 can_err_t       channel_read(Channel* ch, CanFrame* out, uint32_t timeout_ms) {
     if(!ch || !out) return CAN_ERR_INVALID;
-    if (!ch->adapter || !ch->adapter->v->read) return CAN_ERR_INVALID;
+    if (!ch->adapter) return CAN_ERR_INVALID;
+    AsyncSub* q = channel_reader(ch);
+    if (q) {
+        size_t got;
+        can_err_t e = channel_read_ring(q, out, 1, &got, timeout_ms);
+        async_release(q);
+        return e;
+    }
+    if (!ch->adapter->v->read) return ch->adapter->v->ch_set_callbacks ? CAN_ERR_MEMORY : CAN_ERR_INVALID;
     return ch->adapter->v->read(ch->adapter, ch->h, out, timeout_ms);
 }
 
+can_err_t       channel_write_batch(Channel* ch, const CanFrame* frames, size_t n, size_t* sent, uint32_t timeout_ms) {
+    if (!ch || (!frames && n) || !sent) return CAN_ERR_INVALID;
+    *sent = 0;
+    if (!ch->adapter) return CAN_ERR_INVALID;
+    for (size_t i = 0; i < n; ++i)
+        if (!channel_frame_ok(ch, &frames[i])) return CAN_ERR_INVALID;
+    if (ch->adapter->v->write_batch)
+        return ch->adapter->v->write_batch(ch->adapter, ch->h, frames, n, sent, timeout_ms);
+    if (!ch->adapter->v->write) return CAN_ERR_INVALID;
+    for (size_t i = 0; i < n; ++i) {
+        can_err_t e = ch->adapter->v->write(ch->adapter, ch->h, &frames[i], timeout_ms);
+        if (e != CAN_OK) return e;
+        *sent = i + 1;
+    }
+    return CAN_OK;
+}
+
+can_err_t       channel_read_batch(Channel* ch, CanFrame* out, size_t max, size_t* got, uint32_t timeout_ms) {
+    if (!ch || !out || max == 0 || !got) return CAN_ERR_INVALID;
+    *got = 0;
+    if (!ch->adapter) return CAN_ERR_INVALID;
+    AsyncSub* q = channel_reader(ch);
+    if (q) {
+        can_err_t e = channel_read_ring(q, out, max, got, timeout_ms);
+        async_release(q);
+        return e;
+    }
+    if (!ch->adapter->v->read) return ch->adapter->v->ch_set_callbacks ? CAN_ERR_MEMORY : CAN_ERR_INVALID;
+    can_err_t e = ch->adapter->v->read(ch->adapter, ch->h, &out[0], timeout_ms);
+    if (e != CAN_OK) return e;
+    *got = 1;
+    while (*got < max && ch->adapter->v->read(ch->adapter, ch->h, &out[*got], 0) == CAN_OK) (*got)++;
+    return CAN_OK;
+}
+
 can_err_t       channel_register_job(Channel* ch, int* jobId, const CanFrame* frame, uint32_t period_ms){
     if (!ch || !frame || period_ms==0) return CAN_ERR_INVALID;
     if (!ch->adapter || !ch->adapter->v->ch_register_job) return CAN_ERR_INVALID;
+    if (!channel_frame_ok(ch, frame)) return CAN_ERR_INVALID;
     return ch->adapter->v->ch_register_job(ch->adapter, jobId, ch->h, frame, period_ms);
 }
 
@@ -185,8 +1383,38 @@ can_err_t       channel_cancel_job(Channel* ch, int jobId) {
     return ch->adapter->v->ch_cancel_job(ch->adapter, ch->h, jobId);
 }
 
+can_err_t       channel_get_job_stats(Channel* ch, int jobId, CanJobStats* out) {
+    if (!ch || jobId<=0 || !out) return CAN_ERR_INVALID;
+    if (!ch->adapter || !ch->adapter->v->ch_get_job_stats) return CAN_ERR_STATE;
+    return ch->adapter->v->ch_get_job_stats(ch->adapter, ch->h, jobId, out);
+}
+
+can_err_t       channel_update_job(Channel* ch, int jobId, const CanFrame* frame) {
+    if (!ch || jobId<=0 || !frame) return CAN_ERR_INVALID;
+    if (!ch->adapter || !ch->adapter->v->ch_update_job) return CAN_ERR_STATE;
+    if (!channel_frame_ok(ch, frame)) return CAN_ERR_INVALID;
+    return ch->adapter->v->ch_update_job(ch->adapter, ch->h, jobId, frame);
+}
+
+can_err_t       channel_get_latency(Channel* ch, CanLatencyHist* out) {
+    if (!ch || !out) return CAN_ERR_INVALID;
+    // RX 스레드가 쓰는 중에 읽으므로 칸 사이 합이 count와 한두 개 어긋날 수 있다
+    out->count  = atomic_load_explicit(&ch->lat_count, memory_order_relaxed);
+    out->sum_us = atomic_load_explicit(&ch->lat_sum_us, memory_order_relaxed);
+    out->max_us = atomic_load_explicit(&ch->lat_max_us, memory_order_relaxed);
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; ++i)
+        out->bucket[i] = atomic_load_explicit(&ch->lat_bucket[i], memory_order_relaxed);
+    return CAN_OK;
+}
+
 can_err_t       channel_subscribe(Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user) {
+    return channel_subscribe_ex(ch, subId, filter, cb, user, NULL);
+}
+
+static can_err_t channel_subscribe_impl(Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user,
+                                        const CanSubOptions* opt, void (*release)(void*)) {
     if (!ch || !filter || !cb) return CAN_ERR_INVALID;
+    if (opt && (opt->mode > CAN_SUB_ASYNC_POLL || opt->overflow > CAN_SUB_BLOCK)) return CAN_ERR_INVALID;
     Sub* s = (Sub*)calloc(1, sizeof(Sub));
     if (!s) return CAN_ERR_MEMORY;
 
@@ -197,31 +1425,177 @@ can_err_t       channel_subscribe(Channel* ch, int* subId, const CanFilter* filt
 
     s->cb   = cb;
     s->user = user;
+    s->release = release;
+    if (opt && opt->mode != CAN_SUB_INLINE) {
+        s->async = async_create(cb, user, opt);
+        if (!s->async) {
+            filter_free(&s->filter);
+            free(s);
+            return CAN_ERR_MEMORY;
+        }
+        s->cb   = async_push;
+        s->user = s->async;
+    }
 
-    s->id   = ++ch->next_sub_id;
+    pthread_mutex_lock(&ch->sub_mtx);
     s->next = ch->subs;
     ch->subs = s;
+    if (dispatch_publish(ch, NULL) != CAN_OK) {
+        ch->subs = s->next;
+        pthread_mutex_unlock(&ch->sub_mtx);
+        if (s->async) {
+            async_stop(s->async);
+            async_release(s->async);
+        }
+        filter_free(&s->filter);
+        free(s);
+        return CAN_ERR_MEMORY;
+    }
+    s->id = ++ch->next_sub_id;
+    channel_update_hw_filter(ch);
+    pthread_mutex_unlock(&ch->sub_mtx);
 
     *subId = s->id;
 
     return CAN_OK;
 }
 
+can_err_t       channel_subscribe_ex(Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user, const CanSubOptions* opt) {
+    return channel_subscribe_impl(ch, subId, filter, cb, user, opt, NULL);
+}
+
+can_err_t       channel_subscribe_owned(Channel* ch, int* subId, const CanFilter* filter, can_callback_t cb, void* user, void (*release)(void*)) {
+    return channel_subscribe_impl(ch, subId, filter, cb, user, NULL, release);
+}
+
+can_err_t       channel_subscribe_on_change(Channel* ch, int* subId, const CanChangeFilter* filter, can_callback_t cb, can_timeout_callback_t on_timeout, void* user) {
+    if (!ch || !subId || !filter || (!cb && !on_timeout)) return CAN_ERR_INVALID;
+    if (filter->len > CAN_FRAME_DATA_MAX) return CAN_ERR_INVALID;
+    if (!(filter->flags & CAN_FRAME_FD) && filter->len > 8) return CAN_ERR_INVALID;
+    if ((filter->flags & CAN_FRAME_FD) && !ch->cfg.fd) return CAN_ERR_INVALID;
+    if (!ch->adapter || !ch->adapter->v->ch_watch_add) return CAN_ERR_STATE;
+
+    WatchSub* w = (WatchSub*)calloc(1, sizeof(WatchSub));
+    if (!w) return CAN_ERR_MEMORY;
+
+    // 어댑터 호출은 sub_mtx 밖에서 (watch_del은 진행 중인 콜백이 끝나길 기다리므로,
+    // 콜백 안에서 구독 API를 부르는 경우 sub_mtx를 잡고 기다리면 교착)
+    can_err_t e = ch->adapter->v->ch_watch_add(ch->adapter, ch->h, filter, cb, on_timeout, user, &w->watch);
+    if (e != CAN_OK) {
+        free(w);
+        return e;
+    }
+    pthread_mutex_lock(&ch->sub_mtx);
+    w->id = ++ch->next_sub_id;
+    w->next = ch->watches;
+    ch->watches = w;
+    channel_update_hw_filter(ch);
+    pthread_mutex_unlock(&ch->sub_mtx);
+
+    *subId = w->id;
+    return CAN_OK;
+}
+
+static can_err_t channel_unwatch(Channel* ch, int subId) {
+    pthread_mutex_lock(&ch->sub_mtx);
+    WatchSub** pp = &ch->watches;
+    while (*pp && (*pp)->id != subId) pp = &(*pp)->next;
+    WatchSub* del = *pp;
+    if (del) {
+        *pp = del->next;
+        channel_update_hw_filter(ch);
+    }
+    pthread_mutex_unlock(&ch->sub_mtx);
+    if (!del) return CAN_ERR_INVALID;
+
+    can_err_t e = ch->adapter->v->ch_watch_del(ch->adapter, ch->h, del->watch);
+    free(del);
+    return e;
+}
+
 can_err_t       channel_unsubscribe(Channel* ch, int subId) {
     if (!ch || subId <= 0) return CAN_ERR_INVALID;
 
+    pthread_mutex_lock(&ch->sub_mtx);
     Sub** pp = &ch->subs;
     while (*pp) {
         if ((*pp)->id == subId) {
             Sub* del = *pp;
             *pp = del->next;
+            if (dispatch_publish(ch, del) != CAN_OK) {
+                // 새 테이블을 못 만들면 해제하지 않고 되돌린다 (콜백이 계속 불릴 수 있으므로)
+                *pp = del;
+                pthread_mutex_unlock(&ch->sub_mtx);
+                return CAN_ERR_MEMORY;
+            }
+            channel_update_hw_filter(ch);
+            uint64_t epoch = atomic_load(&ch->rx_epoch);
+            pthread_mutex_unlock(&ch->sub_mtx);
+            // 돌아온 뒤에는 콜백이 더 불리지 않으므로 user를 해제해도 된다 (콜백 안에서 부른 경우 제외)
+            dispatch_quiesce(ch, epoch);
+            async_stop(del->async);
             filter_free(&del->filter);
             free(del);
             return CAN_OK;
         }
         pp = &(*pp)->next;
     }
-    return CAN_ERR_INVALID;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return channel_unwatch(ch, subId);
+}
+
+/* subId의 비동기 링을 참조를 잡고 돌려준다 (다 쓰면 async_release) */
+static AsyncSub* channel_sub_async(Channel* ch, int subId){
+    AsyncSub* a = NULL;
+    pthread_mutex_lock(&ch->sub_mtx);
+    for (Sub* s = ch->subs; s; s = s->next){
+        if (s->id == subId){
+            a = s->async;
+            if (a) atomic_fetch_add(&a->refs, 1);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return a;
+}
+
+int             channel_sub_fd(Channel* ch, int subId) {
+    if (!ch || subId <= 0) return -1;
+    AsyncSub* a = channel_sub_async(ch, subId);
+    if (!a) return -1;
+    int fd = a->efd;
+    async_release(a);
+    return fd;
+}
+
+int             channel_sub_drain(Channel* ch, int subId, uint32_t maxFrames) {
+    if (!ch || subId <= 0) return -1;
+    AsyncSub* a = channel_sub_async(ch, subId);
+    if (!a) return -1;
+    if (a->mode != CAN_SUB_ASYNC_POLL) { async_release(a); return -1; }
+#ifdef __linux__
+    // 비우기 전에 fd 신호를 먼저 지워야 그 사이 들어온 프레임의 신호를 놓치지 않는다
+    uint64_t cnt;
+    ssize_t r = read(a->efd, &cnt, sizeof(cnt));
+    (void)r;
+#endif
+    int n = async_drain(a, maxFrames);
+    if (atomic_load(&a->head) != atomic_load(&a->tail)) async_notify_fd(a);  // 남은 게 있으면 다시 알림
+    async_release(a);
+    return n;
+}
+
+can_err_t       channel_sub_get_stats(Channel* ch, int subId, CanSubStats* out) {
+    if (!ch || subId <= 0 || !out) return CAN_ERR_INVALID;
+    AsyncSub* a = channel_sub_async(ch, subId);
+    if (!a) return CAN_ERR_INVALID;
+    out->delivered  = atomic_load_explicit(&a->delivered, memory_order_relaxed);
+    out->dropped    = atomic_load_explicit(&a->dropped, memory_order_relaxed);
+    out->blocked    = atomic_load_explicit(&a->blocked, memory_order_relaxed);
+    out->depth      = a->depth;
+    out->high_water = atomic_load_explicit(&a->high_water, memory_order_relaxed);
+    async_release(a);
+    return CAN_OK;
 }
 
 can_err_t       channel_recover(Channel* ch) {
@@ -234,4 +1608,179 @@ can_bus_state_t channel_status(Channel* ch) {
     if (!ch) return CAN_BUS_STATE_ERROR_PASSIVE;
     return ch->adapter->v->status ? 
         ch->adapter->v->status(ch->adapter, ch->h) : CAN_BUS_STATE_ERROR_ACTIVE;
-}
\ No newline at end of file
+}
+
+can_err_t       channel_set_bus_callback(Channel* ch, can_bus_callback_t cb, void* user) {
+    if (!ch) return CAN_ERR_INVALID;
+    // RX 스레드가 콜백 중이면 끝날 때까지 기다린다 (콜백 안에서 부르면 교착)
+    pthread_mutex_lock(&ch->bus_mtx);
+    ch->bus_cb   = cb;
+    ch->bus_user = user;
+    pthread_mutex_unlock(&ch->bus_mtx);
+    return CAN_OK;
+}
+
+static inline float stats_rate(uint64_t cur, uint64_t prev, uint64_t dt_ns){
+    return cur > prev ? (float)((double)(cur - prev) * 1e9 / (double)dt_ns) : 0.0f;
+}
+
+can_err_t       channel_get_stats(Channel* ch, CanStats* out) {
+    if (!ch || !out) return CAN_ERR_INVALID;
+    memset(out, 0, sizeof(*out));
+    out->rx_frames   = atomic_load_explicit(&ch->rx_frames, memory_order_relaxed);
+    out->rx_bytes    = atomic_load_explicit(&ch->rx_bytes, memory_order_relaxed);
+    out->bus_time_ns = atomic_load_explicit(&ch->rx_bus_ns, memory_order_relaxed);
+    out->err_frames  = atomic_load_explicit(&ch->err_events, memory_order_relaxed);
+    AsyncSub* rxq = atomic_load_explicit(&ch->rxq, memory_order_acquire);
+    if (rxq) {
+        out->recv_dropped    = atomic_load_explicit(&rxq->dropped, memory_order_relaxed);
+        out->recv_high_water = atomic_load_explicit(&rxq->high_water, memory_order_relaxed);
+    }
+    if (ch->adapter->v->ch_get_bus_stats) {
+        can_err_t e = ch->adapter->v->ch_get_bus_stats(ch->adapter, ch->h, out);
+        if (e != CAN_OK) return e;
+    } else {
+        out->state = channel_status(ch);
+    }
+
+    pthread_mutex_lock(&ch->stats_mtx);
+    uint64_t now = channel_now_ns();
+    uint64_t dt  = now - ch->stats_prev.t_ns;
+    if (dt > 0) {
+        out->rx_fps   = stats_rate(out->rx_frames, ch->stats_prev.rx_frames, dt);
+        out->rx_Bps   = stats_rate(out->rx_bytes,  ch->stats_prev.rx_bytes,  dt);
+        out->tx_fps   = stats_rate(out->tx_frames, ch->stats_prev.tx_frames, dt);
+        out->tx_Bps   = stats_rate(out->tx_bytes,  ch->stats_prev.tx_bytes,  dt);
+        out->bus_load = stats_rate(out->bus_time_ns, ch->stats_prev.bus_ns, dt) / 1e9f * 100.0f;
+        ch->stats_prev.t_ns      = now;
+        ch->stats_prev.rx_frames = out->rx_frames;
+        ch->stats_prev.rx_bytes  = out->rx_bytes;
+        ch->stats_prev.tx_frames = out->tx_frames;
+        ch->stats_prev.tx_bytes  = out->tx_bytes;
+        ch->stats_prev.bus_ns    = out->bus_time_ns;
+    }
+    pthread_mutex_unlock(&ch->stats_mtx);
+    return CAN_OK;
+}
+
+can_err_t       channel_stats_enable(Channel* ch, int enable) {
+    if (!ch) return CAN_ERR_INVALID;
+    pthread_mutex_lock(&ch->sub_mtx);
+    if (enable && !atomic_load(&ch->id_stats)) {
+        IdStatTable* t = id_stats_create();
+        if (!t) {
+            pthread_mutex_unlock(&ch->sub_mtx);
+            return CAN_ERR_MEMORY;
+        }
+        atomic_store_explicit(&ch->id_stats, t, memory_order_release);
+    }
+    atomic_store(&ch->id_stats_on, enable ? 1 : 0);
+    // 구독하지 않은 ID도 세려면 커널/하드웨어 필터를 열어야 한다
+    if (ch->stats_all != (enable ? 1 : 0)) {
+        ch->stats_all = enable ? 1 : 0;
+        channel_update_hw_filter(ch);
+    }
+    pthread_mutex_unlock(&ch->sub_mtx);
+    return CAN_OK;
+}
+
+static int id_stats_fill(const IdStat* s, uint32_t flags, uint64_t now, CanIdStats* o){
+    uint64_t n = atomic_load_explicit(&s->count, memory_order_relaxed);
+    if (n == 0) return 0;
+    uint64_t last = atomic_load_explicit(&s->last_ns, memory_order_relaxed);
+    uint64_t iv   = atomic_load_explicit(&s->iv_avg_ns, memory_order_relaxed);
+    uint64_t ja   = atomic_load_explicit(&s->jit_avg_ns, memory_order_relaxed);
+    uint64_t jm   = atomic_load_explicit(&s->jit_max_ns, memory_order_relaxed);
+    uint64_t age  = now > last ? (now - last) / 1000000u : 0;
+    o->id            = (uint32_t)atomic_load_explicit(&s->id, memory_order_relaxed);
+    o->flags         = flags;
+    o->count         = n;
+    o->rate_hz       = (n > 1 && iv) ? (float)(1e9 / (double)iv) : 0.0f;
+    o->period_avg_us = (uint32_t)(iv / 1000u);
+    o->jitter_avg_us = (uint32_t)(ja / 1000u);
+    o->jitter_max_us = (uint32_t)(jm / 1000u);
+    o->age_ms        = age > UINT32_MAX ? UINT32_MAX : (uint32_t)age;
+    return 1;
+}
+
+can_err_t       channel_get_id_stats(Channel* ch, CanIdStats* out, size_t max, size_t* count) {
+    if (!ch || (!out && max) || !count) return CAN_ERR_INVALID;
+    *count = 0;
+    IdStatTable* t = atomic_load_explicit(&ch->id_stats, memory_order_acquire);
+    if (!t) return CAN_ERR_STATE;
+    uint64_t now = channel_now_ns();
+    for (uint32_t i = 0; i < DISPATCH_SFF_COUNT && *count < max; ++i)
+        *count += (size_t)id_stats_fill(&t->sff[i], 0, now, &out[*count]);
+    for (uint32_t i = 0; i < ID_STATS_EFF_SLOTS && *count < max; ++i) {
+        if (atomic_load_explicit(&t->eff[i].id, memory_order_acquire) == DISPATCH_HASH_EMPTY) continue;
+        *count += (size_t)id_stats_fill(&t->eff[i], CAN_FRAME_EXTID, now, &out[*count]);
+    }
+    return CAN_OK;
+}
+
+can_err_t       channel_isotp_open(Channel* ch, int* tpId, const CanIsoTpConfig* cfg) {
+    if (!ch || !tpId || !cfg || !ch->adapter) return CAN_ERR_INVALID;
+    const uint32_t known = CAN_FRAME_EXTID | CAN_FRAME_FD | CAN_FRAME_BRS;
+    if ((cfg->flags & ~known) || ((cfg->flags & CAN_FRAME_BRS) && !(cfg->flags & CAN_FRAME_FD))) return CAN_ERR_INVALID;
+    if ((cfg->flags & CAN_FRAME_FD) && !ch->cfg.fd) return CAN_ERR_INVALID;
+    uint32_t id_max = (cfg->flags & CAN_FRAME_EXTID) ? CHANNEL_ID_MASK : 0x7FFu;
+    if (cfg->tx_id > id_max || cfg->rx_id > id_max || cfg->tx_id == cfg->rx_id) return CAN_ERR_INVALID;
+    if (cfg->padding && (cfg->padding & ~0xFFu) != 0x100u) return CAN_ERR_INVALID;
+
+    TpLink* l = (TpLink*)calloc(1, sizeof(TpLink));
+    if (!l) return CAN_ERR_MEMORY;
+    const AdapterVTable* v = ch->adapter->v;
+    can_err_t e = CAN_ERR_NODEV;
+    if (v->ch_isotp_open && v->ch_isotp_send && v->ch_isotp_recv && v->ch_isotp_close)
+        e = v->ch_isotp_open(ch->adapter, ch->h, cfg, &l->link);
+    if (e == CAN_ERR_NODEV) e = isotp_create(ch, cfg, &l->tp);
+    if (e != CAN_OK) {
+        free(l);
+        return e;
+    }
+
+    pthread_mutex_lock(&ch->sub_mtx);
+    l->id = ++ch->next_tp_id;
+    l->refs = 1;
+    ch->tp_live++;
+    l->next = ch->tp_links;
+    ch->tp_links = l;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    *tpId = l->id;
+    return CAN_OK;
+}
+
+can_err_t       channel_isotp_send(Channel* ch, int tpId, const void* data, size_t len, uint32_t timeout_ms) {
+    if (!ch || !data || len == 0 || len > CAN_ISOTP_MAX_LEN) return CAN_ERR_INVALID;
+    TpLink* l = tp_link_get(ch, tpId);
+    if (!l) return CAN_ERR_INVALID;
+    can_err_t e = l->tp ? isotp_send(l->tp, data, len, timeout_ms)
+                        : ch->adapter->v->ch_isotp_send(ch->adapter, l->link, data, len, timeout_ms);
+    tp_link_put(ch, l);
+    return e;
+}
+
+can_err_t       channel_isotp_recv(Channel* ch, int tpId, void* buf, size_t cap, size_t* len, uint32_t timeout_ms) {
+    if (!ch || (!buf && cap) || !len) return CAN_ERR_INVALID;
+    TpLink* l = tp_link_get(ch, tpId);
+    if (!l) return CAN_ERR_INVALID;
+    can_err_t e = l->tp ? isotp_recv(l->tp, buf, cap, len, timeout_ms)
+                        : ch->adapter->v->ch_isotp_recv(ch->adapter, l->link, buf, cap, len, timeout_ms);
+    tp_link_put(ch, l);
+    return e;
+}
+
+can_err_t       channel_isotp_close(Channel* ch, int tpId) {
+    if (!ch) return CAN_ERR_INVALID;
+    pthread_mutex_lock(&ch->sub_mtx);
+    TpLink** pp = &ch->tp_links;
+    while (*pp && (*pp)->id != tpId) pp = &(*pp)->next;
+    TpLink* l = *pp;
+    if (l) *pp = l->next;
+    pthread_mutex_unlock(&ch->sub_mtx);
+    if (!l) return CAN_ERR_INVALID;
+
+    if (l->tp) isotp_shutdown(l->tp);       // 기다리는 send/recv를 깨운다
+    tp_link_put(ch, l);
+    return CAN_OK;
+}
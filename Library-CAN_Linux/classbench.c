@@ -0,0 +1,139 @@
+// classbench.c — 필터 묶음 분류 비교: 프레임마다 filter_match 반복 vs canclassify (스칼라 SoA / SIMD)
+// 같은 ID 배열과 필터로 세 경로를 돌려 결과가 같은지 확인하고 프레임당 시간을 비교한다.
+//   ./classbench [필터 수=32] [프레임 수=1000000] [반복=5]
+#define _GNU_SOURCE
+#include "canclassify.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LIST_LEN    4
+
+static uint32_t g_rng = 0x12345678u;
+
+static uint32_t rnd(void){
+    g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// channel.c의 filter_match와 같은 규칙 (프레임 하나 × 필터 하나)
+static int filter_match(const CanFilter* f, uint32_t id){
+    switch (f->type){
+    case CAN_FILTER_RANGE: return id >= f->data.range.min && id <= f->data.range.max;
+    case CAN_FILTER_MASK:  return (id & f->data.mask.mask) == (f->data.mask.id & f->data.mask.mask);
+    case CAN_FILTER_LIST:
+        for (uint32_t i = 0; i < f->data.list.count; ++i)
+            if (f->data.list.list[i] == id) return 1;
+        return 0;
+    default: return 0;
+    }
+}
+
+static void classify_naive(const CanFilter* fs, size_t nf, const uint32_t* ids, size_t n, uint64_t* out){
+    for (size_t i = 0; i < n; ++i){
+        uint64_t r = 0;
+        for (size_t k = 0; k < nf; ++k)
+            if (filter_match(&fs[k], ids[i])) r |= 1ULL << k;
+        out[i] = r;
+    }
+}
+
+// 게이트웨이 설정에 흔한 모양: 11-bit 마스크 블록, ID 범위, 진단 ID 몇 개, 29-bit J1939 PGN 마스크
+static void make_filters(CanFilter* fs, size_t nf, uint32_t* lists){
+    for (size_t k = 0; k < nf; ++k){
+        CanFilter* f = &fs[k];
+        memset(f, 0, sizeof(*f));
+        switch (k % 4){
+        case 0:
+            f->type = CAN_FILTER_MASK;
+            f->data.mask.id = rnd() & 0x7F0; f->data.mask.mask = 0x7F0;
+            break;
+        case 1: {
+            uint32_t lo = rnd() & 0x7FF;
+            f->type = CAN_FILTER_RANGE;
+            f->data.range.min = lo; f->data.range.max = lo + (rnd() & 0x3F);
+            break;
+        }
+        case 2: {
+            uint32_t* l = lists + k*LIST_LEN;
+            for (int i = 0; i < LIST_LEN; ++i) l[i] = rnd() & 0x7FF;
+            f->type = CAN_FILTER_LIST;
+            f->data.list.list = l; f->data.list.count = LIST_LEN;
+            break;
+        }
+        default:
+            f->type = CAN_FILTER_MASK;
+            f->data.mask.id = (rnd() & 0xFFFF) << 8; f->data.mask.mask = 0x00FFFF00;
+            break;
+        }
+    }
+}
+
+int main(int argc, char* argv[]){
+    size_t nf   = argc > 1 ? strtoul(argv[1], NULL, 0) : 32;
+    size_t n    = argc > 2 ? strtoul(argv[2], NULL, 0) : 1000000;
+    int    reps = argc > 3 ? atoi(argv[3]) : 5;
+    if (nf == 0 || nf > CANCLASS_MAX_FILTERS || n == 0 || reps <= 0){
+        fprintf(stderr, "usage: %s [filters 1..%d] [frames] [reps]\n", argv[0], CANCLASS_MAX_FILTERS);
+        return 2;
+    }
+
+    CanFilter* fs    = (CanFilter*)calloc(nf, sizeof(CanFilter));
+    uint32_t*  lists = (uint32_t*)calloc(nf * LIST_LEN, sizeof(uint32_t));
+    uint32_t*  ids   = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint64_t*  ref   = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t*  got   = (uint64_t*)malloc(n * sizeof(uint64_t));
+    if (!fs || !lists || !ids || !ref || !got){ fprintf(stderr, "out of memory\n"); return 1; }
+    make_filters(fs, nf, lists);
+    for (size_t i = 0; i < n; ++i)
+        ids[i] = (rnd() & 7) ? (rnd() & 0x7FF) : (rnd() & 0x1FFFFFFF);     // 11-bit 위주, 1/8은 29-bit
+
+    CanClass* simd = NULL;
+    CanClass* soa  = NULL;
+    if (canclass_build(fs, nf, 0, &simd) != 0 || canclass_build(fs, nf, CANCLASS_NO_SIMD, &soa) != 0){
+        fprintf(stderr, "canclass_build failed\n");
+        return 1;
+    }
+
+    struct { const char* name; const CanClass* c; } paths[] = {
+        { "naive", NULL },
+        { "scalar", soa },
+        { canclass_impl(simd), simd },
+    };
+    double base = 0;
+    int bad = 0;
+    for (size_t p = 0; p < sizeof(paths)/sizeof(paths[0]); ++p){
+        uint64_t best = UINT64_MAX;
+        for (int r = 0; r < reps; ++r){
+            uint64_t t0 = now_ns();
+            if (paths[p].c) canclass_classify(paths[p].c, ids, n, p ? got : ref);
+            else            classify_naive(fs, nf, ids, n, ref);
+            uint64_t dt = now_ns() - t0;
+            if (dt < best) best = dt;
+        }
+        if (p && memcmp(ref, got, n * sizeof(uint64_t)) != 0){
+            printf("%-7s MISMATCH\n", paths[p].name);
+            bad = 1;
+            continue;
+        }
+        double per = (double)best / (double)n;
+        if (!p) base = per;
+        printf("%-7s filters=%zu frames=%zu %.2f ns/frame (x%.1f)\n", paths[p].name, nf, n, per, base / per);
+    }
+
+    size_t hits = 0;
+    for (size_t i = 0; i < n; ++i) hits += ref[i] != 0;
+    printf("frames with at least one match: %zu (%.1f%%)\n", hits, 100.0 * (double)hits / (double)n);
+
+    canclass_free(simd);
+    canclass_free(soa);
+    free(fs); free(lists); free(ids); free(ref); free(got);
+    return bad;
+}
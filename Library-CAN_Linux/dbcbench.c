@@ -0,0 +1,223 @@
+// dbcbench.c — 수신 디코드 비교: can_decode_pcan (CanMessage union, memset+memcpy) vs dbcgen.py 생성 디코더 (pcan_db.h)
+// 같은 프레임 배열을 세 방식으로 풀고, 꺼낸 신호를 더해 결과가 같은지 확인하면서 초당 프레임 수를 잰다.
+//   ./dbcbench [프레임 수=1000000] [반복=5]
+//  - union : can_decode_pcan() 후 ID로 switch해서 union 멤버를 읽는다 (지금 SCA/DCU 코드 방식)
+//  - typed : ID로 switch해서 메시지별 pcan_<메시지>_decode() (메시지를 아는 구독 콜백 방식)
+//  - table : pcan_db_decode()로 ID → 디코더 테이블을 거쳐 pcan_db_t에 unpack
+//  - 프레임 묶음: USER_INFO 한 종류(얼굴 프로파일), USER_INFO_FD 한 종류, 5종 섞기
+#define _GNU_SOURCE
+#include "canmessage.h"
+#include "pcan_db.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint32_t g_rng = 0x2545F491u;
+
+static uint32_t rnd(void){
+    g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static float rnd_f(void){ return (float)(rnd() % 2000000) / 1000.0f - 1000.0f; }
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 프레임은 생성 코드의 encode로 만든다 (float이 NaN이 되지 않게, 범위 있는 신호는 범위 안으로)
+static CanFrame make_frame(uint32_t id){
+    switch (id){
+    case PCAN_SCA_DCU_AUTH_STATE_ID: {
+        pcan_sca_dcu_auth_state_t m = { (uint8_t)(rnd() % 4), (uint8_t)rnd() };
+        return pcan_sca_dcu_auth_state_encode(&m);
+    }
+    case PCAN_TCU_SCA_USER_INFO_ID: {
+        pcan_tcu_sca_user_info_t m = { rnd() % 2048, rnd_f() };
+        return pcan_tcu_sca_user_info_encode(&m);
+    }
+    case PCAN_TCU_SCA_USER_INFO_FD_ID: {
+        pcan_tcu_sca_user_info_fd_t m;
+        float v[15];
+        for (int i = 0; i < 15; ++i) v[i] = rnd_f();
+        m.sig_user_info_index = rnd() % 2048;
+        m.sig_user_info_value_0 = v[0];   m.sig_user_info_value_1 = v[1];   m.sig_user_info_value_2 = v[2];
+        m.sig_user_info_value_3 = v[3];   m.sig_user_info_value_4 = v[4];   m.sig_user_info_value_5 = v[5];
+        m.sig_user_info_value_6 = v[6];   m.sig_user_info_value_7 = v[7];   m.sig_user_info_value_8 = v[8];
+        m.sig_user_info_value_9 = v[9];   m.sig_user_info_value_10 = v[10]; m.sig_user_info_value_11 = v[11];
+        m.sig_user_info_value_12 = v[12]; m.sig_user_info_value_13 = v[13]; m.sig_user_info_value_14 = v[14];
+        return pcan_tcu_sca_user_info_fd_encode(&m);
+    }
+    case PCAN_TCU_DCU_USER_PROFILE_SEAT_ID: {
+        pcan_tcu_dcu_user_profile_seat_t m = { (uint8_t)(rnd() % 101), (uint8_t)(rnd() % 181),
+                                               (uint8_t)(rnd() % 101), (uint8_t)(rnd() % 101) };
+        return pcan_tcu_dcu_user_profile_seat_encode(&m);
+    }
+    default: {
+        pcan_tcu_dcu_user_profile_mirror_t m = { (uint8_t)(rnd() % 181), (uint8_t)(rnd() % 181), (uint8_t)(rnd() % 181),
+                                                 (uint8_t)(rnd() % 181), (uint8_t)(rnd() % 181), (uint8_t)(rnd() % 181) };
+        return pcan_tcu_dcu_user_profile_mirror_encode(&m);
+    }
+    }
+}
+
+/* ===== union: can_decode_pcan + switch ===== */
+static double run_union(const CanFrame* frs, size_t n){
+    double acc = 0;
+    CanMessage msg;
+    can_msg_pcan_id_t id;
+    for (size_t i = 0; i < n; ++i){
+        if (can_decode_pcan(&frs[i], &id, &msg) != CAN_OK) continue;
+        switch (id){
+        case PCAN_ID_SCA_DCU_AUTH_STATE:
+            acc += msg.sca_dcu_auth_state.sig_auth_step + msg.sca_dcu_auth_state.sig_auth_state;
+            break;
+        case PCAN_ID_TCU_SCA_USER_INFO:
+            acc += msg.tcu_sca_user_info.sig_user_info_index + (double)msg.tcu_sca_user_info.sig_user_info_value;
+            break;
+        case PCAN_ID_TCU_SCA_USER_INFO_FD:
+            acc += msg.tcu_sca_user_info_fd.sig_user_info_index;
+            for (int k = 0; k < 15; ++k) acc += (double)msg.tcu_sca_user_info_fd.sig_user_info_value[k];
+            break;
+        case PCAN_ID_TCU_DCU_USER_PROFILE_SEAT:
+            acc += msg.tcu_dcu_user_profile_seat.sig_seat_position + msg.tcu_dcu_user_profile_seat.sig_seat_angle
+                 + msg.tcu_dcu_user_profile_seat.sig_seat_front_height + msg.tcu_dcu_user_profile_seat.sig_seat_rear_height;
+            break;
+        case PCAN_ID_TCU_DCU_USER_PROFILE_MIRROR:
+            acc += msg.tcu_dcu_user_profile_mirror.sig_mirror_left_yaw + msg.tcu_dcu_user_profile_mirror.sig_mirror_left_pitch
+                 + msg.tcu_dcu_user_profile_mirror.sig_mirror_right_yaw + msg.tcu_dcu_user_profile_mirror.sig_mirror_right_pitch
+                 + msg.tcu_dcu_user_profile_mirror.sig_mirror_room_yaw + msg.tcu_dcu_user_profile_mirror.sig_mirror_room_pitch;
+            break;
+        default: break;
+        }
+    }
+    return acc;
+}
+
+/* ===== 생성 코드: 메시지별 struct에서 신호 읽기 (typed/table 공용) ===== */
+static inline double use_auth_state(const pcan_sca_dcu_auth_state_t* m){
+    return m->sig_auth_step + m->sig_auth_state;
+}
+static inline double use_user_info(const pcan_tcu_sca_user_info_t* m){
+    return m->sig_user_info_index + (double)m->sig_user_info_value;
+}
+static inline double use_user_info_fd(const pcan_tcu_sca_user_info_fd_t* m){
+    double acc = m->sig_user_info_index;
+    acc += (double)m->sig_user_info_value_0;  acc += (double)m->sig_user_info_value_1;  acc += (double)m->sig_user_info_value_2;
+    acc += (double)m->sig_user_info_value_3;  acc += (double)m->sig_user_info_value_4;  acc += (double)m->sig_user_info_value_5;
+    acc += (double)m->sig_user_info_value_6;  acc += (double)m->sig_user_info_value_7;  acc += (double)m->sig_user_info_value_8;
+    acc += (double)m->sig_user_info_value_9;  acc += (double)m->sig_user_info_value_10; acc += (double)m->sig_user_info_value_11;
+    acc += (double)m->sig_user_info_value_12; acc += (double)m->sig_user_info_value_13; acc += (double)m->sig_user_info_value_14;
+    return acc;
+}
+static inline double use_seat(const pcan_tcu_dcu_user_profile_seat_t* m){
+    return m->sig_seat_position + m->sig_seat_angle + m->sig_seat_front_height + m->sig_seat_rear_height;
+}
+static inline double use_mirror(const pcan_tcu_dcu_user_profile_mirror_t* m){
+    return m->sig_mirror_left_yaw + m->sig_mirror_left_pitch + m->sig_mirror_right_yaw
+         + m->sig_mirror_right_pitch + m->sig_mirror_room_yaw + m->sig_mirror_room_pitch;
+}
+
+static double run_typed(const CanFrame* frs, size_t n){
+    double acc = 0;
+    for (size_t i = 0; i < n; ++i){
+        const CanFrame* f = &frs[i];
+        switch (f->id){
+        case PCAN_SCA_DCU_AUTH_STATE_ID: {
+            pcan_sca_dcu_auth_state_t m;
+            if (pcan_sca_dcu_auth_state_decode(f, &m) == CAN_OK) acc += use_auth_state(&m);
+            break;
+        }
+        case PCAN_TCU_SCA_USER_INFO_ID: {
+            pcan_tcu_sca_user_info_t m;
+            if (pcan_tcu_sca_user_info_decode(f, &m) == CAN_OK) acc += use_user_info(&m);
+            break;
+        }
+        case PCAN_TCU_SCA_USER_INFO_FD_ID: {
+            pcan_tcu_sca_user_info_fd_t m;
+            if (pcan_tcu_sca_user_info_fd_decode(f, &m) == CAN_OK) acc += use_user_info_fd(&m);
+            break;
+        }
+        case PCAN_TCU_DCU_USER_PROFILE_SEAT_ID: {
+            pcan_tcu_dcu_user_profile_seat_t m;
+            if (pcan_tcu_dcu_user_profile_seat_decode(f, &m) == CAN_OK) acc += use_seat(&m);
+            break;
+        }
+        case PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID: {
+            pcan_tcu_dcu_user_profile_mirror_t m;
+            if (pcan_tcu_dcu_user_profile_mirror_decode(f, &m) == CAN_OK) acc += use_mirror(&m);
+            break;
+        }
+        default: break;
+        }
+    }
+    return acc;
+}
+
+static double run_table(const CanFrame* frs, size_t n){
+    double acc = 0;
+    pcan_db_t any;
+    const CanDbMessage* m;
+    for (size_t i = 0; i < n; ++i){
+        if (pcan_db_decode(&frs[i], &any, &m) != CAN_OK) continue;
+        switch (m->id){
+        case PCAN_SCA_DCU_AUTH_STATE_ID:         acc += use_auth_state(&any.sca_dcu_auth_state); break;
+        case PCAN_TCU_SCA_USER_INFO_ID:          acc += use_user_info(&any.tcu_sca_user_info); break;
+        case PCAN_TCU_SCA_USER_INFO_FD_ID:       acc += use_user_info_fd(&any.tcu_sca_user_info_fd); break;
+        case PCAN_TCU_DCU_USER_PROFILE_SEAT_ID:  acc += use_seat(&any.tcu_dcu_user_profile_seat); break;
+        case PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID: acc += use_mirror(&any.tcu_dcu_user_profile_mirror); break;
+        default: break;
+        }
+    }
+    return acc;
+}
+
+typedef double (*run_fn)(const CanFrame*, size_t);
+
+// reps번 돌려 가장 빠른 값 (Mframes/s)
+static double measure(run_fn fn, const CanFrame* frs, size_t n, int reps, double* acc){
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < reps; ++r){
+        uint64_t t0 = now_ns();
+        *acc = fn(frs, n);
+        uint64_t t = now_ns() - t0;
+        if (t < best) best = t;
+    }
+    return (double)n * 1e3 / (double)best;
+}
+
+static void bench(const char* name, const uint32_t* ids, size_t nids, CanFrame* frs, size_t n, int reps){
+    for (size_t i = 0; i < n; ++i) frs[i] = make_frame(ids[nids == 1 ? 0 : rnd() % nids]);
+    double a_union, a_typed, a_table;
+    double s_union = measure(run_union, frs, n, reps, &a_union);
+    double s_typed = measure(run_typed, frs, n, reps, &a_typed);
+    double s_table = measure(run_table, frs, n, reps, &a_table);
+    printf("%-9s union %6.1f  typed %6.1f (x%.1f)  table %6.1f (x%.1f) Mframes/s%s\n", name,
+           s_union, s_typed, s_typed / s_union, s_table, s_table / s_union,
+           a_union == a_typed && a_union == a_table ? "" : "  MISMATCH");
+}
+
+int main(int argc, char* argv[]){
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+    int reps = argc > 2 ? atoi(argv[2]) : 5;
+    if (n == 0 || reps <= 0){
+        fprintf(stderr, "usage: %s [frames] [repeats]\n", argv[0]);
+        return 2;
+    }
+    CanFrame* frs = (CanFrame*)calloc(n, sizeof(CanFrame));
+    if (!frs){ fprintf(stderr, "out of memory\n"); return 1; }
+
+    static const uint32_t info[]  = { PCAN_TCU_SCA_USER_INFO_ID };
+    static const uint32_t fd[]    = { PCAN_TCU_SCA_USER_INFO_FD_ID };
+    static const uint32_t mixed[] = { PCAN_SCA_DCU_AUTH_STATE_ID, PCAN_TCU_SCA_USER_INFO_ID, PCAN_TCU_SCA_USER_INFO_FD_ID,
+                                      PCAN_TCU_DCU_USER_PROFILE_SEAT_ID, PCAN_TCU_DCU_USER_PROFILE_MIRROR_ID };
+    bench("user_info", info, 1, frs, n, reps);
+    bench("info_fd", fd, 1, frs, n, reps);
+    bench("mixed", mixed, sizeof(mixed)/sizeof(mixed[0]), frs, n, reps);
+
+    free(frs);
+    return 0;
+}
@@ -0,0 +1,504 @@
+#!/usr/bin/env python3
+"""DBC → header-only C 코덱 생성기.
+
+    python3 dbcgen.py pcan.dbc -o pcan_db.h
+    python3 dbcgen.py bcan.dbc -o bcan_db.h --prefix bcan
+
+메시지마다 struct, pack/unpack(바이트 단위로 펼친 시프트/마스크, 분기 없음),
+CanFrame encode/decode, 버스 전체용 ID→디코더 테이블과 신호 디스크립터 테이블을 만든다.
+지원하는 DBC 구문: BO_, SG_(멀티플렉스 제외), CM_, VAL_, SIG_VALTYPE_, BA_ "VFrameFormat".
+"""
+import argparse
+import os
+import re
+import sys
+
+VALID_LEN = (0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64)
+FD_FORMATS = (14, 15)   # VFrameFormat: StandardCAN_FD, ExtendedCAN_FD
+
+
+class Signal:
+    def __init__(self, name, start, length, motorola, signed, factor, offset, lo, hi, unit):
+        self.name = name
+        self.start = start
+        self.len = length
+        self.motorola = motorola
+        self.signed = signed
+        self.factor = factor
+        self.offset = offset
+        self.min = lo
+        self.max = hi
+        self.unit = unit
+        self.valtype = 0        # 0: 정수, 1: float, 2: double
+        self.comment = ''
+        self.values = []
+
+    def bits(self):
+        """신호 비트(LSB=0)마다 프레임 안의 비트 위치."""
+        if not self.motorola:
+            return [self.start + i for i in range(self.len)]
+        out, pos = [], self.start
+        for _ in range(self.len):
+            out.append(pos)
+            pos = pos - 1 if pos % 8 else pos + 15
+        return out[::-1]
+
+    def chunks(self):
+        """(바이트, 바이트 안 시작 비트, 비트 수, 신호 안 시프트) 목록."""
+        per = {}
+        for sbit, pos in enumerate(self.bits()):
+            per.setdefault(pos // 8, []).append((pos % 8, sbit))
+        out = []
+        for byte in sorted(per):
+            lst = sorted(per[byte])
+            out.append((byte, lst[0][0], len(lst), lst[0][1]))
+        return out
+
+
+class Message:
+    def __init__(self, frame_id, name, length, sender):
+        self.extended = bool(frame_id & 0x80000000)
+        self.id = frame_id & 0x1FFFFFFF
+        self.name = name
+        self.len = length
+        self.sender = sender
+        self.fd = length > 8
+        self.signals = []
+        self.comment = ''
+
+
+def fail(msg):
+    sys.exit('dbcgen: ' + msg)
+
+
+def parse(path):
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    msgs, by_id, cur = [], {}, None
+    re_bo = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+    re_sg = re.compile(r'^SG_\s+(\w+)\s*(\w*)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+                       r'\(([^,]+),([^)]+)\)\s*\[([^|]+)\|([^\]]+)\]\s*"([^"]*)"')
+    for raw in text.splitlines():
+        line = raw.strip()
+        m = re_bo.match(line)
+        if m:
+            cur = Message(int(m.group(1)), m.group(2), int(m.group(3)), m.group(4))
+            msgs.append(cur)
+            by_id[int(m.group(1))] = cur
+            continue
+        m = re_sg.match(line)
+        if m:
+            if cur is None:
+                fail('SG_ outside BO_: ' + line)
+            if m.group(2):
+                fail('multiplexed signals are not supported: ' + m.group(1))
+            cur.signals.append(Signal(m.group(1), int(m.group(3)), int(m.group(4)),
+                                      m.group(5) == '0', m.group(6) == '-',
+                                      float(m.group(7)), float(m.group(8)),
+                                      float(m.group(9)), float(m.group(10)), m.group(11)))
+            continue
+        if line and not line.startswith('SG_'):
+            cur = None
+
+    def sig(frame_id, name):
+        msg = by_id.get(frame_id)
+        for s in (msg.signals if msg else []):
+            if s.name == name:
+                return s
+        fail('unknown signal %d %s' % (frame_id, name))
+
+    for m in re.finditer(r'SIG_VALTYPE_\s+(\d+)\s+(\w+)\s*:?\s*(\d)\s*;', text):
+        sig(int(m.group(1)), m.group(2)).valtype = int(m.group(3))
+    for m in re.finditer(r'CM_\s+BO_\s+(\d+)\s+"([^"]*)"\s*;', text):
+        if int(m.group(1)) in by_id:
+            by_id[int(m.group(1))].comment = m.group(2)
+    for m in re.finditer(r'CM_\s+SG_\s+(\d+)\s+(\w+)\s+"([^"]*)"\s*;', text):
+        sig(int(m.group(1)), m.group(2)).comment = m.group(3)
+    for m in re.finditer(r'VAL_\s+(\d+)\s+(\w+)\s+((?:-?\d+\s+"[^"]*"\s*)+);', text):
+        pairs = re.findall(r'(-?\d+)\s+"([^"]*)"', m.group(3))
+        sig(int(m.group(1)), m.group(2)).values = [(int(v), d) for v, d in pairs]
+    for m in re.finditer(r'BA_\s+"VFrameFormat"\s+BO_\s+(\d+)\s+(\d+)\s*;', text):
+        if int(m.group(1)) in by_id:
+            by_id[int(m.group(1))].fd = int(m.group(2)) in FD_FORMATS
+    return msgs
+
+
+def check(msgs):
+    seen = set()
+    for msg in msgs:
+        key = (msg.id, msg.extended)
+        if key in seen:
+            fail('duplicate id 0x%X' % msg.id)
+        seen.add(key)
+        if msg.len not in VALID_LEN:
+            fail('%s: length %d is not a CAN/CAN FD length' % (msg.name, msg.len))
+        if msg.len > 8 and not msg.fd:
+            fail('%s: length %d needs a CAN FD frame' % (msg.name, msg.len))
+        for s in msg.signals:
+            if not 1 <= s.len <= 64:
+                fail('%s.%s: bad length %d' % (msg.name, s.name, s.len))
+            if s.valtype and s.len != (32 if s.valtype == 1 else 64):
+                fail('%s.%s: float signal must be 32/64 bits' % (msg.name, s.name))
+            if max(s.bits()) >= msg.len * 8 or min(s.bits()) < 0:
+                fail('%s.%s: does not fit in %d bytes' % (msg.name, s.name, msg.len))
+        used = {}
+        for s in msg.signals:
+            for b in s.bits():
+                if b in used:
+                    fail('%s: %s overlaps %s' % (msg.name, s.name, used[b]))
+                used[b] = s.name
+
+
+def is_int(x):
+    return float(x).is_integer()
+
+
+def raw_range(s):
+    if s.signed:
+        return -(1 << (s.len - 1)), (1 << (s.len - 1)) - 1
+    return 0, (1 << s.len) - 1
+
+
+def ctype(s):
+    """struct 필드 타입. 정수 factor/offset이면 물리 범위에 맞는 정수형, 아니면 float."""
+    if s.valtype == 1:
+        return 'float'
+    if s.valtype == 2:
+        return 'double'
+    if not (is_int(s.factor) and is_int(s.offset)):
+        return 'float'
+    lo, hi = raw_range(s)
+    a, b = lo * int(s.factor) + int(s.offset), hi * int(s.factor) + int(s.offset)
+    lo, hi = min(a, b), max(a, b)
+    for bits in (8, 16, 32, 64):
+        if lo >= 0 and hi < (1 << bits):
+            return 'uint%d_t' % bits
+        if -(1 << (bits - 1)) <= lo and hi < (1 << (bits - 1)):
+            return 'int%d_t' % bits
+    fail('%s: value range does not fit 64 bits' % s.name)
+
+
+def rtype(s):
+    return 'uint32_t' if s.len <= 32 else 'uint64_t'
+
+
+def num(x, t):
+    if t in ('float', 'double'):
+        return repr(float(x)) + ('f' if t == 'float' else '')
+    v = int(x)
+    suffix = 'ull' if t == 'uint64_t' else 'll' if t == 'int64_t' else ''
+    return '%d%s' % (v, suffix) if v >= 0 else '(%d%s)' % (v, suffix)
+
+
+def mask(n, t):
+    return '0x%X%s' % ((1 << n) - 1, 'ull' if t == 'uint64_t' else 'u')
+
+
+def ident(s):
+    return re.sub(r'\W', '_', s)
+
+
+def clamp_sides(s):
+    """DBC [min|max]가 raw로 표현할 수 있는 범위보다 좁은 쪽만 클램프한다 (하한, 상한)."""
+    if s.valtype or s.min >= s.max:
+        return False, False
+    lo, hi = raw_range(s)
+    a, b = lo * s.factor + s.offset, hi * s.factor + s.offset
+    return s.min > min(a, b), s.max < max(a, b)
+
+
+def gen_unpack(s, out):
+    rt = rtype(s)
+    terms = []
+    for byte, lo, n, sh in s.chunks():
+        t = 'd[%d]' % byte
+        if lo:
+            t = '(%s >> %d)' % (t, lo)
+        if lo + n < 8:
+            t = '(%s & 0x%Xu)' % (t, (1 << n) - 1)
+        t = '(%s)%s' % (rt, t)
+        if sh:
+            t = '(%s << %d)' % (t, sh)
+        terms.append(t)
+    out.append('    const %s r_%s = %s;' % (rt, s.name, '\n        | '.join(terms)))
+    ct = ctype(s)
+    if s.valtype == 1:
+        val = 'candb_f32(r_%s)' % s.name
+    elif s.valtype == 2:
+        val = 'candb_f64(r_%s)' % s.name
+    else:
+        width = 32 if rt == 'uint32_t' else 64
+        if s.signed and s.len < width:
+            val = '((int%d_t)(r_%s << %d) >> %d)' % (width, s.name, width - s.len, width - s.len)
+        elif s.signed:
+            val = '(int%d_t)r_%s' % (width, s.name)
+        else:
+            val = 'r_%s' % s.name
+        if ct in ('float', 'double'):
+            val = '(%s)%s' % (ct, val)
+        if s.factor != 1:
+            val = '%s * %s' % (val, num(s.factor, ct if ct in ('float', 'double') else 'int64_t'))
+        if s.offset != 0:
+            t = ct if ct in ('float', 'double') else 'int64_t'
+            val = '%s %s %s' % (val, '-' if s.offset < 0 else '+', num(abs(s.offset), t))
+    out.append('    m->%s = (%s)(%s);' % (s.name, ct, val))
+
+
+def gen_pack_raw(s, out):
+    rt = rtype(s)
+    ct = ctype(s)
+    v = 'm->' + s.name
+    if s.valtype == 1:
+        out.append('    const uint32_t r_%s = candb_u32(%s);' % (s.name, v))
+        return
+    if s.valtype == 2:
+        out.append('    const uint64_t r_%s = candb_u64(%s);' % (s.name, v))
+        return
+    lo, hi = clamp_sides(s)
+    if lo or hi:
+        out.append('    %s v_%s = %s;' % (ct, s.name, v))
+        if lo:
+            out.append('    v_%s = v_%s < %s ? %s : v_%s;' % (s.name, s.name, num(s.min, ct), num(s.min, ct), s.name))
+        if hi:
+            out.append('    v_%s = v_%s > %s ? %s : v_%s;' % (s.name, s.name, num(s.max, ct), num(s.max, ct), s.name))
+        v = 'v_' + s.name
+    if ct in ('float', 'double'):
+        e = v
+        if s.offset != 0:
+            e = '(%s %s %s)' % (e, '+' if s.offset < 0 else '-', num(abs(s.offset), ct))
+        if s.factor != 1:
+            e = '%s / %s' % (e, num(s.factor, ct))
+        half = '0.5f' if ct == 'float' else '0.5'
+        out.append('    const %s t_%s = %s;' % (ct, s.name, e))
+        e = '(int64_t)(t_%s + (t_%s < 0 ? -%s : %s))' % (s.name, s.name, half, half)
+    else:
+        e = v
+        if s.offset != 0 or s.factor != 1:
+            e = '(int64_t)' + v
+        if s.offset != 0:
+            e = '(%s %s %s)' % (e, '+' if s.offset < 0 else '-', num(abs(s.offset), 'int64_t'))
+        if s.factor != 1:
+            e = '(%s / %s)' % (e, num(s.factor, 'int64_t'))
+    out.append('    const %s r_%s = (%s)%s;' % (rt, s.name, rt, e))
+
+
+def gen_pack_bytes(msg, out):
+    per = {}
+    for s in msg.signals:
+        for byte, lo, n, sh in s.chunks():
+            t = 'r_%s' % s.name
+            if sh:
+                t = '(%s >> %d)' % (t, sh)
+            if n < 8:
+                t = '(%s & %s)' % (t, mask(n, rtype(s)))
+            if lo:
+                t = '(%s << %d)' % (t, lo)
+            per.setdefault(byte, []).append(t)
+    for byte in range(msg.len):
+        terms = per.get(byte)
+        out.append('    d[%d] = %s;' % (byte, '(uint8_t)(%s)' % ' | '.join(terms) if terms else '0'))
+
+
+def generate(msgs, prefix, src):
+    P, p = prefix.upper(), prefix.lower()
+    o = []
+    o.append('// %s에서 dbcgen.py로 생성됨. 직접 고치지 말고 DBC를 고친 뒤 다시 생성할 것.' % src)
+    o.append('#pragma once')
+    o.append('#include <stdint.h>')
+    o.append('#include <stddef.h>')
+    o.append('#include "candb.h"')
+    o.append('')
+    for msg in msgs:
+        M = '%s_%s' % (P, msg.name.upper())
+        m = '%s_%s' % (p, msg.name.lower())
+        o.append('// ---- 0x%03X %s (%d byte%s%s, %s)%s' % (
+            msg.id, msg.name, msg.len, '' if msg.len == 1 else 's', ', FD' if msg.fd else '', msg.sender,
+            ': ' + msg.comment if msg.comment else ''))
+        o.append('#define %s_ID   0x%03Xu' % (M, msg.id))
+        o.append('#define %s_LEN  %d' % (M, msg.len))
+        o.append('CANDB_STATIC_ASSERT(CANDB_VALID_LEN(%s_LEN) && %s_LEN <= CAN_FRAME_DATA_MAX, "%s: invalid length");'
+                 % (M, M, msg.name))
+        for s in msg.signals:
+            o.append('CANDB_STATIC_ASSERT(%d < %s_LEN * 8, "%s.%s: out of frame");'
+                     % (max(s.bits()), M, msg.name, s.name))
+            for v, d in s.values:
+                o.append('#define %s_%s_%s %d' % (M, s.name.upper(), ident(d).upper(), v))
+        o.append('')
+        o.append('typedef struct {')
+        for s in msg.signals:
+            notes = []
+            if s.min < s.max:
+                notes.append('[%g..%g]' % (s.min, s.max))
+            if s.unit:
+                notes.append(s.unit)
+            if s.comment:
+                notes.append(s.comment)
+            o.append('    %-9s %s;%s' % (ctype(s), s.name, ('  // ' + ' '.join(notes)) if notes else ''))
+        if not msg.signals:
+            o.append('    uint8_t   _unused;')
+        o.append('} %s_t;' % m)
+        o.append('')
+        o.append('static inline void %s_unpack(%s_t* m, const uint8_t* d){' % (m, m))
+        if not msg.signals:
+            o.append('    (void)m; (void)d;')
+        for s in msg.signals:
+            gen_unpack(s, o)
+        o.append('}')
+        o.append('')
+        o.append('static inline void %s_pack(uint8_t* d, const %s_t* m){' % (m, m))
+        if not msg.signals:
+            o.append('    (void)m;')
+        for s in msg.signals:
+            gen_pack_raw(s, o)
+        gen_pack_bytes(msg, o)
+        o.append('}')
+        o.append('')
+        o.append('// 짧은 프레임도 data[]는 64바이트라 그대로 unpack하고 길이만 결과로 알려준다')
+        o.append('static inline can_err_t %s_decode(const CanFrame* fr, %s_t* m){' % (m, m))
+        o.append('    %s_unpack(m, fr->data);' % m)
+        o.append('    return fr->dlc >= %s_LEN ? CAN_OK : CAN_ERR_INVALID;' % M)
+        o.append('}')
+        o.append('')
+        o.append('static inline CanFrame %s_encode(const %s_t* m){' % (m, m))
+        o.append('    CanFrame fr;')
+        o.append('    fr.id           = %s_ID;' % M)
+        o.append('    fr.dlc          = %s_LEN;' % M)
+        flags = []
+        if msg.extended:
+            flags.append('CAN_FRAME_EXTID')
+        if msg.fd:
+            flags += ['CAN_FRAME_FD', 'CAN_FRAME_BRS']
+        o.append('    fr.flags        = %s;' % (' | '.join(flags) if flags else '0'))
+        o.append('    fr.timestamp_ns = 0;')
+        o.append('    %s_pack(fr.data, m);' % m)
+        o.append('    return fr;')
+        o.append('}')
+        o.append('')
+        o.append('static inline can_err_t %s_decode_any(const CanFrame* fr, void* m){' % m)
+        o.append('    return %s_decode(fr, (%s_t*)m);' % (m, m))
+        o.append('}')
+        o.append('')
+
+    # 버스 전체 테이블
+    o.append('// ---- %s 버스 전체' % P)
+    o.append('typedef union {')
+    for msg in msgs:
+        o.append('    %s_%s_t %s;' % (p, msg.name.lower(), msg.name.lower()))
+    o.append('} %s_db_t;' % p)
+    o.append('')
+    o.append('enum {')
+    for i, msg in enumerate(msgs):
+        o.append('    %s_MSG_%s = %d,' % (P, msg.name.upper(), i))
+    o.append('    %s_MSG_COUNT = %d' % (P, len(msgs)))
+    o.append('};')
+    o.append('')
+    o.append('enum {')
+    n = 0
+    for msg in msgs:
+        for s in msg.signals:
+            o.append('    %s_SIG_%s_%s = %d,' % (P, msg.name.upper(), s.name.upper(), n))
+            n += 1
+    o.append('    %s_SIG_COUNT = %d' % (P, n))
+    o.append('};')
+    o.append('')
+    o.append('static const CanDbSignal %s_db_signals[%s_SIG_COUNT] = {' % (p, P))
+    for i, msg in enumerate(msgs):
+        for s in msg.signals:
+            flags = []
+            if s.signed:
+                flags.append('CANDB_SIG_SIGNED')
+            if s.valtype:
+                flags.append('CANDB_SIG_FLOAT')
+            if s.motorola:
+                flags.append('CANDB_SIG_MOTOROLA')
+            o.append('    { "%s", %d, %d, %d, %s, %r, %r, %r, %r },' % (
+                s.name, i, s.start, s.len, ' | '.join(flags) if flags else '0',
+                float(s.factor), float(s.offset), float(s.min), float(s.max)))
+    o.append('};')
+    o.append('')
+    o.append('static const CanDbMessage %s_db_messages[%s_MSG_COUNT] = {' % (p, P))
+    first = 0
+    for msg in msgs:
+        flags = []
+        if msg.extended:
+            flags.append('CAN_FRAME_EXTID')
+        if msg.fd:
+            flags.append('CAN_FRAME_FD')
+        o.append('    { "%s", 0x%03Xu, %s, %d, %d, %d, %s_%s_decode_any },' % (
+            msg.name, msg.id, ' | '.join(flags) if flags else '0', msg.len,
+            first, len(msg.signals), p, msg.name.lower()))
+        first += len(msg.signals)
+    o.append('};')
+    o.append('')
+    o.append('static const CanDb %s_db = { %s_db_messages, %s_db_signals, %s_MSG_COUNT, %s_SIG_COUNT };' % (p, p, p, P, P))
+    o.append('')
+
+    std = [m for m in msgs if not m.extended]
+    ext = [m for m in msgs if m.extended]
+    top = max([m.id for m in std] or [0])
+    idx_t = 'uint8_t' if len(msgs) < 255 else 'uint16_t'
+    o.append('// 표준 ID → (메시지 인덱스 + 1), 0은 미등록')
+    slot = [0] * (top + 1)
+    for i, msg in enumerate(msgs):
+        if not msg.extended:
+            slot[msg.id] = i + 1
+    # C++에서도 include할 수 있게 지정 초기화자 없이 전부 펼친다
+    o.append('static const %s %s_db_slot[0x%03X] = {' % (idx_t, p, top + 1))
+    for i in range(0, len(slot), 16):
+        o.append('    ' + ','.join('%2d' % v for v in slot[i:i + 16]) + ',  // 0x%03X' % i)
+    o.append('};')
+    o.append('')
+    o.append('static inline const CanDbMessage* %s_db_find(uint32_t id, uint32_t flags){' % p)
+    if ext:
+        o.append('    if (flags & CAN_FRAME_EXTID) {')
+        o.append('        switch (id) {')
+        for msg in ext:
+            o.append('        case 0x%Xu: return &%s_db_messages[%s_MSG_%s];' % (msg.id, p, P, msg.name.upper()))
+        o.append('        default: return NULL;')
+        o.append('        }')
+        o.append('    }')
+    else:
+        o.append('    if (flags & CAN_FRAME_EXTID) return NULL;')
+    o.append('    if (id >= sizeof(%s_db_slot) / sizeof(%s_db_slot[0]) || !%s_db_slot[id]) return NULL;' % (p, p, p))
+    o.append('    return &%s_db_messages[%s_db_slot[id] - 1];' % (p, p))
+    o.append('}')
+    o.append('')
+    o.append('// ID로 디코더를 찾아 out의 해당 멤버에 unpack. msg에는 찾은 메시지 디스크립터 (NULL 가능)')
+    o.append('static inline can_err_t %s_db_decode(const CanFrame* fr, %s_db_t* out, const CanDbMessage** msg){' % (p, p))
+    o.append('    const CanDbMessage* m = %s_db_find(fr->id, fr->flags);' % p)
+    o.append('    if (msg) *msg = m;')
+    o.append('    if (!m) return CAN_ERR_INVALID;')
+    o.append('    return m->decode(fr, out);')
+    o.append('}')
+    o.append('')
+    o.append('static inline const CanDbSignal* %s_db_signal(const char* msg, const char* sig){' % p)
+    o.append('    for (size_t i = 0; i < %s_SIG_COUNT; ++i) {' % P)
+    o.append('        const CanDbSignal* s = &%s_db_signals[i];' % p)
+    o.append('        if (!strcmp(s->name, sig) && !strcmp(%s_db_messages[s->msg].name, msg)) return s;' % p)
+    o.append('    }')
+    o.append('    return NULL;')
+    o.append('}')
+    return '\n'.join(o) + '\n'
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('dbc')
+    ap.add_argument('-o', '--output', required=True)
+    ap.add_argument('--prefix', help='식별자 접두사 (기본: DBC 파일 이름)')
+    a = ap.parse_args()
+    prefix = a.prefix or os.path.splitext(os.path.basename(a.dbc))[0]
+    msgs = parse(a.dbc)
+    check(msgs)
+    text = generate(msgs, ident(prefix), os.path.basename(a.dbc))
+    # 내용이 같으면 건드리지 않는다 (빌드 시 불필요한 재컴파일 방지)
+    if os.path.exists(a.output):
+        with open(a.output, encoding='utf-8') as f:
+            if f.read() == text:
+                return
+    with open(a.output, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,168 @@
+// dispatchbench.c — 수신 디스패치 비교: 구독 목록을 프레임마다 filter_match로 훑기 vs channel.c 디스패치 테이블
+// 커널 CAN 없이 가짜 어댑터로 채널을 열고, 어댑터 RX 콜백(on_rx)에 같은 ID 배열을 넣어 초당 프레임 수를 비교한다.
+//   ./dispatchbench [프레임 수=1000000] [구독 수...=1 10 100 1000]
+//  - 구독 모양: 4개 중 3개는 ID 하나짜리 LIST, 1개는 8칸 RANGE (DBC 메시지별 구독에 가까움)
+//  - 프레임: 11-bit 전 구간 무작위 (구독이 많을수록 걸리는 비율이 올라감), 1/16은 29-bit
+#define _GNU_SOURCE
+#include "channel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_SUBS    2048
+
+static uint32_t g_rng = 0x2545F491u;
+static uint64_t g_hits;
+
+static uint32_t rnd(void){
+    g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* ===== 가짜 어댑터: 채널이 건네준 RX 콜백만 잡아 둔다 ===== */
+static adapter_rx_cb_t g_on_rx;
+static void*           g_on_rx_user;
+
+static can_err_t fa_open(Adapter* self, const char* name, const CanConfig* cfg, AdapterHandle* out){
+    (void)self; (void)name; (void)cfg;
+    *out = (AdapterHandle)&g_on_rx;
+    return CAN_OK;
+}
+
+static void fa_close(Adapter* self, AdapterHandle h){
+    (void)self; (void)h;
+    g_on_rx = NULL;
+}
+
+static can_err_t fa_set_callbacks(Adapter* self, AdapterHandle h, adapter_rx_cb_t on_rx, void* on_rx_user,
+                                  adapter_err_cb_t on_err, void* on_err_user, adapter_bus_cb_t on_bus, void* on_bus_user){
+    (void)self; (void)h; (void)on_err; (void)on_err_user; (void)on_bus; (void)on_bus_user;
+    g_on_rx = on_rx;
+    g_on_rx_user = on_rx_user;
+    return CAN_OK;
+}
+
+static AdapterVTable g_fake_v = {
+    .ch_open          = fa_open,
+    .ch_close         = fa_close,
+    .ch_set_callbacks = fa_set_callbacks,
+};
+static Adapter g_fake = { &g_fake_v, NULL };
+
+/* ===== 예전 방식: Sub 목록을 프레임마다 훑는다 ===== */
+typedef struct ListSub {
+    CanFilter       filter;
+    can_callback_t  cb;
+    void*           user;
+    struct ListSub* next;
+} ListSub;
+
+static int filter_match(const CanFilter* f, uint32_t id){
+    switch (f->type){
+    case CAN_FILTER_RANGE: return id >= f->data.range.min && id <= f->data.range.max;
+    case CAN_FILTER_MASK:  return (id & f->data.mask.mask) == (f->data.mask.id & f->data.mask.mask);
+    case CAN_FILTER_LIST:
+        for (uint32_t i = 0; i < f->data.list.count; ++i)
+            if (f->data.list.list[i] == id) return 1;
+        return 0;
+    default: return 0;
+    }
+}
+
+static void list_rx(const ListSub* head, const CanFrame* f){
+    for (const ListSub* s = head; s; s = s->next)
+        if (filter_match(&s->filter, f->id)) s->cb(f, s->user);
+}
+
+static void on_frame(const CanFrame* f, void* user){
+    (void)f; (void)user;
+    g_hits++;
+}
+
+// 구독 k: 11-bit 공간을 겹치지 않게 나눠 쓴다 (LIST는 ids[k]에 ID 하나)
+static void make_filter(CanFilter* f, size_t k, uint32_t* ids){
+    memset(f, 0, sizeof(*f));
+    uint32_t base = (uint32_t)((k * 8) % 0x800) + (uint32_t)(k * 8 / 0x800);
+    if (k % 4 == 3){
+        f->type = CAN_FILTER_RANGE;
+        f->data.range.min = base;
+        f->data.range.max = base + 7 > 0x7FF ? 0x7FF : base + 7;
+    } else {
+        ids[k] = base;
+        f->type = CAN_FILTER_LIST;
+        f->data.list.list = &ids[k];
+        f->data.list.count = 1;
+    }
+}
+
+int main(int argc, char* argv[]){
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+    size_t counts_def[] = { 1, 10, 100, 1000 };
+    size_t ncounts = argc > 2 ? (size_t)(argc - 2) : sizeof(counts_def)/sizeof(counts_def[0]);
+    if (n == 0){
+        fprintf(stderr, "usage: %s [frames] [subscriptions 1..%d ...]\n", argv[0], MAX_SUBS);
+        return 2;
+    }
+
+    CanFrame* frs = (CanFrame*)calloc(n, sizeof(CanFrame));
+    CanFilter* fs = (CanFilter*)calloc(MAX_SUBS, sizeof(CanFilter));
+    ListSub*   ls = (ListSub*)calloc(MAX_SUBS, sizeof(ListSub));
+    uint32_t*  ids = (uint32_t*)calloc(MAX_SUBS, sizeof(uint32_t));
+    if (!frs || !fs || !ls || !ids){ fprintf(stderr, "out of memory\n"); return 1; }
+    for (size_t i = 0; i < n; ++i){
+        if ((rnd() & 15) == 0){ frs[i].id = rnd() & 0x1FFFFFFF; frs[i].flags = CAN_FRAME_EXTID; }
+        else frs[i].id = rnd() & 0x7FF;
+        frs[i].dlc = 8;
+    }
+
+    for (size_t c = 0; c < ncounts; ++c){
+        size_t nsub = argc > 2 ? strtoul(argv[2 + c], NULL, 0) : counts_def[c];
+        if (nsub == 0 || nsub > MAX_SUBS){ fprintf(stderr, "subscriptions must be 1..%d\n", MAX_SUBS); return 2; }
+
+        ListSub* head = NULL;
+        for (size_t k = nsub; k-- > 0; ){
+            make_filter(&fs[k], k, ids);
+            ls[k].filter = fs[k];
+            ls[k].cb = on_frame;
+            ls[k].next = head;
+            head = &ls[k];
+        }
+
+        CanConfig cfg;
+        memset(&cfg, 0, sizeof(cfg));
+        cfg.bitrate = 500000;
+        Channel* ch = NULL;
+        if (channel_start("bench", cfg, &g_fake, &ch) != CAN_OK){ fprintf(stderr, "channel_start failed\n"); return 1; }
+        for (size_t k = 0; k < nsub; ++k){
+            int id;
+            if (channel_subscribe(ch, &id, &fs[k], on_frame, NULL) != CAN_OK){ fprintf(stderr, "channel_subscribe failed\n"); return 1; }
+        }
+
+        g_hits = 0;
+        uint64_t t0 = now_ns();
+        for (size_t i = 0; i < n; ++i) list_rx(head, &frs[i]);
+        uint64_t t_list = now_ns() - t0;
+        uint64_t hits_list = g_hits;
+
+        g_hits = 0;
+        t0 = now_ns();
+        for (size_t i = 0; i < n; ++i) g_on_rx(&frs[i], g_on_rx_user);
+        uint64_t t_table = now_ns() - t0;
+
+        printf("subs=%-5zu list %6.1f Mframes/s  table %6.1f Mframes/s (x%.1f)  hits=%llu%s\n", nsub,
+               (double)n * 1e3 / (double)t_list, (double)n * 1e3 / (double)t_table,
+               (double)t_list / (double)t_table, (unsigned long long)hits_list,
+               g_hits == hits_list ? "" : "  MISMATCH");
+        channel_stop(ch);
+    }
+
+    free(frs); free(fs); free(ls); free(ids);
+    return 0;
+}
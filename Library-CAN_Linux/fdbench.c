@@ -0,0 +1,151 @@
+// fdbench.c — 클래식 8바이트 프레임 vs CAN FD 64바이트 프레임 처리량 (라이브러리 송신 → CAN_RAW 소켓 수신)
+// 같은 양의 페이로드를 클래식/FD 프레임으로 can_send_batch_h에 넘기고, 따로 연 소켓이 다 받을 때까지의 초당 바이트를 잰다.
+// vcan은 버스 속도 제한이 없으므로, 실제 버스(bitrate / BRS dbitrate)에서 걸릴 시간도 프레임 길이로 추정해 같이 출력한다.
+//   sudo ip link add vcan0 type vcan && sudo ip link set vcan0 mtu 72 && sudo ip link set vcan0 up
+//   ./fdbench vcan0 [바이트=4194304] [bitrate=500000] [dbitrate=2000000]
+#define _GNU_SOURCE
+#include "can_api.h"
+#include "adapter.h"        // can_frame_bus_time_ns
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#define BENCH_BATCH     64
+#define FACE_PAIRS      2048        // 얼굴 프로파일: (uint32 idx, float) 쌍
+
+static atomic_int           g_stop;
+static atomic_uint_fast64_t g_rx_frames;
+static atomic_uint_fast64_t g_rx_bytes;
+static const char*          g_ifname;
+static int                  g_rx_err;
+
+static uint64_t mono_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 라이브러리 채널과 따로 CAN_RAW 소켓으로 받는다 (CAN_RAW는 자기 송신을 안 받으므로)
+static void* rx_fn(void* arg){
+    (void)arg;
+    int s = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
+    if (s < 0){ g_rx_err = errno; return NULL; }
+    int on = 1, rcvbuf = 4 << 20;
+    setsockopt(s, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &on, sizeof(on));
+    setsockopt(s, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    struct timeval tv = { 0, 100000 };
+    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    struct sockaddr_can a;
+    memset(&a, 0, sizeof(a));
+    a.can_family  = AF_CAN;
+    a.can_ifindex = (int)if_nametoindex(g_ifname);
+    if (!a.can_ifindex || bind(s, (struct sockaddr*)&a, sizeof(a)) < 0){
+        g_rx_err = errno ? errno : ENODEV;
+        close(s);
+        return NULL;
+    }
+    struct canfd_frame cf;
+    while (!atomic_load_explicit(&g_stop, memory_order_relaxed)){
+        ssize_t n = read(s, &cf, sizeof(cf));
+        if (n != CAN_MTU && n != CANFD_MTU) continue;
+        atomic_fetch_add_explicit(&g_rx_bytes, cf.len, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_rx_frames, 1, memory_order_relaxed);
+    }
+    close(s);
+    return NULL;
+}
+
+// 페이로드 total 바이트를 len바이트 프레임으로 보낸다. 받는 쪽이 다 받거나 1초 동안 늘지 않으면 끝
+static void run(CanChannel* ch, const char* name, uint8_t len, uint32_t flags, uint64_t total, int bitrate, int dbitrate){
+    CanFrame frs[BENCH_BATCH];
+    memset(frs, 0, sizeof(frs));
+    for (int i = 0; i < BENCH_BATCH; ++i){
+        frs[i].id    = 0x123;
+        frs[i].dlc   = len;
+        frs[i].flags = flags;
+        for (int b = 0; b < len; ++b) frs[i].data[b] = (uint8_t)(i + b);
+    }
+    uint64_t nframes = (total + len - 1) / len;
+    uint64_t f0 = atomic_load(&g_rx_frames), b0 = atomic_load(&g_rx_bytes);
+    uint64_t t0 = mono_ns(), sent = 0, fails = 0;
+    while (sent < nframes){
+        size_t k = nframes - sent < BENCH_BATCH ? (size_t)(nframes - sent) : BENCH_BATCH;
+        size_t got = 0;
+        if (can_send_batch_h(ch, frs, k, &got, 100) != CAN_OK && got == 0 && ++fails > 100){
+            printf("%-7s send stalled after %llu frames\n", name, (unsigned long long)sent);
+            return;
+        }
+        sent += got;
+    }
+    uint64_t last = 0, t_last = mono_ns();
+    for (;;){
+        uint64_t r = atomic_load(&g_rx_frames) - f0;
+        if (r >= nframes) break;
+        if (r != last){ last = r; t_last = mono_ns(); }
+        if (mono_ns() - t_last > 1000000000ULL) break;
+        usleep(1000);
+    }
+    double sec = (double)(mono_ns() - t0) / 1e9;
+    uint64_t rf = atomic_load(&g_rx_frames) - f0, rb = atomic_load(&g_rx_bytes) - b0;
+    double bus = (double)can_frame_bus_time_ns(&frs[0], bitrate, dbitrate) * (double)nframes / 1e9;
+    printf("%-7s len=%2u frames=%llu rx=%llu  vcan %.1f MB/s  bus-bound %.0f B/s (%.2f s for %llu B)\n",
+           name, len, (unsigned long long)nframes, (unsigned long long)rf, (double)rb / sec / 1e6,
+           (double)total / bus, bus, (unsigned long long)total);
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 2){
+        fprintf(stderr, "usage: %s <ifname> [bytes] [bitrate] [dbitrate]\n", argv[0]);
+        return 2;
+    }
+    g_ifname = argv[1];
+    uint64_t total = argc > 2 ? strtoull(argv[2], NULL, 0) : (4u << 20);
+    int bitrate    = argc > 3 ? atoi(argv[3]) : 500000;
+    int dbitrate   = argc > 4 ? atoi(argv[4]) : 2000000;
+    if (total == 0 || bitrate <= 0 || dbitrate <= 0){
+        fprintf(stderr, "usage: %s <ifname> [bytes] [bitrate] [dbitrate]\n", argv[0]);
+        return 2;
+    }
+
+    if (can_init(CAN_DEVICE_LINUX) != CAN_OK){ fprintf(stderr, "can_init failed\n"); return 1; }
+    CanConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.bitrate = bitrate; cfg.samplePoint = 0.8f; cfg.sjw = 1; cfg.mode = CAN_MODE_NORMAL;
+    cfg.fd = 1; cfg.dataBitrate = dbitrate; cfg.dataSamplePoint = 0.75f;
+    CanChannel* ch = NULL;
+    if (can_open_h(g_ifname, cfg, &ch) != CAN_OK){
+        fprintf(stderr, "can_open(%s) failed (FD needs mtu 72: ip link set %s mtu 72)\n", g_ifname, g_ifname);
+        return 1;
+    }
+
+    pthread_t rt;
+    pthread_create(&rt, NULL, rx_fn, NULL);
+    usleep(100000);     // 수신 소켓이 bind될 때까지
+    if (g_rx_err){ fprintf(stderr, "receiver: %s\n", strerror(g_rx_err)); return 1; }
+
+    run(ch, "classic", 8, 0, total, bitrate, dbitrate);
+    run(ch, "fd", 64, CAN_FRAME_FD, total, bitrate, dbitrate);
+    run(ch, "fd+brs", 64, CAN_FRAME_FD | CAN_FRAME_BRS, total, bitrate, dbitrate);
+
+    // 얼굴 프로파일 한 번 (2048 쌍 × 8바이트): 클래식은 쌍마다 프레임 하나, FD는 8쌍씩
+    CanFrame c8  = { .id = 0x123, .dlc = 8 };
+    CanFrame f64 = { .id = 0x123, .dlc = 64, .flags = CAN_FRAME_FD | CAN_FRAME_BRS };
+    printf("face profile (%d pairs): classic %d frames %.1f ms, fd+brs %d frames %.1f ms on the bus\n", FACE_PAIRS,
+           FACE_PAIRS, (double)can_frame_bus_time_ns(&c8, bitrate, dbitrate) * FACE_PAIRS / 1e6,
+           FACE_PAIRS / 8, (double)can_frame_bus_time_ns(&f64, bitrate, dbitrate) * (FACE_PAIRS / 8) / 1e6);
+
+    atomic_store(&g_stop, 1);
+    pthread_join(rt, NULL);
+    can_dispose();
+    return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "can_api.h"
+#include "channel.h"
+
+/*
+ * 사용자 공간 ISO-TP (ISO 15765-2) 구현.
+ * 어댑터가 ch_isotp_* 훅을 주지 않을 때 채널이 쓴다 (ESP32, CAN_ISOTP 모듈이 없는 커널).
+ *  - 수신/FC 처리는 채널 구독 콜백(RX 스레드)에서, 송신은 isotp_send 호출자 스레드에서
+ *  - 연결 하나에 송신은 한 번에 하나씩 (여러 스레드가 부르면 순서대로)
+ */
+typedef struct IsoTp IsoTp;
+
+can_err_t   isotp_create    (Channel* ch, const CanIsoTpConfig* cfg, IsoTp** out);
+can_err_t   isotp_send      (IsoTp* tp, const void* data, size_t len, uint32_t timeout_ms);
+can_err_t   isotp_recv      (IsoTp* tp, void* buf, size_t cap, size_t* len, uint32_t timeout_ms);
+void        isotp_shutdown  (IsoTp* tp);    // 기다리는 send/recv를 CAN_ERR_STATE로 깨운다
+void        isotp_destroy   (IsoTp* tp);    // 구독 해제. 메모리는 RX 스레드가 놓은 뒤 해제
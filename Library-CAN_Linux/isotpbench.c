@@ -0,0 +1,267 @@
+// isotpbench.c — 얼굴 프로파일 전송 비교: ISO-TP (isotp.c 사용자 공간 구현) vs 프레임마다 ACK 주고받기
+// 커널 CAN 없이 가짜 어댑터 두 개를 가짜 버스로 이어 채널 두 개를 열고, 같은 float 배열을 보내 프레임 수/버스 시간을 비교한다.
+//   ./isotpbench [float 개수=2048] [반복=20] [bitrate=500000] [dbitrate=2000000]
+//  - ack    : 8바이트 데이터 프레임 (uint32 index + float) 하나 보내고 2바이트 ACK를 받은 뒤 다음 (지금 TCU→SCA 방식)
+//  - isotp  : float 배열을 4092바이트씩 ISO-TP 메시지로 (클래식, block_size 8 / 0)
+//  - isotp fd: 같은 것을 FD+BRS 64바이트 프레임으로
+//  - bus-bound: 버스에 올라간 프레임 길이(can_frame_bus_time_ns)로 계산한 실제 버스에서의 초당 바이트 (가짜 버스는 속도 제한 없음)
+#define _GNU_SOURCE
+#include "channel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#define BUS_DEPTH       8192
+#define TP_CHUNK        4092        // ISO-TP 메시지 하나 (4095 이하, float 단위)
+#define ACK_DATA_ID     0x104       // TCU_SCA_USER_INFO
+#define ACK_ACK_ID      0x111       // SCA_TCU_USER_INFO_ACK
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* ===== 가짜 버스: 핸들 1에 쓴 프레임은 핸들 2의 RX 콜백으로, 2는 1로 (버스 스레드 하나가 순서대로 전달) ===== */
+typedef struct {
+    int         dst;
+    CanFrame    f;
+} BusEnt;
+
+static BusEnt           g_q[BUS_DEPTH];
+static size_t           g_qh, g_qt;
+static int              g_bus_stop;
+static pthread_mutex_t  g_qm = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   g_qc = PTHREAD_COND_INITIALIZER;
+static adapter_rx_cb_t  g_rx[3];
+static void*            g_rx_user[3];
+static int              g_nopen;
+static int              g_bitrate, g_dbitrate;
+static uint64_t         g_bus_ns, g_bus_frames;
+
+static can_err_t fb_open(Adapter* self, const char* name, const CanConfig* cfg, AdapterHandle* out){
+    (void)self; (void)name; (void)cfg;
+    if (g_nopen >= 2) return CAN_ERR_NODEV;
+    *out = (AdapterHandle)(intptr_t)(++g_nopen);
+    return CAN_OK;
+}
+
+static void fb_close(Adapter* self, AdapterHandle h){
+    (void)self;
+    pthread_mutex_lock(&g_qm);
+    g_rx[(intptr_t)h] = NULL;
+    pthread_mutex_unlock(&g_qm);
+}
+
+static can_err_t fb_set_callbacks(Adapter* self, AdapterHandle h, adapter_rx_cb_t on_rx, void* on_rx_user,
+                                  adapter_err_cb_t on_err, void* on_err_user, adapter_bus_cb_t on_bus, void* on_bus_user){
+    (void)self; (void)on_err; (void)on_err_user; (void)on_bus; (void)on_bus_user;
+    pthread_mutex_lock(&g_qm);
+    g_rx[(intptr_t)h] = on_rx;
+    g_rx_user[(intptr_t)h] = on_rx_user;
+    pthread_mutex_unlock(&g_qm);
+    return CAN_OK;
+}
+
+static can_err_t fb_write(Adapter* self, AdapterHandle h, const CanFrame* f, uint32_t timeout_ms){
+    (void)self; (void)timeout_ms;
+    pthread_mutex_lock(&g_qm);
+    if (g_qt - g_qh >= BUS_DEPTH){ pthread_mutex_unlock(&g_qm); return CAN_ERR_AGAIN; }
+    BusEnt* e = &g_q[g_qt++ % BUS_DEPTH];
+    e->dst = 3 - (int)(intptr_t)h;
+    e->f   = *f;
+    g_bus_ns += can_frame_bus_time_ns(f, g_bitrate, g_dbitrate);
+    g_bus_frames++;
+    pthread_cond_signal(&g_qc);
+    pthread_mutex_unlock(&g_qm);
+    return CAN_OK;
+}
+
+static void* bus_fn(void* arg){
+    (void)arg;
+    pthread_mutex_lock(&g_qm);
+    for (;;){
+        while (g_qh == g_qt && !g_bus_stop) pthread_cond_wait(&g_qc, &g_qm);
+        if (g_qh == g_qt) break;
+        BusEnt e = g_q[g_qh++ % BUS_DEPTH];
+        adapter_rx_cb_t cb = g_rx[e.dst];
+        void* user = g_rx_user[e.dst];
+        pthread_mutex_unlock(&g_qm);
+        if (cb) cb(&e.f, user);
+        pthread_mutex_lock(&g_qm);
+    }
+    pthread_mutex_unlock(&g_qm);
+    return NULL;
+}
+
+static AdapterVTable g_bus_v = {
+    .ch_open          = fb_open,
+    .ch_close         = fb_close,
+    .ch_set_callbacks = fb_set_callbacks,
+    .write            = fb_write,
+};
+static Adapter g_bus = { &g_bus_v, NULL };
+
+/* ===== 프레임마다 ACK: 받는 쪽은 데이터 프레임마다 ACK, 보내는 쪽은 ACK를 기다렸다가 다음 ===== */
+typedef struct {
+    Channel*        ch;
+    float*          out;
+    size_t          n;
+} AckRx;
+
+static pthread_mutex_t g_ack_m = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  g_ack_c = PTHREAD_COND_INITIALIZER;
+static uint32_t        g_ack_next;      // 다음에 기다리는 ACK index + 1
+
+static void ack_rx_cb(const CanFrame* f, void* user){
+    AckRx* r = (AckRx*)user;
+    uint32_t idx;
+    memcpy(&idx, f->data, sizeof(idx));
+    if (idx < r->n) memcpy(&r->out[idx], f->data + 4, sizeof(float));
+    CanFrame a = { .id = ACK_ACK_ID, .dlc = 2 };
+    a.data[0] = (uint8_t)idx;
+    a.data[1] = 0;      // 정상
+    channel_write(r->ch, &a, 0);
+}
+
+static void ack_tx_cb(const CanFrame* f, void* user){
+    (void)f; (void)user;
+    pthread_mutex_lock(&g_ack_m);
+    g_ack_next++;
+    pthread_cond_signal(&g_ack_c);
+    pthread_mutex_unlock(&g_ack_m);
+}
+
+static int send_ack(Channel* a, const float* v, size_t n){
+    for (size_t i = 0; i < n; ++i){
+        CanFrame f = { .id = ACK_DATA_ID, .dlc = 8 };
+        uint32_t idx = (uint32_t)i;
+        memcpy(f.data, &idx, 4);
+        memcpy(f.data + 4, &v[i], 4);
+        if (channel_write(a, &f, 100) != CAN_OK) return -1;
+        struct timespec dl;
+        clock_gettime(CLOCK_REALTIME, &dl);
+        dl.tv_sec += 1;
+        pthread_mutex_lock(&g_ack_m);
+        while (g_ack_next < (uint32_t)i + 1)
+            if (pthread_cond_timedwait(&g_ack_c, &g_ack_m, &dl) == ETIMEDOUT) break;
+        int ok = g_ack_next >= (uint32_t)i + 1;
+        pthread_mutex_unlock(&g_ack_m);
+        if (!ok) return -1;
+    }
+    return 0;
+}
+
+/* ===== ISO-TP: TP_CHUNK바이트씩 ===== */
+static int send_tp(Channel* a, int ta, Channel* b, int tb, const float* v, float* out, size_t n){
+    const uint8_t* src = (const uint8_t*)v;
+    uint8_t* dst = (uint8_t*)out;
+    size_t total = n * sizeof(float);
+    for (size_t off = 0; off < total; off += TP_CHUNK){
+        size_t k = total - off < TP_CHUNK ? total - off : TP_CHUNK, got = 0;
+        if (channel_isotp_send(a, ta, src + off, k, 1000) != CAN_OK) return -1;
+        if (channel_isotp_recv(b, tb, dst + off, k, &got, 1000) != CAN_OK || got != k) return -1;
+    }
+    return 0;
+}
+
+static void report(const char* name, size_t n, int reps, uint64_t wall_ns, int ok, const float* v, const float* out){
+    double bytes = (double)n * sizeof(float) * reps;
+    double bus = (double)g_bus_ns / 1e9;
+    printf("%-11s frames/profile=%-6.0f bus %7.1f ms/profile  bus-bound %7.0f B/s  sim %6.1f MB/s%s\n", name,
+           (double)g_bus_frames / reps, bus * 1e3 / reps, bytes / bus, bytes / ((double)wall_ns / 1e9) / 1e6,
+           ok == 0 && !memcmp(v, out, n * sizeof(float)) ? "" : "  FAIL");
+}
+
+static void reset_bus(void){
+    pthread_mutex_lock(&g_qm);
+    g_bus_ns = 0;
+    g_bus_frames = 0;
+    pthread_mutex_unlock(&g_qm);
+}
+
+int main(int argc, char* argv[]){
+    size_t n   = argc > 1 ? strtoul(argv[1], NULL, 0) : 2048;
+    int reps   = argc > 2 ? atoi(argv[2]) : 20;
+    g_bitrate  = argc > 3 ? atoi(argv[3]) : 500000;
+    g_dbitrate = argc > 4 ? atoi(argv[4]) : 2000000;
+    if (n == 0 || reps <= 0 || g_bitrate <= 0 || g_dbitrate <= 0){
+        fprintf(stderr, "usage: %s [floats] [repeats] [bitrate] [dbitrate]\n", argv[0]);
+        return 2;
+    }
+    float* v   = (float*)malloc(n * sizeof(float));
+    float* out = (float*)malloc(n * sizeof(float));
+    if (!v || !out){ fprintf(stderr, "out of memory\n"); return 1; }
+    for (size_t i = 0; i < n; ++i) v[i] = (float)i * 0.25f - 100.0f;
+
+    pthread_t bt;
+    pthread_create(&bt, NULL, bus_fn, NULL);
+    CanConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.bitrate = g_bitrate; cfg.fd = 1; cfg.dataBitrate = g_dbitrate;
+    Channel *a = NULL, *b = NULL;
+    if (channel_start("tcu", cfg, &g_bus, &a) != CAN_OK || channel_start("sca", cfg, &g_bus, &b) != CAN_OK){
+        fprintf(stderr, "channel_start failed\n");
+        return 1;
+    }
+
+    // 프레임마다 ACK
+    {
+        uint32_t id_d = ACK_DATA_ID, id_a = ACK_ACK_ID;
+        CanFilter fd = { .type = CAN_FILTER_LIST, .data.list = { .list = &id_d, .count = 1 } };
+        CanFilter fa = { .type = CAN_FILTER_LIST, .data.list = { .list = &id_a, .count = 1 } };
+        AckRx r = { b, out, n };
+        int sb, sa;
+        channel_subscribe(b, &sb, &fd, ack_rx_cb, &r);
+        channel_subscribe(a, &sa, &fa, ack_tx_cb, NULL);
+        memset(out, 0, n * sizeof(float));
+        reset_bus();
+        int ok = 0;
+        uint64_t t0 = now_ns();
+        for (int k = 0; k < reps && ok == 0; ++k){
+            g_ack_next = 0;
+            ok = send_ack(a, v, n);
+        }
+        report("ack", n, reps, now_ns() - t0, ok, v, out);
+        channel_unsubscribe(a, sa);
+        channel_unsubscribe(b, sb);
+    }
+
+    // ISO-TP: 클래식 bs=8, bs=0, FD+BRS bs=8
+    static const struct { const char* name; uint8_t bs; uint32_t flags; } tps[] = {
+        { "isotp bs=8", 8, 0 },
+        { "isotp bs=0", 0, 0 },
+        { "isotp fd",   8, CAN_FRAME_FD | CAN_FRAME_BRS },
+    };
+    for (size_t t = 0; t < sizeof(tps)/sizeof(tps[0]); ++t){
+        CanIsoTpConfig ca = { .tx_id = 0x7E0, .rx_id = 0x7E8, .flags = tps[t].flags };
+        CanIsoTpConfig cb = { .tx_id = 0x7E8, .rx_id = 0x7E0, .flags = tps[t].flags, .block_size = tps[t].bs };
+        int ta, tb;
+        if (channel_isotp_open(a, &ta, &ca) != CAN_OK || channel_isotp_open(b, &tb, &cb) != CAN_OK){
+            fprintf(stderr, "channel_isotp_open failed\n");
+            return 1;
+        }
+        memset(out, 0, n * sizeof(float));
+        reset_bus();
+        int ok = 0;
+        uint64_t t0 = now_ns();
+        for (int k = 0; k < reps && ok == 0; ++k) ok = send_tp(a, ta, b, tb, v, out, n);
+        report(tps[t].name, n, reps, now_ns() - t0, ok, v, out);
+        channel_isotp_close(a, ta);
+        channel_isotp_close(b, tb);
+    }
+
+    // 버스에 남은 프레임을 다 전달한 뒤 채널을 닫는다
+    pthread_mutex_lock(&g_qm);
+    g_bus_stop = 1;
+    pthread_cond_signal(&g_qc);
+    pthread_mutex_unlock(&g_qm);
+    pthread_join(bt, NULL);
+    channel_stop(a);
+    channel_stop(b);
+    free(v); free(out);
+    return 0;
+}
@@ -0,0 +1,177 @@
+// latbench.c — CPU 부하 중 수신 지연 측정 (can_set_thread_policy 효과 확인)
+// 모든 CPU를 쓰는 hog 스레드를 돌리면서 1 ms마다 프레임을 보내고, 구독 콜백까지의 최악 지연을 본다.
+//   ./latbench <ifname> [초=10] [SCHED_FIFO 우선순위=0] [cpu_mask=0] [hog 수=CPU 수]
+//   우선순위 0과 80으로 한 번씩 돌려 비교 (vcan이면 bring-up 권한만 있으면 됨)
+//  - lib : can_get_latency (커널 수신 시각 → 콜백 직전, reactor가 깨어나는 지연 포함)
+//  - e2e : 보낸 시각(데이터 8바이트) → 콜백 (송신 스레드/커널 경로까지)
+#define _GNU_SOURCE
+#include "can_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#define BENCH_ID        0x321
+#define BENCH_PERIOD_NS 1000000ULL
+#define MAX_HOGS        64
+
+typedef struct {
+    atomic_uint_fast64_t count;
+    atomic_uint_fast64_t max_us;
+    atomic_uint_fast64_t bucket[CAN_LATENCY_BUCKETS];
+} E2eHist;
+
+static atomic_int   g_stop;
+static E2eHist      g_e2e;
+static const char*  g_ifname;
+static uint64_t     g_sent;
+
+static uint64_t mono_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 콜백은 reactor 스레드에서 불린다 (쓰는 쪽 하나)
+static void on_rx(const CanFrame* f, void* user){
+    (void)user;
+    if (f->id != BENCH_ID || f->dlc < 8) return;
+    uint64_t sent;
+    memcpy(&sent, f->data, sizeof(sent));
+    uint64_t now = mono_ns();
+    uint64_t us = now > sent ? (now - sent) / 1000u : 0;
+    unsigned b = us < 2 ? 0 : (unsigned)(63 - __builtin_clzll(us));
+    if (b >= CAN_LATENCY_BUCKETS) b = CAN_LATENCY_BUCKETS - 1;
+    atomic_fetch_add_explicit(&g_e2e.bucket[b], 1, memory_order_relaxed);
+    if (us > atomic_load_explicit(&g_e2e.max_us, memory_order_relaxed))
+        atomic_store_explicit(&g_e2e.max_us, us, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_e2e.count, 1, memory_order_relaxed);
+}
+
+static void* hog_fn(void* arg){
+    (void)arg;
+    volatile uint64_t x = 1;
+    while (!atomic_load_explicit(&g_stop, memory_order_relaxed))
+        for (int i = 0; i < 100000; ++i) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return NULL;
+}
+
+// 라이브러리 채널과 따로 CAN_RAW 소켓으로 보낸다 (같은 호스트의 다른 소켓이라 루프백으로 받음)
+static void* send_fn(void* arg){
+    (void)arg;
+    int s = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
+    struct sockaddr_can a;
+    memset(&a, 0, sizeof(a));
+    a.can_family  = AF_CAN;
+    a.can_ifindex = (int)if_nametoindex(g_ifname);
+    if (s < 0 || !a.can_ifindex || bind(s, (struct sockaddr*)&a, sizeof(a)) < 0){
+        fprintf(stderr, "sender: %s\n", strerror(errno));
+        if (s >= 0) close(s);
+        return NULL;
+    }
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (!atomic_load_explicit(&g_stop, memory_order_relaxed)){
+        next.tv_nsec += (long)BENCH_PERIOD_NS;
+        if (next.tv_nsec >= 1000000000L){ next.tv_sec++; next.tv_nsec -= 1000000000L; }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        struct can_frame cf;
+        memset(&cf, 0, sizeof(cf));
+        cf.can_id  = BENCH_ID;
+        cf.can_dlc = 8;
+        uint64_t t = mono_ns();
+        memcpy(cf.data, &t, sizeof(t));
+        if (write(s, &cf, sizeof(cf)) == (ssize_t)sizeof(cf)) g_sent++;
+    }
+    close(s);
+    return NULL;
+}
+
+// 히스토그램에서 q 분위가 들어 있는 칸의 위쪽 경계 (us)
+static uint64_t hist_quantile(const uint64_t* bucket, uint64_t count, double q){
+    uint64_t need = (uint64_t)((double)count * q), acc = 0;
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; ++i){
+        acc += bucket[i];
+        if (acc > need) return 2ULL << i;
+    }
+    return 2ULL << (CAN_LATENCY_BUCKETS - 1);
+}
+
+static void report(const char* name, const uint64_t* bucket, uint64_t count, uint64_t max_us){
+    printf("%-4s frames=%llu p50<%llu us p99<%llu us p99.9<%llu us max=%llu us\n", name,
+           (unsigned long long)count,
+           (unsigned long long)hist_quantile(bucket, count, 0.50),
+           (unsigned long long)hist_quantile(bucket, count, 0.99),
+           (unsigned long long)hist_quantile(bucket, count, 0.999),
+           (unsigned long long)max_us);
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 2){
+        fprintf(stderr, "usage: %s <ifname> [seconds] [fifo_priority] [cpu_mask] [hogs]\n", argv[0]);
+        return 2;
+    }
+    g_ifname = argv[1];
+    int sec = argc > 2 ? atoi(argv[2]) : 10;
+    if (sec <= 0) sec = 10;
+    int prio = argc > 3 ? atoi(argv[3]) : 0;
+    uint32_t mask = argc > 4 ? (uint32_t)strtoul(argv[4], NULL, 0) : 0;
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    int hogs = argc > 5 ? atoi(argv[5]) : (int)(ncpu > 0 ? ncpu : 1);
+    if (hogs < 0) hogs = 0;
+    if (hogs > MAX_HOGS) hogs = MAX_HOGS;
+
+    if (can_init(CAN_DEVICE_LINUX) != CAN_OK){ fprintf(stderr, "can_init failed\n"); return 1; }
+    CanConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.bitrate = 500000; cfg.samplePoint = 0.875f; cfg.sjw = 1; cfg.mode = CAN_MODE_NORMAL;
+    if (can_open(g_ifname, cfg) != CAN_OK){ fprintf(stderr, "can_open(%s) failed\n", g_ifname); return 1; }
+
+    CanThreadPolicy pol;
+    memset(&pol, 0, sizeof(pol));
+    pol.priority      = prio;
+    pol.cpu_mask      = mask;
+    pol.lock_memory   = prio > 0;
+    pol.fallback_nice = prio > 0 ? -10 : 0;
+    can_err_t pe = can_set_thread_policy(&pol);
+    printf("policy: fifo=%d cpu_mask=0x%x mlock=%d -> %s\n", prio, mask, pol.lock_memory,
+           pe == CAN_OK ? "applied" : pe == CAN_ERR_PERMISSION ? "partly applied (see above)" : "failed");
+
+    CanFilter any;
+    memset(&any, 0, sizeof(any));
+    any.type = CAN_FILTER_LIST;
+    uint32_t id = BENCH_ID;
+    any.data.list.list = &id; any.data.list.count = 1;
+    int subId = 0;
+    if (can_subscribe(g_ifname, &subId, any, on_rx, NULL) != CAN_OK){ fprintf(stderr, "can_subscribe failed\n"); return 1; }
+
+    pthread_t ht[MAX_HOGS], st;
+    for (int i = 0; i < hogs; ++i) pthread_create(&ht[i], NULL, hog_fn, NULL);
+    pthread_create(&st, NULL, send_fn, NULL);
+    printf("%d hog thread(s) on %ld CPU(s), %d s ...\n", hogs, ncpu, sec);
+    fflush(stdout);
+    sleep((unsigned)sec);
+    atomic_store(&g_stop, 1);
+    pthread_join(st, NULL);
+    for (int i = 0; i < hogs; ++i) pthread_join(ht[i], NULL);
+    usleep(100000);     // 마지막 프레임까지
+
+    CanLatencyHist h;
+    if (can_get_latency(g_ifname, &h) == CAN_OK) report("lib", h.bucket, h.count, h.max_us);
+    uint64_t eb[CAN_LATENCY_BUCKETS];
+    for (int i = 0; i < CAN_LATENCY_BUCKETS; ++i) eb[i] = atomic_load(&g_e2e.bucket[i]);
+    report("e2e", eb, atomic_load(&g_e2e.count), atomic_load(&g_e2e.max_us));
+    printf("sent=%llu\n", (unsigned long long)g_sent);
+
+    can_dispose();
+    return 0;
+}
@@ -0,0 +1,205 @@
+// mmsgbench.c — 프레임마다 read()/write() vs recvmmsg()/sendmmsg() 묶음 (adapter_linux.c의 RX/TX 경로와 같은 호출)
+// 한 소켓이 프레임을 보내고 같은 인터페이스의 두 소켓이 동시에 받아, 방식별 프레임당 시스템 콜 수/CPU 시간을 비교한다.
+//   sudo ip link add vcan0 type vcan && sudo ip link set vcan0 up
+//   ./mmsgbench vcan0 [프레임 수=200000] [batch=32]
+//  - TX: 앞 절반은 write() 프레임마다, 뒤 절반은 sendmmsg(batch) (ENOBUFS면 잠깐 쉬고 다시, 그것도 시스템 콜로 셈)
+//  - RX: read() 스레드와 recvmmsg(batch, MSG_WAITFORONE) 스레드가 같은 프레임을 모두 받는다
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#define MAX_BATCH   256
+
+typedef struct {
+    uint64_t    frames;
+    uint64_t    syscalls;
+    uint64_t    cpu_ns;
+    int         err;
+} BenchRes;
+
+typedef struct {
+    BenchRes    res;
+    int         batch;      // 1: read(), 그 외: recvmmsg
+} RxArg;
+
+static atomic_int   g_stop;
+static const char*  g_ifname;
+
+static uint64_t thread_cpu_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int open_raw(int rcvbuf){
+    int s = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
+    if (s < 0) return -errno;
+    if (rcvbuf){
+        setsockopt(s, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));     // rmem_max까지만 올라감
+        struct timeval tv = { 0, 100000 };      // 멈춤 확인
+        setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+    struct sockaddr_can a;
+    memset(&a, 0, sizeof(a));
+    a.can_family  = AF_CAN;
+    a.can_ifindex = (int)if_nametoindex(g_ifname);
+    if (!a.can_ifindex || bind(s, (struct sockaddr*)&a, sizeof(a)) < 0){
+        int e = errno ? errno : ENODEV;
+        close(s);
+        return -e;
+    }
+    return s;
+}
+
+static void* rx_fn(void* arg){
+    RxArg* r = (RxArg*)arg;
+    int s = open_raw(4 << 20);
+    if (s < 0){ r->res.err = -s; return NULL; }
+
+    struct can_frame frs[MAX_BATCH];
+    struct iovec   iov[MAX_BATCH];
+    struct mmsghdr msgs[MAX_BATCH];
+    for (int i = 0; i < r->batch; ++i){
+        iov[i].iov_base = &frs[i];
+        iov[i].iov_len  = sizeof(frs[i]);
+    }
+
+    uint64_t t0 = thread_cpu_ns();
+    while (!atomic_load_explicit(&g_stop, memory_order_relaxed)){
+        if (r->batch == 1){
+            ssize_t n = read(s, &frs[0], sizeof(frs[0]));
+            r->res.syscalls++;
+            if (n == (ssize_t)sizeof(frs[0])) r->res.frames++;
+            continue;
+        }
+        memset(msgs, 0, (size_t)r->batch * sizeof(msgs[0]));
+        for (int i = 0; i < r->batch; ++i){
+            msgs[i].msg_hdr.msg_iov    = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        int n = recvmmsg(s, msgs, (unsigned)r->batch, MSG_WAITFORONE, NULL);
+        r->res.syscalls++;
+        if (n > 0) r->res.frames += (uint64_t)n;
+    }
+    r->res.cpu_ns = thread_cpu_ns() - t0;
+    close(s);
+    return NULL;
+}
+
+static void fill(struct can_frame* cf, uint64_t i){
+    memset(cf, 0, sizeof(*cf));
+    cf->can_id  = 0x100 + (canid_t)(i & 0x3F);
+    cf->can_dlc = 8;
+    memcpy(cf->data, &i, sizeof(i));
+}
+
+// 프레임마다 write()
+static void tx_write(int s, uint64_t n, BenchRes* r){
+    uint64_t t0 = thread_cpu_ns();
+    struct can_frame cf;
+    for (uint64_t i = 0; i < n; ){
+        fill(&cf, i);
+        ssize_t w = write(s, &cf, sizeof(cf));
+        r->syscalls++;
+        if (w == (ssize_t)sizeof(cf)){ r->frames++; ++i; continue; }
+        if (errno != ENOBUFS && errno != EAGAIN){ r->err = errno; break; }
+        usleep(100);    // qdisc가 빌 때까지
+    }
+    r->cpu_ns = thread_cpu_ns() - t0;
+}
+
+// sendmmsg로 batch개씩 (adapter_linux.c tx_flush와 같은 방식)
+static void tx_mmsg(int s, uint64_t n, int batch, BenchRes* r){
+    struct can_frame frs[MAX_BATCH];
+    struct iovec   iov[MAX_BATCH];
+    struct mmsghdr msgs[MAX_BATCH];
+    uint64_t t0 = thread_cpu_ns();
+    for (uint64_t i = 0; i < n; ){
+        int k = n - i < (uint64_t)batch ? (int)(n - i) : batch;
+        memset(msgs, 0, (size_t)k * sizeof(msgs[0]));
+        for (int j = 0; j < k; ++j){
+            fill(&frs[j], i + (uint64_t)j);
+            iov[j].iov_base = &frs[j];
+            iov[j].iov_len  = sizeof(frs[j]);
+            msgs[j].msg_hdr.msg_iov    = &iov[j];
+            msgs[j].msg_hdr.msg_iovlen = 1;
+        }
+        int off = 0;
+        while (off < k){
+            int w = sendmmsg(s, &msgs[off], (unsigned)(k - off), 0);
+            r->syscalls++;
+            if (w > 0){ off += w; continue; }
+            if (errno != ENOBUFS && errno != EAGAIN){ r->err = errno; break; }
+            usleep(100);
+        }
+        if (r->err) break;
+        r->frames += (uint64_t)k;
+        i += (uint64_t)k;
+    }
+    r->cpu_ns = thread_cpu_ns() - t0;
+}
+
+static void report(const char* name, const BenchRes* r){
+    if (r->err){
+        printf("%-13s error: %s\n", name, strerror(r->err));
+        return;
+    }
+    printf("%-13s frames=%llu syscalls=%llu (%.3f/frame) cpu=%.1f ms (%.0f ns/frame)\n",
+           name, (unsigned long long)r->frames, (unsigned long long)r->syscalls,
+           r->frames ? (double)r->syscalls / (double)r->frames : 0.0, r->cpu_ns / 1e6,
+           r->frames ? (double)r->cpu_ns / (double)r->frames : 0.0);
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 2){
+        fprintf(stderr, "usage: %s <ifname> [frames] [batch 2..%d]\n", argv[0], MAX_BATCH);
+        return 2;
+    }
+    g_ifname = argv[1];
+    uint64_t n = argc > 2 ? strtoull(argv[2], NULL, 0) : 200000;
+    int batch  = argc > 3 ? atoi(argv[3]) : 32;
+    if (n == 0 || batch < 2 || batch > MAX_BATCH){
+        fprintf(stderr, "usage: %s <ifname> [frames] [batch 2..%d]\n", argv[0], MAX_BATCH);
+        return 2;
+    }
+
+    int s = open_raw(0);
+    if (s < 0){ fprintf(stderr, "%s: %s\n", g_ifname, strerror(-s)); return 1; }
+
+    RxArg rr = { .batch = 1 }, rm = { .batch = batch };
+    pthread_t tr, tm;
+    pthread_create(&tr, NULL, rx_fn, &rr);
+    pthread_create(&tm, NULL, rx_fn, &rm);
+    usleep(100000);     // 수신 소켓이 bind될 때까지
+
+    BenchRes tw = {0}, ts = {0};
+    tx_write(s, n / 2, &tw);
+    tx_mmsg(s, n - n / 2, batch, &ts);
+    usleep(300000);     // 마지막 프레임까지
+    atomic_store(&g_stop, 1);
+    pthread_join(tr, NULL);
+    pthread_join(tm, NULL);
+    close(s);
+
+    report("tx write", &tw);
+    report("tx sendmmsg", &ts);
+    report("rx read", &rr.res);
+    report("rx recvmmsg", &rm.res);
+    uint64_t sent = tw.frames + ts.frames;
+    if (rr.res.frames != sent || rm.res.frames != sent)
+        printf("note: sent %llu, a receiver missed some (rmem_max too small? raise net.core.rmem_max)\n",
+               (unsigned long long)sent);
+    return 0;
+}
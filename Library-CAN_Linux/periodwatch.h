@@ -0,0 +1,19 @@
+#pragma once
+#include "can_api.h"
+#include "channel.h"
+
+/*
+ * 주기 프레임 감시 (can_watch_period).
+ * 채널마다 감시 스레드 하나와 만기 시각 min-heap 하나로 모든 감시를 처리한다 (감시마다 스레드/타이머 없음).
+ *  - 도착 기록은 감시별 구독 콜백(RX 스레드)에서 원자 변수만 갱신한다. heap은 건드리지 않는다
+ *  - 감시 스레드는 가장 이른 만기에 깨어나, 그 사이 프레임이 왔으면 새 만기로 다시 넣기만 한다
+ *  - 타임아웃/복구 콜백은 모두 감시 스레드에서 (RX 스레드는 복구 때만 깨운다)
+ */
+typedef struct PeriodWatcher PeriodWatcher;
+
+PeriodWatcher*  pwatch_create   (Channel* ch);     // 감시 스레드 시작
+can_err_t       pwatch_add      (PeriodWatcher* pw, int* watchId, uint32_t id, uint32_t expected_ms, float tolerance,
+                                 can_period_callback_t cb, void* user);
+can_err_t       pwatch_remove   (PeriodWatcher* pw, int watchId);
+can_err_t       pwatch_get_stats(PeriodWatcher* pw, int watchId, CanPeriodStats* out);
+void            pwatch_destroy  (PeriodWatcher* pw);    // channel_stop: 감시 스레드 종료, 구독 해제
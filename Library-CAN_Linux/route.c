@@ -0,0 +1,251 @@
+#include "route.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// 경로 하나를 어댑터 규칙으로 쪼갤 때 최대 개수 (넘으면 사용자 공간 전달)
+#define ROUTE_RULES_MAX     16
+#define ROUTE_OPS           4       // AND, OR, XOR, SET
+
+typedef struct Route {
+    int             id;
+    Channel*        src;
+    Channel*        dst;
+    uint32_t        flags;
+    CanRouteMod     mods[ROUTE_OPS];    // op 순서대로 (fields == 0: 안 씀)
+
+    // 어댑터 규칙
+    void*           links[ROUTE_RULES_MAX];
+    int             nlinks;
+
+    // 사용자 공간 전달
+    int             sub;
+    pthread_mutex_t mtx;        // RX 콜백이 dst로 보내는 동안 잡는다 (지울 때 dst 사용이 끝났는지)
+    int             closing;
+    atomic_uint_fast64_t forwarded, dropped, deleted;
+    atomic_int      refs;       // 목록 몫 + 구독 몫
+
+    struct Route*   next;
+} Route;
+
+static pthread_mutex_t g_route_mtx = PTHREAD_MUTEX_INITIALIZER;
+static Route*          g_routes;
+static int             g_route_next_id;
+
+static void route_put(Route* r){
+    if (atomic_fetch_sub(&r->refs, 1) != 1) return;
+    pthread_mutex_destroy(&r->mtx);
+    free(r);
+}
+
+static void route_release(void* user){
+    route_put((Route*)user);
+}
+
+/* 커널 CAN_GW와 같은 순서/의미로 고친다. 길이가 프레임 종류 최대를 넘으면 0 (버림) */
+static int route_apply(const Route* r, CanFrame* f){
+    const int fd = (f->flags & CAN_FRAME_FD) != 0;
+    const uint8_t nd = fd ? CAN_FRAME_DATA_MAX : 8;
+    for (int op = 0; op < ROUTE_OPS; ++op){
+        const CanRouteMod* m = &r->mods[op];
+        if (!m->fields) continue;
+        const CanFrame* v = &m->value;
+        if (m->fields & CAN_ROUTE_MOD_ID){
+            switch (op){
+            case CAN_ROUTE_AND: f->id &= v->id; break;
+            case CAN_ROUTE_OR:  f->id |= v->id; break;
+            case CAN_ROUTE_XOR: f->id ^= v->id; break;
+            default:
+                f->id    = v->id;
+                f->flags = (f->flags & ~(uint32_t)(CAN_FRAME_EXTID | CAN_FRAME_RTR)) |
+                           (v->flags & (CAN_FRAME_EXTID | CAN_FRAME_RTR));
+                break;
+            }
+            f->id &= (f->flags & CAN_FRAME_EXTID) ? 0x1FFFFFFFu : 0x7FFu;
+        }
+        if (m->fields & CAN_ROUTE_MOD_LEN){
+            switch (op){
+            case CAN_ROUTE_AND: f->dlc &= v->dlc; break;
+            case CAN_ROUTE_OR:  f->dlc |= v->dlc; break;
+            case CAN_ROUTE_XOR: f->dlc ^= v->dlc; break;
+            default:            f->dlc  = v->dlc; break;
+            }
+        }
+        if (m->fields & CAN_ROUTE_MOD_DATA){
+            for (uint8_t i = 0; i < nd; ++i){
+                switch (op){
+                case CAN_ROUTE_AND: f->data[i] &= v->data[i]; break;
+                case CAN_ROUTE_OR:  f->data[i] |= v->data[i]; break;
+                case CAN_ROUTE_XOR: f->data[i] ^= v->data[i]; break;
+                default:            f->data[i]  = v->data[i]; break;
+                }
+            }
+        }
+        if ((m->fields & CAN_ROUTE_MOD_FLAGS) && fd){
+            const uint32_t fm = CAN_FRAME_BRS | CAN_FRAME_ESI;
+            uint32_t x = f->flags & fm, y = v->flags & fm;
+            switch (op){
+            case CAN_ROUTE_AND: x &= y; break;
+            case CAN_ROUTE_OR:  x |= y; break;
+            case CAN_ROUTE_XOR: x ^= y; break;
+            default:            x  = y; break;
+            }
+            f->flags = (f->flags & ~fm) | x;
+        }
+    }
+    return f->dlc <= nd;
+}
+
+/* RX 스레드 (src 구독 콜백) */
+static void route_on_rx(const CanFrame* f, void* user){
+    Route* r = (Route*)user;
+    if (((f->flags & CAN_FRAME_FD) != 0) != ((r->flags & CAN_ROUTE_FD) != 0)) return;
+    CanFrame g = *f;
+    if (!route_apply(r, &g)){
+        atomic_fetch_add_explicit(&r->deleted, 1, memory_order_relaxed);
+        return;
+    }
+    pthread_mutex_lock(&r->mtx);
+    if (!r->closing){
+        can_err_t e = channel_write(r->dst, &g, 0);
+        atomic_fetch_add_explicit(e == CAN_OK ? &r->forwarded : &r->dropped, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&r->mtx);
+}
+
+static void route_teardown(Route* r){
+    if (r->nlinks){
+        for (int i = 0; i < r->nlinks; ++i) channel_route_unload(r->src, r->links[i]);
+        route_put(r);
+        return;
+    }
+    // 이 뒤로는 아직 돌고 있는 콜백도 dst를 건드리지 않는다 (dst가 곧 닫힐 수 있음)
+    pthread_mutex_lock(&r->mtx);
+    r->closing = 1;
+    pthread_mutex_unlock(&r->mtx);
+    if (r->sub) channel_unsubscribe(r->src, r->sub);    // 구독 몫은 release가 놓는다
+    route_put(r);
+}
+
+static can_err_t route_offload(Route* r, const CanFilter* filter){
+    CanFilter masks[ROUTE_RULES_MAX];
+    int n = channel_filter_compile(filter, masks, ROUTE_RULES_MAX);
+    if (n < 0) return CAN_ERR_NODEV;         // 규칙이 너무 많이 필요함 → 사용자 공간
+    if (n == 0) return CAN_ERR_INVALID;      // 빈 RANGE
+
+    CanRouteMod mods[ROUTE_OPS];
+    size_t nm = 0;
+    for (int op = 0; op < ROUTE_OPS; ++op) if (r->mods[op].fields) mods[nm++] = r->mods[op];
+
+    for (int i = 0; i < n; ++i){
+        CanRouteRule rule = { masks[i].data.mask.id, masks[i].data.mask.mask, r->flags, mods, nm };
+        can_err_t e = channel_route_offload(r->src, r->dst, &rule, &r->links[i]);
+        if (e != CAN_OK){
+            for (int k = 0; k < i; ++k) channel_route_unload(r->src, r->links[k]);
+            return e;
+        }
+    }
+    r->nlinks = n;
+    return CAN_OK;
+}
+
+can_err_t route_add(Channel* src, Channel* dst, const CanFilter* filter,
+                    const CanRouteMod* mods, size_t nMods, uint32_t flags, int* routeId){
+    if (!src || !dst || src == dst || !filter || (!mods && nMods) || !routeId) return CAN_ERR_INVALID;
+    if (flags & ~(uint32_t)CAN_ROUTE_FD) return CAN_ERR_INVALID;
+    if (filter->type == CAN_FILTER_LIST && (!filter->data.list.list || !filter->data.list.count)) return CAN_ERR_INVALID;
+
+    Route* r = (Route*)calloc(1, sizeof(Route));
+    if (!r) return CAN_ERR_MEMORY;
+    const uint8_t allowed = CAN_ROUTE_MOD_ID | CAN_ROUTE_MOD_LEN | CAN_ROUTE_MOD_DATA |
+                            ((flags & CAN_ROUTE_FD) ? CAN_ROUTE_MOD_FLAGS : 0);
+    for (size_t i = 0; i < nMods; ++i){
+        const CanRouteMod* m = &mods[i];
+        if ((unsigned)m->op >= ROUTE_OPS || !m->fields || (m->fields & ~allowed) || r->mods[m->op].fields){
+            free(r);
+            return CAN_ERR_INVALID;     // 연산마다 하나 (커널 규칙과 같은 제약)
+        }
+        r->mods[m->op] = *m;
+    }
+    r->src   = src;
+    r->dst   = dst;
+    r->flags = flags;
+    pthread_mutex_init(&r->mtx, NULL);
+    atomic_init(&r->forwarded, 0);
+    atomic_init(&r->dropped, 0);
+    atomic_init(&r->deleted, 0);
+    atomic_init(&r->refs, 1);
+
+    can_err_t e = route_offload(r, filter);
+    if (e == CAN_ERR_NODEV || e == CAN_ERR_PERMISSION){
+        atomic_store(&r->refs, 2);
+        e = channel_subscribe_owned(src, &r->sub, filter, route_on_rx, r, route_release);
+        if (e != CAN_OK) atomic_store(&r->refs, 1);
+    }
+    if (e != CAN_OK){
+        route_put(r);
+        return e;
+    }
+
+    pthread_mutex_lock(&g_route_mtx);
+    r->id   = ++g_route_next_id;
+    r->next = g_routes;
+    g_routes = r;
+    pthread_mutex_unlock(&g_route_mtx);
+    *routeId = r->id;
+    return CAN_OK;
+}
+
+can_err_t route_del(int routeId){
+    pthread_mutex_lock(&g_route_mtx);
+    Route** pp = &g_routes;
+    while (*pp && (*pp)->id != routeId) pp = &(*pp)->next;
+    Route* r = *pp;
+    if (r) *pp = r->next;
+    pthread_mutex_unlock(&g_route_mtx);
+    if (!r) return CAN_ERR_INVALID;
+    route_teardown(r);
+    return CAN_OK;
+}
+
+can_err_t route_get_stats(int routeId, CanRouteStats* out){
+    if (!out) return CAN_ERR_INVALID;
+    memset(out, 0, sizeof(*out));
+    pthread_mutex_lock(&g_route_mtx);
+    Route* r = g_routes;
+    while (r && r->id != routeId) r = r->next;
+    can_err_t e = r ? CAN_OK : CAN_ERR_INVALID;
+    if (r && r->nlinks){
+        // 목록 락을 잡은 채로 (어댑터 조회 중에 경로가 지워지지 않게)
+        out->rules = (uint32_t)r->nlinks;
+        for (int i = 0; i < r->nlinks && e == CAN_OK; ++i) e = channel_route_offload_stats(r->src, r->links[i], out);
+    } else if (r){
+        out->forwarded = atomic_load_explicit(&r->forwarded, memory_order_relaxed);
+        out->dropped   = atomic_load_explicit(&r->dropped, memory_order_relaxed);
+        out->deleted   = atomic_load_explicit(&r->deleted, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&g_route_mtx);
+    return e;
+}
+
+void route_close_channel(Channel* ch){
+    Route* gone = NULL;
+    pthread_mutex_lock(&g_route_mtx);
+    for (Route** pp = &g_routes; *pp; ){
+        Route* r = *pp;
+        if (r->src == ch || r->dst == ch){
+            *pp = r->next;
+            r->next = gone;
+            gone = r;
+        } else {
+            pp = &r->next;
+        }
+    }
+    pthread_mutex_unlock(&g_route_mtx);
+    while (gone){
+        Route* n = gone->next;
+        route_teardown(gone);
+        gone = n;
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "can_api.h"
+#include "channel.h"
+
+/*
+ * 채널 간 게이트웨이 경로 (can_route_*).
+ * 경로 필터를 (id, mask) 규칙으로 쪼개 어댑터 훅(ch_route_add, Linux는 커널 CAN_GW)에 먼저 맡기고,
+ * 훅이 없거나 거절하면 src 구독 콜백(RX 스레드)에서 고쳐서 dst로 보낸다.
+ *  - 경로 목록은 프로세스 전체에 하나 (src/dst가 서로 다른 채널이므로 채널 밖에 둔다)
+ *  - can_close / can_dispose는 채널을 멈추기 전에 route_close_channel로 그 채널이 낀 경로를 지운다
+ */
+can_err_t   route_add           (Channel* src, Channel* dst, const CanFilter* filter,
+                                 const CanRouteMod* mods, size_t nMods, uint32_t flags, int* routeId);
+can_err_t   route_del           (int routeId);
+can_err_t   route_get_stats     (int routeId, CanRouteStats* out);
+void        route_close_channel (Channel* ch);
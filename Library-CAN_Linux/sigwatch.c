@@ -0,0 +1,365 @@
+#include "sigwatch.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// 한 번에 모아 부르는 알림 수 (넘으면 락을 다시 잡고 이어서 훑는다)
+#define SIG_EVENTS_MAX      16
+
+typedef struct {
+    can_signal_callback_t   cb;
+    void*                   user;
+    uint16_t                sig;
+    double                  old_value;
+    double                  new_value;
+} SigEvent;
+
+/* 메시지(ID) 하나 = 채널 구독 하나. 배열은 모두 t->mtx 아래에서 읽고 쓴다 */
+typedef struct SigGroup {
+    struct SignalTable*     t;
+    uint32_t                can_id;
+    uint32_t                ext;        // CAN_FRAME_EXTID
+    int                     sub;
+    int                     dead;       // 표에서 빠짐 (아직 도는 콜백은 아무것도 안 함)
+
+    // 디코드할 신호 (디스크립터마다 하나)
+    uint16_t                nd, capd;
+    const CanDbSignal**     dsig;
+    uint8_t*                dneed;      // 필요한 payload 바이트 (짧은 프레임이면 건너뜀)
+    uint16_t*               drefs;      // 이 신호를 보는 구독 수
+    uint8_t*                dfresh;     // 이번 프레임에서 디코드함
+    double*                 dval;       // 마지막 디코드 값
+    uint64_t*               dts;        // 그 프레임 수신 시각 (0: 아직)
+
+    // 구독
+    uint16_t                n, cap;
+    int*                    sid;        // subId
+    uint16_t*               sd;         // dsig 인덱스
+    uint16_t*               ssig;       // 신호 번호 (콜백 인자)
+    double*                 band;
+    double*                 last;       // 마지막으로 알린 값 (NAN: 아직)
+    can_signal_callback_t*  cb;
+    void**                  user;
+
+    struct SigGroup*        next;
+} SigGroup;
+
+struct SignalTable {
+    Channel*        ch;
+    pthread_mutex_t mtx;
+    int             next_id;
+    SigGroup*       groups;
+    atomic_int      refs;       // 만든 쪽 몫 + 그룹마다 하나 (구독 release가 놓는다)
+};
+
+static uint64_t sig_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void table_put(SignalTable* t){
+    if (atomic_fetch_sub(&t->refs, 1) != 1) return;
+    pthread_mutex_destroy(&t->mtx);
+    free(t);
+}
+
+static void group_free(SigGroup* g){
+    free(g->dsig); free(g->dneed); free(g->drefs); free(g->dfresh); free(g->dval); free(g->dts);
+    free(g->sid); free(g->sd); free(g->ssig); free(g->band); free(g->last); free(g->cb); free(g->user);
+    free(g);
+}
+
+static void group_release(void* user){
+    SigGroup* g = (SigGroup*)user;
+    SignalTable* t = g->t;
+    group_free(g);
+    table_put(t);
+}
+
+// 신호가 끝나는 바이트 + 1 (모토로라는 LSB 쪽이 뒤 바이트)
+static uint8_t sig_need(const CanDbSignal* s){
+    unsigned pos = s->start;
+    if (!(s->flags & CANDB_SIG_MOTOROLA)) return (uint8_t)(((pos + s->len - 1u) >> 3) + 1u);
+    for (unsigned i = 1; i < s->len; ++i) pos = (pos & 7u) ? pos - 1u : pos + 15u;
+    return (uint8_t)((pos >> 3) + 1u);
+}
+
+// 디코드 결과가 같은 디스크립터 (버스 헤더를 여러 번역 단위가 include하면 포인터가 다르다)
+static int sig_same(const CanDbSignal* a, const CanDbSignal* b){
+    return a == b || (a->start == b->start && a->len == b->len && a->flags == b->flags &&
+                      a->factor == b->factor && a->offset == b->offset);
+}
+
+static int sig_moved(double old_value, double v, double band){
+    if (isnan(old_value) || isnan(v)) return isnan(old_value) != isnan(v);
+    return band > 0.0 ? (v - old_value > band || old_value - v > band) : v != old_value;
+}
+
+static int grow(void** p, size_t elem, size_t cap){
+    void* q = realloc(*p, elem * cap);
+    if (!q) return 0;
+    *p = q;
+    return 1;
+}
+
+/* 구독 하나를 그룹에 붙인다 (t->mtx 또는 아직 그룹이 안 보일 때). 실패하면 0 */
+static int group_add_slot(SigGroup* g, int id, const CanDbSignal* s, uint16_t sig, double band,
+                          can_signal_callback_t cb, void* user){
+    uint16_t d = 0;
+    while (d < g->nd && !sig_same(g->dsig[d], s)) ++d;
+    if (d == g->nd){
+        if (g->nd == UINT16_MAX) return 0;
+        if (g->nd == g->capd){
+            size_t c = g->capd ? (size_t)g->capd * 2u : 4u;
+            if (c > UINT16_MAX) c = UINT16_MAX;
+            if (!grow((void**)&g->dsig, sizeof(*g->dsig), c) || !grow((void**)&g->dneed, sizeof(*g->dneed), c) ||
+                !grow((void**)&g->drefs, sizeof(*g->drefs), c) || !grow((void**)&g->dfresh, sizeof(*g->dfresh), c) ||
+                !grow((void**)&g->dval, sizeof(*g->dval), c) || !grow((void**)&g->dts, sizeof(*g->dts), c)) return 0;
+            g->capd = (uint16_t)c;
+        }
+        g->dsig[d]   = s;
+        g->dneed[d]  = sig_need(s);
+        g->drefs[d]  = 0;
+        g->dfresh[d] = 0;
+        g->dval[d]   = NAN;
+        g->dts[d]    = 0;
+        g->nd++;
+    }
+    if (g->n == UINT16_MAX) return 0;
+    if (g->n == g->cap){
+        size_t c = g->cap ? (size_t)g->cap * 2u : 4u;
+        if (c > UINT16_MAX) c = UINT16_MAX;
+        if (!grow((void**)&g->sid, sizeof(*g->sid), c) || !grow((void**)&g->sd, sizeof(*g->sd), c) ||
+            !grow((void**)&g->ssig, sizeof(*g->ssig), c) || !grow((void**)&g->band, sizeof(*g->band), c) ||
+            !grow((void**)&g->last, sizeof(*g->last), c) || !grow((void**)&g->cb, sizeof(*g->cb), c) ||
+            !grow((void**)&g->user, sizeof(*g->user), c)){
+            if (!g->drefs[d]) g->nd--;      // 방금 넣은 신호
+            return 0;
+        }
+        g->cap = (uint16_t)c;
+    }
+    uint16_t i = g->n++;
+    g->sid[i]  = id;
+    g->sd[i]   = d;
+    g->ssig[i] = sig;
+    g->band[i] = band;
+    g->last[i] = NAN;
+    g->cb[i]   = cb;
+    g->user[i] = user;
+    g->drefs[d]++;
+    return 1;
+}
+
+/* 구독 i를 뺀다 (마지막 칸을 그 자리로). 신호를 보는 구독이 없어지면 신호 칸도 같은 식으로 뺀다 */
+static void group_remove_slot(SigGroup* g, uint16_t i){
+    uint16_t d = g->sd[i];
+    uint16_t l = --g->n;
+    g->sid[i]  = g->sid[l];
+    g->sd[i]   = g->sd[l];
+    g->ssig[i] = g->ssig[l];
+    g->band[i] = g->band[l];
+    g->last[i] = g->last[l];
+    g->cb[i]   = g->cb[l];
+    g->user[i] = g->user[l];
+    if (--g->drefs[d]) return;
+    uint16_t ld = --g->nd;
+    if (d == ld) return;
+    g->dsig[d]   = g->dsig[ld];
+    g->dneed[d]  = g->dneed[ld];
+    g->drefs[d]  = g->drefs[ld];
+    g->dfresh[d] = g->dfresh[ld];
+    g->dval[d]   = g->dval[ld];
+    g->dts[d]    = g->dts[ld];
+    for (uint16_t k = 0; k < g->n; ++k) if (g->sd[k] == ld) g->sd[k] = d;
+}
+
+/* RX 스레드 (그룹 구독 콜백) */
+static void sig_on_rx(const CanFrame* f, void* user){
+    SigGroup* g = (SigGroup*)user;
+    SignalTable* t = g->t;
+    SigEvent ev[SIG_EVENTS_MAX];
+    if ((f->flags & CAN_FRAME_EXTID) != g->ext) return;
+
+    pthread_mutex_lock(&t->mtx);
+    if (g->dead){
+        pthread_mutex_unlock(&t->mtx);
+        return;
+    }
+    const uint64_t ts = f->timestamp_ns ? f->timestamp_ns : sig_now_ns();
+    for (uint16_t d = 0; d < g->nd; ++d){
+        g->dfresh[d] = f->dlc >= g->dneed[d];
+        if (!g->dfresh[d]) continue;
+        g->dval[d] = candb_signal_get(g->dsig[d], f->data);
+        g->dts[d]  = ts;
+    }
+    uint16_t i = 0;
+    for (;;){
+        size_t n = 0;
+        for (; i < g->n && n < SIG_EVENTS_MAX; ++i){
+            uint16_t d = g->sd[i];
+            if (!g->dfresh[d]) continue;
+            double v = g->dval[d], o = g->last[i];
+            if (!sig_moved(o, v, g->band[i])) continue;
+            g->last[i] = v;
+            ev[n].cb        = g->cb[i];
+            ev[n].user      = g->user[i];
+            ev[n].sig       = g->ssig[i];
+            ev[n].old_value = o;
+            ev[n].new_value = v;
+            ++n;
+        }
+        int more = i < g->n;
+        pthread_mutex_unlock(&t->mtx);
+        for (size_t k = 0; k < n; ++k) ev[k].cb(ev[k].sig, ev[k].old_value, ev[k].new_value, ev[k].user);
+        if (!more) return;
+        // 콜백 사이에 구독이 빠졌으면 칸이 당겨져 하나쯤 건너뛸 수 있다 (다음 프레임에서 알림)
+        pthread_mutex_lock(&t->mtx);
+        if (g->dead){
+            pthread_mutex_unlock(&t->mtx);
+            return;
+        }
+    }
+}
+
+SignalTable* sigtab_create(Channel* ch){
+    SignalTable* t = (SignalTable*)calloc(1, sizeof(SignalTable));
+    if (!t) return NULL;
+    t->ch = ch;
+    pthread_mutex_init(&t->mtx, NULL);
+    atomic_init(&t->refs, 1);
+    return t;
+}
+
+static SigGroup* table_find(SignalTable* t, uint32_t id, uint32_t ext){
+    SigGroup* g = t->groups;
+    while (g && (g->can_id != id || g->ext != ext)) g = g->next;
+    return g;
+}
+
+can_err_t sigtab_add(SignalTable* t, int* subId, const CanDb* db, uint16_t sig, double deadband,
+                     can_signal_callback_t cb, void* user){
+    if (!t || !subId || !db || !cb || sig >= db->n_sigs || !(deadband >= 0.0)) return CAN_ERR_INVALID;
+    const CanDbSignal* s = &db->signals[sig];
+    if (s->msg >= db->n_msgs || s->len == 0 || s->len > 64) return CAN_ERR_INVALID;
+    const CanDbMessage* m = &db->messages[s->msg];
+    const uint32_t ext = m->flags & CAN_FRAME_EXTID;
+
+    // 이미 구독 중인 메시지면 칸만 붙인다
+    pthread_mutex_lock(&t->mtx);
+    SigGroup* g = table_find(t, m->id, ext);
+    if (g){
+        int id = ++t->next_id;
+        int ok = group_add_slot(g, id, s, sig, deadband, cb, user);
+        pthread_mutex_unlock(&t->mtx);
+        if (!ok) return CAN_ERR_MEMORY;
+        *subId = id;
+        return CAN_OK;
+    }
+    int id = ++t->next_id;
+    pthread_mutex_unlock(&t->mtx);
+
+    // 새 메시지: 구독까지 마친 뒤 표에 건다 (채널 호출을 표 락 밖에서)
+    g = (SigGroup*)calloc(1, sizeof(SigGroup));
+    if (!g) return CAN_ERR_MEMORY;
+    g->t      = t;
+    g->can_id = m->id;
+    g->ext    = ext;
+    if (!group_add_slot(g, id, s, sig, deadband, cb, user)){
+        group_free(g);
+        return CAN_ERR_MEMORY;
+    }
+    CanFilter flt;
+    memset(&flt, 0, sizeof(flt));
+    flt.type = CAN_FILTER_MASK;
+    flt.data.mask.id   = m->id;
+    flt.data.mask.mask = 0x1FFFFFFFu;
+    atomic_fetch_add(&t->refs, 1);
+    can_err_t e = channel_subscribe_owned(t->ch, &g->sub, &flt, sig_on_rx, g, group_release);
+    if (e != CAN_OK){
+        group_free(g);              // release는 불리지 않는다
+        table_put(t);
+        return e;
+    }
+
+    pthread_mutex_lock(&t->mtx);
+    SigGroup* other = table_find(t, m->id, ext);    // 그 사이 다른 스레드가 같은 메시지를 걸었으면 그쪽으로
+    int dup = other != NULL;
+    int ok  = 1;
+    if (dup){
+        ok = group_add_slot(other, id, s, sig, deadband, cb, user);
+        g->dead = 1;
+    } else {
+        g->next = t->groups;
+        t->groups = g;
+    }
+    pthread_mutex_unlock(&t->mtx);
+    if (dup) channel_unsubscribe(t->ch, g->sub);
+    if (!ok) return CAN_ERR_MEMORY;
+    *subId = id;
+    return CAN_OK;
+}
+
+can_err_t sigtab_remove(SignalTable* t, int subId){
+    if (!t || subId <= 0) return CAN_ERR_INVALID;
+    pthread_mutex_lock(&t->mtx);
+    for (SigGroup** pp = &t->groups; *pp; pp = &(*pp)->next){
+        SigGroup* g = *pp;
+        for (uint16_t i = 0; i < g->n; ++i){
+            if (g->sid[i] != subId) continue;
+            group_remove_slot(g, i);
+            int sub = 0;
+            if (g->n == 0){
+                *pp = g->next;
+                g->dead = 1;
+                sub = g->sub;
+            }
+            pthread_mutex_unlock(&t->mtx);
+            if (sub) channel_unsubscribe(t->ch, sub);     // 그룹 메모리는 release가 놓는다
+            return CAN_OK;
+        }
+    }
+    pthread_mutex_unlock(&t->mtx);
+    return CAN_ERR_INVALID;
+}
+
+can_err_t sigtab_get(SignalTable* t, int subId, double* value, uint64_t* age_ns){
+    if (!t || !value) return CAN_ERR_INVALID;
+    can_err_t e = CAN_ERR_INVALID;
+    uint64_t ts = 0;
+    pthread_mutex_lock(&t->mtx);
+    for (SigGroup* g = t->groups; g && e == CAN_ERR_INVALID; g = g->next){
+        for (uint16_t i = 0; i < g->n; ++i){
+            if (g->sid[i] != subId) continue;
+            uint16_t d = g->sd[i];
+            ts = g->dts[d];
+            *value = g->dval[d];
+            e = ts ? CAN_OK : CAN_ERR_AGAIN;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&t->mtx);
+    if (e == CAN_OK && age_ns){
+        uint64_t now = sig_now_ns();
+        *age_ns = now > ts ? now - ts : 0;
+    }
+    return e;
+}
+
+void sigtab_destroy(SignalTable* t){
+    if (!t) return;
+    pthread_mutex_lock(&t->mtx);
+    SigGroup* gs = t->groups;
+    t->groups = NULL;
+    for (SigGroup* g = gs; g; g = g->next) g->dead = 1;
+    pthread_mutex_unlock(&t->mtx);
+    while (gs){
+        SigGroup* n = gs->next;     // 구독을 풀면 release가 언제든 g를 놓을 수 있다
+        channel_unsubscribe(t->ch, gs->sub);
+        gs = n;
+    }
+    table_put(t);
+}
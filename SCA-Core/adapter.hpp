@@ -21,6 +21,9 @@ struct AdapterVTable {
     can_bus_state_t (*status)(Adapter* self, AdapterHandle handle);
     can_err_t       (*recover)(Adapter* self, AdapterHandle handle);
     void (*destroy)(Adapter* self);
+    // () can_open  can_set_thread_policy  ִ RX 忡 Ǵ (  can_thread_policy_get)
+    //  ʱȭϴ (adapter_debug)    ְ  ڿ д
+    can_err_t       (*set_thread_policy)(Adapter* self, const CanThreadPolicy* policy);
 };
 
 struct Adapter {
@@ -29,3 +32,6 @@ struct Adapter {
 };
 
 Adapter* create_adapter(can_device_t device);  // ݵ Ǿ 
+
+// can_set_thread_policy  RX  å (    0)
+const CanThreadPolicy* can_thread_policy_get();
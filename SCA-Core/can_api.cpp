@@ -20,6 +20,9 @@ typedef struct {
 // ʱⰪ device ƴ϶ bool/ptr ǹ  ( ҽ Ÿ )
 static can_api_state_t g_state = { false, nullptr, nullptr };
 
+// can_set_thread_policy 纻. Ͱ RX 带   can_thread_policy_get д´
+static CanThreadPolicy g_thread_policy{};
+
 // ƿ: ̸ ä ã  :contentReference[oaicite:7]{index=7}
 static Channel* find_by_name(const char* name) {
     for (ChannelNode* n = g_state.head; n; n = n->next) {
@@ -173,3 +176,15 @@ can_bus_state_t can_get_status(const char* name) {
     Channel* ch = find_by_name(name);
     return ch ? channel_status(ch) : CAN_BUS_STATE_ERROR_PASSIVE;
 }
+
+can_err_t can_set_thread_policy(const CanThreadPolicy* policy) {
+    if (!policy || policy->priority < 0 || policy->priority > 99) return CAN_ERR_INVALID;
+    if (policy->fallback_nice < -20 || policy->fallback_nice > 19) return CAN_ERR_INVALID;
+    g_thread_policy = *policy;
+    if (!g_state.initialized || !g_state.adapter->v->set_thread_policy) return CAN_OK;
+    return g_state.adapter->v->set_thread_policy(g_state.adapter, policy);
+}
+
+const CanThreadPolicy* can_thread_policy_get() {
+    return &g_thread_policy;
+}
@@ -79,6 +79,16 @@ typedef struct {
 
 typedef void (*can_callback_t)(const CanFrame* frame, void* user);
 
+// CAN 수신 스레드 실행 정책 (can_set_thread_policy, Library-CAN과 같은 구조체)
+// 카메라 인증(MediaPipe) 중에도 수신이 밀리지 않도록 채널 RX 스레드에 SCHED_FIFO 등을 건다.
+typedef struct {
+    int         priority;       // SCHED_FIFO 1~99 (0: 기본 SCHED_OTHER)
+    uint32_t    cpu_mask;       // bit i = CPU i에 고정 (0: 고정 안 함)
+    uint32_t    stack_size;     // 무시 (RX 스레드는 std::thread)
+    int         lock_memory;    // mlockall (CAP_IPC_LOCK 또는 무제한 RLIMIT_MEMLOCK)
+    int         fallback_nice;  // SCHED_FIFO 권한(CAP_SYS_NICE/RLIMIT_RTPRIO)이 없을 때 대신 걸 nice (0: 안 함)
+} CanThreadPolicy;
+
 // API (원형 동일)  :contentReference[oaicite:5]{index=5}
 can_err_t      can_init(can_device_t device);
 void           can_dispose();
@@ -92,3 +102,4 @@ int            can_subscribe(const char* name, CanFilter filter, can_callback_t
 can_err_t      can_unsubscribe(const char* name, int subId);
 can_err_t      can_recover(const char* name);
 can_bus_state_t can_get_status(const char* name);
+can_err_t      can_set_thread_policy(const CanThreadPolicy* policy);  // can_open 전: 열 때 적용, 뒤: 바로. 권한이 없어 일부만 걸렸으면 CAN_ERR_PERMISSION
@@ -7,10 +7,13 @@
 #include <linux/can/raw.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <cstring>
 #include <cerrno>
 #include <cstdio>
 
+#include "canrt.h"      // RX 스레드 SCHED_FIFO/CPU 고정/mlockall (Library-CAN과 공용)
+
 static can_err_t linux_probe(Adapter* /*self*/) {
     // 특별히 할 건 없음. 성공 가정.
     return CAN_OK;
@@ -38,6 +41,7 @@ static int open_bind_socket(const char* ifname, int* out_fd) {
 }
 
 static void rx_loop(LinuxPriv* p) {
+    p->tid.store(canrt_gettid());
     while (!p->stop.load()) {
         struct can_frame fr{};
         ssize_t n = ::read(p->fd, &fr, sizeof(fr));
@@ -50,9 +54,10 @@ static void rx_loop(LinuxPriv* p) {
                 p->on_rx(&cf, p->on_rx_user);
             }
         } else {
-            // EAGAIN 이면 잠깐 쉼
+            // EAGAIN 이면 올 때까지 기다림 (1 ms 폴링이면 우선순위를 올려도 그만큼 늦음, stop은 100 ms마다 확인)
             if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                usleep(1000 * 1);
+                struct pollfd pfd{ p->fd, POLLIN, 0 };
+                ::poll(&pfd, 1, 100);
             } else {
                 // 치명 에러 아닐 땐 그냥 이어감
                 usleep(1000 * 5);
@@ -61,6 +66,32 @@ static void rx_loop(LinuxPriv* p) {
     }
 }
 
+// 카메라 인증(MediaPipe)이 CPU를 다 써도 수신이 밀리지 않게. 권한이 없으면 걸 수 있는 만큼만 건다
+static can_err_t apply_thread_policy(LinuxPriv* p, const CanThreadPolicy* pol) {
+    unsigned got = 0;
+    int r = canrt_set_thread(p->tid.load(), pol->priority, pol->cpu_mask, pol->fallback_nice, &got);
+    if (r == -EPERM) {
+        if (got & CANRT_NICE)
+            std::fprintf(stderr, "canrt: SCHED_FIFO needs CAP_SYS_NICE or RLIMIT_RTPRIO, RX thread runs at nice %d\n", pol->fallback_nice);
+        else
+            std::fprintf(stderr, "canrt: SCHED_FIFO needs CAP_SYS_NICE or RLIMIT_RTPRIO, RX thread keeps the default scheduler\n");
+    } else if (r) {
+        std::fprintf(stderr, "canrt: RX thread policy: %s\n", std::strerror(-r));
+    }
+    int m = pol->lock_memory ? canrt_lock_memory() : 0;
+    if (m) std::fprintf(stderr, "canrt: mlockall: %s (needs CAP_IPC_LOCK or unlimited memlock)\n", std::strerror(-m));
+
+    if (r == -EINVAL) return CAN_ERR_INVALID;
+    if (r == -EPERM || m == -EPERM || m == -ENOMEM) return CAN_ERR_PERMISSION;
+    return (r || m) ? CAN_ERR_IO : CAN_OK;
+}
+
+static can_err_t linux_set_thread_policy(Adapter* self, const CanThreadPolicy* pol) {
+    if (!pol) return CAN_ERR_INVALID;
+    if (!self || !self->priv) return CAN_OK;     // 아직 안 열림 → can_open에서 적용
+    return apply_thread_policy((LinuxPriv*)self->priv, pol);
+}
+
 static can_err_t linux_ch_open(Adapter* self, const char* name, const CanConfig* /*cfg*/, AdapterHandle* out_h) {
     if (!self || !name || !out_h) return CAN_ERR_INVALID;
     auto* priv = new LinuxPriv();
@@ -76,6 +107,9 @@ static can_err_t linux_ch_open(Adapter* self, const char* name, const CanConfig*
     // RX 스레드 시작
     priv->stop.store(false);
     priv->rx_thread = std::thread(rx_loop, priv);
+    while (!priv->tid.load()) std::this_thread::yield();
+    const CanThreadPolicy* pol = can_thread_policy_get();
+    if (pol->priority || pol->cpu_mask || pol->lock_memory) apply_thread_policy(priv, pol);
 
     self->priv = priv;
     *out_h = (AdapterHandle)priv; // 채널 1:1 가정
@@ -172,7 +206,8 @@ static AdapterVTable V = {
     .read          = linux_read,
     .status        = linux_status,
     .recover       = linux_recover,
-    .destroy       = linux_destroy
+    .destroy       = linux_destroy,
+    .set_thread_policy = linux_set_thread_policy
 };
 
 Adapter* create_linux_adapter() {
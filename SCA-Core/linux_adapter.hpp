@@ -8,6 +8,7 @@
 struct LinuxPriv {
     int                 fd{-1};
     std::thread         rx_thread;
+    std::atomic_int     tid{0};         // RX 스레드 tid (스레드 정책은 tid로 건다)
     std::atomic_bool    stop{false};
 
     // 콜백 (channel.cpp가 ch_set_callbacks로 내려줌)
@@ -1,44 +1,50 @@
 #include <cstdio>
 #include <thread>
 #include <chrono>
+#include <cerrno>
+#include <cstring>
 
 // �װ� ���� C++ ���� ���
 #include "can_api.hpp"
+#include "canlink.h"
 
 #include "sequencer.hpp"
 
 // CAN �ݹ�: ��� �������� sequencer�� ����
 static Sequencer* g_seq = nullptr;
 
-static int run_cmd(const char* cmd) {
-    int rc = std::system(cmd);
-    if (rc != 0) std::fprintf(stderr, "[can0] cmd failed (%d): %s\n", rc, cmd);
-    return rc;
-}
-
+// can0 bring-up: rtnetlink로 직접 설정 (Library-CAN_Linux/canlink.c, ip/libsocketcan 불필요)
 bool bringup_can0(unsigned bitrate = 500000, bool canfd = false) {
-    // 내려두고 시작(에러 무시)
-    run_cmd("ip link set can0 down 2>/dev/null || true");
-
-    char buf[256];
+    CanLinkConfig lc{};
+    lc.bitrate      = bitrate;
+    lc.sample_point = 875;
+    lc.ctrl_mask    = CAN_CTRLMODE_LISTENONLY | CAN_CTRLMODE_LOOPBACK;
     if (canfd) {
-        std::snprintf(buf, sizeof(buf),
-            "ip link set can0 type can bitrate %u dbitrate 2000000 fd on", bitrate);
-    } else {
-        std::snprintf(buf, sizeof(buf),
-            "ip link set can0 type can bitrate %u", bitrate);
+        lc.dbitrate    = 2000000;
+        lc.ctrl_mask  |= CAN_CTRLMODE_FD;
+        lc.ctrl_flags |= CAN_CTRLMODE_FD;
     }
-    if (run_cmd(buf) != 0) return false;
-
-    run_cmd("ip link set can0 txqueuelen 1024");
-
-    if (run_cmd("ip link set can0 up") != 0) return false;
-
+    lc.txqueuelen   = 1024;
+    lc.restart_ms   = -1;
+
+    CanLinkTiming t{};
+    int r = canlink_configure("can0", &lc, &t);
+    if (r != 0) {
+        std::fprintf(stderr, "[can0] bring-up failed: %s\n", std::strerror(-r));
+        return false;
+    }
+    if (t.reused)
+        std::fprintf(stderr, "[can0] already up with the same settings (%.2f ms)\n", t.total_us / 1000.0);
+    else
+        std::fprintf(stderr, "[can0] link up in %.2f ms (query %.2f, down %.2f, config %.2f, up %.2f)\n",
+                     t.total_us / 1000.0, t.query_us / 1000.0, t.down_us / 1000.0,
+                     t.config_us / 1000.0, t.up_us / 1000.0);
     return true;
 }
 
 void bringdown_can0() {
-    run_cmd("ip link set can0 down 2>/dev/null || true");
+    int r = canlink_set_up("can0", 0);
+    if (r != 0 && r != -ENODEV) std::fprintf(stderr, "[can0] down failed: %s\n", std::strerror(-r));
 }
 static void on_rx_cb(const CanFrame* f, void* user) {
     (void)user;
@@ -56,6 +62,12 @@ int main() {
         return 1;
     }
 
+    // 카메라 인증(MediaPipe)이 CPU를 다 쓰는 동안에도 RX 스레드가 밀리지 않게 (권한 없으면 nice -10으로 대신)
+    CanThreadPolicy pol { .priority=80, .cpu_mask=0, .stack_size=0, .lock_memory=1, .fallback_nice=-10 };
+    if (can_set_thread_policy(&pol) != CAN_OK) {
+        std::fprintf(stderr, "[can] real-time policy not fully applied (setcap cap_sys_nice,cap_ipc_lock)\n");
+    }
+
     CanConfig cfg { .channel=0, .bitrate=500000, .samplePoint=0.875f, .sjw=1, .mode=CAN_MODE_NORMAL };
     const char* CH = "can0";
     if (can_open(CH, cfg) != CAN_OK) {
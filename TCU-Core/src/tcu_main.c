@@ -335,21 +335,25 @@ int main(int argc, char* argv[]) {
 
     CanFilter filter = {.type = CAN_FILTER_MASK};
 
+    // Handlers call the REST server (blocking curl), so run them on per-subscription
+    // worker threads instead of the CAN RX thread.
+    CanSubOptions sub_opt = {.mode = CAN_SUB_ASYNC_WORKER, .depth = 16, .overflow = CAN_SUB_DROP_OLDEST};
+
     // Subscribe to SCA_TCU_USER_INFO_REQ (0x102)
     filter.data.mask.id = 0x102;
     filter.data.mask.mask = 0x7FF;
-    can_subscribe(g_can_interface, &sub_ids[sub_count++], filter, on_sca_user_info_req, NULL);
+    can_subscribe_ex(g_can_interface, &sub_ids[sub_count++], filter, on_sca_user_info_req, NULL, &sub_opt);
     printf("[TCU-CAN] Subscribed to SCA_TCU_USER_INFO_REQ (0x102)\n");
 
     // Subscribe to DCU_TCU_USER_PROFILE_REQ (0x201)
     filter.data.mask.id = 0x201;
-    can_subscribe(g_can_interface, &sub_ids[sub_count++], filter, on_dcu_profile_req, NULL);
+    can_subscribe_ex(g_can_interface, &sub_ids[sub_count++], filter, on_dcu_profile_req, NULL, &sub_opt);
     printf("[TCU-CAN] Subscribed to DCU_TCU_USER_PROFILE_REQ (0x201)\n");
 
     // Subscribe to profile updates (0x206, 0x207, 0x208)
     for (uint32_t id = 0x206; id <= 0x208; id++) {
         filter.data.mask.id = id;
-        can_subscribe(g_can_interface, &sub_ids[sub_count++], filter, on_dcu_profile_update, NULL);
+        can_subscribe_ex(g_can_interface, &sub_ids[sub_count++], filter, on_dcu_profile_update, NULL, &sub_opt);
         printf("[TCU-CAN] Subscribed to USER_PROFILE_UPDATE (0x%03X)\n", id);
     }
 